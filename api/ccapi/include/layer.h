@@ -49,6 +49,9 @@ enum LayerType {
   LAYER_CONV2D_TRANSPOSE =
     ML_TRAIN_LAYER_TYPE_CONV2D_TRANSPOSE, /**< Convolution 2D Transpose Layer
                                              type */
+  LAYER_DEPTHWISE_CONV2D =
+    ML_TRAIN_LAYER_TYPE_DEPTHWISE_CONV2D, /**< Depthwise Convolution 2D Layer
+                                             type */
   LAYER_POOLING2D = ML_TRAIN_LAYER_TYPE_POOLING2D, /**< Pooling 2D Layer type */
   LAYER_FLATTEN = ML_TRAIN_LAYER_TYPE_FLATTEN,     /**< Flatten Layer type */
   LAYER_ACTIVATION =
@@ -402,6 +405,14 @@ Convolution2D(const std::vector<std::string> &properties = {}) {
   return createLayer(LayerType::LAYER_CONV2D, properties);
 }
 
+/**
+ * @brief Helper function to create depthwise convolution 2d layer
+ */
+inline std::unique_ptr<Layer>
+DepthwiseConvolution2D(const std::vector<std::string> &properties = {}) {
+  return createLayer(LayerType::LAYER_DEPTHWISE_CONV2D, properties);
+}
+
 /**
  * @brief Helper function to create convolution 1d layer
  */
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   benchmark_activation.cpp
+ * @date   17 Oct 2026
+ * @brief  benchmark of activation forward and backward throughput
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ */
+#include <functional>
+
+#include <acti_func.h>
+#include <tensor.h>
+
+#include "benchmark/benchmark.h"
+
+using nntrainer::ActiFunc;
+using nntrainer::ActivationType;
+using nntrainer::Tensor;
+
+/**
+ * @brief fill a tensor with values in [-4, 4)
+ */
+static void fill(Tensor &t) {
+  float *data = t.getData<float>();
+  for (size_t i = 0; i < t.size(); ++i)
+    data[i] = static_cast<float>(i % 8192) / 1024.0f - 4.0f;
+}
+
+/**
+ * @brief report the processed elements per second
+ */
+static void set_throughput(benchmark::State &state, size_t len) {
+  state.SetItemsProcessed(state.iterations() * len);
+  state.SetBytesProcessed(state.iterations() * len * sizeof(float) * 2);
+}
+
+/**
+ * @brief get the element-wise function and its derivative of an activation
+ */
+static void get_functions(ActivationType type,
+                          std::function<float(float)> &fn,
+                          std::function<float(float)> &prime) {
+  switch (type) {
+  case ActivationType::ACT_SIGMOID:
+    fn = ActiFunc::sigmoid<float>;
+    prime = ActiFunc::sigmoidPrime<float>;
+    break;
+  case ActivationType::ACT_TANH:
+    fn = ActiFunc::tanhFloat<float>;
+    prime = ActiFunc::tanhPrime<float>;
+    break;
+  case ActivationType::ACT_RELU:
+    fn = ActiFunc::relu<float>;
+    prime = ActiFunc::reluPrime<float>;
+    break;
+  default:
+    fn = ActiFunc::leakyRelu<float>;
+    prime = ActiFunc::leakyReluPrime<float>;
+    break;
+  }
+}
+
+/**
+ * @brief previous path, std::function per element and a separate multiply
+ * for the derivative. Benchmark arguments are (activation type, length)
+ */
+static void BM_ApplyStdFunction(benchmark::State &state) {
+  ActivationType type = static_cast<ActivationType>(state.range(0));
+  size_t len = state.range(1);
+  std::function<float(float)> fn, prime;
+  get_functions(type, fn, prime);
+
+  Tensor in(1, 1, 1, len), out(1, 1, 1, len), d_in(1, 1, 1, len),
+    d_out(1, 1, 1, len);
+  fill(in);
+  fill(d_in);
+
+  for (auto _ : state) {
+    in.apply<float>(fn, out);
+    out.apply<float>(prime, d_out);
+    d_out.multiply_i_strided(d_in);
+    benchmark::DoNotOptimize(d_out.getData());
+  }
+  set_throughput(state, len);
+}
+
+/**
+ * @brief ActiFunc forward. Benchmark arguments are (activation type, length)
+ */
+static void BM_ActiFuncForward(benchmark::State &state) {
+  ActivationType type = static_cast<ActivationType>(state.range(0));
+  size_t len = state.range(1);
+  ActiFunc act(type, false);
+
+  Tensor in(1, 1, 1, len), out(1, 1, 1, len);
+  fill(in);
+
+  for (auto _ : state) {
+    act.run_fn(in, out);
+    benchmark::DoNotOptimize(out.getData());
+  }
+  set_throughput(state, len);
+}
+
+/**
+ * @brief ActiFunc forward and backward. Benchmark arguments are (activation
+ * type, length)
+ */
+static void BM_ActiFuncForwardBackward(benchmark::State &state) {
+  ActivationType type = static_cast<ActivationType>(state.range(0));
+  size_t len = state.range(1);
+  ActiFunc act(type, false);
+
+  Tensor in(1, 1, 1, len), out(1, 1, 1, len), d_in(1, 1, 1, len),
+    d_out(1, 1, 1, len);
+  fill(in);
+  fill(d_in);
+
+  for (auto _ : state) {
+    act.run_fn(in, out);
+    act.run_prime_fn(in, out, d_out, d_in);
+    benchmark::DoNotOptimize(d_out.getData());
+  }
+  set_throughput(state, len);
+}
+
+/**
+ * @brief inlined element-wise apply of a lambda. Benchmark argument is the
+ * length
+ */
+static void BM_ApplyInline(benchmark::State &state) {
+  size_t len = state.range(0);
+  Tensor in(1, 1, 1, len), out(1, 1, 1, len);
+  fill(in);
+
+  for (auto _ : state) {
+    in.apply<float>([](float x) { return x > 0.0f ? x : 0.01f * x; }, out);
+    benchmark::DoNotOptimize(out.getData());
+  }
+  set_throughput(state, len);
+}
+
+#define ACTI_ARGS                                                              \
+  ArgsProduct({{static_cast<int>(ActivationType::ACT_SIGMOID),                 \
+                static_cast<int>(ActivationType::ACT_TANH),                    \
+                static_cast<int>(ActivationType::ACT_RELU),                    \
+                static_cast<int>(ActivationType::ACT_LEAKY_RELU)},             \
+               {4096, 1 << 20}})                                               \
+    ->Unit(benchmark::kMicrosecond)
+
+BENCHMARK(BM_ApplyStdFunction)->ACTI_ARGS;
+BENCHMARK(BM_ActiFuncForward)->ACTI_ARGS;
+BENCHMARK(BM_ActiFuncForwardBackward)->ACTI_ARGS;
+BENCHMARK(BM_ApplyInline)
+  ->Arg(4096)
+  ->Arg(1 << 20)
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   benchmark_mobilenet.cpp
+ * @date   17 Oct 2026
+ * @brief  benchmark of a mobilenet style network built from depthwiseconv2d
+ *         against the same network built from conv2d
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ */
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <layer.h>
+#include <model.h>
+#include <optimizer.h>
+#include <util_func.h>
+
+#include "benchmark/benchmark.h"
+#include <fake_data_gen.h>
+
+using LayerHandle = std::shared_ptr<ml::train::Layer>;
+using ModelHandle = std::unique_ptr<ml::train::Model>;
+
+using UserDataType = std::unique_ptr<nntrainer::util::DataLoader>;
+
+namespace {
+
+constexpr unsigned int IMAGE_SIZE = 32;
+constexpr unsigned int NUM_CLASS = 100;
+
+/**
+ * @brief way the per channel 3x3 convolution of a block is expressed
+ */
+enum class DepthwiseImpl {
+  DEPTHWISE = 0, /**< depthwiseconv2d */
+  CONV2D = 1,    /**< conv2d with filters = channels, the only option without
+                      a depthwise layer since conv2d has no groups */
+};
+
+/**
+ * @brief depthwise separable block: 3x3 per channel convolution, batch
+ * normalization, 1x1 convolution, batch normalization
+ *
+ * @param name name of the block
+ * @param channels input channels of the block
+ * @param filters output channels of the block
+ * @param stride stride of the 3x3 convolution
+ * @param impl way the 3x3 convolution is expressed
+ * @return std::vector<LayerHandle> layers of the block
+ */
+std::vector<LayerHandle> separableBlock(const std::string &name,
+                                        unsigned int channels,
+                                        unsigned int filters,
+                                        unsigned int stride,
+                                        DepthwiseImpl impl) {
+  using ml::train::createLayer;
+
+  auto bn_relu = [](const std::string &bn_name) {
+    return createLayer("batch_normalization",
+                       {nntrainer::withKey("name", bn_name),
+                        nntrainer::withKey("activation", "relu"),
+                        nntrainer::withKey("momentum", "0.9"),
+                        nntrainer::withKey("epsilon", "0.00001")});
+  };
+
+  LayerHandle dw = createLayer(
+    impl == DepthwiseImpl::DEPTHWISE ? "depthwiseconv2d" : "conv2d",
+    {nntrainer::withKey("name", name + "/dw"),
+     nntrainer::withKey("filters", channels),
+     nntrainer::withKey("kernel_size", {3, 3}),
+     nntrainer::withKey("stride", {stride, stride}),
+     nntrainer::withKey("padding", "same"),
+     nntrainer::withKey("disable_bias", "true")});
+
+  LayerHandle pw = createLayer(
+    "conv2d", {nntrainer::withKey("name", name + "/pw"),
+               nntrainer::withKey("filters", filters),
+               nntrainer::withKey("kernel_size", {1, 1}),
+               nntrainer::withKey("disable_bias", "true")});
+
+  return {dw, bn_relu(name + "/dw_bn"), pw, bn_relu(name)};
+}
+
+/**
+ * @brief mobilenet v1 scaled down to 32x32 inputs
+ */
+ModelHandle createMobileNet(DepthwiseImpl impl) {
+  using ml::train::createLayer;
+
+  ModelHandle model = ml::train::createModel(
+    ml::train::ModelType::NEURAL_NET, {nntrainer::withKey("loss", "cross")});
+
+  model->addLayer(createLayer(
+    "input", {nntrainer::withKey("name", "input0"),
+              nntrainer::withKey("input_shape", "3:32:32")}));
+  model->addLayer(createLayer(
+    "conv2d",
+    {nntrainer::withKey("name", "conv0"), nntrainer::withKey("filters", 32),
+     nntrainer::withKey("kernel_size", {3, 3}),
+     nntrainer::withKey("padding", "same"),
+     nntrainer::withKey("activation", "relu")}));
+
+  struct BlockSpec {
+    unsigned int channels;
+    unsigned int filters;
+    unsigned int stride;
+  };
+  const std::vector<BlockSpec> blocks = {
+    {32, 64, 1},   {64, 128, 2},  {128, 128, 1}, {128, 256, 2},
+    {256, 256, 1}, {256, 512, 2}, {512, 512, 1}, {512, 512, 1},
+  };
+
+  for (unsigned int i = 0; i < blocks.size(); ++i) {
+    auto &spec = blocks[i];
+    for (auto &layer :
+         separableBlock("block" + std::to_string(i), spec.channels,
+                        spec.filters, spec.stride, impl))
+      model->addLayer(layer);
+  }
+
+  model->addLayer(createLayer(
+    "pooling2d", {nntrainer::withKey("name", "pool"),
+                  nntrainer::withKey("pooling", "global_average")}));
+  model->addLayer(createLayer("flatten", {nntrainer::withKey("name", "flat")}));
+  model->addLayer(createLayer(
+    "fully_connected", {nntrainer::withKey("unit", NUM_CLASS),
+                        nntrainer::withKey("activation", "softmax")}));
+
+  return model;
+}
+
+int data_cb(float **input, float **label, bool *last, void *user_data) {
+  auto data = reinterpret_cast<nntrainer::util::DataLoader *>(user_data);
+
+  data->next(input, label, last);
+  return 0;
+}
+
+} // namespace
+
+/**
+ * @brief one epoch of training. Arguments are the depthwise implementation
+ * and the batch size.
+ */
+static void BM_MobileNetTrain(benchmark::State &state) {
+  const auto impl = static_cast<DepthwiseImpl>(state.range(0));
+  const unsigned int batch_size = state.range(1);
+  const unsigned int iterations = 4;
+
+  UserDataType train_data(new nntrainer::util::RandomDataLoader(
+    {{batch_size, 3, IMAGE_SIZE, IMAGE_SIZE}}, {{batch_size, 1, 1, NUM_CLASS}},
+    batch_size * iterations));
+
+  ModelHandle model = createMobileNet(impl);
+  model->setProperty({nntrainer::withKey("batch_size", batch_size),
+                      nntrainer::withKey("epochs", 1)});
+  model->setOptimizer(
+    ml::train::createOptimizer("sgd", {"learning_rate=0.001"}));
+  model->compile();
+  model->initialize();
+  model->setDataset(ml::train::DatasetModeType::MODE_TRAIN,
+                    ml::train::createDataset(ml::train::DatasetType::GENERATOR,
+                                             data_cb, train_data.get()));
+
+  for (auto _ : state) {
+    model->train({nntrainer::withKey("epochs", 1)});
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size * iterations);
+}
+
+/**
+ * @brief forward only. Arguments are the depthwise implementation and the
+ * batch size.
+ */
+static void BM_MobileNetInference(benchmark::State &state) {
+  const auto impl = static_cast<DepthwiseImpl>(state.range(0));
+  const unsigned int batch_size = state.range(1);
+
+  ModelHandle model = createMobileNet(impl);
+  model->setProperty({nntrainer::withKey("batch_size", batch_size)});
+  model->compile(ml::train::ExecutionMode::INFERENCE);
+  model->initialize(ml::train::ExecutionMode::INFERENCE);
+
+  std::vector<float> input(batch_size * 3 * IMAGE_SIZE * IMAGE_SIZE, 0.5f);
+  std::vector<float *> in = {input.data()};
+
+  for (auto _ : state) {
+    auto out = model->inference(batch_size, in, {});
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+BENCHMARK(BM_MobileNetTrain)
+  ->ArgNames({"conv2d", "batch"})
+  ->ArgsProduct({{0, 1}, {1, 16}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+BENCHMARK(BM_MobileNetInference)
+  ->ArgNames({"conv2d", "batch"})
+  ->ArgsProduct({{0, 1}, {1, 16}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+BENCHMARK_MAIN();
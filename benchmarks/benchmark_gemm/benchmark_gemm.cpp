@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   benchmark_gemm.cpp
+ * @date   17 Oct 2026
+ * @brief  benchmark of the single precision gemm paths
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ */
+#include <random>
+#include <vector>
+
+#include <fallback_internal.h>
+#include <tensor.h>
+
+#include "benchmark/benchmark.h"
+
+/**
+ * @brief fill a buffer with uniform random values
+ */
+static void fill_random(std::vector<float> &v) {
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  for (auto &x : v)
+    x = dist(rng);
+}
+
+/**
+ * @brief report the achieved floating point operations per second
+ */
+static void set_flops(benchmark::State &state, unsigned int M, unsigned int N,
+                      unsigned int K) {
+  state.counters["FLOPS"] = benchmark::Counter(
+    2.0 * M * N * K, benchmark::Counter::kIsIterationInvariantRate,
+    benchmark::Counter::OneK::kIs1000);
+}
+
+/**
+ * @brief non-BLAS gemm. Benchmark arguments are (M, N, K, transB)
+ */
+static void BM_FallbackSgemm(benchmark::State &state) {
+  unsigned int M = state.range(0);
+  unsigned int N = state.range(1);
+  unsigned int K = state.range(2);
+  bool trans_b = state.range(3);
+
+  std::vector<float> A(M * K), B(K * N), C(M * N);
+  fill_random(A);
+  fill_random(B);
+
+  for (auto _ : state) {
+    nntrainer::__fallback_sgemm(0, false, trans_b, M, N, K, 1.0f, A.data(), K,
+                                B.data(), trans_b ? K : N, 0.0f, C.data(), N);
+    benchmark::DoNotOptimize(C.data());
+  }
+  set_flops(state, M, N, K);
+}
+
+/**
+ * @brief Tensor::dot through the configured compute backend. Benchmark
+ * arguments are (M, N, K, transB)
+ */
+static void BM_TensorDot(benchmark::State &state) {
+  unsigned int M = state.range(0);
+  unsigned int N = state.range(1);
+  unsigned int K = state.range(2);
+  bool trans_b = state.range(3);
+
+  nntrainer::Tensor a(1, 1, M, K);
+  nntrainer::Tensor b(1, 1, trans_b ? N : K, trans_b ? K : N);
+  nntrainer::Tensor c(1, 1, M, N);
+  a.setRandUniform(-1.0f, 1.0f);
+  b.setRandUniform(-1.0f, 1.0f);
+
+  for (auto _ : state) {
+    a.dot(b, c, false, trans_b);
+    benchmark::DoNotOptimize(c.getData());
+  }
+  set_flops(state, M, N, K);
+}
+
+/** square, fully-connected (small M) and attention-like shapes */
+#define GEMM_ARGS                                                              \
+  Args({128, 128, 128, 0})                                                     \
+    ->Args({256, 256, 256, 0})                                                 \
+    ->Args({512, 512, 512, 0})                                                 \
+    ->Args({1024, 1024, 1024, 0})                                              \
+    ->Args({32, 1024, 1024, 1})                                                \
+    ->Args({1, 4096, 1024, 1})                                                 \
+    ->Args({512, 512, 64, 1})                                                  \
+    ->UseRealTime()                                                            \
+    ->Unit(benchmark::kMicrosecond)
+
+BENCHMARK(BM_FallbackSgemm)->GEMM_ARGS;
+BENCHMARK(BM_TensorDot)->GEMM_ARGS;
+
+BENCHMARK_MAIN();
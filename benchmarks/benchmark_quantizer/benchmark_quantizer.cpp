@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   benchmark_quantizer.cpp
+ * @date   17 Oct 2026
+ * @brief  benchmark of the quantize and dequantize throughput
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ */
+#include <memory>
+
+#include <quantizer.h>
+#include <tensor.h>
+
+#include "benchmark/benchmark.h"
+
+using nntrainer::QScheme;
+using nntrainer::Tdatatype;
+using nntrainer::Tensor;
+
+constexpr unsigned int WIDTH = 4096; /**< width of the quantized tensor */
+
+/**
+ * @brief quantized data types indexed by a benchmark argument
+ */
+static const Tdatatype qtypes[] = {Tdatatype::QINT4, Tdatatype::QINT8,
+                                   Tdatatype::UINT8, Tdatatype::UINT16};
+
+/**
+ * @brief quantization schemes indexed by a benchmark argument
+ */
+static const QScheme qschemes[] = {QScheme::PER_TENSOR_AFFINE,
+                                   QScheme::PER_CHANNEL_AFFINE};
+
+/**
+ * @brief quantize a float tensor, including the computation of the
+ * quantization parameters. Benchmark arguments are (rows, data type index,
+ * scheme index), throughput is of the float input
+ */
+static void BM_Quantize(benchmark::State &state) {
+  Tensor input(1, 1, state.range(0), WIDTH);
+  input.setRandUniform(-1.0f, 1.0f);
+  Tdatatype qtype = qtypes[state.range(1)];
+  std::unique_ptr<nntrainer::Quantizer> quantizer =
+    nntrainer::Quantization::createQuantizer(qschemes[state.range(2)]);
+
+  for (auto _ : state) {
+    Tensor output = quantizer->quantize(input, qtype);
+    benchmark::DoNotOptimize(output.getData<void>());
+  }
+  state.SetBytesProcessed(state.iterations() * input.bytes());
+}
+
+/**
+ * @brief dequantize to a float tensor. Benchmark arguments are (rows, data
+ * type index, scheme index), throughput is of the float output
+ */
+static void BM_Dequantize(benchmark::State &state) {
+  Tensor input(1, 1, state.range(0), WIDTH);
+  input.setRandUniform(-1.0f, 1.0f);
+  std::unique_ptr<nntrainer::Quantizer> quantizer =
+    nntrainer::Quantization::createQuantizer(qschemes[state.range(2)]);
+  Tensor quantized = quantizer->quantize(input, qtypes[state.range(1)]);
+
+  for (auto _ : state) {
+    Tensor output = quantizer->dequantize(quantized, Tdatatype::FP32);
+    benchmark::DoNotOptimize(output.getData());
+  }
+  state.SetBytesProcessed(state.iterations() * input.bytes());
+}
+
+BENCHMARK(BM_Quantize)
+  ->ArgsProduct({{256, 4096}, {0, 1, 2, 3}, {0, 1}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+BENCHMARK(BM_Dequantize)
+  ->ArgsProduct({{256, 4096}, {0, 1, 2, 3}, {0, 1}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+BENCHMARK_MAIN();
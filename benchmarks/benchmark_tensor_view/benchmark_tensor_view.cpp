@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   benchmark_tensor_view.cpp
+ * @date   17 Oct 2026
+ * @brief  benchmark of slicing in inner loops and of the forward overhead of
+ * a layer on small tensors
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ */
+#include <memory>
+#include <vector>
+
+#include <layer.h>
+#include <model.h>
+#include <tensor.h>
+#include <tensor_view.h>
+#include <util_func.h>
+
+#include "benchmark/benchmark.h"
+
+using nntrainer::Tensor;
+using nntrainer::TensorDim;
+using nntrainer::TensorView;
+
+constexpr unsigned int NUM_WORDS = 128; /**< rows of the lookup table */
+
+/**
+ * @brief word indices spread over the table
+ */
+static std::vector<unsigned int> make_words(unsigned int len) {
+  std::vector<unsigned int> words(len);
+  for (unsigned int i = 0; i < len; ++i)
+    words[i] = (i * 37) % NUM_WORDS;
+  return words;
+}
+
+/**
+ * @brief copy rows of a table with shared tensors made per row, as the
+ * embedding layer did. Benchmark arguments are (words, row width)
+ */
+static void BM_RowCopySharedTensor(benchmark::State &state) {
+  unsigned int len = state.range(0);
+  unsigned int width = state.range(1);
+  Tensor table(1, 1, NUM_WORDS, width), out(1, 1, len, width);
+  table.setRandUniform(-1.0f, 1.0f);
+  auto words = make_words(len);
+  TensorDim row_dim({1, 1, 1, width}, table.getTensorType());
+
+  for (auto _ : state) {
+    for (unsigned int i = 0; i < len; ++i) {
+      Tensor from = table.getSharedDataTensor(row_dim, width * words[i]);
+      Tensor to = out.getSharedDataTensor(row_dim, width * i);
+      to.copyData(from);
+    }
+    benchmark::DoNotOptimize(out.getData());
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+/**
+ * @brief copy rows of a table with views. Benchmark arguments are (words, row
+ * width)
+ */
+static void BM_RowCopyView(benchmark::State &state) {
+  unsigned int len = state.range(0);
+  unsigned int width = state.range(1);
+  Tensor table(1, 1, NUM_WORDS, width), out(1, 1, len, width);
+  table.setRandUniform(-1.0f, 1.0f);
+  auto words = make_words(len);
+
+  for (auto _ : state) {
+    TensorView<const float> from(table);
+    TensorView<float> to(out);
+    for (unsigned int i = 0; i < len; ++i)
+      to.getRow(0, 0, i).copyData(from.getRow(0, 0, words[i]));
+    benchmark::DoNotOptimize(out.getData());
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+/**
+ * @brief batch slices made per sample with Tensor::getBatchSlice. Benchmark
+ * argument is the batch size
+ */
+static void BM_BatchSliceTensor(benchmark::State &state) {
+  unsigned int batch = state.range(0);
+  Tensor t(batch, 1, 4, 4);
+  t.setRandUniform(-1.0f, 1.0f);
+
+  for (auto _ : state) {
+    float sum = 0.0f;
+    for (unsigned int b = 0; b < batch; ++b)
+      sum += t.getBatchSlice(b, 1).getValue(0, 0, 1, 1);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+
+/**
+ * @brief batch slices made per sample with TensorView::getBatchSlice.
+ * Benchmark argument is the batch size
+ */
+static void BM_BatchSliceView(benchmark::State &state) {
+  unsigned int batch = state.range(0);
+  Tensor t(batch, 1, 4, 4);
+  t.setRandUniform(-1.0f, 1.0f);
+
+  for (auto _ : state) {
+    TensorView<const float> view(t);
+    float sum = 0.0f;
+    for (unsigned int b = 0; b < batch; ++b)
+      sum += view.getBatchSlice(b, 1)(0, 0, 1, 1);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+
+/**
+ * @brief inference of a model made of an embedding layer only, where the
+ * forward time is dominated by per word overhead. Benchmark arguments are
+ * (words, out_dim)
+ */
+static void BM_EmbeddingForward(benchmark::State &state) {
+  unsigned int len = state.range(0);
+  unsigned int out_dim = state.range(1);
+
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+  model->addLayer(ml::train::createLayer(
+    "input",
+    {nntrainer::withKey("input_shape", "1:1:" + std::to_string(len))}));
+  model->addLayer(ml::train::createLayer(
+    "embedding", {nntrainer::withKey("in_dim", NUM_WORDS),
+                  nntrainer::withKey("out_dim", out_dim)}));
+  model->setProperty({nntrainer::withKey("batch_size", 1)});
+  model->compile(ml::train::ExecutionMode::INFERENCE);
+  model->initialize(ml::train::ExecutionMode::INFERENCE);
+
+  auto words = make_words(len);
+  std::vector<float> input(words.begin(), words.end());
+  std::vector<float *> in = {input.data()};
+
+  for (auto _ : state) {
+    auto out = model->inference(1, in);
+    benchmark::DoNotOptimize(out[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+BENCHMARK(BM_RowCopySharedTensor)
+  ->ArgsProduct({{32, 512}, {16, 256}})
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RowCopyView)
+  ->ArgsProduct({{32, 512}, {16, 256}})
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BatchSliceTensor)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BatchSliceView)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EmbeddingForward)
+  ->ArgsProduct({{32, 512}, {16, 256}})
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   benchmark_thread_pool.cpp
+ * @date   17 Oct 2026
+ * @brief  benchmark of the persistent thread pool against spawning threads
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ */
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <nntr_thread_pool.h>
+
+#include "benchmark/benchmark.h"
+
+/**
+ * @brief per-batch work, roughly the size of a small conv2d slice
+ */
+static void batch_work(std::vector<float> &data, unsigned int b,
+                       unsigned int work) {
+  float *p = data.data() + b * work;
+  for (unsigned int i = 0; i < work; ++i)
+    p[i] = std::sqrt(p[i] * 0.5f + 1.0f);
+}
+
+/**
+ * @brief previous ParallelBatch::run, one std::thread per worker per call
+ */
+static void spawn_per_call(unsigned int num_workers, unsigned int batch,
+                           const std::function<void(unsigned int,
+                                                    unsigned int)> &fn) {
+  std::vector<std::thread> workers;
+  unsigned int chunk = (batch + num_workers - 1) / num_workers;
+  for (unsigned int i = 0; i < num_workers; ++i) {
+    unsigned int s = i * chunk;
+    unsigned int e = std::min(s + chunk, batch);
+    workers.emplace_back(fn, s, e);
+  }
+  for (auto &w : workers)
+    w.join();
+}
+
+/**
+ * @brief Benchmark arguments are (num_threads, batch, work per batch)
+ */
+static void BM_SpawnPerCall(benchmark::State &state) {
+  unsigned int num_threads = state.range(0);
+  unsigned int batch = state.range(1);
+  unsigned int work = state.range(2);
+  std::vector<float> data(batch * work, 1.0f);
+
+  for (auto _ : state) {
+    spawn_per_call(num_threads, batch, [&](unsigned int s, unsigned int e) {
+      for (unsigned int b = s; b < e; ++b)
+        batch_work(data, b, work);
+    });
+    benchmark::DoNotOptimize(data.data());
+  }
+}
+
+/**
+ * @brief Benchmark arguments are (num_threads, batch, work per batch)
+ */
+static void BM_ThreadPool(benchmark::State &state) {
+  unsigned int num_threads = state.range(0);
+  unsigned int batch = state.range(1);
+  unsigned int work = state.range(2);
+  std::vector<float> data(batch * work, 1.0f);
+  nntrainer::ThreadPool pool(num_threads);
+
+  for (auto _ : state) {
+    pool.parallelFor(0, batch, 0,
+                     [&](unsigned int s, unsigned int e, unsigned int) {
+                       for (unsigned int b = s; b < e; ++b)
+                         batch_work(data, b, work);
+                     });
+    benchmark::DoNotOptimize(data.data());
+  }
+}
+
+#define THREAD_ARGS                                                            \
+  ArgsProduct({{2, 4, 8}, {8, 32, 128}, {256, 4096}})                          \
+    ->UseRealTime()                                                            \
+    ->Unit(benchmark::kMicrosecond)
+
+BENCHMARK(BM_SpawnPerCall)->THREAD_ARGS;
+BENCHMARK(BM_ThreadPool)->THREAD_ARGS;
+
+BENCHMARK_MAIN();
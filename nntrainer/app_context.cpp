@@ -44,6 +44,7 @@
 #include <conv2d_transpose_layer.h>
 #include <cross_entropy_sigmoid_loss_layer.h>
 #include <cross_entropy_softmax_loss_layer.h>
+#include <depthwise_conv2d_layer.h>
 #include <divide_layer.h>
 #include <dropout.h>
 #include <dynamic_library_loader.h>
@@ -283,6 +284,9 @@ static void add_default_object(AppContext &ac) {
   ac.registerFactory(nntrainer::createLayer<Conv2DTransposeLayer>,
                      Conv2DTransposeLayer::type,
                      LayerType::LAYER_CONV2D_TRANSPOSE);
+  ac.registerFactory(nntrainer::createLayer<DepthwiseConv2DLayer>,
+                     DepthwiseConv2DLayer::type,
+                     LayerType::LAYER_DEPTHWISE_CONV2D);
   ac.registerFactory(nntrainer::createLayer<Conv1DLayer>, Conv1DLayer::type,
                      LayerType::LAYER_CONV1D);
   ac.registerFactory(nntrainer::createLayer<Pooling2DLayer>,
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file bn_fold_realizer.cpp
+ * @date 17 October 2026
+ * @brief NNTrainer graph realizer which folds batch normalization and the
+ * following activation into the preceding convolution or fully connected
+ * layer for inference
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug No known bugs except for NYI items
+ */
+#include <bn_fold_realizer.h>
+#include <remap_realizer.h>
+
+#include <activation_layer.h>
+#include <bn_layer.h>
+#include <common_properties.h>
+#include <conv2d_layer.h>
+#include <fc_layer.h>
+#include <layer_node.h>
+#include <node_exporter.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace nntrainer {
+
+namespace {
+
+/**
+ * @brief get the properties of the node as key, value pairs
+ */
+std::unordered_map<std::string, std::string> getProperties(LayerNode *node) {
+  Exporter e;
+  node->exportTo(e, ml::train::ExportMethods::METHOD_STRINGVECTOR);
+  auto props = e.getResult<ml::train::ExportMethods::METHOD_STRINGVECTOR>();
+
+  std::unordered_map<std::string, std::string> key_vals;
+  if (props != nullptr)
+    key_vals.insert(props->begin(), props->end());
+  return key_vals;
+}
+
+/**
+ * @brief get the value of the property, empty if it is not set
+ */
+std::string
+getProperty(const std::unordered_map<std::string, std::string> &props,
+            const std::string &key) {
+  auto iter = props.find(key);
+  return iter == props.end() ? std::string() : iter->second;
+}
+
+} // namespace
+
+GraphRepresentation
+BnFoldRealizer::realize(const GraphRepresentation &reference) {
+  std::unordered_map<std::string /**< layer_name */,
+                     std::vector<LayerNode *> /**< consumers */>
+    consumers;
+
+  for (auto &node : reference) {
+    for (auto &input : node->getInputConnections()) {
+      consumers[input].push_back(node.get());
+    }
+  }
+
+  /** the only consumer of the node if it takes nothing else, else nullptr */
+  auto single_consumer = [&consumers](LayerNode *node) -> LayerNode * {
+    auto iter = consumers.find(node->getName());
+    if (iter == consumers.end() || iter->second.size() != 1 ||
+        iter->second.front()->getNumInputConnections() != 1)
+      return nullptr;
+    return iter->second.front();
+  };
+
+  std::unordered_map<std::string /**< folded_layer_name */,
+                     std::string /**< layer_name */>
+    remap_table;
+
+  for (auto &node : reference) {
+    const bool is_conv = node->getType() == Conv2DLayer::type;
+    if (!is_conv && node->getType() != FullyConnectedLayer::type)
+      continue;
+
+    auto props = getProperties(node.get());
+    if (istrequal(getProperty(props, props::DisableBias::key), "true") ||
+        !getProperty(props, props::LoraRank::key).empty() ||
+        !node->getSharedFrom().empty())
+      continue;
+
+    LayerNode *bn = single_consumer(node.get());
+    if (bn == nullptr || bn->getType() != BatchNormalizationLayer::type)
+      continue;
+
+    /** batch normalization picks the width axis for a single channel */
+    auto bn_props = getProperties(bn);
+    auto axis = getProperty(bn_props, props::Axis::key);
+    bool channel_axis =
+      is_conv ? axis == "1" ||
+                  (axis.empty() &&
+                   getProperty(props, props::FilterSize::key) != "1")
+              : axis == "3";
+    if (!channel_axis || !bn->getSharedFrom().empty())
+      continue;
+
+    /** the last layer keeps its name as it might be looked up as an output */
+    LayerNode *act = single_consumer(bn);
+    if (act == nullptr)
+      continue;
+
+    node->setProperty({"folded_batch_norm_epsilon=" +
+                       getProperty(bn_props, props::Epsilon::key)});
+    remap_table.insert({bn->getName(), node->getName()});
+
+    if (act->getType() == ActivationLayer::type &&
+        act->getActivationType() != ActivationType::ACT_NONE &&
+        act->getActivationType() != ActivationType::ACT_UNKNOWN &&
+        single_consumer(act) != nullptr) {
+      props::Activation act_prop;
+      act_prop.set(act->getActivationType());
+      node->setProperty({"fused_activation=" + to_string(act_prop)});
+      remap_table.insert({act->getName(), node->getName()});
+    }
+  }
+
+  GraphRepresentation processed;
+  processed.reserve(reference.size());
+  for (auto &node : reference) {
+    if (remap_table.find(node->getName()) == remap_table.end())
+      processed.push_back(node);
+  }
+
+  return RemapRealizer([&remap_table](std::string &name, unsigned &idx) {
+           if (auto iter = remap_table.find(name); iter != remap_table.end()) {
+             name = iter->second;
+           }
+         })
+    .realize(processed);
+}
+
+} // namespace nntrainer
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file bn_fold_realizer.h
+ * @date 17 October 2026
+ * @brief NNTrainer graph realizer which folds batch normalization and the
+ * following activation into the preceding convolution or fully connected
+ * layer for inference
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug No known bugs except for NYI items
+ */
+#ifndef __BN_FOLD_REALIZER_H__
+#define __BN_FOLD_REALIZER_H__
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <realizer.h>
+
+namespace nntrainer {
+
+/**
+ * @brief Graph realizer class which folds conv2d / fully_connected ->
+ * batch_normalization (-> activation) into the conv2d / fully_connected layer
+ * @note The batch normalization statistics are requested by the producer under
+ * the same names, so weights saved for the unfolded graph are read as is.
+ * Chains are only folded when every removed layer is the single consumer of
+ * the previous one and the normalized axis is the output channel.
+ *
+ */
+class BnFoldRealizer final : public GraphRealizer {
+public:
+  /**
+   * @brief Construct a new BN Fold Realizer object
+   *
+   */
+  BnFoldRealizer() = default;
+
+  /**
+   * @brief Destroy the Graph Realizer object
+   *
+   */
+  ~BnFoldRealizer() = default;
+
+  /**
+   * @brief graph realizer creates a shallow copied graph based on the reference
+   * @note bn fold realizer removes the folded batch normalization and
+   * activation layers from GraphRepresentation
+   * @param reference GraphRepresentation to be realized
+   *
+   */
+  GraphRepresentation realize(const GraphRepresentation &reference) override;
+};
+
+} // namespace nntrainer
+
+#endif // __BN_FOLD_REALIZER_H__
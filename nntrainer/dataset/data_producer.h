@@ -125,6 +125,15 @@ public:
    * @return bool true if thread safe.
    */
   virtual bool isMultiThreadSafe() const { return false; }
+
+  /**
+   * @brief hint the order of the indices the generator is going to be called
+   * with, so that the producer can read ahead. This is called after finalize
+   * and before the first call of the generator.
+   *
+   * @param order indices in the order of the calls, empty if sequential
+   */
+  virtual void setAccessOrder(const std::vector<unsigned int> &order) {}
 };
 } // namespace nntrainer
 #endif // __DATA_PRODUCER_H__
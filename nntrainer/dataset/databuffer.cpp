@@ -26,10 +26,12 @@
 #include <climits>
 #include <cstring>
 #include <databuffer.h>
+#include <exception>
 #include <func_data_producer.h>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
 #include <node_exporter.h>
@@ -59,6 +61,40 @@ public:
   using prop_tag = uint_prop_tag;                   /**< property type */
 };
 
+/**
+ * @brief Props containing number of fetch workers. Workers are used only when
+ * the size of the producer is known and the producer is multi-thread safe
+ *
+ */
+class PropsNumWorkers : public nntrainer::PositiveIntegerProperty {
+public:
+  /**
+   * @brief Construct a new props num workers object with a default value
+   *
+   * @param value default value
+   */
+  PropsNumWorkers(unsigned int value = 1) { set(value); }
+  static constexpr const char *key = "num_workers"; /**< unique key to access */
+  using prop_tag = uint_prop_tag;                   /**< property type */
+};
+
+/**
+ * @brief Props to serve iterations in the order of the samples. If false, an
+ * iteration is served as soon as it is filled
+ *
+ */
+class PropsInOrder : public nntrainer::Property<bool> {
+public:
+  /**
+   * @brief Construct a new props in order object with a default value
+   *
+   * @param value default value
+   */
+  PropsInOrder(bool value = true) : nntrainer::Property<bool>(value) {}
+  static constexpr const char *key = "in_order"; /**< unique key to access */
+  using prop_tag = bool_prop_tag;                /**< property type */
+};
+
 constexpr char USER_DATA[] = "user_data";
 
 DataBuffer::DataBuffer(std::unique_ptr<DataProducer> &&producer_) :
@@ -76,8 +112,9 @@ DataBuffer::startFetchWorker(const std::vector<TensorDim> &input_dims,
   NNTR_THROW_IF(input_dims.empty(), std::runtime_error)
     << "There must be at least one input";
 
-  auto q_size = std::get<PropsBufferSize>(*db_props);
-  auto iq = std::make_shared<IterationQueue>(q_size, input_dims, label_dims);
+  auto &[q_size, num_workers_, in_order] = *db_props;
+  auto iq = std::make_shared<IterationQueue>(q_size, input_dims, label_dims,
+                                             in_order);
   auto generator = producer->finalize(input_dims, label_dims);
   auto size = producer->size(input_dims, label_dims);
   iq_view = iq;
@@ -129,24 +166,76 @@ DataBuffer::startFetchWorker(const std::vector<TensorDim> &input_dims,
     std::iota(idxes_.begin(), idxes_.end(), 0);
     std::shuffle(idxes_.begin(), idxes_.end(), rng);
   }
+  producer->setAccessOrder(idxes_);
+
+  unsigned int num_workers = num_workers_.get();
+  if (num_workers > 1 && !producer->isMultiThreadSafe()) {
+    ml_logw("[Databuffer] %s producer is not multi-thread safe, fetching with "
+            "a single worker",
+            producer->getType().c_str());
+    num_workers = 1;
+  }
 
   return std::async(std::launch::async, [iq, generator, size,
-                                         idxes = std::move(idxes_), shuffle] {
+                                         idxes = std::move(idxes_), shuffle,
+                                         num_workers] {
     auto notifier = NotifyOnDestruct(iq.get());
-    for (unsigned int i = 0; i < size; ++i) {
-      /// below loop can be parallelized
-      auto sample_view = iq->requestEmptySlot();
-      NNTR_THROW_IF(sample_view.isEmpty(), std::runtime_error)
-        << "[Databuffer] Cannot fill empty buffer";
-      auto &sample = sample_view.get();
+    std::mutex claim_mutex;
+    unsigned int next = 0;
+    bool failed = false;
+
+    /// a sample index and its slot are claimed together, so the samples land
+    /// in the same slots regardless of the number of workers. Blocking on the
+    /// queue while claiming applies the back-pressure to every worker.
+    auto fetch = [&] {
+      while (true) {
+        std::unique_lock<std::mutex> claim_lock(claim_mutex);
+        if (failed || next >= size) {
+          return;
+        }
+        unsigned int i = next++;
+        auto sample_view = iq->requestEmptySlot();
+        claim_lock.unlock();
+
+        NNTR_THROW_IF(sample_view.isEmpty(), std::runtime_error)
+          << "[Databuffer] Cannot fill empty buffer";
+        auto &sample = sample_view.get();
+        try {
+          generator(shuffle ? idxes[i] : i, sample.getInputsRef(),
+                    sample.getLabelsRef());
+        } catch (std::exception &e) {
+          ml_loge("Fetching sample failed, Error: %s", e.what());
+          claim_lock.lock();
+          failed = true;
+          throw;
+        }
+      }
+    };
+
+    std::vector<std::future<void>> workers;
+    workers.reserve(num_workers - 1);
+    for (unsigned int w = 1; w < num_workers; ++w) {
+      workers.push_back(std::async(std::launch::async, fetch));
+    }
+
+    std::exception_ptr error;
+    try {
+      fetch();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    for (auto &worker : workers) {
       try {
-        generator(shuffle ? idxes[i] : i, sample.getInputsRef(),
-                  sample.getLabelsRef());
-      } catch (std::exception &e) {
-        ml_loge("Fetching sample failed, Error: %s", e.what());
-        throw;
+        worker.get();
+      } catch (...) {
+        if (!error) {
+          error = std::current_exception();
+        }
       }
     }
+    if (error) {
+      std::rethrow_exception(error);
+    }
 
     return iq;
   });
@@ -50,6 +50,8 @@ using datagen_cb = ml::train::datagen_cb;
 using TensorDim = ml::train::TensorDim;
 
 class PropsBufferSize;
+class PropsNumWorkers;
+class PropsInOrder;
 
 /**
  * @class   DataBuffer Data Buffers
@@ -71,7 +73,10 @@ public:
 
   /**
    * @brief prepare iteration a head of time with a dedicated worker. The
-   * iteration prepared can be retrieved with @a fetch();
+   * iteration prepared can be retrieved with @a fetch(); If the producer has a
+   * known size and is multi-thread safe, samples are filled by "num_workers"
+   * workers. Iterations are served in the sample order unless "in_order" is
+   * false.
    * @remark the batch dimension of input_dims / label_dims must be same for
    * all.
    * @param input_dims dimension of input_dims
@@ -157,7 +162,8 @@ public:
 protected:
   std::shared_ptr<DataProducer> producer;
   std::weak_ptr<IterationQueue> iq_view;
-  using Props = std::tuple<PropsBufferSize>;
+  using Props =
+    std::tuple<PropsBufferSize, PropsNumWorkers, PropsInOrder>;
   std::unique_ptr<Props> db_props;
   std::mt19937 rng;
 
@@ -23,10 +23,13 @@ namespace nntrainer {
 
 IterationQueue::IterationQueue(
   unsigned int num_slots, const std::vector<ml::train::TensorDim> &input_dims,
-  const std::vector<ml::train::TensorDim> &label_dims) :
+  const std::vector<ml::train::TensorDim> &label_dims, bool in_order) :
   being_filled(nullptr),
   num_being_filled(0),
-  flow_state(IterationQueue::FlowState::FLOW_STATE_OPEN) {
+  flow_state(IterationQueue::FlowState::FLOW_STATE_OPEN),
+  in_order(in_order),
+  next_fill_seq(0),
+  next_push_seq(0) {
   NNTR_THROW_IF(num_slots == 0, std::invalid_argument)
     << "number of slots must be more then zero";
 
@@ -52,7 +55,10 @@ IterationQueue::~IterationQueue() {
 }
 
 ScopedView<Sample> IterationQueue::requestEmptySlot() {
-  std::scoped_lock lg(empty_mutex);
+  /// empty_mutex must not be held while waiting for an empty slot, otherwise
+  /// other producers cannot mark their iteration filled
+  std::scoped_lock request_lg(request_mutex);
+  std::unique_lock lg(empty_mutex);
   auto current_flow_state = flow_state.load();
   NNTR_THROW_IF(current_flow_state != FlowState::FLOW_STATE_OPEN,
                 std::invalid_argument)
@@ -68,8 +74,12 @@ ScopedView<Sample> IterationQueue::requestEmptySlot() {
 
   if (being_filled == nullptr ||
       current_iterator + 1 == being_filled->get().end()) {
-    being_filled = empty_q.waitAndPop();
+    lg.unlock();
+    auto next = empty_q.waitAndPop();
+    lg.lock();
+    being_filled = next;
     being_filled->reset();
+    being_filled->setSequence(next_fill_seq++);
     num_being_filled++;
     current_iterator = being_filled->get().begin();
   } else {
@@ -83,8 +93,10 @@ ScopedView<Sample> IterationQueue::requestEmptySlot() {
     },
     [this, current_being_filled = this->being_filled] {
       std::unique_lock lg(empty_mutex);
-      this->markEmpty(current_being_filled);
-      num_being_filled--;
+      if (being_filled == current_being_filled) {
+        being_filled = nullptr;
+      }
+      this->pushFilled(current_being_filled, true);
       notify_emptied_cv.notify_all();
     });
   return view;
@@ -126,6 +138,7 @@ ScopedView<Iteration> IterationQueue::requestFilledSlot() {
 }
 
 void IterationQueue::notifyEndOfRequestEmpty() {
+  std::scoped_lock request_lg(request_mutex);
   std::unique_lock lg(empty_mutex);
   auto open_state = FlowState::FLOW_STATE_OPEN;
 
@@ -155,8 +168,7 @@ void IterationQueue::notifyEndOfRequestEmpty() {
 void IterationQueue::markFilled(MarkableIteration *iteration) {
   {
     std::lock_guard lg(empty_mutex);
-    --num_being_filled;
-    filled_q.push(iteration);
+    pushFilled(iteration);
   }
   notify_emptied_cv.notify_all();
 }
@@ -165,13 +177,38 @@ void IterationQueue::markEmpty(MarkableIteration *iteration) {
   empty_q.push(iteration);
 }
 
+void IterationQueue::pushFilled(MarkableIteration *iteration, bool discard) {
+  auto push = [this](MarkableIteration *it, bool to_empty) {
+    --num_being_filled;
+    if (to_empty) {
+      markEmpty(it);
+    } else {
+      filled_q.push(it);
+    }
+  };
+
+  if (!in_order) {
+    push(iteration, discard);
+    return;
+  }
+
+  reorder_buf.emplace(iteration->getSequence(),
+                      std::make_pair(iteration, discard));
+  for (auto it = reorder_buf.begin();
+       it != reorder_buf.end() && it->first == next_push_seq;
+       it = reorder_buf.erase(it)) {
+    push(it->second.first, it->second.second);
+    next_push_seq++;
+  }
+}
+
 IterationQueue::MarkableIteration::MarkableIteration(
   const std::vector<ml::train::TensorDim> &input_dims,
   const std::vector<ml::train::TensorDim> &label_dims, IterationQueue *iq) :
-  num_observed(0), iteration(input_dims, label_dims), iq(iq) {}
+  num_observed(0), iteration(input_dims, label_dims), iq(iq), seq(0) {}
 
 IterationQueue::MarkableIteration::MarkableIteration(MarkableIteration &&rhs) :
-  iteration(std::move(rhs.iteration)), iq(rhs.iq) {
+  iteration(std::move(rhs.iteration)), iq(rhs.iq), seq(rhs.seq) {
   std::lock_guard notify_lock_guard(notify_mutex);
   num_observed = rhs.num_observed;
 }
@@ -191,6 +228,7 @@ IterationQueue::MarkableIteration::operator=(MarkableIteration &&rhs) {
   std::swap(iteration, rhs.iteration);
   std::swap(iq, rhs.iq);
   std::swap(num_observed, rhs.num_observed);
+  std::swap(seq, rhs.seq);
   return *this;
 }
 
@@ -223,8 +261,7 @@ void IterationQueue::MarkableIteration::setEndSample(
          "locked.";
 #endif
     /// warning: iq has to be locked with iq->empty_mutex
-    iq->num_being_filled--;
-    iq->filled_q.push(this);
+    iq->pushFilled(this);
     iq->notify_emptied_cv.notify_all();
     num_observed = 0;
   }
@@ -16,6 +16,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <map>
 #include <memory>
 #include <queue>
 #include <shared_mutex>
@@ -206,10 +207,13 @@ public:
    * should be buffersize/batchsize
    * @param input_dims input dimensions
    * @param label_dims label dimensions
+   * @param in_order if true, iterations are served in the order they are
+   * requested for filling even if a later one is filled first
    */
   IterationQueue(unsigned int num_slots,
                  const std::vector<ml::train::TensorDim> &input_dims,
-                 const std::vector<ml::train::TensorDim> &label_dims);
+                 const std::vector<ml::train::TensorDim> &label_dims,
+                 bool in_order = true);
 
   /**
    * @brief Destroy the Iteration Queue object
@@ -218,7 +222,9 @@ public:
   ~IterationQueue();
 
   /**
-   * @brief request empty sample from the queue.
+   * @brief request empty sample from the queue. This is safe to be called
+   * from multiple producers at the same time, samples are given in the order
+   * of the calls.
    * @note User must check if ScopedView actually has a value by calling
    * ScopedView::isEmpty()
    * @return ScopedView<Sample> sample view. ScopedView::isEmpty() == true
@@ -328,6 +334,20 @@ private:
      */
     Iteration &get() { return iteration; }
 
+    /**
+     * @brief set sequence number of the iteration in the filling order
+     *
+     * @param seq_ sequence number
+     */
+    void setSequence(unsigned int seq_) { seq = seq_; }
+
+    /**
+     * @brief get sequence number of the iteration in the filling order
+     *
+     * @return unsigned int sequence number
+     */
+    unsigned int getSequence() const { return seq; }
+
   private:
     unsigned int num_observed; /**< number of observed samples which were passed
                                   to the callee and notified done filling */
@@ -335,6 +355,7 @@ private:
       notify_mutex;      /**< mutex which should be locked when try to notify */
     Iteration iteration; /**< underlying iteration that this class owns */
     IterationQueue *iq;  /**< view of iteration queue */
+    unsigned int seq;    /**< sequence number in the filling order */
   };
 
   /**
@@ -361,11 +382,24 @@ private:
    */
   void markEmpty(MarkableIteration *iteration) /** noexcept */;
 
+  /**
+   * @brief hand over an iteration which is done filling. When the queue is in
+   * order, the iteration is held until every former iteration is handed over.
+   * @note empty_mutex must be locked by the caller
+   *
+   * @param iteration iteration which is done filling
+   * @param discard if true, iteration is given back to the empty queue
+   * instead of being served
+   */
+  void pushFilled(MarkableIteration *iteration, bool discard = false);
+
   std::vector<MarkableIteration> iterations; /**< allocated iterations */
   MarkableIteration *being_filled; /**< last iteration that is being filled */
   std::vector<Sample>::iterator
     current_iterator; /**< current sample iteration of being_filled */
 
+  mutable std::mutex
+    request_mutex; /**< mutex to serialize the requests of empty slots */
   mutable std::mutex empty_mutex; /**< mutex to be used when it is mutually
                                      exclusive to the requesting empty slots */
   unsigned int
@@ -378,6 +412,13 @@ private:
                            num_being_filled */
   std::atomic<FlowState> flow_state; /**< flow state of the queue */
 
+  bool in_order;              /**< serve iterations in the filling order */
+  unsigned int next_fill_seq; /**< sequence of the next iteration to fill */
+  unsigned int next_push_seq; /**< sequence of the next iteration to serve */
+  std::map<unsigned int, std::pair<MarkableIteration *, bool>>
+    reorder_buf; /**< iterations filled ahead of their turn, with discard flag
+                  */
+
   unsigned int batch_size;
   ViewQueue<MarkableIteration> empty_q;  /**< iterations to be filled */
   ViewQueue<MarkableIteration> filled_q; /**< iterations to be served */
@@ -79,8 +79,8 @@ const std::string RandomDataOneHotProducer::getType() const {
 }
 
 bool RandomDataOneHotProducer::isMultiThreadSafe() const {
-  /// @todo make this true, it is needed to test multiple worker scenario
-  return false;
+  /// generator draws from a random engine owned by each sample
+  return true;
 }
 
 void RandomDataOneHotProducer::setProperty(
@@ -125,19 +125,26 @@ RandomDataOneHotProducer::finalize(const std::vector<TensorDim> &input_dims,
                      0, label_dim.width() - 1);
                  });
 
-  std::mt19937 rng;
-  rng.seed(0);
   auto sz = size(input_dims, input_dims);
 
   /** DataProducer::Generator */
-  return [rng, sz, min_ = min_.get(), max_ = max_.get(),
+  return [sz, min_ = min_.get(), max_ = max_.get(),
           label_chooser = std::move(label_chooser_)](
            unsigned int idx, std::vector<Tensor> &inputs,
-           std::vector<Tensor> &labels) mutable -> bool {
-    auto populate_input = [&](Tensor &t) { t.setRandUniform(min_, max_); };
+           std::vector<Tensor> &labels) -> bool {
+    /// each sample owns its engine seeded by the index, so that the samples do
+    /// not depend on the order nor the thread they are generated from
+    std::mt19937 rng(idx);
+    std::uniform_real_distribution<float> input_dist(min_, max_);
+    auto populate_input = [&](Tensor &t) {
+      float *data = t.getData();
+      for (unsigned int i = 0; i < t.size(); ++i) {
+        data[i] = input_dist(rng);
+      }
+    };
 
     auto populate_label =
-      [&](Tensor &t, std::uniform_int_distribution<unsigned int> &label_dist_) {
+      [&](Tensor &t, std::uniform_int_distribution<unsigned int> label_dist_) {
         t.setZero();
         t.setValue(0, 0, 0, label_dist_(rng), 1);
         return t;
@@ -14,22 +14,177 @@
 
 #include <raw_file_data_producer.h>
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <random>
 #include <vector>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <base_properties.h>
 #include <common_properties.h>
 #include <nntrainer_error.h>
+#include <nntrainer_log.h>
 #include <node_exporter.h>
 #include <util_func.h>
 
 namespace nntrainer {
 
+/**
+ * @brief Props to memory map the file instead of reading through a stream
+ *
+ */
+class PropsMmap : public nntrainer::Property<bool> {
+public:
+  /**
+   * @brief Construct a new props mmap object with a default value
+   *
+   * @param value default value
+   */
+  PropsMmap(bool value = true) : nntrainer::Property<bool>(value) {}
+  static constexpr const char *key = "mmap"; /**< unique key to access */
+  using prop_tag = bool_prop_tag;            /**< property type */
+};
+
+/**
+ * @brief read only mapping of the whole file. Samples are fixed size records,
+ * so the pages of the samples to be read next are advised from the access
+ * order.
+ *
+ */
+class RawFileDataProducer::MappedFile {
+public:
+  /**
+   * @brief number of samples to advise ahead of the current one
+   */
+  static constexpr unsigned int read_ahead = 32;
+
+  /**
+   * @brief Construct a new Mapped File object
+   *
+   * @param path path of the file
+   * @param sample_bytes_ size of a sample in bytes
+   * @param num_samples_ number of samples
+   * @throw std::runtime_error if failed to map
+   */
+  MappedFile(const std::string &path, size_t sample_bytes_,
+             unsigned int num_samples_) :
+    data(nullptr),
+    length(static_cast<size_t>(num_samples_) * sample_bytes_),
+    sample_bytes(sample_bytes_),
+    num_samples(num_samples_) {
+#if defined(_WIN32)
+    throw std::runtime_error("mmap is not supported on this platform");
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    NNTR_THROW_IF(fd < 0, std::runtime_error)
+      << "[RawFileDataProducer] failed to open " << path;
+
+    void *ptr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    NNTR_THROW_IF(ptr == MAP_FAILED, std::runtime_error)
+      << "[RawFileDataProducer] failed to map " << path;
+
+    data = static_cast<const char *>(ptr);
+    setAccessOrder({});
+#endif
+  }
+
+  /**
+   * @brief Destroy the Mapped File object
+   *
+   */
+  ~MappedFile() {
+#if !defined(_WIN32)
+    munmap(const_cast<char *>(data), length);
+#endif
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  /**
+   * @brief set the order of the coming accesses. Sequential access relies on
+   * the kernel read-ahead, otherwise the read-ahead is turned off and the
+   * samples to come are advised explicitly.
+   *
+   * @param order_ indices in the order of access, empty if sequential
+   */
+  void setAccessOrder(const std::vector<unsigned int> &order_) {
+    order = order_;
+    position.clear();
+#if !defined(_WIN32)
+    void *addr = const_cast<char *>(data);
+    if (order.empty()) {
+      madvise(addr, length, MADV_SEQUENTIAL);
+      return;
+    }
+
+    madvise(addr, length, MADV_RANDOM);
+    position.resize(num_samples, 0);
+    for (unsigned int i = 0; i < order.size(); ++i) {
+      NNTR_THROW_IF(order[i] >= num_samples, std::invalid_argument)
+        << "[RawFileDataProducer] index out of bound in the access order, "
+        << "index: " << order[i] << " size: " << num_samples;
+      position[order[i]] = i;
+    }
+    unsigned int ahead = std::min<size_t>(read_ahead, order.size());
+    for (unsigned int i = 0; i < ahead; ++i) {
+      adviseSample(order[i]);
+    }
+#endif
+  }
+
+  /**
+   * @brief get the sample and advise the one to be read after the window
+   *
+   * @param idx index of the sample
+   * @return const char* start of the sample
+   */
+  const char *getSample(unsigned int idx) {
+    if (!position.empty()) {
+      size_t next = static_cast<size_t>(position[idx]) + read_ahead;
+      if (next < order.size()) {
+        adviseSample(order[next]);
+      }
+    }
+    return data + static_cast<size_t>(idx) * sample_bytes;
+  }
+
+private:
+  /**
+   * @brief advise the kernel that the sample will be needed soon
+   *
+   * @param idx index of the sample
+   */
+  void adviseSample(unsigned int idx) {
+#if !defined(_WIN32)
+    static const size_t page_size = sysconf(_SC_PAGE_SIZE);
+    size_t begin = static_cast<size_t>(idx) * sample_bytes;
+    size_t aligned = begin / page_size * page_size;
+    madvise(const_cast<char *>(data) + aligned, begin + sample_bytes - aligned,
+            MADV_WILLNEED);
+#endif
+  }
+
+  const char *data;    /**< start of the mapping */
+  size_t length;       /**< length of the mapping */
+  size_t sample_bytes; /**< size of a sample */
+  unsigned int num_samples;
+  std::vector<unsigned int> order;    /**< access order */
+  std::vector<unsigned int> position; /**< position of an index in order */
+};
+
 RawFileDataProducer::RawFileDataProducer() : raw_file_props(new PropTypes()) {}
 
 RawFileDataProducer::RawFileDataProducer(const std::string &path) :
-  raw_file_props(new PropTypes(props::FilePath(path))) {}
+  raw_file_props(new PropTypes(props::FilePath(path), PropsMmap())) {}
 RawFileDataProducer::~RawFileDataProducer() {}
 
 const std::string RawFileDataProducer::getType() const {
@@ -59,6 +214,37 @@ RawFileDataProducer::finalize(const std::vector<TensorDim> &input_dims,
   sample_size = std::accumulate(label_dims.begin(), label_dims.end(),
                                 sample_size, size_accumulator);
 
+  mapped_file.reset();
+  if (std::get<PropsMmap>(*raw_file_props).get() && sz > 0) {
+    try {
+      mapped_file = std::make_shared<MappedFile>(
+        path_prop.get(), sample_size * RawFileDataProducer::pixel_size, sz);
+    } catch (std::exception &e) {
+      ml_logw("[RawFileDataProducer] reading through a stream, reason: %s",
+              e.what());
+    }
+  }
+
+  if (mapped_file) {
+    return [sz, mapped = mapped_file](unsigned int idx,
+                                      std::vector<Tensor> &inputs,
+                                      std::vector<Tensor> &labels) {
+      NNTR_THROW_IF(idx >= sz, std::range_error)
+        << "given index is out of bound, index: " << idx << " size: " << sz;
+      const char *src = mapped->getSample(idx);
+      for (auto &input : inputs) {
+        std::memcpy(input.getData<char>(), src, input.bytes());
+        src += input.bytes();
+      }
+      for (auto &label : labels) {
+        std::memcpy(label.getData<char>(), src, label.bytes());
+        src += label.bytes();
+      }
+
+      return idx == sz - 1;
+    };
+  }
+
   /// as we are passing the reference of file, this means created lamabda is
   /// tightly couple with the file, this is not desirable but working fine for
   /// now...
@@ -117,4 +303,16 @@ void RawFileDataProducer::exportTo(
   Exporter &exporter, const ml::train::ExportMethods &method) const {
   exporter.saveResult(*raw_file_props, method, this);
 }
+
+bool RawFileDataProducer::isMultiThreadSafe() const {
+  /// reading from the mapping does not change any state, unlike the stream
+  return mapped_file != nullptr;
+}
+
+void RawFileDataProducer::setAccessOrder(
+  const std::vector<unsigned int> &order) {
+  if (mapped_file) {
+    mapped_file->setAccessOrder(order);
+  }
+}
 } // namespace nntrainer
@@ -28,10 +28,14 @@ namespace props {
 class FilePath;
 }
 
+class PropsMmap;
+
 using datagen_cb = ml::train::datagen_cb;
 
 /**
  * @brief RawFileDataProducer which contains a callback and returns back
+ * @details the file is memory mapped by default and the samples are copied
+ * from the mapped pages. Set "mmap=false" to read through a file stream.
  *
  */
 class RawFileDataProducer final : public DataProducer {
@@ -92,9 +96,24 @@ public:
   void exportTo(Exporter &exporter,
                 const ml::train::ExportMethods &method) const override;
 
+  /**
+   * @copydoc DataProducer::isMultiThreadSafe()
+   */
+  bool isMultiThreadSafe() const override;
+
+  /**
+   * @copydoc DataProducer::setAccessOrder(const std::vector<unsigned int>
+   * &order)
+   */
+  void setAccessOrder(const std::vector<unsigned int> &order) override;
+
 private:
+  class MappedFile;
+
   std::ifstream file;
-  using PropTypes = std::tuple<props::FilePath>;
+  std::shared_ptr<MappedFile> mapped_file; /**< mapped file of the last
+                                              finalize, nullptr if streamed */
+  using PropTypes = std::tuple<props::FilePath, PropsMmap>;
   std::unique_ptr<PropTypes> raw_file_props;
 };
 
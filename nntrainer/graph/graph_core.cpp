@@ -104,6 +104,22 @@ void GraphCore::topologicalSort() {
   }
 }
 
+std::vector<unsigned int> GraphCore::getSortedNodeLevels() const {
+  NNTR_THROW_IF(Sorted.size() != node_list.size(), std::runtime_error)
+    << "Graph must be sorted before getting the levels";
+
+  /** inputs of a node come before it in the topological order */
+  std::vector<unsigned int> level(Sorted.size(), 0);
+  for (unsigned int idx = 0; idx < Sorted.size(); ++idx) {
+    for (auto const &in_conn : Sorted[idx]->getInputConnections()) {
+      level[idx] =
+        std::max(level[idx], level[sorted_node_map.at(in_conn)] + 1);
+    }
+  }
+
+  return level;
+}
+
 const std::shared_ptr<GraphNode> &
 GraphCore::getNode(const std::string &name) const {
   return node_list.at(node_map.at(name));
@@ -166,6 +166,14 @@ public:
    */
   void topologicalSort();
 
+  /**
+   * @brief Get the level of the sorted nodes, the length of the longest path
+   * from a node without input. Nodes of a level do not depend on each other.
+   * Must be called after topologicalSort()
+   * @retval level of each sorted node
+   */
+  std::vector<unsigned int> getSortedNodeLevels() const;
+
   /**
    * @brief     Copy the graph
    * @param[in] from Graph Object to copy
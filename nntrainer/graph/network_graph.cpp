@@ -36,6 +36,7 @@
 #include <lstmcell.h>
 #include <multiout_layer.h>
 #include <network_graph.h>
+#include <nntr_thread_pool.h>
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
 #include <profiler.h>
@@ -84,8 +85,21 @@ int NetworkGraph::compile(const std::string &loss_type) {
 
   graph.topologicalSort();
 
+  forward_waves.clear();
+  if (inter_op_parallel) {
+    /** the sorted order is kept as it is the order of the saved weights */
+    auto levels = graph.getSortedNodeLevels();
+    for (unsigned int idx = 0; idx < levels.size(); ++idx) {
+      if (levels[idx] >= forward_waves.size())
+        forward_waves.resize(levels[idx] + 1);
+      forward_waves[levels[idx]].push_back(idx);
+    }
+  }
+
   setExecutionOrder();
-  forward_iter_end = (*(cend() - 1)).get();
+  forward_iter_end = inter_op_parallel
+                       ? getSortedLayerNode(forward_waves.back().back()).get()
+                       : (*(cend() - 1)).get();
 
   inPlaceOptimize();
 
@@ -99,11 +113,20 @@ int NetworkGraph::compile(const std::string &loss_type) {
 
 void NetworkGraph::setExecutionOrder() {
   auto backward_order = graph.size();
+  std::vector<unsigned int> levels;
+  if (inter_op_parallel)
+    levels = graph.getSortedNodeLevels();
+
   for (auto iter = getBackwardingBeginIter(); iter != getBackwardingEndIter();
        iter++) {
     auto &node = *iter;
     auto order_idx = getBackwardingEndIter() - iter - 1;
     auto forward_order = order_idx;
+    /** nodes of a wave share the forward order, which keeps their tensors
+     * from being planned onto the same memory */
+    if (inter_op_parallel)
+      forward_order = levels.at(order_idx);
+
     auto calc_gradient_order = backward_order;
     if (node->getTrainable())
       backward_order++;
@@ -291,8 +314,13 @@ void NetworkGraph::setBatchSize(unsigned int batch_size) {
     return;
 
   auto allocated = tensor_manager->isAllocated();
+  /// a smaller batch is a prefix of every batched tensor, so it runs on the
+  /// memory already allocated without planning or allocating again
+  auto in_place = allocated && batch_size <= allocated_batch_size;
 
-  if (allocated)
+  if (in_place)
+    tensor_manager->detachTensors();
+  else if (allocated)
     deallocateTensors();
 
   for (auto iter = cbegin(); iter != cend(); iter++) {
@@ -318,7 +346,9 @@ void NetworkGraph::setBatchSize(unsigned int batch_size) {
   /// resize input and output spec
   tensor_manager->setBatchSize(batch_size);
 
-  if (allocated)
+  if (in_place)
+    tensor_manager->attachTensors();
+  else if (allocated)
     allocateTensors(exec_mode);
 
   /** update input and label dimensions */
@@ -367,15 +397,48 @@ void NetworkGraph::applyGradients(
   }
 }
 
+void NetworkGraph::runWaves(
+  const std::function<void(std::shared_ptr<LayerNode>)> &op,
+  std::function<bool(void *userdata)> stop_cb, void *userdata) {
+  for (unsigned int w = 0; w < forward_waves.size() && !stop_cb(userdata);
+       ++w) {
+    const auto &wave = forward_waves[w];
+
+    if (wave.size() == 1) {
+      auto ln = getSortedLayerNode(wave.front());
+      PROFILE_TIME_START(profile_keys.at(ln->getType()));
+      op(ln);
+      PROFILE_TIME_END(profile_keys.at(ln->getType()));
+      continue;
+    }
+
+    /** the profiler is not thread safe, so concurrent nodes are not timed */
+    ThreadPool::Global().parallelFor(
+      0, wave.size(), 1,
+      [this, &op, &wave](unsigned int start, unsigned int end, unsigned int) {
+        for (unsigned int idx = start; idx < end; ++idx)
+          op(getSortedLayerNode(wave[idx]));
+      });
+  }
+}
+
 sharedConstTensors NetworkGraph::forwarding(
   bool training,
   std::function<void(std::shared_ptr<LayerNode>, bool)> forwarding_op,
   std::function<bool(void *userdata)> stop_cb, void *userdata) {
-  for (auto iter = cbegin(); iter != cend() && !stop_cb(userdata); iter++) {
-    auto &ln = *iter;
-    PROFILE_TIME_START(profile_keys.at(ln->getType()));
-    forwarding_op(*iter, training);
-    PROFILE_TIME_END(profile_keys.at(ln->getType()));
+  if (inter_op_parallel) {
+    runWaves(
+      [&forwarding_op, training](std::shared_ptr<LayerNode> ln) {
+        forwarding_op(ln, training);
+      },
+      stop_cb, userdata);
+  } else {
+    for (auto iter = cbegin(); iter != cend() && !stop_cb(userdata); iter++) {
+      auto &ln = *iter;
+      PROFILE_TIME_START(profile_keys.at(ln->getType()));
+      forwarding_op(*iter, training);
+      PROFILE_TIME_END(profile_keys.at(ln->getType()));
+    }
   }
 
   sharedConstTensors out;
@@ -393,11 +456,19 @@ sharedConstTensors NetworkGraph::incremental_forwarding(
   unsigned int from, unsigned int to, bool training,
   std::function<void(std::shared_ptr<LayerNode>, bool)> forwarding_op,
   std::function<bool(void *userdata)> stop_cb, void *userdata) {
-  for (auto iter = cbegin(); iter != cend() && !stop_cb(userdata); iter++) {
-    auto &ln = *iter;
-    PROFILE_TIME_START(profile_keys.at(ln->getType()));
-    forwarding_op(*iter, training);
-    PROFILE_TIME_END(profile_keys.at(ln->getType()));
+  if (inter_op_parallel) {
+    runWaves(
+      [&forwarding_op, training](std::shared_ptr<LayerNode> ln) {
+        forwarding_op(ln, training);
+      },
+      stop_cb, userdata);
+  } else {
+    for (auto iter = cbegin(); iter != cend() && !stop_cb(userdata); iter++) {
+      auto &ln = *iter;
+      PROFILE_TIME_START(profile_keys.at(ln->getType()));
+      forwarding_op(*iter, training);
+      PROFILE_TIME_END(profile_keys.at(ln->getType()));
+    }
   }
 
   sharedConstTensors out;
@@ -539,14 +610,20 @@ LayerNode *NetworkGraph::computeBackwardEnd() {
     auto &ln = *iter;
     const auto &exec_order = ln->getExecutionOrder();
     int cur_order = std::get<0>(exec_order);
+    bool shared_order = inter_op_parallel;
     if (ln->needsCalcDerivative() || ln->needsCalcGradient()) {
 #ifdef ENABLE_TEST
       cur_order = std::get<2>(exec_order);
 #else
       cur_order = std::get<1>(exec_order);
 #endif
+      shared_order = false;
     }
 
+    /** nodes of a wave share the forward order */
+    if (shared_order && max_exec_order == cur_order)
+      continue;
+
     NNTR_THROW_IF(max_exec_order == cur_order, std::invalid_argument)
       << "layer node: " << ln->getName()
       << " has duplicated max_exec_order, this should not happen, current "
@@ -566,7 +643,20 @@ LayerNode *NetworkGraph::computeBackwardEnd() {
  * @brief Allocate memory for all the managed tensors
  */
 void NetworkGraph::allocateTensors(ExecutionMode exec_mode_) {
+  if (!tensor_manager->isAllocated() && max_batch_size > batch_size) {
+    /// the pool is planned once for the largest batch, the current batch then
+    /// runs in place on the front of every batched tensor
+    unsigned int current_batch_size = batch_size;
+    setBatchSize(max_batch_size);
+    allocateTensors(exec_mode_);
+    setBatchSize(current_batch_size);
+    return;
+  }
+
   exec_mode = exec_mode_;
+  if (!tensor_manager->isAllocated())
+    allocated_batch_size = batch_size;
+
   if (exec_mode == ExecutionMode::INFERENCE)
     /**
      * get the order of execution/usage order for the forwarding of the last
@@ -574,7 +664,7 @@ void NetworkGraph::allocateTensors(ExecutionMode exec_mode_) {
      * with usage less than the max_exec_order are allocated.
      */
     tensor_manager->allocateTensors(
-      std::get<0>((*(cend() - 1))->getExecutionOrder()));
+      std::get<0>(forward_iter_end->getExecutionOrder()));
   else {
     /**
      * get the order of execution/usage order for the backwarding of the first
@@ -1623,6 +1713,15 @@ void NetworkGraph::resetLossScale(float scale) {
   }
 }
 
+bool NetworkGraph::mapWeights(const std::string &file_path) {
+  std::vector<Tensor *> weights;
+  for (auto iter = cbegin(); iter != cend(); iter++) {
+    auto node_weights = (*iter)->getSavedWeights();
+    weights.insert(weights.end(), node_weights.begin(), node_weights.end());
+  }
+  return tensor_manager->mapWeights(weights, file_path);
+}
+
 unsigned int NetworkGraph::getNumLoadedWeightPoolTensors() {
   return tensor_manager->getNumLoadedWeightPoolTensors();
 }
@@ -45,10 +45,13 @@ public:
     graph(),
     compiled(false),
     batch_size(0),
+    allocated_batch_size(0),
+    max_batch_size(0),
     graph_exec_end(0),
     backward_iter_end(nullptr),
     forward_iter_end(nullptr),
     optimize_memory(true),
+    inter_op_parallel(false),
     exec_mode(ExecutionMode::TRAIN),
     tensor_format("NCHW"),
     tensor_dtype(split("FP32-FP32", getRegex("\\-"))),
@@ -76,10 +79,13 @@ public:
     graph(),
     compiled(false),
     batch_size(0),
+    allocated_batch_size(0),
+    max_batch_size(0),
     graph_exec_end(0),
     backward_iter_end(nullptr),
     forward_iter_end(nullptr),
     optimize_memory(true),
+    inter_op_parallel(false),
     exec_mode(mode),
     tensor_format(tensor_format_),
     tensor_dtype(split(tensor_dtype_, getRegex("\\-"))),
@@ -171,6 +177,9 @@ public:
   /**
    * @brief     set batch size
    * @param[in] batch size
+   * @note      if the tensors are allocated with a batch size not smaller than
+   * the given one, the tensors keep their memory and use the front of it.
+   * Otherwise the tensors are reallocated.
    */
   void setBatchSize(unsigned int batch_size);
 
@@ -387,6 +396,14 @@ public:
    */
   void deallocateWeights() { tensor_manager->deallocateWeights(); }
 
+  /**
+   * @brief Map the weights to the given model file instead of reading them
+   *
+   * @param file_path path of the binary model file
+   * @return true if mapped, false if the weights must be read instead
+   */
+  bool mapWeights(const std::string &file_path);
+
   /**
    * @brief     Enable the memory optimizations for the network
    *
@@ -397,6 +414,32 @@ public:
     optimize_memory = val;
   }
 
+  /**
+   * @brief     Run the nodes which do not depend on each other concurrently.
+   * Must be set before compile
+   *
+   * @param val true to enable, else false
+   */
+  void setInterOpParallel(bool val) { inter_op_parallel = val; }
+
+  /**
+   * @brief     Plan and allocate the tensors for at least @a val batches, so
+   * that any batch up to it runs on the same memory without planning again
+   *
+   * @param val largest batch expected, 0 to plan for the current batch only
+   */
+  void setMaxBatchSize(unsigned int val) { max_batch_size = val; }
+
+  /**
+   * @brief     check if the tensors are allocated for the execution mode
+   *
+   * @param mode execution mode
+   * @retval true if allocated for @a mode
+   */
+  bool isAllocated(ExecutionMode mode) const {
+    return tensor_manager->isAllocated() && exec_mode == mode;
+  }
+
   /**
    * @brief     Create optimizer variable for every weights
    *
@@ -520,6 +563,47 @@ public:
    */
   unsigned int getNumLoadedTensorPoolTensors();
 
+  /**
+   * @brief Get bytes moved by the swap devices
+   *
+   * @param reset reset the stats after read
+   * @return SwapDevice::Stats swap stats
+   */
+  SwapDevice::Stats getSwapStats(bool reset = false) {
+    return tensor_manager->getSwapStats(reset);
+  }
+
+  /**
+   * @brief Keep swapped out data compressed in memory before the swap file
+   *
+   * @param budget bytes each of the weight and tensor pools keeps, 0 to
+   * disable
+   * @param lossy pack FP32 activations to FP16
+   */
+  void setCompressedSwapTier(size_t budget, bool lossy) {
+    tensor_manager->setCompressedSwapTier(budget, lossy);
+  }
+
+  /**
+   * @brief Set the limit of the swapped out data loaded ahead
+   *
+   * @param limit bytes of the execution orders loaded ahead, 0 to use the
+   * fixed lookahead
+   */
+  void setPrefetchLimit(size_t limit) {
+    tensor_manager->setPrefetchLimit(limit);
+  }
+
+  /**
+   * @brief Get the stats of the waits for swapped out data to be loaded
+   *
+   * @param reset reset the stats after read
+   * @return PrefetchScheduler::Stats prefetch stats
+   */
+  PrefetchScheduler::Stats getPrefetchStats(bool reset = false) {
+    return tensor_manager->getPrefetchStats(reset);
+  }
+
 private:
   std::map<std::string, std::string> sub_in_out; /** This is map to identify
                    input and output layer name of subgraph */
@@ -528,6 +612,10 @@ private:
   GraphCore graph;             /** core graph object */
   bool compiled;               /**< if the model graph is compiled */
   unsigned int batch_size;     /**< current batch_size */
+  unsigned int allocated_batch_size; /**< batch_size the tensors are
+                                        allocated with */
+  unsigned int max_batch_size; /**< largest batch_size the tensors are
+                                  allocated with, 0 if not set */
   unsigned int graph_exec_end; /**< Inclusive, last execution order of the
                                   given graph */
   LayerNode
@@ -546,6 +634,10 @@ private:
   std::vector<TensorDim> input_dims;    /**< graph input dimensions */
 
   bool optimize_memory;    /**< optimize memory */
+  bool inter_op_parallel;  /**< run independent nodes concurrently */
+  std::vector<std::vector<unsigned int>>
+    forward_waves; /**< sorted index of the nodes of each wave of independent
+                      nodes, in the order of execution */
   ExecutionMode exec_mode; /**< execution mode with which the graph has been
                               currently set or previously set */
 
@@ -670,6 +762,17 @@ private:
    * @return end of the backward iter;
    */
   LayerNode *computeBackwardEnd();
+
+  /**
+   * @brief run @a op over the sorted nodes wave by wave. Nodes of a wave run
+   * concurrently on the global thread pool
+   *
+   * @param op operation to run on each node
+   * @param stop_cb callback to check if the run should stop
+   * @param userdata user data passed along the stop_cb
+   */
+  void runWaves(const std::function<void(std::shared_ptr<LayerNode>)> &op,
+                std::function<bool(void *userdata)> stop_cb, void *userdata);
 };
 
 } // namespace nntrainer
@@ -16,6 +16,8 @@
 #define __ACTI_FUNC_H__
 #ifdef __cplusplus
 
+#include <type_traits>
+
 #include <common_properties.h>
 #include <cpu_backend.h>
 
@@ -37,6 +39,17 @@ class ActiFunc {
 public:
   constexpr static inline float NEGATIVE_SLOPE = 0.01f;
 
+  /**
+   * @brief fp32 activation kernel, Y = f(X)
+   */
+  using ActiKernel = void (*)(const unsigned int N, const float *X, float *Y);
+
+  /**
+   * @brief fp32 activation derivative kernel, dX = dY * f'(Y)
+   */
+  using ActiPrimeKernel = void (*)(const unsigned int N, const float *Y,
+                                   const float *dY, float *dX);
+
   /**
    * @brief     Constructor of ActiFunc
    */
@@ -62,19 +75,28 @@ public:
 
     switch (acti_type) {
     case ActivationType::ACT_TANH:
-      this->setActivation<T>(tanhFloat<T>, tanhPrime<T>);
+      this->setElementwiseActivation<T, tanhFloat<T>, tanhPrime<T>>(
+        ele_tanh, ele_tanh_prime);
       break;
     case ActivationType::ACT_SIGMOID:
-      this->setActivation<T>(sigmoid<T>, sigmoidPrime<T>);
+      this->setElementwiseActivation<T, sigmoid<T>, sigmoidPrime<T>>(
+        ele_sigmoid, ele_sigmoid_prime);
       break;
     case ActivationType::ACT_SOFTMAX:
       this->setActivation<Tensor>(softmax<T>, softmaxPrime<T>);
       break;
     case ActivationType::ACT_RELU:
-      this->setActivation<T>(relu<T>, reluPrime<T>);
+      this->setElementwiseActivation<T, relu<T>, reluPrime<T>>(ele_relu,
+                                                              ele_relu_prime);
       break;
     case ActivationType::ACT_LEAKY_RELU:
-      this->setActivation<T>(leakyRelu<T>, leakyReluPrime<T>);
+      this->setElementwiseActivation<T, leakyRelu<T>, leakyReluPrime<T>>(
+        [](const unsigned int N, const float *X, float *Y) {
+          ele_leaky_relu(N, X, Y, NEGATIVE_SLOPE);
+        },
+        [](const unsigned int N, const float *Y, const float *dY, float *dX) {
+          ele_leaky_relu_prime(N, Y, dY, dX, NEGATIVE_SLOPE);
+        });
       break;
     case ActivationType::ACT_SWISH:
       is_inplace = false;
@@ -93,19 +115,19 @@ public:
       this->setActivation<Tensor>(sigmoidGelu<T>, sigmoidGeluPrime<T>);
       break;
     case ActivationType::ACT_ELU:
-      this->setActivation<T>(elu<T>, eluPrime<T>);
+      this->setElementwiseActivation<T, elu<T>, eluPrime<T>>();
       break;
     case ActivationType::ACT_SELU:
-      this->setActivation<T>(selu<T>, seluPrime<T>);
+      this->setElementwiseActivation<T, selu<T>, seluPrime<T>>();
       break;
     case ActivationType::ACT_SOFTPLUS:
-      this->setActivation<T>(softplus<T>, softplusPrime<T>);
+      this->setElementwiseActivation<T, softplus<T>, softplusPrime<T>>();
       break;
     case ActivationType::ACT_MISH:
-      this->setActivation<T>(mish<T>, mishPrime<T>);
+      this->setElementwiseActivation<T, mish<T>, mishPrime<T>>();
       break;
     case ActivationType::ACT_NONE:
-      this->setActivation<T>(no_op<T>, no_op_prime<T>);
+      this->setElementwiseActivation<T, no_op<T>, no_op_prime<T>>();
       break;
     case ActivationType::ACT_UNKNOWN:
     default:
@@ -156,6 +178,20 @@ public:
    */
   bool supportInPlace() const { return is_inplace; }
 
+  /**
+   * @brief Get the fp32 simd kernel of the activation
+   *
+   * @return ActiKernel kernel, nullptr if the activation has none
+   */
+  ActiKernel getKernel() const { return _act_kernel; }
+
+  /**
+   * @brief Get the fp32 simd kernel of the activation derivative
+   *
+   * @return ActiPrimeKernel kernel, nullptr if the activation has none
+   */
+  ActiPrimeKernel getPrimeKernel() const { return _act_prime_kernel; }
+
   /**
    * @brief       Calculate softmax for Tensor Type
    * @param[in] input input Tensor
@@ -398,7 +434,10 @@ public:
    */
   template <typename T = float>
   static Tensor &swish(Tensor const &t_in, Tensor &t_out) {
-    t_in.apply<T>([&](T x) { return sigmoid<T>(x); }, t_out);
+    if (std::is_same_v<T, float> && isKernelCompatible(t_in, t_out))
+      ele_sigmoid(t_in.size(), t_in.getData<float>(), t_out.getData<float>());
+    else
+      t_in.apply<T>([&](T x) { return sigmoid<T>(x); }, t_out);
     t_out.multiply_i(t_in);
 
     return t_out;
@@ -627,6 +666,8 @@ public:
     std::function<funcParam &(funcParam &, funcParam &,
                               funcParam const &)> const &activation_prime_fn) {
     _act_fn = activation_fn;
+    _act_kernel = nullptr;
+    _act_prime_kernel = nullptr;
     _act_prime_fn = [activation_prime_fn](
                       funcParam const &t_in, funcParam &t_out,
                       funcParam &outgoing_derivative,
@@ -658,6 +699,8 @@ public:
       return ML_ERROR_INVALID_PARAMETER;
 
     _act_fn = activation_fn;
+    _act_kernel = nullptr;
+    _act_prime_kernel = nullptr;
     _act_prime_fn = activation_prime_fn;
 
     return ML_ERROR_NONE;
@@ -677,6 +720,8 @@ public:
       &activation_fn,
     std::function<funcParam &(funcParam &, funcParam &)> const
       &activation_prime_fn) {
+    _act_kernel = nullptr;
+    _act_prime_kernel = nullptr;
     if (!is_inplace) {
       _act_prime_fn = [activation_prime_fn](
                         funcParam const &t_in, funcParam &t_out,
@@ -717,6 +762,8 @@ public:
   int setActivation(
     std::function<funcParam(funcParam const)> const &activation_fn,
     std::function<funcParam(funcParam const)> const &activation_prime_fn) {
+    _act_kernel = nullptr;
+    _act_prime_kernel = nullptr;
     _act_fn = [activation_fn](Tensor const &x, Tensor &hidden) -> Tensor & {
       return x.apply(activation_fn, hidden);
     };
@@ -760,6 +807,63 @@ public:
     std::function<float(float const)> const &activation_fn,
     std::function<float(float const, float const)> const &activation_prime_fn);
 
+  /**
+   * @brief setActivation by element-wise activation function and its
+   * derivative computed from the output. The functions are template arguments
+   * so that they are inlined into the element-wise loop. Contiguous fp32
+   * tensors run on the simd kernels of the cpu backend if given.
+   *
+   * @tparam T data type
+   * @tparam fn activation function
+   * @tparam prime_fn derivative of the activation from its output
+   * @param kernel Y = fn(X) for fp32, nullptr if none
+   * @param prime_kernel dX = dY * prime_fn(Y) for fp32, nullptr if none
+   */
+  template <typename T, T (*fn)(T), T (*prime_fn)(T)>
+  void setElementwiseActivation(ActiKernel kernel = nullptr,
+                                ActiPrimeKernel prime_kernel = nullptr) {
+    if (!std::is_same_v<T, float>) {
+      kernel = nullptr;
+      prime_kernel = nullptr;
+    }
+    _act_kernel = kernel;
+    _act_prime_kernel = prime_kernel;
+
+    _act_fn = [kernel](Tensor const &x, Tensor &hidden) -> Tensor & {
+      if (kernel && isKernelCompatible(x, hidden)) {
+        kernel(x.size(), x.getData<float>(), hidden.getData<float>());
+        return hidden;
+      }
+      return x.apply<T>([](T v) { return fn(v); }, hidden);
+    };
+
+    bool inplace = is_inplace;
+    _act_prime_fn =
+      [prime_kernel, inplace](Tensor const &t_in, Tensor &t_out,
+                              Tensor &outgoing_derivative,
+                              Tensor const &incoming_derivative) -> Tensor & {
+      if (prime_kernel && isKernelCompatible(t_out, incoming_derivative) &&
+          isKernelCompatible(t_out, outgoing_derivative)) {
+        prime_kernel(t_out.size(), t_out.getData<float>(),
+                     incoming_derivative.getData<float>(),
+                     outgoing_derivative.getData<float>());
+        return outgoing_derivative;
+      }
+
+      auto prime = [](T v) { return prime_fn(v); };
+      if (!inplace) {
+        /** @todo update this based on supportInPlace */
+        t_out.apply<T>(prime, outgoing_derivative);
+        outgoing_derivative.multiply_i_strided(incoming_derivative);
+      } else {
+        t_out.apply<T>(prime, t_out);
+        incoming_derivative.multiply_strided(t_out, outgoing_derivative);
+      }
+
+      return outgoing_derivative;
+    };
+  }
+
   /**
    * @brief   Notify that this layer will execute in-place
    *
@@ -774,6 +878,20 @@ public:
   }
 
 private:
+  /**
+   * @brief check if two tensors can be passed to a simd kernel as is
+   *
+   * @param a tensor
+   * @param b tensor
+   * @return true if both are non-empty contiguous fp32 tensors of the same size
+   */
+  static bool isKernelCompatible(Tensor const &a, Tensor const &b) {
+    return !a.empty() && !b.empty() &&
+           a.getDataType() == ml::train::TensorDim::DataType::FP32 &&
+           b.getDataType() == ml::train::TensorDim::DataType::FP32 &&
+           a.getContiguous() && b.getContiguous() && a.size() == b.size();
+  }
+
   constexpr static inline float alpha = 1.0f; /**< alpha for elu */
   constexpr static inline float beta = 1.0f;  /**< beta for Softplus */
   constexpr static inline float selu_alpha = 1.67326324f; /**< alpha for selu */
@@ -782,6 +900,9 @@ private:
   std::function<Tensor &(Tensor const &, Tensor &)> _act_fn;
   std::function<Tensor &(Tensor const &, Tensor &, Tensor &, Tensor const &)>
     _act_prime_fn; /**< prime function with input and output*/
+  ActiKernel _act_kernel = nullptr; /**< fp32 kernel of _act_fn if any */
+  ActiPrimeKernel _act_prime_kernel =
+    nullptr; /**< fp32 kernel of _act_prime_fn if any */
 
   ActivationType
     activation_type; /**< type of the activation represented by this */
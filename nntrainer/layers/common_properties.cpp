@@ -96,6 +96,10 @@ Exponent::Exponent(float value) { set(value); }
 
 bool Epsilon::isValid(const float &value) const { return value > 0.0f; }
 
+bool FoldedBatchNormEpsilon::isValid(const float &value) const {
+  return value > 0.0f;
+}
+
 Momentum::Momentum(float value) { set(value); }
 
 bool Momentum::isValid(const float &value) const {
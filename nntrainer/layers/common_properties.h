@@ -281,6 +281,29 @@ public:
   bool isValid(const float &value) const override;
 };
 
+/**
+ * @brief FoldedBatchNormEpsilon property, epsilon of the batch normalization
+ * folded into the layer. Set by the graph realizer folding the batch
+ * normalization which follows the layer for inference.
+ *
+ */
+class FoldedBatchNormEpsilon : public nntrainer::Property<float> {
+
+public:
+  static constexpr const char *key =
+    "folded_batch_norm_epsilon";   /**< unique key to access */
+  using prop_tag = float_prop_tag; /**< property type */
+
+  /**
+   * @brief FoldedBatchNormEpsilon validator
+   *
+   * @param value float to validate
+   * @retval true if it is greater than 0.0
+   * @retval false if it is smaller or equal than 0.0
+   */
+  bool isValid(const float &value) const override;
+};
+
 /**
  * @brief Exponent property, this is used for pow operation
  *
@@ -1034,6 +1057,18 @@ public:
   static constexpr const char *key = "recurrent_activation";
 };
 
+/**
+ * @brief FusedActivation Enumeration Information, activation applied to the
+ * output of the layer inside the layer. Set by the graph realizer fusing the
+ * activation layer which follows the layer for inference.
+ *
+ */
+class FusedActivation final : public EnumProperty<ActivationTypeInfo> {
+public:
+  using prop_tag = enum_class_prop_tag;
+  static constexpr const char *key = "fused_activation";
+};
+
 /**
  * @brief     Enumeration of tensor initialization type
  */
@@ -18,6 +18,7 @@
 
 #include <conv2d_layer.h>
 #include <cpu_backend.h>
+#include <folded_batch_norm.h>
 #include <layer_context.h>
 #include <lazy_tensor.h>
 #include <nntr_threads.h>
@@ -297,8 +298,10 @@ Conv2DLayer::Conv2DLayer(
   padding(padding_),
   conv_props(props::FilterSize(), std::array<props::KernelSize, CONV2D_DIM>(),
              std::array<props::Stride, CONV2D_DIM>(), props::Padding2D(),
-             std::array<props::Dilation, CONV2D_DIM>()) {
+             std::array<props::Dilation, CONV2D_DIM>(),
+             props::FoldedBatchNormEpsilon(), props::FusedActivation()) {
   wt_idx.fill(std::numeric_limits<unsigned>::max());
+  bn_idx.fill(std::numeric_limits<unsigned>::max());
 }
 
 void Conv2DLayer::finalize(InitLayerContext &context) {
@@ -347,6 +350,37 @@ void Conv2DLayer::finalize(InitLayerContext &context) {
                             1.0f, bias_decay, "bias", true, 0);
   }
 
+  auto &folded_bn_epsilon = std::get<props::FoldedBatchNormEpsilon>(conv_props);
+  auto &fused_activation = std::get<props::FusedActivation>(conv_props);
+  NNTR_THROW_IF((!folded_bn_epsilon.empty() || !fused_activation.empty()) &&
+                  context.getExecutionMode() !=
+                    ml::train::ExecutionMode::INFERENCE,
+                std::invalid_argument)
+    << "folded batch normalization and fused activation are only for "
+       "inference, layer: "
+    << context.getName();
+
+  if (!folded_bn_epsilon.empty()) {
+    NNTR_THROW_IF(wt_idx[ConvParams::bias] ==
+                    std::numeric_limits<unsigned>::max(),
+                  std::invalid_argument)
+      << "folding batch normalization needs bias, layer: "
+      << context.getName();
+    bn_idx = requestFoldedBatchNorm(context, bias_dim);
+  }
+
+  if (!fused_activation.empty()) {
+    if (context.getActivationDataType() == TensorDim::DataType::FP32) {
+      fused_acti_func.setActiFunc<float>(fused_activation.get());
+    } else if (context.getActivationDataType() == TensorDim::DataType::FP16) {
+#ifdef ENABLE_FP16
+      fused_acti_func.setActiFunc<_FP16>(fused_activation.get());
+#else
+      throw std::invalid_argument("Error: enable-fp16 is not enabled");
+#endif
+    }
+  }
+
   // this output_dim must be the same with dimension of hidden
   unsigned int eff_in_height = in_dim.height() + padding[0] + padding[1];
   unsigned int eff_in_width = in_dim.width() + padding[2] + padding[3];
@@ -378,8 +412,6 @@ void Conv2DLayer::finalize(InitLayerContext &context) {
 }
 
 void Conv2DLayer::forwarding(RunLayerContext &context, bool training) {
-  int status = ML_ERROR_NONE;
-
   unsigned int filter_size = std::get<props::FilterSize>(conv_props);
   auto &stride = std::get<std::array<props::Stride, CONV2D_DIM>>(conv_props);
   auto &dilation =
@@ -388,7 +420,20 @@ void Conv2DLayer::forwarding(RunLayerContext &context, bool training) {
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
   Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
 
+  if (auto &epsilon = std::get<props::FoldedBatchNormEpsilon>(conv_props);
+      !epsilon.empty()) {
+    foldBatchNorm(context, bn_idx, epsilon, wt_idx[ConvParams::weight],
+                  wt_idx[ConvParams::bias]);
+  }
+
   Tensor &filter_kernel = context.getWeight(wt_idx[ConvParams::weight]);
+  Tensor *bias_kernel = nullptr;
+  if (auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
+      disable_bias.empty() || disable_bias.get() == false) {
+    bias_kernel = &context.getWeight(wt_idx[ConvParams::bias]);
+  }
+  const bool fused_activation =
+    !std::get<props::FusedActivation>(conv_props).empty();
 
   /** Calculate Convolution 2D
    *
@@ -429,6 +474,8 @@ void Conv2DLayer::forwarding(RunLayerContext &context, bool training) {
   const TensorDim &in_dim = input_.getDim();
   const TensorDim &out_dim = hidden_.getDim();
   const TensorDim &filter_dim = filter_kernel.getDim();
+  TensorDim out_slice_dim = out_dim;
+  out_slice_dim.batch(1);
   TensorDim filter_dim_squeezed{filter_kernel.batch(),
                                 filter_kernel.getDim().getFeatureLen()};
 
@@ -452,6 +499,13 @@ void Conv2DLayer::forwarding(RunLayerContext &context, bool training) {
       im2col(in_sub, filter_dim, padding, stride, dilation, result);
       // filter kernel is (K, CRS), result is (CRS, OH*OW)
       filter_kernel.dot(result, out, false, true);
+
+      /** bias and activation are applied while the slice is still in cache */
+      out.reshape(out_slice_dim);
+      if (bias_kernel && out.add_i(*bias_kernel) != ML_ERROR_NONE)
+        throw std::invalid_argument("[Conv2D] adding bias failed");
+      if (fused_activation)
+        fused_acti_func.run_fn(out, out);
     }
     result.deallocate();
   };
@@ -465,14 +519,6 @@ void Conv2DLayer::forwarding(RunLayerContext &context, bool training) {
   }
 
   filter_kernel.reshape(filter_dim);
-  if (auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
-      disable_bias.empty() || disable_bias.get() == false) {
-    Tensor &bias_kernel = context.getWeight(wt_idx[ConvParams::bias]);
-    status = hidden_.add_i(bias_kernel);
-    if (status != ML_ERROR_NONE) {
-      throw std::invalid_argument("[Conv2D] adding bias failed");
-    }
-  }
 }
 
 void Conv2DLayer::calcDerivative(RunLayerContext &context) {
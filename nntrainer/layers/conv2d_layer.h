@@ -17,7 +17,9 @@
 
 #include <memory.h>
 
+#include <acti_func.h>
 #include <common_properties.h>
+#include <folded_batch_norm.h>
 #include <layer_impl.h>
 
 namespace nntrainer {
@@ -112,10 +114,13 @@ private:
   std::array<unsigned int, CONV2D_DIM * 2> padding;
   std::tuple<props::FilterSize, std::array<props::KernelSize, CONV2D_DIM>,
              std::array<props::Stride, CONV2D_DIM>, props::Padding2D,
-             std::array<props::Dilation, CONV2D_DIM>>
+             std::array<props::Dilation, CONV2D_DIM>,
+             props::FoldedBatchNormEpsilon, props::FusedActivation>
     conv_props;
 
   std::array<unsigned int, 5> wt_idx; /**< indices of the weights and tensors */
+  FoldedBatchNormIdx bn_idx; /**< indices of the folded batch normalization */
+  ActiFunc fused_acti_func;  /**< activation fused into the output */
 };
 
 } // namespace nntrainer
@@ -0,0 +1,560 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   depthwise_conv2d_layer.cpp
+ * @date   17 Oct 2026
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ * @brief  This is Depthwise Convolution Layer Class for Neural Network
+ *
+ */
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <depthwise_conv2d_layer.h>
+#include <layer_context.h>
+#include <nntr_thread_pool.h>
+#include <nntrainer_error.h>
+#include <nntrainer_log.h>
+#include <node_exporter.h>
+#include <tensor_dim.h>
+
+namespace nntrainer {
+
+static constexpr size_t SINGLE_INOUT_IDX = 0;
+
+namespace {
+
+/**
+ * @brief multiply-adds a chunk of the thread pool should carry at least, so
+ * that small planes are batched together
+ */
+constexpr size_t MIN_CHUNK_WORK = 1 << 15;
+
+/**
+ * @brief shape of one depthwise plane. Every (batch, channel) plane of a call
+ * shares it.
+ */
+struct PlaneGeometry {
+  unsigned int in_h, in_w;
+  unsigned int out_h, out_w;
+  unsigned int k_h, k_w;
+  unsigned int stride_h, stride_w;
+  unsigned int dilation_h, dilation_w;
+  unsigned int pad_top, pad_left;
+  std::vector<int> col_offset; /**< input column of output column 0, per kw */
+  std::vector<unsigned int> col_begin; /**< first valid output column, per kw */
+  std::vector<unsigned int> col_end;   /**< last valid output column + 1 */
+
+  /**
+   * @brief input row read by output row @a oh for kernel row @a kh, or -1 if
+   * it falls into the padding
+   */
+  int inputRow(unsigned int oh, unsigned int kh) const {
+    int ih = static_cast<int>(oh * stride_h + kh * dilation_h) -
+             static_cast<int>(pad_top);
+    return ih < 0 || ih >= static_cast<int>(in_h) ? -1 : ih;
+  }
+};
+
+/**
+ * @brief build the plane geometry. The valid output column range of each
+ * kernel column is computed once so that the row loops below carry no bound
+ * checks and can be vectorized.
+ */
+PlaneGeometry makeGeometry(const TensorDim &in, const TensorDim &out,
+                           const TensorDim &kernel,
+                           const std::array<unsigned int, 4> &padding,
+                           unsigned int stride_h, unsigned int stride_w,
+                           unsigned int dilation_h, unsigned int dilation_w) {
+  PlaneGeometry g;
+  g.in_h = in.height();
+  g.in_w = in.width();
+  g.out_h = out.height();
+  g.out_w = out.width();
+  g.k_h = kernel.height();
+  g.k_w = kernel.width();
+  g.stride_h = stride_h;
+  g.stride_w = stride_w;
+  g.dilation_h = dilation_h;
+  g.dilation_w = dilation_w;
+  g.pad_top = padding[0];
+  g.pad_left = padding[2];
+
+  g.col_offset.resize(g.k_w);
+  g.col_begin.resize(g.k_w);
+  g.col_end.resize(g.k_w);
+  const int sw = static_cast<int>(stride_w);
+  const int last = static_cast<int>(g.in_w) - 1;
+  for (unsigned int kw = 0; kw < g.k_w; ++kw) {
+    int off = static_cast<int>(kw * dilation_w) - static_cast<int>(g.pad_left);
+    int begin = off >= 0 ? 0 : (-off + sw - 1) / sw;
+    int end = last - off < 0 ? 0 : (last - off) / sw + 1;
+    end = std::min(end, static_cast<int>(g.out_w));
+    g.col_offset[kw] = off;
+    g.col_begin[kw] = static_cast<unsigned int>(std::min(begin, end));
+    g.col_end[kw] = static_cast<unsigned int>(end);
+  }
+  return g;
+}
+
+/**
+ * @brief out[i] += w * in[i * stride + off] for i in [begin, end). STRIDE is
+ * the stride when it is known at compile time, 0 otherwise.
+ */
+template <unsigned int STRIDE, typename T>
+inline void gatherRow(T w, const T *__restrict in, int off, unsigned int stride,
+                      T *__restrict out, unsigned int begin, unsigned int end) {
+  const int s = static_cast<int>(STRIDE ? STRIDE : stride);
+  for (int i = begin; i < static_cast<int>(end); ++i)
+    out[i] += w * in[i * s + off];
+}
+
+/**
+ * @brief out[i * stride + off] += w * in[i] for i in [begin, end)
+ */
+template <unsigned int STRIDE, typename T>
+inline void scatterRow(T w, const T *__restrict in, int off,
+                       unsigned int stride, T *__restrict out,
+                       unsigned int begin, unsigned int end) {
+  const int s = static_cast<int>(STRIDE ? STRIDE : stride);
+  for (int i = begin; i < static_cast<int>(end); ++i)
+    out[i * s + off] += w * in[i];
+}
+
+/**
+ * @brief acc[i] += dy[i] * in[i * stride + off] for i in [begin, end). The
+ * reduction to a single kernel tap is left to the caller so that this loop
+ * vectorizes without reassociating a sum.
+ */
+template <unsigned int STRIDE, typename T>
+inline void productRow(const T *__restrict dy, const T *__restrict in, int off,
+                       unsigned int stride, float *__restrict acc,
+                       unsigned int begin, unsigned int end) {
+  const int s = static_cast<int>(STRIDE ? STRIDE : stride);
+  for (int i = begin; i < static_cast<int>(end); ++i)
+    acc[i] += static_cast<float>(dy[i]) * static_cast<float>(in[i * s + off]);
+}
+
+/**
+ * @brief output plane = bias + sum over taps of tap * shifted input plane.
+ * One output row stays in cache while every kernel tap is added to it.
+ */
+template <unsigned int STRIDE, typename T>
+void forwardPlane(const PlaneGeometry &g, const T *in, const T *kernel, T bias,
+                  T *out) {
+  for (unsigned int oh = 0; oh < g.out_h; ++oh) {
+    T *out_row = out + oh * g.out_w;
+    std::fill(out_row, out_row + g.out_w, bias);
+    for (unsigned int kh = 0; kh < g.k_h; ++kh) {
+      int ih = g.inputRow(oh, kh);
+      if (ih < 0)
+        continue;
+      const T *in_row = in + ih * g.in_w;
+      const T *k_row = kernel + kh * g.k_w;
+      for (unsigned int kw = 0; kw < g.k_w; ++kw)
+        gatherRow<STRIDE>(k_row[kw], in_row, g.col_offset[kw], g.stride_w,
+                          out_row, g.col_begin[kw], g.col_end[kw]);
+    }
+  }
+}
+
+/**
+ * @brief input derivative plane += derivative plane scattered through the
+ * kernel. The caller zeroes the input derivative first.
+ */
+template <unsigned int STRIDE, typename T>
+void derivativePlane(const PlaneGeometry &g, const T *deriv, const T *kernel,
+                     T *in_deriv) {
+  for (unsigned int oh = 0; oh < g.out_h; ++oh) {
+    const T *d_row = deriv + oh * g.out_w;
+    for (unsigned int kh = 0; kh < g.k_h; ++kh) {
+      int ih = g.inputRow(oh, kh);
+      if (ih < 0)
+        continue;
+      T *in_row = in_deriv + ih * g.in_w;
+      const T *k_row = kernel + kh * g.k_w;
+      for (unsigned int kw = 0; kw < g.k_w; ++kw)
+        scatterRow<STRIDE>(k_row[kw], d_row, g.col_offset[kw], g.stride_w,
+                           in_row, g.col_begin[kw], g.col_end[kw]);
+    }
+  }
+}
+
+/**
+ * @brief acc[tap][ow] += derivative * input for every tap of one plane. acc
+ * holds k_h * k_w rows of out_w partial sums.
+ */
+template <unsigned int STRIDE, typename T>
+void gradientPlane(const PlaneGeometry &g, const T *deriv, const T *in,
+                   float *acc) {
+  for (unsigned int oh = 0; oh < g.out_h; ++oh) {
+    const T *d_row = deriv + oh * g.out_w;
+    for (unsigned int kh = 0; kh < g.k_h; ++kh) {
+      int ih = g.inputRow(oh, kh);
+      if (ih < 0)
+        continue;
+      const T *in_row = in + ih * g.in_w;
+      float *acc_row = acc + kh * g.k_w * g.out_w;
+      for (unsigned int kw = 0; kw < g.k_w; ++kw)
+        productRow<STRIDE>(d_row, in_row, g.col_offset[kw], g.stride_w,
+                           acc_row + kw * g.out_w, g.col_begin[kw],
+                           g.col_end[kw]);
+    }
+  }
+}
+
+/**
+ * @brief call @a fn with the compile time stride matching @a stride. Strides
+ * 1 and 2 cover nearly every depthwise convolution in practice.
+ */
+template <typename Fn> void dispatchStride(unsigned int stride, Fn &&fn) {
+  if (stride == 1)
+    fn(std::integral_constant<unsigned int, 1>());
+  else if (stride == 2)
+    fn(std::integral_constant<unsigned int, 2>());
+  else
+    fn(std::integral_constant<unsigned int, 0>());
+}
+
+/**
+ * @brief number of planes a chunk should carry given the work of one plane
+ */
+unsigned int planeGrain(size_t plane_work) {
+  return static_cast<unsigned int>(
+    std::max<size_t>(1, MIN_CHUNK_WORK / std::max<size_t>(1, plane_work)));
+}
+
+template <typename T>
+void depthwiseForward(const PlaneGeometry &g, const Tensor &input,
+                      const Tensor &kernel, const Tensor *bias,
+                      Tensor &output) {
+  const unsigned int channels = input.channel();
+  const unsigned int filters = output.channel();
+  const unsigned int multiplier = filters / channels;
+  const size_t in_plane = static_cast<size_t>(g.in_h) * g.in_w;
+  const size_t out_plane = static_cast<size_t>(g.out_h) * g.out_w;
+  const size_t k_plane = static_cast<size_t>(g.k_h) * g.k_w;
+
+  const T *in = input.getData<T>();
+  const T *k = kernel.getData<T>();
+  const T *b = bias ? bias->getData<T>() : nullptr;
+  T *out = output.getData<T>();
+
+  dispatchStride(g.stride_w, [&](auto stride) {
+    auto run = [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int p = start; p < end; ++p) {
+        unsigned int f = p % filters;
+        unsigned int n = p / filters;
+        size_t c = static_cast<size_t>(n) * channels + f / multiplier;
+        forwardPlane<decltype(stride)::value>(
+          g, in + c * in_plane, k + f * k_plane, b ? b[f] : static_cast<T>(0),
+          out + static_cast<size_t>(p) * out_plane);
+      }
+    };
+    ThreadPool::Global().parallelFor(0, input.batch() * filters,
+                                     planeGrain(out_plane * k_plane), run);
+  });
+}
+
+template <typename T>
+void depthwiseDerivative(const PlaneGeometry &g, const Tensor &deriv,
+                         const Tensor &kernel, Tensor &in_deriv) {
+  const unsigned int channels = in_deriv.channel();
+  const unsigned int filters = deriv.channel();
+  const unsigned int multiplier = filters / channels;
+  const size_t in_plane = static_cast<size_t>(g.in_h) * g.in_w;
+  const size_t out_plane = static_cast<size_t>(g.out_h) * g.out_w;
+  const size_t k_plane = static_cast<size_t>(g.k_h) * g.k_w;
+
+  const T *d = deriv.getData<T>();
+  const T *k = kernel.getData<T>();
+  T *dx = in_deriv.getData<T>();
+
+  /** an input plane gathers from all of its filters, so it is the work unit */
+  dispatchStride(g.stride_w, [&](auto stride) {
+    auto run = [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int p = start; p < end; ++p) {
+        unsigned int c = p % channels;
+        unsigned int n = p / channels;
+        T *dx_plane = dx + static_cast<size_t>(p) * in_plane;
+        std::fill(dx_plane, dx_plane + in_plane, static_cast<T>(0));
+        for (unsigned int m = 0; m < multiplier; ++m) {
+          size_t f = static_cast<size_t>(c) * multiplier + m;
+          derivativePlane<decltype(stride)::value>(
+            g, d + (static_cast<size_t>(n) * filters + f) * out_plane,
+            k + f * k_plane, dx_plane);
+        }
+      }
+    };
+    ThreadPool::Global().parallelFor(
+      0, in_deriv.batch() * channels,
+      planeGrain(out_plane * k_plane * multiplier), run);
+  });
+}
+
+template <typename T>
+void depthwiseGradient(const PlaneGeometry &g, const Tensor &deriv,
+                       const Tensor &input, Tensor &kernel_grad) {
+  const unsigned int channels = input.channel();
+  const unsigned int filters = deriv.channel();
+  const unsigned int multiplier = filters / channels;
+  const unsigned int batch = input.batch();
+  const size_t in_plane = static_cast<size_t>(g.in_h) * g.in_w;
+  const size_t out_plane = static_cast<size_t>(g.out_h) * g.out_w;
+  const size_t k_plane = static_cast<size_t>(g.k_h) * g.k_w;
+
+  const T *d = deriv.getData<T>();
+  const T *in = input.getData<T>();
+  T *dk = kernel_grad.getData<T>();
+
+  /** a filter reduces over the whole batch, so filters are the work unit */
+  dispatchStride(g.stride_w, [&](auto stride) {
+    auto run = [&](unsigned int start, unsigned int end, unsigned int) {
+      std::vector<float> acc(k_plane * g.out_w);
+      for (unsigned int f = start; f < end; ++f) {
+        std::fill(acc.begin(), acc.end(), 0.0f);
+        unsigned int c = f / multiplier;
+        for (unsigned int n = 0; n < batch; ++n)
+          gradientPlane<decltype(stride)::value>(
+            g, d + (static_cast<size_t>(n) * filters + f) * out_plane,
+            in + (static_cast<size_t>(n) * channels + c) * in_plane,
+            acc.data());
+
+        for (size_t t = 0; t < k_plane; ++t) {
+          const float *row = acc.data() + t * g.out_w;
+          float sum = 0.0f;
+          for (unsigned int i = 0; i < g.out_w; ++i)
+            sum += row[i];
+          dk[f * k_plane + t] = static_cast<T>(sum);
+        }
+      }
+    };
+    ThreadPool::Global().parallelFor(
+      0, filters, planeGrain(out_plane * k_plane * batch), run);
+  });
+}
+
+} // namespace
+
+enum DepthwiseConvParams { weight, bias };
+
+DepthwiseConv2DLayer::DepthwiseConv2DLayer(
+  const std::array<unsigned int, DEPTHWISE_CONV2D_DIM * 2> &padding_) :
+  LayerImpl(),
+  padding(padding_),
+  depthwise_conv_props(
+    props::FilterSize(), std::array<props::KernelSize, DEPTHWISE_CONV2D_DIM>(),
+    std::array<props::Stride, DEPTHWISE_CONV2D_DIM>(), props::Padding2D(),
+    std::array<props::Dilation, DEPTHWISE_CONV2D_DIM>()) {
+  wt_idx.fill(std::numeric_limits<unsigned>::max());
+}
+
+void DepthwiseConv2DLayer::finalize(InitLayerContext &context) {
+  NNTR_THROW_IF(context.getNumInputs() != 1, std::invalid_argument)
+    << "Depthwise convolution layer takes only one input";
+
+  const TensorDim &in_dim = context.getInputDimensions()[0];
+
+  NNTR_THROW_IF(in_dim.getFormat() != TensorDim::Format::NCHW,
+                std::invalid_argument)
+    << "Depthwise convolution supports NCHW only, layer: "
+    << context.getName();
+
+  NNTR_THROW_IF(context.getWeightDataType() !=
+                  context.getActivationDataType(),
+                std::invalid_argument)
+    << "Depthwise convolution needs the same weight and activation data "
+       "type, layer: "
+    << context.getName();
+
+  auto &weight_regularizer =
+    std::get<props::WeightRegularizer>(*layer_impl_props);
+  auto &weight_regularizer_constant =
+    std::get<props::WeightRegularizerConstant>(*layer_impl_props);
+  auto &weight_initializer =
+    std::get<props::WeightInitializer>(*layer_impl_props);
+  auto &weight_decay = std::get<props::WeightDecay>(*layer_impl_props);
+  auto &bias_decay = std::get<props::BiasDecay>(*layer_impl_props);
+  auto &bias_initializer = std::get<props::BiasInitializer>(*layer_impl_props);
+  auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
+
+  auto &filter_prop = std::get<props::FilterSize>(depthwise_conv_props);
+  unsigned int filter_size =
+    filter_prop.empty() ? in_dim.channel() : filter_prop.get();
+  NNTR_THROW_IF(filter_size % in_dim.channel() != 0, std::invalid_argument)
+    << "filters must be a multiple of the input channels, filters: "
+    << filter_size << " channels: " << in_dim.channel()
+    << " layer: " << context.getName();
+
+  auto &kernel_size =
+    std::get<std::array<props::KernelSize, DEPTHWISE_CONV2D_DIM>>(
+      depthwise_conv_props);
+  auto &stride = std::get<std::array<props::Stride, DEPTHWISE_CONV2D_DIM>>(
+    depthwise_conv_props);
+  auto &dilation =
+    std::get<std::array<props::Dilation, DEPTHWISE_CONV2D_DIM>>(
+      depthwise_conv_props);
+
+  auto in_t_type = in_dim.getTensorType();
+  in_t_type.data_type = context.getWeightDataType();
+
+  TensorDim kernel_dim =
+    TensorDim(filter_size, 1, kernel_size[0], kernel_size[1], in_t_type);
+
+  TensorDim bias_dim = TensorDim(1, filter_size, 1, 1, in_t_type);
+
+  padding = std::get<props::Padding2D>(depthwise_conv_props)
+              .compute(in_dim, kernel_dim, {stride[0], stride[1]},
+                       {dilation[0], dilation[1]});
+
+  wt_idx[DepthwiseConvParams::weight] = context.requestWeight(
+    kernel_dim, weight_initializer, weight_regularizer,
+    weight_regularizer_constant, weight_decay, "filter", true, 0);
+
+  if (disable_bias.empty() || disable_bias.get() == false) {
+    wt_idx[DepthwiseConvParams::bias] =
+      context.requestWeight(bias_dim, bias_initializer, WeightRegularizer::NONE,
+                            1.0f, bias_decay, "bias", true, 0);
+  }
+
+  unsigned int eff_in_height = in_dim.height() + padding[0] + padding[1];
+  unsigned int eff_in_width = in_dim.width() + padding[2] + padding[3];
+
+  unsigned int eff_k_height = (kernel_size[0] - 1) * dilation[0] + 1;
+  unsigned int eff_k_width = (kernel_size[1] - 1) * dilation[1] + 1;
+
+  NNTR_THROW_IF(eff_in_height < eff_k_height || eff_in_width < eff_k_width,
+                std::invalid_argument)
+    << "Failed to initialize: in size + padding is smaller than effective "
+       "kernel";
+
+  TensorDim out_dim;
+  out_dim.batch(in_dim.batch());
+  out_dim.channel(filter_size);
+  out_dim.height((eff_in_height - eff_k_height) / stride[0] + 1);
+  out_dim.width((eff_in_width - eff_k_width) / stride[1] + 1);
+
+  out_dim.setTensorType(in_dim.getTensorType());
+
+  context.setOutputDimensions({out_dim});
+}
+
+void DepthwiseConv2DLayer::forwarding(RunLayerContext &context,
+                                      bool training) {
+  auto &stride = std::get<std::array<props::Stride, DEPTHWISE_CONV2D_DIM>>(
+    depthwise_conv_props);
+  auto &dilation =
+    std::get<std::array<props::Dilation, DEPTHWISE_CONV2D_DIM>>(
+      depthwise_conv_props);
+
+  Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
+  Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
+  Tensor &filter_kernel =
+    context.getWeight(wt_idx[DepthwiseConvParams::weight]);
+  Tensor *bias_kernel = nullptr;
+  if (auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
+      disable_bias.empty() || disable_bias.get() == false) {
+    bias_kernel = &context.getWeight(wt_idx[DepthwiseConvParams::bias]);
+  }
+
+  PlaneGeometry g =
+    makeGeometry(input_.getDim(), hidden_.getDim(), filter_kernel.getDim(),
+                 padding, stride[0], stride[1], dilation[0], dilation[1]);
+
+  if (input_.getDataType() == TensorDim::DataType::FP32) {
+    depthwiseForward<float>(g, input_, filter_kernel, bias_kernel, hidden_);
+  } else if (input_.getDataType() == TensorDim::DataType::FP16) {
+#ifdef ENABLE_FP16
+    depthwiseForward<_FP16>(g, input_, filter_kernel, bias_kernel, hidden_);
+#else
+    throw std::invalid_argument("Error: enable-fp16 is not enabled");
+#endif
+  } else {
+    throw std::invalid_argument(
+      "[DepthwiseConv2D] only FP32 and FP16 are supported");
+  }
+}
+
+void DepthwiseConv2DLayer::calcDerivative(RunLayerContext &context) {
+  auto &stride = std::get<std::array<props::Stride, DEPTHWISE_CONV2D_DIM>>(
+    depthwise_conv_props);
+  auto &dilation =
+    std::get<std::array<props::Dilation, DEPTHWISE_CONV2D_DIM>>(
+      depthwise_conv_props);
+
+  const Tensor &derivative = context.getIncomingDerivative(SINGLE_INOUT_IDX);
+  Tensor &input_derivative = context.getOutgoingDerivative(SINGLE_INOUT_IDX);
+  Tensor &filter_kernel =
+    context.getWeight(wt_idx[DepthwiseConvParams::weight]);
+
+  PlaneGeometry g = makeGeometry(
+    input_derivative.getDim(), derivative.getDim(), filter_kernel.getDim(),
+    padding, stride[0], stride[1], dilation[0], dilation[1]);
+
+  if (derivative.getDataType() == TensorDim::DataType::FP32) {
+    depthwiseDerivative<float>(g, derivative, filter_kernel, input_derivative);
+  } else if (derivative.getDataType() == TensorDim::DataType::FP16) {
+#ifdef ENABLE_FP16
+    depthwiseDerivative<_FP16>(g, derivative, filter_kernel, input_derivative);
+#else
+    throw std::invalid_argument("Error: enable-fp16 is not enabled");
+#endif
+  } else {
+    throw std::invalid_argument(
+      "[DepthwiseConv2D] only FP32 and FP16 are supported");
+  }
+}
+
+void DepthwiseConv2DLayer::calcGradient(RunLayerContext &context) {
+  auto &stride = std::get<std::array<props::Stride, DEPTHWISE_CONV2D_DIM>>(
+    depthwise_conv_props);
+  auto &dilation =
+    std::get<std::array<props::Dilation, DEPTHWISE_CONV2D_DIM>>(
+      depthwise_conv_props);
+
+  const Tensor &derivative = context.getIncomingDerivative(SINGLE_INOUT_IDX);
+  Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
+  Tensor &delK = context.getWeightGrad(wt_idx[DepthwiseConvParams::weight]);
+
+  PlaneGeometry g =
+    makeGeometry(input_.getDim(), derivative.getDim(), delK.getDim(), padding,
+                 stride[0], stride[1], dilation[0], dilation[1]);
+
+  if (derivative.getDataType() == TensorDim::DataType::FP32) {
+    depthwiseGradient<float>(g, derivative, input_, delK);
+  } else if (derivative.getDataType() == TensorDim::DataType::FP16) {
+#ifdef ENABLE_FP16
+    depthwiseGradient<_FP16>(g, derivative, input_, delK);
+#else
+    throw std::invalid_argument("Error: enable-fp16 is not enabled");
+#endif
+  } else {
+    throw std::invalid_argument(
+      "[DepthwiseConv2D] only FP32 and FP16 are supported");
+  }
+
+  if (auto &disable_bias = std::get<props::DisableBias>(*layer_impl_props);
+      disable_bias.empty() || disable_bias.get() == false) {
+    Tensor &delBias = context.getWeightGrad(wt_idx[DepthwiseConvParams::bias]);
+    delBias.setZero();
+    derivative.sum({0, 2, 3}, delBias);
+  }
+}
+
+void DepthwiseConv2DLayer::exportTo(
+  Exporter &exporter, const ml::train::ExportMethods &method) const {
+  LayerImpl::exportTo(exporter, method);
+  exporter.saveResult(depthwise_conv_props, method, this);
+}
+
+void DepthwiseConv2DLayer::setProperty(const std::vector<std::string> &values) {
+  auto remain_props = loadProperties(values, depthwise_conv_props);
+  LayerImpl::setProperty(remain_props);
+}
+
+} /* namespace nntrainer */
@@ -27,6 +27,11 @@ constexpr const unsigned int DEPTHWISE_CONV2D_DIM = 2;
 /**
  * @class   Depthwise Convolution 2D Layer
  * @brief   Depthwise Convolution 2D Layer
+ *
+ * Each input channel is convolved with its own filters. filters defaults to
+ * the number of input channels and must be a multiple of it; output channel
+ * o reads input channel o / (filters / channels). The kernel is stored as
+ * filters:1:kernel_height:kernel_width and only NCHW is supported.
  */
 class DepthwiseConv2DLayer : public LayerImpl {
 public:
@@ -34,7 +39,8 @@ public:
    * @brief     Constructor of Depthwise Convolution 2D Layer
    */
   DepthwiseConv2DLayer(
-    const std::array<unsigned int, CONV2D_DIM * 2> &padding_ = {0, 0, 0, 0});
+    const std::array<unsigned int, DEPTHWISE_CONV2D_DIM * 2> &padding_ = {
+      0, 0, 0, 0});
 
   /**
    * @brief     Destructor of Depthwise Convolution 2D Layer
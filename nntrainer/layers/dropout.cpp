@@ -26,13 +26,24 @@ void DropOutLayer::finalize(InitLayerContext &context) {
   auto const &input_dims = context.getInputDimensions();
   context.setOutputDimensions(input_dims);
 
+  /// the mask keeps one bit per element, a row of words for each batch
   mask_idx.reserve(input_dims.size());
   for (auto &t : input_dims) {
-    mask_idx.push_back(context.requestTensor(
-      t, "Mask", Initializer::NONE, false, TensorLifespan::ITERATION_LIFESPAN));
+    TensorDim mask_dim(t.batch(), 1, 1, (t.getFeatureLen() + 31) / 32,
+                       t.getFormat(), TensorDim::DataType::UINT32);
+    mask_idx.push_back(
+      context.requestTensor(mask_dim, "Mask", Initializer::NONE, false,
+                            TensorLifespan::ITERATION_LIFESPAN));
   }
 }
 
+/**
+ * @brief multiplier of the kept elements
+ */
+static float keepScale(float rate) {
+  return rate < 1.0f ? 1.0f / (1.0f - rate) : 0.0f;
+}
+
 void DropOutLayer::forwarding(RunLayerContext &context, bool training) {
   auto &rate_ = std::get<props::DropOutRate>(dropout_rate).get();
 
@@ -48,10 +59,10 @@ void DropOutLayer::forwarding(RunLayerContext &context, bool training) {
     if (training && rate_ > epsilon) {
       Tensor &mask_ = context.getTensor(mask_idx[i]);
       if (!context.reStoreData()) {
-        mask_.dropout_mask(rate_);
+        mask_.setRandBitmask(1.0f - rate_);
       }
 
-      input_.multiply(mask_, output_);
+      input_.multiply_bitmask(mask_, keepScale(rate_), 0.0f, output_);
     } else {
       output_.fill(input_);
     }
@@ -69,7 +80,7 @@ void DropOutLayer::calcDerivative(RunLayerContext &context) {
     /** @todo make this in-place */
     if (rate_ > epsilon) {
       Tensor &mask_ = context.getTensor(mask_idx[i]);
-      derivative_.multiply(mask_, ret_);
+      derivative_.multiply_bitmask(mask_, keepScale(rate_), 0.0f, ret_);
     } else {
       ret_.fill(derivative_);
     }
@@ -17,6 +17,7 @@
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
 #include <node_exporter.h>
+#include <tensor_view.h>
 #include <util_func.h>
 
 #include <iostream>
@@ -27,6 +28,37 @@ static constexpr size_t SINGLE_INOUT_IDX = 0;
 
 enum EmbeddingParams { weight };
 
+namespace {
+
+/**
+ * @brief copy the embedding of the words in [from, to) of every batch to the
+ * output rows from the first row. Rows are views, so nothing is allocated per
+ * word.
+ */
+template <typename W, typename O>
+void embedWords(const Tensor &weight, const Tensor &input, Tensor &hidden,
+                unsigned int from, unsigned int to) {
+  TensorView<const W> table(weight);
+  TensorView<O> output(hidden);
+  const unsigned int in_dim = table.height();
+
+  for (unsigned int b = 0; b < input.batch(); ++b) {
+    const float *in_data =
+      input.getAddress<float>(b * input.getDim().getFeatureLen());
+
+    for (unsigned int i = from; i < to; ++i) {
+      unsigned int embed_idx = static_cast<unsigned int>(in_data[i]);
+      if (embed_idx >= in_dim) {
+        throw std::invalid_argument("input word index is greater than in_dim");
+      }
+
+      output.getRow(b, 0, i - from).copyData(table.getRow(0, 0, embed_idx));
+    }
+  }
+}
+
+} // namespace
+
 EmbeddingLayer::EmbeddingLayer() :
   LayerImpl(),
   embedding_props(props::InDim(), props::OutDim()),
@@ -82,44 +114,13 @@ void EmbeddingLayer::setProperty(const std::vector<std::string> &values) {
 }
 
 void EmbeddingLayer::forwarding(RunLayerContext &context, bool training) {
-  /// @todo get input and output dimension from input_ and hidden itself
-  unsigned int in_dim = std::get<props::InDim>(embedding_props);
-  unsigned int out_dim = std::get<props::OutDim>(embedding_props);
-
-  Tensor &weight = context.getWeight(weight_idx);
-  Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
-  TensorDim out_tensor_dim =
-    TensorDim({1, 1, 1, out_dim}, hidden_.getTensorType());
-
-  for (unsigned int b = 0; b < input_.batch(); ++b) {
-    float *in_data =
-      input_.getAddress<float>(b * input_.getDim().getFeatureLen());
-
-    Tensor batchsliced_hidden = hidden_.getBatchSlice(b, 1);
-    for (unsigned int i = 0; i < input_.width(); ++i) {
-      unsigned int embed_idx = static_cast<unsigned int>(in_data[i]);
-      if (embed_idx >= in_dim) {
-        throw std::invalid_argument("input word index is greater than in_dim");
-      }
-
-      Tensor cur_weight =
-        weight.getSharedDataTensor(out_tensor_dim, out_dim * embed_idx);
-      Tensor out_tensor =
-        batchsliced_hidden.getSharedDataTensor(out_tensor_dim, out_dim * i);
-      out_tensor.copyData(cur_weight);
-    }
-  }
+  lookup(context, 0, input_.width());
 }
 
 void EmbeddingLayer::incremental_forwarding(RunLayerContext &context,
                                             unsigned int from, unsigned int to,
                                             bool training) {
-
-  /// @todo get input and output dimension from input_ and hidden itself
-  unsigned int in_dim = std::get<props::InDim>(embedding_props);
-  unsigned int out_dim = std::get<props::OutDim>(embedding_props);
-
   if (from) {
     NNTR_THROW_IF(to - from != 1, std::invalid_argument)
       << "incremental step size is not 1";
@@ -127,32 +128,35 @@ void EmbeddingLayer::incremental_forwarding(RunLayerContext &context,
     to = 1;
   }
 
+  lookup(context, from, to);
+}
+
+void EmbeddingLayer::lookup(RunLayerContext &context, unsigned int from,
+                            unsigned int to) {
   Tensor &weight = context.getWeight(weight_idx);
   Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
 
-  TensorDim out_tensor_dim =
-    TensorDim({1, 1, 1, out_dim}, hidden_.getTensorType());
-
-  for (unsigned int b = 0; b < input_.batch(); ++b) {
-    float *in_data =
-      input_.getAddress<float>(b * input_.getDim().getFeatureLen());
-
-    Tensor batchsliced_hidden = hidden_.getBatchSlice(b, 1);
-    for (unsigned int i = from; i < to; ++i) {
-      unsigned int embed_idx = static_cast<unsigned int>(in_data[i]);
-      if (embed_idx >= in_dim) {
-        throw std::invalid_argument("input word index is greater than in_dim");
-      }
-
-      Tensor cur_weight =
-        weight.getSharedDataTensor(out_tensor_dim, out_dim * embed_idx);
-
-      Tensor out_tensor = batchsliced_hidden.getSharedDataTensor(
-        out_tensor_dim, out_dim * (i - from));
+  const Tdatatype weight_type = weight.getDataType();
+  const Tdatatype hidden_type = hidden_.getDataType();
 
-      out_tensor.copyData(cur_weight);
-    }
+  if (weight_type == Tdatatype::FP32 && hidden_type == Tdatatype::FP32) {
+    embedWords<float, float>(weight, input_, hidden_, from, to);
+  }
+#ifdef ENABLE_FP16
+  else if (weight_type == Tdatatype::FP16 && hidden_type == Tdatatype::FP16) {
+    embedWords<_FP16, _FP16>(weight, input_, hidden_, from, to);
+  } else if (weight_type == Tdatatype::FP32 &&
+             hidden_type == Tdatatype::FP16) {
+    embedWords<float, _FP16>(weight, input_, hidden_, from, to);
+  } else if (weight_type == Tdatatype::FP16 &&
+             hidden_type == Tdatatype::FP32) {
+    embedWords<_FP16, float>(weight, input_, hidden_, from, to);
+  }
+#endif
+  else {
+    throw std::invalid_argument(
+      "Embedding layer supports FP32 and FP16 weight and output only");
   }
 }
 
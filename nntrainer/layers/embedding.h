@@ -106,6 +106,15 @@ public:
 private:
   std::tuple<props::InDim, props::OutDim> embedding_props;
   unsigned int weight_idx;
+
+  /**
+   * @brief copy the embedding of the words in [from, to) to the output
+   *
+   * @param context context of the layer
+   * @param from first word
+   * @param to one past the last word
+   */
+  void lookup(RunLayerContext &context, unsigned int from, unsigned int to);
 };
 } // namespace nntrainer
 
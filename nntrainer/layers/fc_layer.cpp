@@ -23,6 +23,7 @@
 
 #include <common_properties.h>
 #include <fc_layer.h>
+#include <folded_batch_norm.h>
 #include <layer_context.h>
 #include <lazy_tensor.h>
 #include <nntrainer_error.h>
@@ -42,9 +43,11 @@ enum LORAParams { loraA, loraB, loraTmp, loraOut };
 FullyConnectedLayer::FullyConnectedLayer() :
   LayerImpl(),
   lora_scaling(1.0f),
-  fc_props(props::Unit(), props::LoraRank(), props::LoraAlpha()) {
+  fc_props(props::Unit(), props::LoraRank(), props::LoraAlpha(),
+           props::FoldedBatchNormEpsilon(), props::FusedActivation()) {
   weight_idx.fill(std::numeric_limits<unsigned>::max());
   lora_idx.fill(std::numeric_limits<unsigned>::max());
+  bn_idx.fill(std::numeric_limits<unsigned>::max());
 }
 
 void FullyConnectedLayer::finalize(InitLayerContext &context) {
@@ -162,6 +165,38 @@ void FullyConnectedLayer::finalize(InitLayerContext &context) {
       context.requestTensor(loraOut_dim, "hidden_lora", Initializer::NONE, true,
                             TensorLifespan::FORWARD_FUNC_LIFESPAN);
   }
+
+  auto &folded_bn_epsilon = std::get<props::FoldedBatchNormEpsilon>(fc_props);
+  auto &fused_activation = std::get<props::FusedActivation>(fc_props);
+  NNTR_THROW_IF((!folded_bn_epsilon.empty() || !fused_activation.empty()) &&
+                  context.getExecutionMode() !=
+                    ml::train::ExecutionMode::INFERENCE,
+                std::invalid_argument)
+    << "folded batch normalization and fused activation are only for "
+       "inference, layer: "
+    << context.getName();
+
+  if (!folded_bn_epsilon.empty()) {
+    NNTR_THROW_IF(weight_idx[FCParams::bias] ==
+                    std::numeric_limits<unsigned>::max() ||
+                  lora_rank,
+                  std::invalid_argument)
+      << "folding batch normalization needs bias and no lora, layer: "
+      << context.getName();
+    bn_idx = requestFoldedBatchNorm(context, bias_dim);
+  }
+
+  if (!fused_activation.empty()) {
+    if (context.getActivationDataType() == TensorDim::DataType::FP32) {
+      fused_acti_func.setActiFunc<float>(fused_activation.get());
+    } else if (context.getActivationDataType() == TensorDim::DataType::FP16) {
+#ifdef ENABLE_FP16
+      fused_acti_func.setActiFunc<_FP16>(fused_activation.get());
+#else
+      throw std::invalid_argument("Error: enable-fp16 is not enabled");
+#endif
+    }
+  }
 }
 
 void FullyConnectedLayer::exportTo(
@@ -185,27 +220,18 @@ void FullyConnectedLayer::setBatch(nntrainer::RunLayerContext &context,
 }
 
 void FullyConnectedLayer::forwarding(RunLayerContext &context, bool training) {
+  if (auto &epsilon = std::get<props::FoldedBatchNormEpsilon>(fc_props);
+      !epsilon.empty()) {
+    foldBatchNorm(context, bn_idx, epsilon, weight_idx[FCParams::weight],
+                  weight_idx[FCParams::bias]);
+  }
+
   Tensor &weight = context.getWeight(weight_idx[FCParams::weight]);
   Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
 
-  if (weight.getDataType() == nntrainer::Tdatatype::QINT4 ||
-      weight.getDataType() == nntrainer::Tdatatype::QINT8) {
-    Tdatatype dtype = input_.getDataType();
-
-    Tensor weight_(
-      {{weight.batch(), weight.channel(), weight.height(), weight.width()},
-       {weight.getFormat(), dtype}},
-      true);
-
-    unsigned int axis =
-      context.getWeightObject(weight_idx[FCParams::weight]).getOutputAxis();
-
-    // weight.dequantize(weight_, axis);
-    input_.dot(weight_, hidden_, false, false);
-  } else {
-    input_.dot(weight, hidden_, false, false);
-  }
+  /// QINT8 and QINT4 weights are dequantized tile by tile inside dot()
+  input_.dot(weight, hidden_, false, false);
 
   if (!std::get<props::LoraRank>(fc_props).empty()) {
     Tensor &loraA = context.getWeight(lora_idx[LORAParams::loraA]);
@@ -224,12 +250,21 @@ void FullyConnectedLayer::forwarding(RunLayerContext &context, bool training) {
     Tensor &bias = context.getWeight(weight_idx[FCParams::bias]);
     hidden_.add_i(bias);
   }
+
+  if (!std::get<props::FusedActivation>(fc_props).empty())
+    fused_acti_func.run_fn(hidden_, hidden_);
 }
 
 void FullyConnectedLayer::incremental_forwarding(RunLayerContext &context,
                                                  unsigned int from,
                                                  unsigned int to,
                                                  bool training) {
+  if (auto &epsilon = std::get<props::FoldedBatchNormEpsilon>(fc_props);
+      !epsilon.empty()) {
+    foldBatchNorm(context, bn_idx, epsilon, weight_idx[FCParams::weight],
+                  weight_idx[FCParams::bias]);
+  }
+
   Tensor &weight = context.getWeight(weight_idx[FCParams::weight]);
   Tensor &input_ = context.getInput(SINGLE_INOUT_IDX);
   Tensor &hidden_ = context.getOutput(SINGLE_INOUT_IDX);
@@ -280,6 +315,9 @@ void FullyConnectedLayer::incremental_forwarding(RunLayerContext &context,
       Tensor &bias = context.getWeight(weight_idx[FCParams::bias]);
       hidden_step.add_i(bias);
     }
+
+    if (!std::get<props::FusedActivation>(fc_props).empty())
+      fused_acti_func.run_fn(hidden_step, hidden_step);
   }
 }
 
@@ -15,7 +15,9 @@
 #define __FC_LAYER_H__
 #ifdef __cplusplus
 
+#include <acti_func.h>
 #include <common_properties.h>
+#include <folded_batch_norm.h>
 #include <layer_impl.h>
 
 namespace nntrainer {
@@ -113,14 +115,19 @@ public:
 
 private:
   float lora_scaling;
-  std::tuple<props::Unit, props::LoraRank, props::LoraAlpha>
+  std::tuple<props::Unit, props::LoraRank, props::LoraAlpha,
+             props::FoldedBatchNormEpsilon, props::FusedActivation>
     fc_props;                             /**< fc layer properties :
                                                 unit - number of output neurons,
                                                 lora_rank - rank of lora (optional)
                                                 lora_scaling - scaling factor of LoRA apply, i.e.,
-                                             lora_scaling = alpha / lora_rank */
+                                             lora_scaling = alpha / lora_rank
+                                                folded_batch_norm_epsilon - epsilon of the folded batch normalization (optional)
+                                                fused_activation - activation applied to the output (optional) */
   std::array<unsigned int, 2> weight_idx; /**< indices of the weights */
   std::array<unsigned int, 4> lora_idx;   /**< indices of the lora weights */
+  FoldedBatchNormIdx bn_idx; /**< indices of the folded batch normalization */
+  ActiFunc fused_acti_func;  /**< activation fused into the output */
 };
 } // namespace nntrainer
 
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   folded_batch_norm.cpp
+ * @date   17 Oct 2026
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ * @brief  Batch normalization folded into the weight and bias of the
+ * preceding layer for inference
+ *
+ */
+
+#include <cmath>
+
+#include <folded_batch_norm.h>
+#include <layer_context.h>
+#include <nntrainer_error.h>
+
+namespace nntrainer {
+
+enum FoldedBNParams { mu, var, gamma, beta };
+
+FoldedBatchNormIdx requestFoldedBatchNorm(InitLayerContext &context,
+                                          const TensorDim &dim) {
+  FoldedBatchNormIdx idx;
+
+  idx[FoldedBNParams::mu] =
+    context.requestWeight(dim, Initializer::ZEROS, WeightRegularizer::NONE,
+                          1.0f, 0.0f, "moving_mean", false);
+  idx[FoldedBNParams::var] =
+    context.requestWeight(dim, Initializer::ONES, WeightRegularizer::NONE, 1.0f,
+                          0.0f, "moving_variance", false);
+  idx[FoldedBNParams::gamma] =
+    context.requestWeight(dim, Initializer::ONES, WeightRegularizer::NONE, 1.0f,
+                          0.0f, "gamma", false);
+  idx[FoldedBNParams::beta] =
+    context.requestWeight(dim, Initializer::ZEROS, WeightRegularizer::NONE,
+                          1.0f, 0.0f, "beta", false);
+
+  return idx;
+}
+
+void foldBatchNorm(RunLayerContext &context, const FoldedBatchNormIdx &idx,
+                   float epsilon, unsigned int weight_idx,
+                   unsigned int bias_idx) {
+  Tensor &weight = context.getWeight(weight_idx);
+  Tensor &bias = context.getWeight(bias_idx);
+
+  NNTR_THROW_IF(weight.getDataType() != Tdatatype::FP32 ||
+                  bias.getDataType() != Tdatatype::FP32,
+                std::invalid_argument)
+    << "folding batch normalization is only supported for FP32 weights";
+
+  float *mu = context.getWeight(idx[FoldedBNParams::mu]).getData<float>();
+  float *var = context.getWeight(idx[FoldedBNParams::var]).getData<float>();
+  float *gamma = context.getWeight(idx[FoldedBNParams::gamma]).getData<float>();
+  float *beta = context.getWeight(idx[FoldedBNParams::beta]).getData<float>();
+
+  /** (1 - epsilon) + epsilon is the unit variance of the identity */
+  const float identity_var = 1.0f - epsilon;
+  const unsigned int channels = bias.size();
+
+  bool identity = true;
+  for (unsigned int c = 0; c < channels && identity; ++c)
+    identity = mu[c] == 0.0f && var[c] == identity_var && gamma[c] == 1.0f &&
+               beta[c] == 0.0f;
+  if (identity)
+    return;
+
+  const unsigned int out_axis =
+    context.getWeightObject(weight_idx).getOutputAxis();
+  NNTR_THROW_IF(out_axis != 0 && out_axis != 3, std::invalid_argument)
+    << "folding batch normalization needs the channels on the outermost or the "
+       "innermost axis of the weight, axis: "
+    << out_axis;
+
+  float *w = weight.getData<float>();
+  float *b = bias.getData<float>();
+  const size_t per_channel = weight.size() / channels;
+
+  for (unsigned int c = 0; c < channels; ++c) {
+    const float scale = gamma[c] / std::sqrt(var[c] + epsilon);
+
+    if (out_axis == 0) {
+      float *row = w + c * per_channel;
+      for (size_t i = 0; i < per_channel; ++i)
+        row[i] *= scale;
+    } else {
+      for (size_t i = 0; i < per_channel; ++i)
+        w[i * channels + c] *= scale;
+    }
+    b[c] = (b[c] - mu[c]) * scale + beta[c];
+
+    mu[c] = 0.0f;
+    var[c] = identity_var;
+    gamma[c] = 1.0f;
+    beta[c] = 0.0f;
+  }
+}
+
+} // namespace nntrainer
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   folded_batch_norm.h
+ * @date   17 Oct 2026
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ * @brief  Batch normalization folded into the weight and bias of the
+ * preceding layer for inference
+ *
+ */
+
+#ifndef __FOLDED_BATCH_NORM_H__
+#define __FOLDED_BATCH_NORM_H__
+#ifdef __cplusplus
+
+#include <array>
+
+#include <tensor.h>
+
+namespace nntrainer {
+
+class InitLayerContext;
+class RunLayerContext;
+
+/**
+ * @brief indices of moving mean, moving variance, gamma and beta of the
+ * folded batch normalization
+ */
+using FoldedBatchNormIdx = std::array<unsigned int, 4>;
+
+/**
+ * @brief Request the statistics of the folded batch normalization. They are
+ * requested with the names and in the order of BatchNormalizationLayer, so the
+ * weights saved for the removed batch normalization layer are read into them.
+ * @note statistics are initialized as BatchNormalizationLayer does by default
+ *
+ * @param context context of the layer
+ * @param dim dimension of a statistic, same as the bias of the layer
+ * @return FoldedBatchNormIdx indices of the statistics
+ */
+FoldedBatchNormIdx requestFoldedBatchNorm(InitLayerContext &context,
+                                          const TensorDim &dim);
+
+/**
+ * @brief Fold the statistics into the weight and bias of the layer, then reset
+ * the statistics to the identity. Nothing is done while the statistics are the
+ * identity, so this is cheap to call on every forwarding and folds again once
+ * new statistics are read.
+ *
+ * @param context context of the layer
+ * @param idx indices of the statistics
+ * @param epsilon epsilon of the batch normalization
+ * @param weight_idx index of the weight, its output axis holds the channels
+ * @param bias_idx index of the bias
+ * @throw std::invalid_argument if the weight is not FP32
+ */
+void foldBatchNorm(RunLayerContext &context, const FoldedBatchNormIdx &idx,
+                   float epsilon, unsigned int weight_idx,
+                   unsigned int bias_idx);
+
+} // namespace nntrainer
+
+#endif /* __cplusplus */
+#endif /* __FOLDED_BATCH_NORM_H__ */
@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   fused_attention.cpp
+ * @date   17 Oct 2026
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ * @brief  Tiled scaled dot product attention with online softmax
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <cpu_backend.h>
+#include <fused_attention.h>
+#include <nntr_thread_pool.h>
+
+namespace nntrainer {
+
+namespace {
+
+constexpr unsigned int ROW_MAJOR = 0;
+constexpr unsigned int QUERY_TILE = 32; /**< query rows of a tile */
+constexpr unsigned int KEY_TILE = 64;   /**< key rows of a tile */
+constexpr float NEG_INF = -std::numeric_limits<float>::infinity();
+
+/**
+ * @brief number of keys of the tile starting at @a key_start that query
+ * @a row may attend
+ */
+unsigned int validKeys(const FusedAttentionArgs &args, unsigned int row,
+                       unsigned int key_start, unsigned int keys) {
+  if (args.causal_offset < 0)
+    return keys;
+
+  long last = static_cast<long>(row) + args.causal_offset;
+  if (last < static_cast<long>(key_start))
+    return 0;
+  return std::min<long>(keys, last - key_start + 1);
+}
+
+/**
+ * @brief compute the scaled and masked scores of a tile into @a scores
+ */
+void tileScores(const FusedAttentionArgs &args, const float *query,
+                const float *key, const float *mask, unsigned int row_start,
+                unsigned int rows, unsigned int key_start, unsigned int keys,
+                float *scores) {
+  const unsigned int ldq = args.num_heads * args.key_dim;
+
+  sgemm(ROW_MAJOR, false, true, rows, keys, args.key_dim, args.scale,
+        query + row_start * ldq, ldq, key + key_start * ldq, ldq, 0.0f, scores,
+        KEY_TILE);
+
+  if (mask) {
+    for (unsigned int r = 0; r < rows; ++r) {
+      const float *mask_row = mask + (row_start + r) * args.key_len + key_start;
+      float *score_row = scores + r * KEY_TILE;
+      for (unsigned int c = 0; c < keys; ++c)
+        score_row[c] += mask_row[c];
+    }
+  }
+}
+
+} // namespace
+
+void fusedAttentionForward(const FusedAttentionArgs &args) {
+  const unsigned int q_tiles = (args.query_len + QUERY_TILE - 1) / QUERY_TILE;
+  const unsigned int ldv = args.num_heads * args.value_dim;
+  const unsigned int dv = args.value_dim;
+
+  auto run = [&](unsigned int start, unsigned int end, unsigned int) {
+    std::vector<float> scores(QUERY_TILE * KEY_TILE);
+    std::vector<float> acc(QUERY_TILE * dv);
+    std::vector<float> row_max(QUERY_TILE);
+    std::vector<float> row_sum(QUERY_TILE);
+
+    for (unsigned int t = start; t < end; ++t) {
+      const unsigned int bh = t / q_tiles;
+      const unsigned int b = bh / args.num_heads;
+      const unsigned int h = bh % args.num_heads;
+      const unsigned int row_start = (t % q_tiles) * QUERY_TILE;
+      const unsigned int rows =
+        std::min(QUERY_TILE, args.query_len - row_start);
+
+      const float *query =
+        args.query + b * args.query_stride + h * args.key_dim;
+      const float *key = args.key + b * args.key_stride + h * args.key_dim;
+      const float *value = args.value + b * args.value_stride + h * dv;
+      const float *mask =
+        args.mask ? args.mask + static_cast<size_t>(bh) * args.query_len *
+                                  args.key_len
+                  : nullptr;
+      float *output = args.output + b * args.output_stride + h * dv;
+
+      std::fill(row_max.begin(), row_max.end(), NEG_INF);
+      std::fill(row_sum.begin(), row_sum.end(), 0.0f);
+      std::fill(acc.begin(), acc.end(), 0.0f);
+
+      for (unsigned int key_start = 0; key_start < args.key_len;
+           key_start += KEY_TILE) {
+        const unsigned int keys = std::min(KEY_TILE, args.key_len - key_start);
+        if (validKeys(args, row_start + rows - 1, key_start, keys) == 0)
+          break;
+
+        tileScores(args, query, key, mask, row_start, rows, key_start, keys,
+                   scores.data());
+
+        for (unsigned int r = 0; r < rows; ++r) {
+          float *score_row = scores.data() + r * KEY_TILE;
+          const unsigned int valid =
+            validKeys(args, row_start + r, key_start, keys);
+
+          float tile_max = NEG_INF;
+          for (unsigned int c = 0; c < valid; ++c)
+            tile_max = std::max(tile_max, score_row[c]);
+
+          const float new_max = std::max(row_max[r], tile_max);
+          if (new_max == NEG_INF) {
+            std::fill(score_row, score_row + keys, 0.0f);
+            continue;
+          }
+
+          float sum = 0.0f;
+          for (unsigned int c = 0; c < valid; ++c) {
+            score_row[c] = std::exp(score_row[c] - new_max);
+            sum += score_row[c];
+          }
+          std::fill(score_row + valid, score_row + keys, 0.0f);
+
+          /** rescale what is accumulated so far to the new maximum */
+          const float correction = std::exp(row_max[r] - new_max);
+          if (correction != 1.0f) {
+            float *acc_row = acc.data() + r * dv;
+            for (unsigned int d = 0; d < dv; ++d)
+              acc_row[d] *= correction;
+          }
+          row_sum[r] = row_sum[r] * correction + sum;
+          row_max[r] = new_max;
+        }
+
+        sgemm(ROW_MAJOR, false, false, rows, dv, keys, 1.0f, scores.data(),
+              KEY_TILE, value + key_start * ldv, ldv, 1.0f, acc.data(), dv);
+      }
+
+      for (unsigned int r = 0; r < rows; ++r) {
+        const float inv = row_sum[r] > 0.0f ? 1.0f / row_sum[r] : 0.0f;
+        const float *acc_row = acc.data() + r * dv;
+        float *out_row = output + (row_start + r) * ldv;
+        for (unsigned int d = 0; d < dv; ++d)
+          out_row[d] = acc_row[d] * inv;
+
+        if (args.row_stats) {
+          const size_t row =
+            static_cast<size_t>(bh) * args.query_len + row_start + r;
+          float *stats = args.row_stats + row * 2;
+          stats[0] = row_max[r];
+          stats[1] = row_sum[r];
+        }
+      }
+    }
+  };
+
+  ThreadPool::Global().parallelFor(0, args.batch * args.num_heads * q_tiles, 1,
+                                   run);
+}
+
+void fusedAttentionBackward(const FusedAttentionArgs &args,
+                            const float *d_output, float *d_query,
+                            float *d_key, float *d_value, float *d_mask) {
+  const unsigned int ldk = args.num_heads * args.key_dim;
+  const unsigned int ldv = args.num_heads * args.value_dim;
+  const unsigned int dk = args.key_dim;
+  const unsigned int dv = args.value_dim;
+
+  /**
+   * Query tiles of a head share the key and value gradients, so the heads are
+   * the unit of work.
+   */
+  auto run = [&](unsigned int start, unsigned int end, unsigned int) {
+    std::vector<float> probs(QUERY_TILE * KEY_TILE);
+    std::vector<float> d_scores(QUERY_TILE * KEY_TILE);
+    std::vector<float> d_query_tile(QUERY_TILE * dk);
+    std::vector<float> delta(args.query_len);
+
+    for (unsigned int bh = start; bh < end; ++bh) {
+      const unsigned int b = bh / args.num_heads;
+      const unsigned int h = bh % args.num_heads;
+      const size_t head_offset =
+        static_cast<size_t>(bh) * args.query_len * args.key_len;
+
+      const float *query = args.query + b * args.query_stride + h * dk;
+      const float *key = args.key + b * args.key_stride + h * dk;
+      const float *value = args.value + b * args.value_stride + h * dv;
+      const float *output = args.output + b * args.output_stride + h * dv;
+      const float *mask = args.mask ? args.mask + head_offset : nullptr;
+      const float *row_stats =
+        args.row_stats + static_cast<size_t>(bh) * args.query_len * 2;
+      const float *d_out = d_output + b * args.output_stride + h * dv;
+      float *d_q = d_query + b * args.query_stride + h * dk;
+      float *d_k = d_key + b * args.key_stride + h * dk;
+      float *d_v = d_value + b * args.value_stride + h * dv;
+      float *d_m = d_mask ? d_mask + head_offset : nullptr;
+
+      for (unsigned int j = 0; j < args.key_len; ++j) {
+        std::fill(d_k + j * ldk, d_k + j * ldk + dk, 0.0f);
+        std::fill(d_v + j * ldv, d_v + j * ldv + dv, 0.0f);
+      }
+      if (d_m)
+        std::fill(d_m, d_m + args.query_len * args.key_len, 0.0f);
+
+      /** rowsum(P o dP) == dO . O */
+      for (unsigned int i = 0; i < args.query_len; ++i) {
+        float sum = 0.0f;
+        for (unsigned int d = 0; d < dv; ++d)
+          sum += d_out[i * ldv + d] * output[i * ldv + d];
+        delta[i] = sum;
+      }
+
+      for (unsigned int row_start = 0; row_start < args.query_len;
+           row_start += QUERY_TILE) {
+        const unsigned int rows =
+          std::min(QUERY_TILE, args.query_len - row_start);
+        std::fill(d_query_tile.begin(), d_query_tile.end(), 0.0f);
+
+        for (unsigned int key_start = 0; key_start < args.key_len;
+             key_start += KEY_TILE) {
+          const unsigned int keys =
+            std::min(KEY_TILE, args.key_len - key_start);
+          if (validKeys(args, row_start + rows - 1, key_start, keys) == 0)
+            break;
+
+          tileScores(args, query, key, mask, row_start, rows, key_start, keys,
+                     probs.data());
+
+          for (unsigned int r = 0; r < rows; ++r) {
+            float *prob_row = probs.data() + r * KEY_TILE;
+            const float row_max = row_stats[(row_start + r) * 2];
+            const float row_sum = row_stats[(row_start + r) * 2 + 1];
+            const float inv = row_sum > 0.0f ? 1.0f / row_sum : 0.0f;
+            const unsigned int valid =
+              row_sum > 0.0f ? validKeys(args, row_start + r, key_start, keys)
+                             : 0;
+            for (unsigned int c = 0; c < valid; ++c)
+              prob_row[c] = std::exp(prob_row[c] - row_max) * inv;
+            std::fill(prob_row + valid, prob_row + keys, 0.0f);
+          }
+
+          /** dV += P^T dO */
+          sgemm(ROW_MAJOR, true, false, keys, dv, rows, 1.0f, probs.data(),
+                KEY_TILE, d_out + row_start * ldv, ldv, 1.0f,
+                d_v + key_start * ldv, ldv);
+
+          /** dP = dO V^T, dS = P o (dP - delta) */
+          sgemm(ROW_MAJOR, false, true, rows, keys, dv, 1.0f,
+                d_out + row_start * ldv, ldv, value + key_start * ldv, ldv,
+                0.0f, d_scores.data(), KEY_TILE);
+
+          for (unsigned int r = 0; r < rows; ++r) {
+            const float *prob_row = probs.data() + r * KEY_TILE;
+            float *d_score_row = d_scores.data() + r * KEY_TILE;
+            const float row_delta = delta[row_start + r];
+            for (unsigned int c = 0; c < keys; ++c)
+              d_score_row[c] = prob_row[c] * (d_score_row[c] - row_delta);
+
+            if (d_m)
+              std::copy(d_score_row, d_score_row + keys,
+                        d_m + (row_start + r) * args.key_len + key_start);
+          }
+
+          /** dQ += scale * dS K, dK += scale * dS^T Q */
+          sgemm(ROW_MAJOR, false, false, rows, dk, keys, args.scale,
+                d_scores.data(), KEY_TILE, key + key_start * ldk, ldk, 1.0f,
+                d_query_tile.data(), dk);
+          sgemm(ROW_MAJOR, true, false, keys, dk, rows, args.scale,
+                d_scores.data(), KEY_TILE, query + row_start * ldk, ldk, 1.0f,
+                d_k + key_start * ldk, ldk);
+        }
+
+        for (unsigned int r = 0; r < rows; ++r)
+          std::copy(d_query_tile.data() + r * dk,
+                    d_query_tile.data() + (r + 1) * dk,
+                    d_q + (row_start + r) * ldk);
+      }
+    }
+  };
+
+  ThreadPool::Global().parallelFor(0, args.batch * args.num_heads, 1, run);
+}
+
+} // namespace nntrainer
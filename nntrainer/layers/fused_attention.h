@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   fused_attention.h
+ * @date   17 Oct 2026
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ * @brief  Tiled scaled dot product attention with online softmax
+ *
+ */
+
+#ifndef __FUSED_ATTENTION_H__
+#define __FUSED_ATTENTION_H__
+#ifdef __cplusplus
+
+#include <cstddef>
+
+namespace nntrainer {
+
+/**
+ * @brief Arguments of the fused attention. Query, key, value and output are
+ * row-major (batch, length, num_heads * dim) with the heads interleaved in a
+ * row, as produced by the projections of MultiHeadAttentionLayer.
+ */
+struct FusedAttentionArgs {
+  unsigned int batch;     /**< batch size */
+  unsigned int num_heads; /**< number of heads */
+  unsigned int query_len; /**< number of query rows */
+  unsigned int key_len;   /**< number of key and value rows */
+  unsigned int key_dim;   /**< per head dim of query and key */
+  unsigned int value_dim; /**< per head dim of value and output */
+  float scale;            /**< scale of the scores */
+
+  const float *query;  /**< query */
+  size_t query_stride; /**< elements between the batches of query */
+  const float *key;    /**< key */
+  size_t key_stride;   /**< elements between the batches of key */
+  const float *value;  /**< value */
+  size_t value_stride; /**< elements between the batches of value */
+
+  /**
+   * mask added to the scaled scores, (batch, num_heads, query_len, key_len),
+   * nullptr if none
+   */
+  const float *mask;
+
+  /**
+   * if >= 0, key j is not attended by query i when j > i + causal_offset
+   */
+  int causal_offset;
+
+  float *output;        /**< output */
+  size_t output_stride; /**< elements between the batches of output */
+
+  /**
+   * maximum and sum of the exponentials of the scaled scores of each row,
+   * (batch, num_heads, query_len, 2). Written by the forward if not nullptr,
+   * read by the backward. They are kept apart since folding the sum into the
+   * maximum loses it when the maximum is large, e.g. in a fully masked row.
+   */
+  float *row_stats;
+};
+
+/**
+ * @brief Compute softmax(scale * Q * K^T + mask) * V of every head without
+ * materializing the scores. Query rows are processed in tiles, key tiles are
+ * folded into a running softmax. Tiles are spread over the global thread pool.
+ *
+ * @param args arguments
+ */
+void fusedAttentionForward(const FusedAttentionArgs &args);
+
+/**
+ * @brief Compute the gradients of the fused attention. The probabilities are
+ * recomputed tile by tile from args.row_stats, args.output must hold the
+ * output of the forward. Gradients have the layout of their forward tensors
+ * and are overwritten.
+ *
+ * @param args arguments given to the forward
+ * @param d_output gradient of the output
+ * @param[out] d_query gradient of the query
+ * @param[out] d_key gradient of the key
+ * @param[out] d_value gradient of the value
+ * @param[out] d_mask gradient of the mask, nullptr if not needed
+ */
+void fusedAttentionBackward(const FusedAttentionArgs &args,
+                            const float *d_output, float *d_query,
+                            float *d_key, float *d_value, float *d_mask);
+
+} // namespace nntrainer
+
+#endif /* __cplusplus */
+#endif /* __FUSED_ATTENTION_H__ */
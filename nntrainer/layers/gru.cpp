@@ -26,9 +26,14 @@
  *   xs------------------+--------+---------------+
  */
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
+
+#include <cpu_backend.h>
 #include <gru.h>
 #include <layer_context.h>
+#include <nntr_thread_pool.h>
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
 #include <node_exporter.h>
@@ -50,6 +55,294 @@ enum GRUParams {
   dropout_mask
 };
 
+namespace {
+
+constexpr unsigned int ROW_MAJOR = 0;
+
+/** minimum number of elements handled by a chunk of a timestep */
+constexpr unsigned int MIN_CHUNK_WORK = 1 << 14;
+
+/**
+ * @brief layout of the batched engine. Every tensor is batch first, so a
+ * sequence is a block of @a timestep rows and a timestep of all sequences is
+ * a strided matrix.
+ */
+struct GRUShape {
+  unsigned int batch;    /**< number of sequences */
+  unsigned int timestep; /**< rows of a sequence */
+  unsigned int unit;     /**< width of a hidden state row */
+  unsigned int gates;    /**< width of a zrg row */
+  bool reset_after;      /**< reset gate applies after the candidate gemm */
+
+  /**
+   * @brief elements between two sequences of the hidden state
+   */
+  size_t stateStride() const { return static_cast<size_t>(timestep) * unit; }
+
+  /**
+   * @brief elements between two sequences of zrg
+   */
+  size_t gateStride() const { return static_cast<size_t>(timestep) * gates; }
+
+  /**
+   * @brief sequences per chunk of the element-wise part of a timestep
+   */
+  unsigned int grain() const { return std::max(1u, MIN_CHUNK_WORK / gates); }
+};
+
+/**
+ * @brief check if the layer can run on the batched engine. The engine is
+ * fp32 and calls the simd kernels of both activations on raw rows.
+ */
+bool isBatchedGRU(const ActiFunc &acti_func,
+                  const ActiFunc &recurrent_acti_func, const Tensor &weight) {
+  return weight.getDataType() == TensorDim::DataType::FP32 &&
+         acti_func.getKernel() && acti_func.getPrimeKernel() &&
+         recurrent_acti_func.getKernel() &&
+         recurrent_acti_func.getPrimeKernel();
+}
+
+/**
+ * @brief forward recurrence of all sequences. @a zrg holds the input
+ * projection of every row on entry and the activated gates on exit. A
+ * timestep adds the previous hidden states of all sequences times the z, r
+ * columns of @a weight_hh with one gemm, runs the candidate gemm, then
+ * activates the gates and updates the states row by row.
+ *
+ * @param candidate_bias bias_hh of the candidate scaled by the reset gate,
+ * nullptr if none. Only read when reset_after is set.
+ * @param mask dropout mask, nullptr if none
+ * @param mask_step elements between the masks of two timesteps
+ */
+void forwardRecurrence(const GRUShape &s, ActiFunc::ActiKernel acti,
+                       ActiFunc::ActiKernel recurrent_acti,
+                       const float *weight_hh, const float *candidate_bias,
+                       float *zrg, float *hidden, const float *mask,
+                       unsigned int mask_step) {
+  const unsigned int unit = s.unit;
+  const size_t stride = s.stateStride();
+  const size_t gate_stride = s.gateStride();
+  const size_t mask_stride =
+    static_cast<size_t>(mask_step ? s.timestep : 1) * unit;
+  const float *weight_hg = weight_hh + unit * 2;
+
+  /** hidden part of the candidate, r * h_prev unless reset_after */
+  std::vector<float> candidate(static_cast<size_t>(s.batch) * unit);
+  std::vector<float> bias_g(unit, 0.0f);
+  if (candidate_bias && s.reset_after)
+    std::copy(candidate_bias, candidate_bias + unit, bias_g.begin());
+
+  for (unsigned int t = 0; t < s.timestep; ++t) {
+    float *gates_t = zrg + t * s.gates;
+    const float *prev = t ? hidden + (t - 1) * unit : nullptr;
+
+    if (prev)
+      sgemm(ROW_MAJOR, false, false, s.batch, unit * 2, unit, 1.0f, prev,
+            stride, weight_hh, s.gates, 1.0f, gates_t, gate_stride);
+
+    auto activate = [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b) {
+        float *z = gates_t + b * gate_stride;
+        recurrent_acti(unit * 2, z, z);
+        if (prev && !s.reset_after) {
+          const float *r = z + unit;
+          const float *h_prev = prev + b * stride;
+          float *c = candidate.data() + b * unit;
+          for (unsigned int u = 0; u < unit; ++u)
+            c[u] = r[u] * h_prev[u];
+        }
+      }
+    };
+    ThreadPool::Global().parallelFor(0, s.batch, s.grain(), activate);
+
+    if (prev && s.reset_after)
+      sgemm(ROW_MAJOR, false, false, s.batch, unit, unit, 1.0f, prev, stride,
+            weight_hg, s.gates, 0.0f, candidate.data(), unit);
+    else if (prev)
+      sgemm(ROW_MAJOR, false, false, s.batch, unit, unit, 1.0f,
+            candidate.data(), unit, weight_hg, s.gates, 1.0f,
+            gates_t + unit * 2, gate_stride);
+    else if (s.reset_after)
+      std::fill(candidate.begin(), candidate.end(), 0.0f);
+
+    auto update = [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b) {
+        float *z = gates_t + b * gate_stride;
+        const float *r = z + unit;
+        float *g = z + unit * 2;
+        float *h = hidden + b * stride + t * unit;
+
+        if (s.reset_after) {
+          const float *c = candidate.data() + b * unit;
+          for (unsigned int u = 0; u < unit; ++u)
+            g[u] += r[u] * (c[u] + bias_g[u]);
+        }
+        acti(unit, g, g);
+
+        if (prev) {
+          const float *h_prev = prev + b * stride;
+          for (unsigned int u = 0; u < unit; ++u)
+            h[u] = z[u] * h_prev[u] + g[u] * (1.0f - z[u]);
+        } else {
+          for (unsigned int u = 0; u < unit; ++u)
+            h[u] = g[u] * (1.0f - z[u]);
+        }
+
+        if (mask) {
+          const float *m = mask + b * mask_stride + t * mask_step;
+          for (unsigned int u = 0; u < unit; ++u)
+            h[u] *= m[u];
+        }
+      }
+    };
+    ThreadPool::Global().parallelFor(0, s.batch, s.grain(), update);
+  }
+}
+
+/**
+ * @brief backward recurrence of all sequences. @a d_hidden holds the
+ * incoming derivative of every timestep on entry, @a d_zrg gets the
+ * derivative of the gate inputs. The derivative of the previous hidden state
+ * and the gradient of @a weight_hh are accumulated with one gemm per
+ * timestep and term.
+ *
+ * @param d_candidate_bias gradient of @a candidate_bias, nullptr if none.
+ * Only written when reset_after is set.
+ */
+void backwardRecurrence(const GRUShape &s, ActiFunc::ActiPrimeKernel prime,
+                        ActiFunc::ActiPrimeKernel recurrent_prime,
+                        const float *weight_hh, const float *candidate_bias,
+                        const float *zrg, const float *hidden, float *d_zrg,
+                        float *d_hidden, float *d_weight_hh,
+                        float *d_candidate_bias) {
+  const unsigned int unit = s.unit;
+  const size_t stride = s.stateStride();
+  const size_t gate_stride = s.gateStride();
+  const float *weight_hg = weight_hh + unit * 2;
+  float *d_weight_hg = d_weight_hh + unit * 2;
+
+  /** hidden part of the candidate and the derivative flowing through it */
+  std::vector<float> candidate(static_cast<size_t>(s.batch) * unit);
+  std::vector<float> d_candidate(static_cast<size_t>(s.batch) * unit);
+  std::vector<float> bias_g(unit, 0.0f);
+  if (candidate_bias && s.reset_after)
+    std::copy(candidate_bias, candidate_bias + unit, bias_g.begin());
+
+  for (unsigned int t = s.timestep; t-- > 0;) {
+    const float *gates_t = zrg + t * s.gates;
+    float *d_gates_t = d_zrg + t * s.gates;
+    const float *prev = t ? hidden + (t - 1) * unit : nullptr;
+    float *d_prev = t ? d_hidden + (t - 1) * unit : nullptr;
+
+    if (prev && s.reset_after)
+      sgemm(ROW_MAJOR, false, false, s.batch, unit, unit, 1.0f, prev, stride,
+            weight_hg, s.gates, 0.0f, candidate.data(), unit);
+    else if (s.reset_after)
+      std::fill(candidate.begin(), candidate.end(), 0.0f);
+
+    /** d_z, d_g and the direct path to the previous hidden state */
+    auto gate = [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b) {
+        const float *z = gates_t + b * gate_stride;
+        const float *r = z + unit;
+        const float *g = z + unit * 2;
+        float *d_z = d_gates_t + b * gate_stride;
+        float *d_r = d_z + unit;
+        float *d_g = d_z + unit * 2;
+        const float *d_h = d_hidden + b * stride + t * unit;
+
+        if (prev) {
+          const float *h_prev = prev + b * stride;
+          float *d_h_prev = d_prev + b * stride;
+          for (unsigned int u = 0; u < unit; ++u) {
+            d_z[u] = d_h[u] * (h_prev[u] - g[u]);
+            d_h_prev[u] += z[u] * d_h[u];
+          }
+        } else {
+          for (unsigned int u = 0; u < unit; ++u)
+            d_z[u] = -d_h[u] * g[u];
+        }
+        for (unsigned int u = 0; u < unit; ++u)
+          d_g[u] = d_h[u] * (1.0f - z[u]);
+
+        recurrent_prime(unit, z, d_z, d_z);
+        prime(unit, g, d_g, d_g);
+
+        if (s.reset_after) {
+          const float *c = candidate.data() + b * unit;
+          float *d_c = d_candidate.data() + b * unit;
+          for (unsigned int u = 0; u < unit; ++u) {
+            d_r[u] = d_g[u] * (c[u] + bias_g[u]);
+            d_c[u] = d_g[u] * r[u];
+          }
+          recurrent_prime(unit, r, d_r, d_r);
+        }
+      }
+    };
+    ThreadPool::Global().parallelFor(0, s.batch, s.grain(), gate);
+
+    if (s.reset_after) {
+      if (d_candidate_bias) {
+        for (unsigned int b = 0; b < s.batch; ++b) {
+          const float *d_c = d_candidate.data() + b * unit;
+          for (unsigned int u = 0; u < unit; ++u)
+            d_candidate_bias[u] += d_c[u];
+        }
+      }
+      if (prev) {
+        sgemm(ROW_MAJOR, true, false, unit, unit, s.batch, 1.0f, prev, stride,
+              d_candidate.data(), unit, 1.0f, d_weight_hg, s.gates);
+        sgemm(ROW_MAJOR, false, true, s.batch, unit, unit, 1.0f,
+              d_candidate.data(), unit, weight_hg, s.gates, 1.0f, d_prev,
+              stride);
+      }
+    } else {
+      /** d_candidate = d_g . W_hg^T is the derivative of r * h_prev */
+      if (prev)
+        sgemm(ROW_MAJOR, false, true, s.batch, unit, unit, 1.0f,
+              d_gates_t + unit * 2, gate_stride, weight_hg, s.gates, 0.0f,
+              d_candidate.data(), unit);
+
+      auto reset = [&](unsigned int start, unsigned int end, unsigned int) {
+        for (unsigned int b = start; b < end; ++b) {
+          const float *r = gates_t + b * gate_stride + unit;
+          float *d_r = d_gates_t + b * gate_stride + unit;
+          const float *d_c = d_candidate.data() + b * unit;
+
+          if (prev) {
+            const float *h_prev = prev + b * stride;
+            float *d_h_prev = d_prev + b * stride;
+            float *c = candidate.data() + b * unit;
+            for (unsigned int u = 0; u < unit; ++u) {
+              d_r[u] = d_c[u] * h_prev[u];
+              d_h_prev[u] += d_c[u] * r[u];
+              c[u] = r[u] * h_prev[u];
+            }
+          } else {
+            std::fill(d_r, d_r + unit, 0.0f);
+          }
+          recurrent_prime(unit, r, d_r, d_r);
+        }
+      };
+      ThreadPool::Global().parallelFor(0, s.batch, s.grain(), reset);
+
+      if (prev)
+        sgemm(ROW_MAJOR, true, false, unit, unit, s.batch, 1.0f,
+              candidate.data(), unit, d_gates_t + unit * 2, gate_stride, 1.0f,
+              d_weight_hg, s.gates);
+    }
+
+    if (prev) {
+      sgemm(ROW_MAJOR, true, false, unit, unit * 2, s.batch, 1.0f, prev,
+            stride, d_gates_t, gate_stride, 1.0f, d_weight_hh, s.gates);
+      sgemm(ROW_MAJOR, false, true, s.batch, unit, unit * 2, 1.0f, d_gates_t,
+            gate_stride, weight_hh, s.gates, 1.0f, d_prev, stride);
+    }
+  }
+}
+
+} // namespace
+
 GRULayer::GRULayer() :
   LayerImpl(),
   gru_props(props::Unit(),
@@ -59,7 +352,8 @@ GRULayer::GRULayer() :
             props::IntegrateBias(), props::ResetAfter()),
   acti_func(ActivationType::ACT_NONE, true),
   recurrent_acti_func(ActivationType::ACT_NONE, true),
-  epsilon(1e-3f) {
+  epsilon(1e-3f),
+  batched_engine(true) {
   wt_idx.fill(std::numeric_limits<unsigned>::max());
 }
 
@@ -221,110 +515,159 @@ void GRULayer::forwarding(RunLayerContext &context, bool training) {
   Tensor &zrg = context.getTensor(wt_idx[GRUParams::zrg]);
   Tensor &h_prev = context.getTensor(wt_idx[GRUParams::h_prev]);
 
-  hidden_state.setZero();
-  zrg.setZero();
-  h_prev.setZero();
-
-  Tensor prev_hs;
-  Tensor hs;
-
-  // zt = sigma(W_hz.h_prev + W_xz.xs)
-  // rt = sigma(W_hr.h_prev + W_xr.xs)
-  // gt = tanh((h_prev*rt).W_hr + W_xg.xs)
-  // h_nx = (1-zt)*gt + zt*h_prev
-
-  for (unsigned int b = 0; b < batch_size; ++b) {
-    Tensor islice = input.getBatchSlice(b, 1);
-    Tensor oslice = hidden_state.getBatchSlice(b, 1);
-    Tensor zrg_ = zrg.getBatchSlice(b, 1);
-
-    for (unsigned int t = 0; t < max_timestep; ++t) {
-      Tensor xs = islice.getSharedDataTensor({feature_size}, t * feature_size);
-
-      /** @todo verify this dropout working */
-      // if (dropout_rate > 0.0 && training) {
-      //   xs.multiply_i(xs.dropout_mask(dropout_rate));
-      // }
-      hs = oslice.getSharedDataTensor({unit}, t * unit);
-      Tensor zrg_t =
-        zrg_.getSharedDataTensor({unit * NUM_GATE}, unit * t * NUM_GATE);
-
-      if (t > 0) {
-        prev_hs = oslice.getSharedDataTensor({unit}, (t - 1) * unit);
+  if (batched_engine &&
+      isBatchedGRU(acti_func, recurrent_acti_func, weight_hh)) {
+    const unsigned int rows = batch_size * max_timestep;
+    const GRUShape shape = {batch_size, max_timestep, unit, NUM_GATE * unit,
+                            reset_after};
+
+    /** the input projection of every timestep is one gemm */
+    const Tensor inputs =
+      input.getSharedDataTensor(TensorDim({rows, feature_size}), 0);
+    Tensor gates =
+      zrg.getSharedDataTensor(TensorDim({rows, NUM_GATE * unit}), 0);
+    inputs.dot(weight_ih, gates);
+    if (!disable_bias) {
+      if (integrate_bias) {
+        gates.add_i(bias_h);
+      } else if (reset_after) {
+        /** bias_hh of the candidate is scaled by the reset gate */
+        Tensor bias_hh_zr = bias_hh.clone();
+        bias_hh_zr.getSharedDataTensor({unit}, unit * 2).setZero();
+        gates.add_i(bias_ih);
+        gates.add_i(bias_hh_zr);
       } else {
-        prev_hs = h_prev.getBatchSlice(b, 1);
+        gates.add_i(bias_ih);
+        gates.add_i(bias_hh);
       }
+    }
 
-      xs.dot(weight_ih, zrg_t); // x_z, x_r, x_g
-
-      Tensor ztrt = zrg_t.getSharedDataTensor({unit * 2}, 0);
-
-      Tensor w_hh;
-      w_hh.copy_with_stride(
-        weight_hh.getSharedDataTensor({1, 1, unit, unit * 2}, 0, false));
-      Tensor w_g;
-      w_g.copy_with_stride(
-        weight_hh.getSharedDataTensor({1, 1, unit, unit}, unit * 2, false));
+    const float *mask_data = nullptr;
+    unsigned int mask_step = 0;
+    if (dropout_rate > epsilon && training) {
+      Tensor &mask = context.getTensor(wt_idx[GRUParams::dropout_mask]);
+      mask.dropout_mask(dropout_rate);
+      mask_data = mask.getData<float>();
+      /** a single row mask is shared by every timestep as in calcGradient */
+      mask_step = mask.height() == 1 ? 0 : unit;
+    }
 
-      Tensor gt = zrg_t.getSharedDataTensor({unit}, unit * 2);
+    forwardRecurrence(
+      shape, acti_func.getKernel(), recurrent_acti_func.getKernel(),
+      weight_hh.getData<float>(),
+      bias_hh.empty() ? nullptr : bias_hh.getData<float>() + unit * 2,
+      zrg.getData<float>(), hidden_state.getData<float>(), mask_data,
+      mask_step);
+  } else {
+    hidden_state.setZero();
+    zrg.setZero();
+    h_prev.setZero();
 
-      ztrt.add_i(prev_hs.dot(w_hh));
-      if (!disable_bias) {
-        if (integrate_bias) {
-          Tensor ztrt_bias_h = bias_h.getSharedDataTensor({unit * 2}, 0);
-          ztrt.add_i(ztrt_bias_h);
+    Tensor prev_hs;
+    Tensor hs;
+
+    // zt = sigma(W_hz.h_prev + W_xz.xs)
+    // rt = sigma(W_hr.h_prev + W_xr.xs)
+    // gt = tanh((h_prev*rt).W_hr + W_xg.xs)
+    // h_nx = (1-zt)*gt + zt*h_prev
+
+    for (unsigned int b = 0; b < batch_size; ++b) {
+      Tensor islice = input.getBatchSlice(b, 1);
+      Tensor oslice = hidden_state.getBatchSlice(b, 1);
+      Tensor zrg_ = zrg.getBatchSlice(b, 1);
+
+      for (unsigned int t = 0; t < max_timestep; ++t) {
+        Tensor xs =
+          islice.getSharedDataTensor({feature_size}, t * feature_size);
+
+        /** @todo verify this dropout working */
+        // if (dropout_rate > 0.0 && training) {
+        //   xs.multiply_i(xs.dropout_mask(dropout_rate));
+        // }
+        hs = oslice.getSharedDataTensor({unit}, t * unit);
+        Tensor zrg_t =
+          zrg_.getSharedDataTensor({unit * NUM_GATE}, unit * t * NUM_GATE);
+
+        if (t > 0) {
+          prev_hs = oslice.getSharedDataTensor({unit}, (t - 1) * unit);
         } else {
-          Tensor ztrt_bias_ih = bias_ih.getSharedDataTensor({unit * 2}, 0);
-          ztrt.add_i(ztrt_bias_ih);
-          Tensor ztrt_bias_hh = bias_hh.getSharedDataTensor({unit * 2}, 0);
-          ztrt.add_i(ztrt_bias_hh);
+          prev_hs = h_prev.getBatchSlice(b, 1);
         }
-      }
 
-      recurrent_acti_func.run_fn(ztrt, ztrt);
+        xs.dot(weight_ih, zrg_t); // x_z, x_r, x_g
+
+        Tensor ztrt = zrg_t.getSharedDataTensor({unit * 2}, 0);
+
+        Tensor w_hh;
+        w_hh.copy_with_stride(
+          weight_hh.getSharedDataTensor({1, 1, unit, unit * 2}, 0, false));
+        Tensor w_g;
+        w_g.copy_with_stride(
+          weight_hh.getSharedDataTensor({1, 1, unit, unit}, unit * 2, false));
+
+        Tensor gt = zrg_t.getSharedDataTensor({unit}, unit * 2);
+
+        ztrt.add_i(prev_hs.dot(w_hh));
+        if (!disable_bias) {
+          if (integrate_bias) {
+            Tensor ztrt_bias_h = bias_h.getSharedDataTensor({unit * 2}, 0);
+            ztrt.add_i(ztrt_bias_h);
+          } else {
+            Tensor ztrt_bias_ih = bias_ih.getSharedDataTensor({unit * 2}, 0);
+            ztrt.add_i(ztrt_bias_ih);
+            Tensor ztrt_bias_hh = bias_hh.getSharedDataTensor({unit * 2}, 0);
+            ztrt.add_i(ztrt_bias_hh);
+          }
+        }
 
-      Tensor zt = ztrt.getSharedDataTensor({unit}, 0);
-      Tensor rt = ztrt.getSharedDataTensor({unit}, unit);
+        recurrent_acti_func.run_fn(ztrt, ztrt);
 
-      Tensor temp;
-      if (reset_after) {
-        prev_hs.dot(w_g, temp);
-        if (!disable_bias && !integrate_bias) {
-          Tensor bias_hh_g = bias_hh.getSharedDataTensor({unit}, 2 * unit);
-          temp.add_i(bias_hh_g);
-        }
-        temp.multiply_i(rt);
-        gt.add_i(temp);
-      } else {
-        rt.multiply(prev_hs, temp);
-        temp.dot(w_g, gt, false, false, 1.0f);
-        if (!disable_bias && !integrate_bias) {
-          Tensor bias_hh_g = bias_hh.getSharedDataTensor({unit}, 2 * unit);
-          gt.add_i(bias_hh_g);
-        }
-      }
-      if (!disable_bias) {
-        if (integrate_bias) {
-          Tensor gt_bias_h = bias_h.getSharedDataTensor({unit}, unit * 2);
-          gt.add_i(gt_bias_h);
+        Tensor zt = ztrt.getSharedDataTensor({unit}, 0);
+        Tensor rt = ztrt.getSharedDataTensor({unit}, unit);
+
+        Tensor temp;
+        if (reset_after) {
+          prev_hs.dot(w_g, temp);
+          if (!disable_bias && !integrate_bias) {
+            Tensor bias_hh_g = bias_hh.getSharedDataTensor({unit}, 2 * unit);
+            temp.add_i(bias_hh_g);
+          }
+          temp.multiply_i(rt);
+          gt.add_i(temp);
         } else {
-          Tensor gt_bias_ih = bias_ih.getSharedDataTensor({unit}, unit * 2);
-          gt.add_i(gt_bias_ih);
+          rt.multiply(prev_hs, temp);
+          temp.dot(w_g, gt, false, false, 1.0f);
+          if (!disable_bias && !integrate_bias) {
+            Tensor bias_hh_g = bias_hh.getSharedDataTensor({unit}, 2 * unit);
+            gt.add_i(bias_hh_g);
+          }
+        }
+        if (!disable_bias) {
+          if (integrate_bias) {
+            Tensor gt_bias_h = bias_h.getSharedDataTensor({unit}, unit * 2);
+            gt.add_i(gt_bias_h);
+          } else {
+            Tensor gt_bias_ih = bias_ih.getSharedDataTensor({unit}, unit * 2);
+            gt.add_i(gt_bias_ih);
+          }
         }
-      }
-
-      acti_func.run_fn(gt, gt);
-
-      zt.multiply(prev_hs, hs);
-      temp = zt.multiply(-1.0).add(1.0);
-      hs.add_i(gt.multiply(temp));
 
-      if (dropout_rate > epsilon && training) {
-        Tensor mask_ = context.getTensor(wt_idx[GRUParams::dropout_mask])
-                         .getBatchSlice(b, 1);
-        Tensor msk = mask_.getSharedDataTensor({unit}, t * unit);
-        msk.dropout_mask(dropout_rate);
-        hs.multiply_i(msk);
+        acti_func.run_fn(gt, gt);
+
+        zt.multiply(prev_hs, hs);
+        temp = zt.multiply(-1.0).add(1.0);
+        hs.add_i(gt.multiply(temp));
+
+        if (dropout_rate > epsilon && training) {
+          Tensor mask_ = context.getTensor(wt_idx[GRUParams::dropout_mask])
+                           .getBatchSlice(b, 1);
+          /** a single row mask is drawn once and shared by every timestep */
+          const bool shared = mask_.height() == 1;
+          Tensor msk = mask_.getSharedDataTensor({unit}, shared ? 0 : t * unit);
+          if (!shared || t == 0)
+            msk.dropout_mask(dropout_rate);
+          hs.multiply_i(msk);
+        }
       }
     }
   }
@@ -385,8 +728,6 @@ void GRULayer::calcGradient(RunLayerContext &context) {
                          ? context.getWeightGrad(wt_idx[GRUParams::bias_hh])
                          : empty;
 
-  Tensor djdweight_hh_zr = Tensor({1, 1, unit, unit * 2}, true);
-  Tensor djdweight_hh_g = Tensor({1, 1, unit, unit}, true);
   Tensor &hidden_state_derivative =
     context.getTensorGrad(wt_idx[GRUParams::hidden_state]);
   Tensor &hidden_state = context.getTensor(wt_idx[GRUParams::hidden_state]);
@@ -394,8 +735,6 @@ void GRULayer::calcGradient(RunLayerContext &context) {
   Tensor &d_zrg = context.getTensorGrad(wt_idx[GRUParams::zrg]);
 
   djdweight_ih.setZero();
-  djdweight_hh_zr.setZero();
-  djdweight_hh_g.setZero();
   if (!disable_bias) {
     if (integrate_bias) {
       djdbias_h.setZero();
@@ -425,6 +764,53 @@ void GRULayer::calcGradient(RunLayerContext &context) {
       context.getTensor(wt_idx[GRUParams::dropout_mask]));
   }
 
+  if (batched_engine &&
+      isBatchedGRU(acti_func, recurrent_acti_func, weight_hh)) {
+    const unsigned int rows = batch_size * max_timestep;
+    const GRUShape shape = {batch_size, max_timestep, unit, NUM_GATE * unit,
+                            reset_after};
+
+    djdweight_hh.setZero();
+    backwardRecurrence(
+      shape, acti_func.getPrimeKernel(), recurrent_acti_func.getPrimeKernel(),
+      weight_hh.getData<float>(),
+      bias_hh.empty() ? nullptr : bias_hh.getData<float>() + unit * 2,
+      zrg.getData<float>(), hidden_state.getData<float>(),
+      d_zrg.getData<float>(), hidden_state_derivative.getData<float>(),
+      djdweight_hh.getData<float>(),
+      djdbias_hh.empty() ? nullptr : djdbias_hh.getData<float>() + unit * 2);
+
+    /** the weight_ih gradient of every timestep is one gemm */
+    const Tensor inputs =
+      input.getSharedDataTensor(TensorDim({rows, feature_size}), 0);
+    const Tensor d_gates =
+      d_zrg.getSharedDataTensor(TensorDim({rows, NUM_GATE * unit}), 0);
+    inputs.dot(d_gates, djdweight_ih, true, false, 1.0f);
+
+    if (!disable_bias) {
+      const Tensor d_gate_rows =
+        d_zrg.getSharedDataTensor(TensorDim(rows, 1, 1, NUM_GATE * unit), 0);
+      if (integrate_bias) {
+        d_gate_rows.sum(0, djdbias_h, 1.0f, 1.0f);
+      } else if (reset_after) {
+        /** the candidate part of djdbias_hh is done by the recurrence */
+        Tensor d_bias = d_gate_rows.sum(0);
+        djdbias_ih.add_i(d_bias);
+        Tensor djdbias_hh_zr = djdbias_hh.getSharedDataTensor({2 * unit}, 0);
+        djdbias_hh_zr.add_i(d_bias.getSharedDataTensor({2 * unit}, 0));
+      } else {
+        d_gate_rows.sum(0, djdbias_ih, 1.0f, 1.0f);
+        d_gate_rows.sum(0, djdbias_hh, 1.0f, 1.0f);
+      }
+    }
+    return;
+  }
+
+  Tensor djdweight_hh_zr = Tensor({1, 1, unit, unit * 2}, true);
+  Tensor djdweight_hh_g = Tensor({1, 1, unit, unit}, true);
+  djdweight_hh_zr.setZero();
+  djdweight_hh_g.setZero();
+
   Tensor dh_nx = Tensor(unit);
 
   for (unsigned int b = 0; b < batch_size; ++b) {
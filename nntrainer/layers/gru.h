@@ -97,6 +97,14 @@ public:
    */
   void setBatch(RunLayerContext &context, unsigned int batch) override;
 
+#ifdef ENABLE_TEST
+  /**
+   * @brief keep the layer on the per-sequence path even if the batched engine
+   * could run it, to compare both in tests
+   */
+  void disableBatchedEngine() { batched_engine = false; }
+#endif // ENABLE_TEST
+
   static constexpr const char *type = "gru";
 
 private:
@@ -132,6 +140,8 @@ private:
    * @brief     to protect overflow
    */
   float epsilon;
+
+  bool batched_engine; /**< run on the batched engine when possible */
 };
 } // namespace nntrainer
 
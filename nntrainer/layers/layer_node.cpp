@@ -546,6 +546,19 @@ void LayerNode::read(std::ifstream &file, bool opt_var,
   }
 }
 
+std::vector<Tensor *> LayerNode::getSavedWeights() {
+  NNTR_THROW_IF(!run_context, std::runtime_error)
+    << __func__ << " layer needs to be finalized first!";
+
+  std::vector<Tensor *> weights;
+  for (unsigned int i = 0; i < run_context->getNumWeights(); ++i) {
+    if (run_context->isGradientFirstAccess(i)) {
+      weights.push_back(&run_context->getWeight(i));
+    }
+  }
+  return weights;
+}
+
 void LayerNode::save(std::ofstream &file, bool opt_var,
                      ml::train::ExecutionMode mode) const {
   NNTR_THROW_IF(!run_context, std::runtime_error)
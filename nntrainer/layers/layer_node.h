@@ -761,6 +761,13 @@ public:
             ml::train::ExecutionMode mode = ml::train::ExecutionMode::TRAIN,
             bool swap = false);
 
+  /**
+   * @brief     get the weights in the order they are saved to the file
+   * @note      shared weights are only included at the first access
+   * @return    std::vector<Tensor *> weights in the saved order
+   */
+  std::vector<Tensor *> getSavedWeights();
+
   /**
    * @brief     save layer Weight & Bias data from file
    * @param file output file stream
@@ -11,8 +11,13 @@
  *
  */
 
+#include <algorithm>
+#include <vector>
+
+#include <cpu_backend.h>
 #include <layer_context.h>
 #include <lstm.h>
+#include <nntr_thread_pool.h>
 #include <nntr_threads.h>
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
@@ -42,6 +47,217 @@ enum LSTMParams {
   dropout_mask
 };
 
+namespace {
+
+constexpr unsigned int ROW_MAJOR = 0;
+
+/** minimum number of gate elements handled by a chunk of a timestep */
+constexpr unsigned int MIN_CHUNK_WORK = 1 << 14;
+
+/**
+ * @brief layout of one direction of the lstm. Every tensor is batch first,
+ * a sequence is a block of @a timestep rows.
+ */
+struct LSTMShape {
+  unsigned int batch;    /**< number of sequences */
+  unsigned int timestep; /**< rows of a sequence */
+  unsigned int unit;     /**< width of a hidden or cell state row */
+  unsigned int gates;    /**< width of an ifgo row */
+  bool reverse;          /**< the recurrence runs from the last row */
+
+  /**
+   * @brief row of the @a t th step of the recurrence
+   */
+  unsigned int row(unsigned int t) const {
+    return reverse ? timestep - 1 - t : t;
+  }
+
+  /**
+   * @brief sequences per chunk of the element-wise part of a step
+   */
+  unsigned int grain() const { return std::max(1u, MIN_CHUNK_WORK / gates); }
+};
+
+/**
+ * @brief check if a direction can run on the batched engine. The engine is
+ * fp32 and calls the simd kernels of both activations on raw rows.
+ */
+bool isBatchedLSTM(const ActiFunc &acti_func,
+                   const ActiFunc &recurrent_acti_func, const Tensor &weight,
+                   const Tensor &state) {
+  return weight.getDataType() == TensorDim::DataType::FP32 &&
+         state.getDataType() == TensorDim::DataType::FP32 &&
+         acti_func.getKernel() && acti_func.getPrimeKernel() &&
+         recurrent_acti_func.getKernel() &&
+         recurrent_acti_func.getPrimeKernel();
+}
+
+/**
+ * @brief forward recurrence of all sequences. @a ifgo holds the input
+ * projection of every row on entry and the activated gates on exit. A step
+ * adds the previous hidden states of all sequences times @a weight_hh with
+ * one gemm, then activates the gates and updates the states row by row.
+ */
+void forwardRecurrence(const LSTMShape &s, const ActiFunc &acti_func,
+                       const ActiFunc &recurrent_acti_func,
+                       const float *weight_hh, float *ifgo, float *cell,
+                       float *hidden, const float *mask) {
+  const unsigned int unit = s.unit;
+  const size_t state_stride = static_cast<size_t>(s.timestep) * unit;
+  const size_t gate_stride = static_cast<size_t>(s.timestep) * s.gates;
+  const ActiFunc::ActiKernel acti = acti_func.getKernel();
+  const ActiFunc::ActiKernel recurrent_acti = recurrent_acti_func.getKernel();
+
+  for (unsigned int t = 0; t < s.timestep; ++t) {
+    const unsigned int cur = s.row(t);
+    const unsigned int prev = t ? s.row(t - 1) : 0;
+
+    /** the initial states are zero, so the first step has no recurrence */
+    if (t)
+      sgemm(ROW_MAJOR, false, false, s.batch, s.gates, unit, 1.0f,
+            hidden + prev * unit, state_stride, weight_hh, s.gates, 1.0f,
+            ifgo + cur * s.gates, gate_stride);
+
+    auto run = [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b) {
+        float *i = ifgo + b * gate_stride + cur * s.gates;
+        float *f = i + unit;
+        float *g = i + unit * 2;
+        float *o = i + unit * 3;
+        float *c = cell + b * state_stride + cur * unit;
+        float *h = hidden + b * state_stride + cur * unit;
+
+        recurrent_acti(unit * 2, i, i);
+        acti(unit, g, g);
+        recurrent_acti(unit, o, o);
+
+        if (t) {
+          const float *c_prev = cell + b * state_stride + prev * unit;
+          for (unsigned int u = 0; u < unit; ++u)
+            c[u] = f[u] * c_prev[u] + g[u] * i[u];
+        } else {
+          for (unsigned int u = 0; u < unit; ++u)
+            c[u] = g[u] * i[u];
+        }
+
+        acti(unit, c, h);
+        if (mask) {
+          /** the mask is indexed by step, not by row */
+          const float *m = mask + b * state_stride + t * unit;
+          for (unsigned int u = 0; u < unit; ++u)
+            h[u] = h[u] * o[u] * m[u];
+        } else {
+          for (unsigned int u = 0; u < unit; ++u)
+            h[u] *= o[u];
+        }
+      }
+    };
+    ThreadPool::Global().parallelFor(0, s.batch, s.grain(), run);
+  }
+}
+
+/**
+ * @brief backward recurrence of all sequences. @a d_hidden holds the
+ * incoming derivative of every row on entry, and a step adds the derivative
+ * of the previous hidden states of all sequences with one gemm. @a d_cell
+ * must be zero on entry.
+ */
+void backwardRecurrence(const LSTMShape &s, const ActiFunc &acti_func,
+                        const ActiFunc &recurrent_acti_func,
+                        const float *weight_hh, const float *ifgo,
+                        const float *cell, float *d_ifgo, float *d_cell,
+                        float *d_hidden) {
+  const unsigned int unit = s.unit;
+  const size_t state_stride = static_cast<size_t>(s.timestep) * unit;
+  const size_t gate_stride = static_cast<size_t>(s.timestep) * s.gates;
+  const ActiFunc::ActiKernel acti = acti_func.getKernel();
+  const ActiFunc::ActiPrimeKernel acti_prime = acti_func.getPrimeKernel();
+  const ActiFunc::ActiPrimeKernel recurrent_prime =
+    recurrent_acti_func.getPrimeKernel();
+
+  ThreadPool &pool = ThreadPool::Global();
+  std::vector<float> scratch(static_cast<size_t>(unit) * 2 *
+                             pool.getNumThreads());
+
+  for (unsigned int t = s.timestep; t-- > 0;) {
+    const unsigned int cur = s.row(t);
+    const unsigned int prev = t ? s.row(t - 1) : 0;
+
+    auto run = [&](unsigned int start, unsigned int end, unsigned int slot) {
+      float *acti_c = scratch.data() + static_cast<size_t>(slot) * unit * 2;
+      float *d_c = acti_c + unit;
+
+      for (unsigned int b = start; b < end; ++b) {
+        const float *i = ifgo + b * gate_stride + cur * s.gates;
+        const float *f = i + unit;
+        const float *g = i + unit * 2;
+        const float *o = i + unit * 3;
+        float *d_i = d_ifgo + b * gate_stride + cur * s.gates;
+        float *d_f = d_i + unit;
+        float *d_g = d_i + unit * 2;
+        float *d_o = d_i + unit * 3;
+        const float *c = cell + b * state_stride + cur * unit;
+        const float *d_h = d_hidden + b * state_stride + cur * unit;
+        const float *d_c_next = d_cell + b * state_stride + cur * unit;
+
+        acti(unit, c, acti_c);
+        acti_prime(unit, acti_c, d_h, d_c);
+        for (unsigned int u = 0; u < unit; ++u) {
+          d_o[u] = d_h[u] * acti_c[u];
+          d_c[u] = d_c[u] * o[u] + d_c_next[u];
+          d_i[u] = d_c[u] * g[u];
+          d_g[u] = d_c[u] * i[u];
+        }
+
+        if (t) {
+          const float *c_prev = cell + b * state_stride + prev * unit;
+          float *d_c_prev = d_cell + b * state_stride + prev * unit;
+          for (unsigned int u = 0; u < unit; ++u) {
+            d_f[u] = d_c[u] * c_prev[u];
+            d_c_prev[u] = d_c[u] * f[u];
+          }
+        } else {
+          std::fill(d_f, d_f + unit, 0.0f);
+        }
+
+        recurrent_prime(unit * 2, i, d_i, d_i);
+        acti_prime(unit, g, d_g, d_g);
+        recurrent_prime(unit, o, d_o, d_o);
+      }
+    };
+    pool.parallelFor(0, s.batch, s.grain(), run);
+
+    if (t)
+      sgemm(ROW_MAJOR, false, true, s.batch, unit, s.gates, 1.0f,
+            d_ifgo + cur * s.gates, gate_stride, weight_hh, s.gates, 1.0f,
+            d_hidden + prev * unit, state_stride);
+  }
+}
+
+/**
+ * @brief accumulate the gradient of weight_hh over all sequences. Row r of
+ * @a d_ifgo pairs with the hidden state of the previous step, so a sequence
+ * is one gemm over timestep - 1 rows.
+ */
+void recurrentWeightGradient(const LSTMShape &s, const float *hidden,
+                             const float *d_ifgo, float *d_weight_hh) {
+  if (s.timestep < 2)
+    return;
+
+  const size_t state_stride = static_cast<size_t>(s.timestep) * s.unit;
+  const size_t gate_stride = static_cast<size_t>(s.timestep) * s.gates;
+  const size_t hidden_offset = s.reverse ? s.unit : 0;
+  const size_t gate_offset = s.reverse ? 0 : s.gates;
+
+  for (unsigned int b = 0; b < s.batch; ++b)
+    sgemm(ROW_MAJOR, true, false, s.unit, s.gates, s.timestep - 1, 1.0f,
+          hidden + b * state_stride + hidden_offset, s.unit,
+          d_ifgo + b * gate_stride + gate_offset, s.gates, 1.0f, d_weight_hh,
+          s.gates);
+}
+
+} // namespace
+
 void LSTMLayer::forwardingBatchFirstLSTM(
   unsigned int NUM_GATE, const unsigned int batch_size,
   const unsigned int feature_size, const bool disable_bias,
@@ -52,6 +268,41 @@ void LSTMLayer::forwardingBatchFirstLSTM(
   const Tensor &bias_h, const Tensor &bias_ih, const Tensor &bias_hh,
   Tensor &hidden_state_, Tensor &cell_state_, Tensor &ifgo_,
   const Tensor &mask_) {
+  if (batched_engine && isBatchedLSTM(acti_func, recurrent_acti_func,
+                                     weight_ih, hidden_state_)) {
+    TensorDim::TensorType tensor_type = weight_ih.getTensorType();
+    const LSTMShape shape = {batch_size, max_timestep, unit, NUM_GATE * unit,
+                             reverse};
+    const unsigned int rows = batch_size * max_timestep;
+
+    /** the input projection of every row of every sequence is one gemm */
+    const TensorDim input_rows_dim({rows, feature_size}, tensor_type);
+    const TensorDim gate_rows_dim({rows, shape.gates}, tensor_type);
+    const Tensor inputs = input_.getSharedDataTensor(input_rows_dim, 0);
+    Tensor gates = ifgo_.getSharedDataTensor(gate_rows_dim, 0);
+    inputs.dot(weight_ih, gates);
+    if (!disable_bias) {
+      if (integrate_bias) {
+        gates.add_i(bias_h);
+      } else {
+        gates.add_i(bias_ih);
+        gates.add_i(bias_hh);
+      }
+    }
+
+    if (enable_dropout) {
+      Tensor mask = mask_.getSharedDataTensor(mask_.getDim(), 0);
+      mask.dropout_mask(dropout_rate);
+    }
+
+    forwardRecurrence(shape, acti_func, recurrent_acti_func,
+                      weight_hh.getData<float>(), ifgo_.getData<float>(),
+                      cell_state_.getData<float>(),
+                      hidden_state_.getData<float>(),
+                      enable_dropout ? mask_.getData<float>() : nullptr);
+    return;
+  }
+
   hidden_state_.setZero();
   cell_state_.setZero();
   TensorDim::TensorType tensor_type = weight_ih.getTensorType();
@@ -183,6 +434,42 @@ void LSTMLayer::calcGradientBatchFirstLSTM(
     d_hidden_state_.multiply_i(mask_);
   }
 
+  if (batched_engine && isBatchedLSTM(acti_func, recurrent_acti_func,
+                                     weight_hh, hidden_state_)) {
+    const LSTMShape shape = {batch_size, max_timestep, unit, NUM_GATE * unit,
+                             reverse};
+    const unsigned int rows = batch_size * max_timestep;
+
+    backwardRecurrence(shape, acti_func, recurrent_acti_func,
+                       weight_hh.getData<float>(), ifgo_.getData<float>(),
+                       cell_state_.getData<float>(), d_ifgo_.getData<float>(),
+                       d_cell_state_.getData<float>(),
+                       d_hidden_state_.getData<float>());
+
+    /** the weight_ih gradient of every row of every sequence is one gemm */
+    const TensorDim input_rows_dim({rows, feature_size}, tensor_type);
+    const TensorDim gate_rows_dim({rows, shape.gates}, tensor_type);
+    const Tensor inputs = input_.getSharedDataTensor(input_rows_dim, 0);
+    const Tensor d_gates = d_ifgo_.getSharedDataTensor(gate_rows_dim, 0);
+    inputs.dot(d_gates, d_weight_ih, true, false, 1.0f);
+
+    recurrentWeightGradient(shape, hidden_state_.getData<float>(),
+                            d_ifgo_.getData<float>(),
+                            d_weight_hh.getData<float>());
+
+    if (!disable_bias) {
+      const Tensor d_gate_rows = d_ifgo_.getSharedDataTensor(
+        TensorDim(rows, 1, 1, shape.gates, tensor_type), 0);
+      if (integrate_bias) {
+        d_gate_rows.sum(0, d_bias_h, 1.0f, 1.0f);
+      } else {
+        d_gate_rows.sum(0, d_bias_ih, 1.0f, 1.0f);
+        d_gate_rows.sum(0, d_bias_hh, 1.0f, 1.0f);
+      }
+    }
+    return;
+  }
+
   auto workers = ParallelBatch(batch_size);
 
   if (workers.getNumWorkers() > 1) {
@@ -409,7 +696,8 @@ void LSTMLayer::calcGradientBatchFirstLSTM(
 LSTMLayer::LSTMLayer() :
   LSTMCore(),
   lstm_props(props::ReturnSequences(), props::Bidirectional(),
-             props::DropOutRate(), props::MaxTimestep()) {
+             props::DropOutRate(), props::MaxTimestep()),
+  batched_engine(true) {
   wt_idx.fill(std::numeric_limits<unsigned>::max());
 }
 
@@ -97,6 +97,14 @@ public:
    */
   void setBatch(RunLayerContext &context, unsigned int batch) override;
 
+#ifdef ENABLE_TEST
+  /**
+   * @brief keep the layer on the per-sequence path even if the batched engine
+   * could run it, to compare both in tests
+   */
+  void disableBatchedEngine() { batched_engine = false; }
+#endif // ENABLE_TEST
+
   static constexpr const char *type = "lstm";
 
 private:
@@ -117,6 +125,8 @@ private:
     lstm_props;
   std::array<unsigned int, 17> wt_idx; /**< indices of the weights */
 
+  bool batched_engine; /**< run on the batched engine when possible */
+
   /**
    * @brief run lstm fowarding for batch_first input
    *
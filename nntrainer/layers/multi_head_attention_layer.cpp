@@ -14,6 +14,7 @@
 
 #include <cmath>
 
+#include <fused_attention.h>
 #include <layer_context.h>
 #include <multi_head_attention_layer.h>
 #include <nntrainer_error.h>
@@ -28,6 +29,7 @@ MultiHeadAttentionLayer::MultiHeadAttentionLayer() :
     props::OutputShape(), props::DropOutRate(), props::ReturnAttentionWeight(),
     props::AverageAttentionWeight()),
   sm(ActivationType::ACT_SOFTMAX),
+  fused_attention(false),
   epsilon(1e-3f) {
   weight_idx.fill(std::numeric_limits<unsigned>::max());
 }
@@ -64,6 +66,7 @@ enum AttentionParams {
   attention_weight,
   dropout_mask,
   attention_output,
+  attention_row_stats,
 };
 
 void MultiHeadAttentionLayer::finalize(InitLayerContext &context) {
@@ -157,6 +160,17 @@ void MultiHeadAttentionLayer::finalize(InitLayerContext &context) {
 
   const unsigned int projected_query_dim_prop = projected_key_dim_prop;
 
+  /**
+   * The fused attention never materializes the attention weight, so it can
+   * not return it nor apply dropout to it while training.
+   */
+  const bool training_mode =
+    context.getExecutionMode() == ml::train::ExecutionMode::TRAIN;
+  fused_attention =
+    activation_type.data_type == TensorDim::DataType::FP32 &&
+    return_attention_weight == props::ReturnAttentionWeightInfo::Enum::none &&
+    (dropout_rate <= epsilon || !training_mode);
+
   if (activation_type.data_type == TensorDim::DataType::FP32) {
     sm.setActiFunc(ActivationType::ACT_SOFTMAX);
   } else if (activation_type.data_type == TensorDim::DataType::FP16) {
@@ -294,19 +308,31 @@ void MultiHeadAttentionLayer::finalize(InitLayerContext &context) {
     //   attention_mask_dim, "attention_mask", Initializer::NONE, false,
     //   TensorLifespan::FORWARD_FUNC_LIFESPAN);
   }
-  /** tensor for attention weight */
-  TensorDim attention_weight_dim(
-    {batch_size, num_heads, query_height, key_height}, activation_type);
-  weight_idx[AttentionParams::attention_weight] = context.requestTensor(
-    attention_weight_dim, "attention_weight", Initializer::NONE, true,
-    TensorLifespan::ITERATION_LIFESPAN);
-  if (dropout_rate > epsilon) {
-    /** tensor for dropout mask */
-    TensorDim dropout_mask_dim(
+  if (fused_attention) {
+    if (training_mode) {
+      /** tensor for maximum and sum of exponentials of each score row */
+      TensorDim attention_row_stats_dim(
+        {batch_size, num_heads, query_height, 2}, activation_type);
+      weight_idx[AttentionParams::attention_row_stats] =
+        context.requestTensor(attention_row_stats_dim, "attention_row_stats",
+                              Initializer::NONE, false,
+                              TensorLifespan::ITERATION_LIFESPAN);
+    }
+  } else {
+    /** tensor for attention weight */
+    TensorDim attention_weight_dim(
       {batch_size, num_heads, query_height, key_height}, activation_type);
-    weight_idx[AttentionParams::dropout_mask] =
-      context.requestTensor(dropout_mask_dim, "dropout_mask", Initializer::NONE,
-                            false, TensorLifespan::ITERATION_LIFESPAN);
+    weight_idx[AttentionParams::attention_weight] = context.requestTensor(
+      attention_weight_dim, "attention_weight", Initializer::NONE, true,
+      TensorLifespan::ITERATION_LIFESPAN);
+    if (dropout_rate > epsilon) {
+      /** tensor for dropout mask */
+      TensorDim dropout_mask_dim(
+        {batch_size, num_heads, query_height, key_height}, activation_type);
+      weight_idx[AttentionParams::dropout_mask] = context.requestTensor(
+        dropout_mask_dim, "dropout_mask", Initializer::NONE, false,
+        TensorLifespan::ITERATION_LIFESPAN);
+    }
   }
 
   /** tensor for attention output */
@@ -398,8 +424,6 @@ void MultiHeadAttentionLayer::forwarding(RunLayerContext &context,
   Tensor &projected_value =
     context.getTensor(weight_idx[AttentionParams::projected_value]);
 
-  Tensor &attention_weight =
-    context.getTensor(weight_idx[AttentionParams::attention_weight]);
   Tensor &attention_output =
     context.getTensor(weight_idx[AttentionParams::attention_output]);
 
@@ -424,6 +448,47 @@ void MultiHeadAttentionLayer::forwarding(RunLayerContext &context,
     projected_value.add_i(value_fc_bias);
   }
 
+  if (fused_attention) {
+    /** heads are read in place, without transposing the projections */
+    FusedAttentionArgs args;
+    args.batch = batch_size;
+    args.num_heads = num_heads;
+    args.query_len = query_height;
+    args.key_len = key_height;
+    args.key_dim = projected_key_dim_prop;
+    args.value_dim = projected_value_dim_prop;
+    args.scale = 1 / sqrt((float)projected_query_dim_prop);
+    args.query = projected_query.getData<float>();
+    args.query_stride = projected_query.getDim().getFeatureLen();
+    args.key = projected_key.getData<float>();
+    args.key_stride = projected_key.getDim().getFeatureLen();
+    args.value = projected_value.getData<float>();
+    args.value_stride = projected_value.getDim().getFeatureLen();
+    args.mask = provide_attention_mask ? mask.getData<float>() : nullptr;
+    args.causal_offset = -1;
+    args.output = attention_output.getData<float>();
+    args.output_stride = attention_output.getDim().getFeatureLen();
+    args.row_stats =
+      training
+        ? context.getTensor(weight_idx[AttentionParams::attention_row_stats])
+            .getData<float>()
+        : nullptr;
+    fusedAttentionForward(args);
+
+    attention_output.reshape(TensorDim(
+      {batch_size * query_height, 1, 1, num_heads * projected_value_dim_prop}));
+    attention_output.dot(fc_weight, output);
+    if (!disable_bias) {
+      output.add_i(fc_bias);
+    }
+    attention_output.reshape(TensorDim(
+      {batch_size, 1, query_height, num_heads * projected_value_dim_prop}));
+    return;
+  }
+
+  Tensor &attention_weight =
+    context.getTensor(weight_idx[AttentionParams::attention_weight]);
+
   projected_query.reshape(
     TensorDim({batch_size, query_height, num_heads, projected_query_dim_prop}));
   projected_key.reshape(
@@ -662,18 +727,8 @@ void MultiHeadAttentionLayer::incremental_forwarding(RunLayerContext &context,
   Tensor cached_value =
     cache_value.getSharedDataTensor(cached_value_dim, 0, true);
 
-  Tensor &attention_weight =
-    context.getTensor(weight_idx[AttentionParams::attention_weight]);
   Tensor &attention_output =
     context.getTensor(weight_idx[AttentionParams::attention_output]);
-  TensorDim attention_weight_dim = attention_weight.getDim();
-
-  TensorDim attention_weight_step_dim = attention_weight_dim;
-  attention_weight_step_dim.height(to - from);
-  attention_weight_step_dim.width(to);
-
-  Tensor attention_weight_step =
-    attention_weight.getSharedDataTensor(attention_weight_step_dim, 0, true);
 
   TensorDim attention_output_dim = attention_output.getDim();
   TensorDim attention_output_step_dim = attention_output_dim;
@@ -700,6 +755,49 @@ void MultiHeadAttentionLayer::incremental_forwarding(RunLayerContext &context,
     cache_value_step.add_i(value_fc_bias);
   }
 
+  if (fused_attention) {
+    /** attend the cached keys and values in place */
+    FusedAttentionArgs args;
+    args.batch = batch_size;
+    args.num_heads = num_heads;
+    args.query_len = to - from;
+    args.key_len = to;
+    args.key_dim = projected_key_dim_prop;
+    args.value_dim = projected_value_dim_prop;
+    args.scale = 1 / sqrt((float)projected_query_dim_prop);
+    args.query = projected_query_step.getData<float>();
+    args.query_stride = projected_query_step.getDim().getFeatureLen();
+    args.key = cache_key.getData<float>();
+    args.key_stride = cache_key_dim.getFeatureLen();
+    args.value = cache_value.getData<float>();
+    args.value_stride = cache_value_dim.getFeatureLen();
+    args.mask = nullptr;
+    args.causal_offset = from;
+    args.output = attention_output_step.getData<float>();
+    args.output_stride = attention_output_step.getDim().getFeatureLen();
+    args.row_stats = nullptr;
+    fusedAttentionForward(args);
+
+    attention_output_step.reshape(TensorDim(
+      {batch_size * (to - from), 1, 1, num_heads * projected_value_dim_prop}));
+    attention_output_step.dot(fc_weight, output);
+    if (!disable_bias) {
+      output.add_i(fc_bias);
+    }
+    return;
+  }
+
+  Tensor &attention_weight =
+    context.getTensor(weight_idx[AttentionParams::attention_weight]);
+  TensorDim attention_weight_dim = attention_weight.getDim();
+
+  TensorDim attention_weight_step_dim = attention_weight_dim;
+  attention_weight_step_dim.height(to - from);
+  attention_weight_step_dim.width(to);
+
+  Tensor attention_weight_step =
+    attention_weight.getSharedDataTensor(attention_weight_step_dim, 0, true);
+
   projected_query_step.reshape(
     TensorDim({batch_size, 1, num_heads, projected_query_dim_prop}));
   cached_key.reshape(
@@ -770,7 +868,99 @@ void MultiHeadAttentionLayer::incremental_forwarding(RunLayerContext &context,
   }
 }
 
+void MultiHeadAttentionLayer::calcFusedCommonDerivative(
+  RunLayerContext &context) {
+  const unsigned int num_heads =
+    std::get<props::NumHeads>(multi_head_attention_props).get();
+  const unsigned int projected_key_dim_prop =
+    std::get<props::ProjectedKeyDim>(multi_head_attention_props).get();
+  const unsigned int projected_value_dim_prop =
+    std::get<props::ProjectedValueDim>(multi_head_attention_props).get();
+
+  const bool provide_attention_mask = context.getNumInputs() == 4;
+  const unsigned int projected_query_dim_prop = projected_key_dim_prop;
+
+  Tensor &query = context.getInput(INOUT_INDEX::QUERY);
+  Tensor &key = context.getInput(INOUT_INDEX::KEY);
+  Tensor &value = context.getInput(INOUT_INDEX::VALUE);
+  const Tensor &incoming_derivative =
+    context.getIncomingDerivative(INOUT_INDEX::OUTPUT);
+
+  Tensor &fc_weight = context.getWeight(weight_idx[AttentionParams::fc_weight]);
+
+  Tensor &projected_query =
+    context.getTensor(weight_idx[AttentionParams::projected_query]);
+  Tensor &d_projected_query =
+    context.getTensorGrad(weight_idx[AttentionParams::projected_query]);
+  Tensor &projected_key =
+    context.getTensor(weight_idx[AttentionParams::projected_key]);
+  Tensor &d_projected_key =
+    context.getTensorGrad(weight_idx[AttentionParams::projected_key]);
+  Tensor &projected_value =
+    context.getTensor(weight_idx[AttentionParams::projected_value]);
+  Tensor &d_projected_value =
+    context.getTensorGrad(weight_idx[AttentionParams::projected_value]);
+
+  Tensor &attention_output =
+    context.getTensor(weight_idx[AttentionParams::attention_output]);
+  Tensor &d_attention_output =
+    context.getTensorGrad(weight_idx[AttentionParams::attention_output]);
+  Tensor &attention_row_stats =
+    context.getTensor(weight_idx[AttentionParams::attention_row_stats]);
+
+  const unsigned int batch_size = query.getDim().batch();
+  const unsigned int query_height = query.getDim().height();
+  const unsigned int key_height = key.getDim().height();
+  const unsigned int value_height = value.getDim().height();
+
+  d_attention_output.dot_deriv_wrt_1(fc_weight, incoming_derivative);
+
+  FusedAttentionArgs args;
+  args.batch = batch_size;
+  args.num_heads = num_heads;
+  args.query_len = query_height;
+  args.key_len = key_height;
+  args.key_dim = projected_key_dim_prop;
+  args.value_dim = projected_value_dim_prop;
+  args.scale = 1 / sqrt((float)projected_query_dim_prop);
+  args.query = projected_query.getData<float>();
+  args.query_stride = query_height * num_heads * projected_query_dim_prop;
+  args.key = projected_key.getData<float>();
+  args.key_stride = key_height * num_heads * projected_key_dim_prop;
+  args.value = projected_value.getData<float>();
+  args.value_stride = value_height * num_heads * projected_value_dim_prop;
+  args.mask = provide_attention_mask
+                ? context.getInput(INOUT_INDEX::MASK).getData<float>()
+                : nullptr;
+  args.causal_offset = -1;
+  args.output = attention_output.getData<float>();
+  args.output_stride = query_height * num_heads * projected_value_dim_prop;
+  args.row_stats = attention_row_stats.getData<float>();
+
+  /** the gradient of the mask is the gradient of the scores */
+  float *d_mask =
+    provide_attention_mask
+      ? context.getOutgoingDerivative(INOUT_INDEX::MASK).getData<float>()
+      : nullptr;
+  fusedAttentionBackward(args, d_attention_output.getData<float>(),
+                         d_projected_query.getData<float>(),
+                         d_projected_key.getData<float>(),
+                         d_projected_value.getData<float>(), d_mask);
+
+  d_projected_query.reshape(TensorDim(
+    {batch_size * query_height, 1, 1, num_heads * projected_query_dim_prop}));
+  d_projected_key.reshape(TensorDim(
+    {batch_size * key_height, 1, 1, num_heads * projected_key_dim_prop}));
+  d_projected_value.reshape(TensorDim(
+    {batch_size * value_height, 1, 1, num_heads * projected_value_dim_prop}));
+}
+
 void MultiHeadAttentionLayer::calcCommonDerivative(RunLayerContext &context) {
+  if (fused_attention) {
+    calcFusedCommonDerivative(context);
+    return;
+  }
+
   const unsigned int num_heads =
     std::get<props::NumHeads>(multi_head_attention_props).get();
   const unsigned int projected_key_dim_prop =
@@ -1107,9 +1297,16 @@ void MultiHeadAttentionLayer::setBatch(RunLayerContext &context,
   context.updateTensor(weight_idx[AttentionParams::cache_key], batch);
   context.updateTensor(weight_idx[AttentionParams::cache_value], batch);
   // context.updateTensor(weight_idx[AttentionParams::cache_value], batch);
-  context.updateTensor(weight_idx[AttentionParams::attention_weight], batch);
-  if (dropout_rate > epsilon) {
-    context.updateTensor(weight_idx[AttentionParams::dropout_mask], batch);
+  if (fused_attention) {
+    if (weight_idx[AttentionParams::attention_row_stats] !=
+        std::numeric_limits<unsigned>::max())
+      context.updateTensor(weight_idx[AttentionParams::attention_row_stats],
+                           batch);
+  } else {
+    context.updateTensor(weight_idx[AttentionParams::attention_weight], batch);
+    if (dropout_rate > epsilon) {
+      context.updateTensor(weight_idx[AttentionParams::dropout_mask], batch);
+    }
   }
   context.updateTensor(weight_idx[AttentionParams::attention_output], batch);
 }
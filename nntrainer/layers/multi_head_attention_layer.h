@@ -115,9 +115,12 @@ private:
     multi_head_attention_props; /**< multi_head_attention layer properties */
 
   ActiFunc sm; /** softmax activation operation */
-  std::array<unsigned int, 16>
+  std::array<unsigned int, 17>
     weight_idx; /**< indices of the weights and tensors */
 
+  bool fused_attention; /**< compute the attention without materializing the
+                           attention weight */
+
   /**
    * @brief     to protect overflow
    */
@@ -128,6 +131,12 @@ private:
    * @param context Context of the layer
    */
   void calcCommonDerivative(RunLayerContext &context);
+
+  /**
+   * @brief calculate common derivative of the fused attention
+   * @param context Context of the layer
+   */
+  void calcFusedCommonDerivative(RunLayerContext &context);
 };
 
 } // namespace nntrainer
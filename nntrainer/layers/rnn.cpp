@@ -11,8 +11,11 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
+#include <cpu_backend.h>
 #include <layer_context.h>
+#include <nntr_thread_pool.h>
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
 #include <node_exporter.h>
@@ -38,13 +41,114 @@ enum RNNParams {
   dropout_mask
 };
 
+namespace {
+
+constexpr unsigned int ROW_MAJOR = 0;
+
+/** minimum number of elements handled by a chunk of a timestep */
+constexpr unsigned int MIN_CHUNK_WORK = 1 << 14;
+
+/**
+ * @brief sequences per chunk of the element-wise part of a timestep
+ */
+unsigned int rowGrain(unsigned int unit) {
+  return std::max(1u, MIN_CHUNK_WORK / unit);
+}
+
+/**
+ * @brief forward recurrence of all sequences. @a hidden holds the input
+ * projection of every timestep on entry. A timestep adds the previous hidden
+ * states of all sequences times @a weight_hh with one gemm, then activates
+ * the rows.
+ *
+ * @param mask dropout mask, nullptr if none
+ * @param mask_step elements between the masks of two timesteps
+ */
+void forwardRecurrence(unsigned int batch, unsigned int timestep,
+                       unsigned int unit, ActiFunc::ActiKernel acti,
+                       const float *weight_hh, float *hidden,
+                       const float *mask, unsigned int mask_step) {
+  const size_t stride = static_cast<size_t>(timestep) * unit;
+  const size_t mask_stride = static_cast<size_t>(mask_step ? timestep : 1) *
+                             unit;
+
+  for (unsigned int t = 0; t < timestep; ++t) {
+    if (t)
+      sgemm(ROW_MAJOR, false, false, batch, unit, unit, 1.0f,
+            hidden + (t - 1) * unit, stride, weight_hh, unit, 1.0f,
+            hidden + t * unit, stride);
+
+    auto run = [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b) {
+        float *h = hidden + b * stride + t * unit;
+        acti(unit, h, h);
+        if (mask) {
+          const float *m = mask + b * mask_stride + t * mask_step;
+          for (unsigned int u = 0; u < unit; ++u)
+            h[u] *= m[u];
+        }
+      }
+    };
+    ThreadPool::Global().parallelFor(0, batch, rowGrain(unit), run);
+  }
+}
+
+/**
+ * @brief backward recurrence of all sequences. @a d_hidden holds the
+ * incoming derivative of every timestep on entry and the derivative of the
+ * activation input on exit.
+ */
+void backwardRecurrence(unsigned int batch, unsigned int timestep,
+                        unsigned int unit, ActiFunc::ActiPrimeKernel prime,
+                        const float *weight_hh, const float *hidden,
+                        float *d_hidden) {
+  const size_t stride = static_cast<size_t>(timestep) * unit;
+
+  for (unsigned int t = timestep; t-- > 0;) {
+    auto run = [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b) {
+        float *d_h = d_hidden + b * stride + t * unit;
+        prime(unit, hidden + b * stride + t * unit, d_h, d_h);
+      }
+    };
+    ThreadPool::Global().parallelFor(0, batch, rowGrain(unit), run);
+
+    if (t)
+      sgemm(ROW_MAJOR, false, true, batch, unit, unit, 1.0f,
+            d_hidden + t * unit, stride, weight_hh, unit, 1.0f,
+            d_hidden + (t - 1) * unit, stride);
+  }
+}
+
+/**
+ * @brief accumulate the gradient of weight_hh over all sequences. A timestep
+ * pairs with the hidden state of the previous one, so a sequence is one gemm
+ * over timestep - 1 rows.
+ */
+void recurrentWeightGradient(unsigned int batch, unsigned int timestep,
+                             unsigned int unit, const float *hidden,
+                             const float *d_hidden, float *d_weight_hh) {
+  const size_t stride = static_cast<size_t>(timestep) * unit;
+
+  if (timestep < 2)
+    return;
+
+  for (unsigned int b = 0; b < batch; ++b)
+    sgemm(ROW_MAJOR, true, false, unit, unit, timestep - 1, 1.0f,
+          hidden + b * stride, unit, d_hidden + b * stride + unit, unit, 1.0f,
+          d_weight_hh, unit);
+}
+
+} // namespace
+
 RNNLayer::RNNLayer() :
   LayerImpl(),
   rnn_props(
     props::Unit(), props::HiddenStateActivation() = ActivationType::ACT_TANH,
     props::ReturnSequences(), props::DropOutRate(), props::IntegrateBias()),
   acti_func(ActivationType::ACT_NONE, true),
-  epsilon(1e-3f) {
+  epsilon(1e-3f),
+  batched_engine(true) {
   wt_idx.fill(std::numeric_limits<unsigned>::max());
 }
 
@@ -193,43 +297,79 @@ void RNNLayer::forwarding(RunLayerContext &context, bool training) {
 
   Tensor &hidden_state = context.getTensor(wt_idx[RNNParams::hidden_state]);
 
-  // TODO: swap batch and timestep index with transpose
-  for (unsigned int batch = 0; batch < batch_size; ++batch) {
-    Tensor input_slice = input.getBatchSlice(batch, 1);
-    Tensor hidden_state_slice = hidden_state.getBatchSlice(batch, 1);
+  if (batched_engine && acti_func.getKernel() && acti_func.getPrimeKernel()) {
+    const unsigned int rows = batch_size * max_timestep;
+
+    /** the input projection of every timestep is one gemm */
+    const Tensor inputs =
+      input.getSharedDataTensor(TensorDim({rows, feature_size}), 0);
+    Tensor states =
+      hidden_state.getSharedDataTensor(TensorDim({rows, unit}), 0);
+    inputs.dot(weight_ih, states);
+    if (!disable_bias) {
+      if (integrate_bias) {
+        states.add_i(bias_h);
+      } else {
+        states.add_i(bias_ih);
+        states.add_i(bias_hh);
+      }
+    }
 
-    for (unsigned int timestep = 0; timestep < max_timestep; ++timestep) {
-      Tensor in = input_slice.getSharedDataTensor({feature_size},
-                                                  timestep * feature_size);
-      Tensor hs =
-        hidden_state_slice.getSharedDataTensor({unit}, timestep * unit);
+    const float *mask_data = nullptr;
+    unsigned int mask_step = 0;
+    if (dropout_rate > epsilon && training) {
+      Tensor &mask = context.getTensor(wt_idx[RNNParams::dropout_mask]);
+      mask.dropout_mask(dropout_rate);
+      mask_data = mask.getData<float>();
+      /** a single row mask is shared by every timestep as in calcGradient */
+      mask_step = mask.height() == 1 ? 0 : unit;
+    }
 
-      in.dot(weight_ih, hs);
-      if (!disable_bias) {
-        if (integrate_bias) {
-          hs.add_i(bias_h);
-        } else {
-          hs.add_i(bias_ih);
-          hs.add_i(bias_hh);
+    forwardRecurrence(batch_size, max_timestep, unit, acti_func.getKernel(),
+                      weight_hh.getData<float>(),
+                      hidden_state.getData<float>(), mask_data, mask_step);
+  } else {
+    for (unsigned int batch = 0; batch < batch_size; ++batch) {
+      Tensor input_slice = input.getBatchSlice(batch, 1);
+      Tensor hidden_state_slice = hidden_state.getBatchSlice(batch, 1);
+
+      for (unsigned int timestep = 0; timestep < max_timestep; ++timestep) {
+        Tensor in = input_slice.getSharedDataTensor({feature_size},
+                                                    timestep * feature_size);
+        Tensor hs =
+          hidden_state_slice.getSharedDataTensor({unit}, timestep * unit);
+
+        in.dot(weight_ih, hs);
+        if (!disable_bias) {
+          if (integrate_bias) {
+            hs.add_i(bias_h);
+          } else {
+            hs.add_i(bias_ih);
+            hs.add_i(bias_hh);
+          }
         }
-      }
-
-      if (timestep) {
-        Tensor prev_hs =
-          hidden_state_slice.getSharedDataTensor({unit}, (timestep - 1) * unit);
-        prev_hs.dot(weight_hh, hs, false, false, 1.0);
-      }
 
-      // In-place calculation for activation
-      acti_func.run_fn(hs, hs);
+        if (timestep) {
+          Tensor prev_hs = hidden_state_slice.getSharedDataTensor(
+            {unit}, (timestep - 1) * unit);
+          prev_hs.dot(weight_hh, hs, false, false, 1.0);
+        }
 
-      if (dropout_rate > epsilon && training) {
-        Tensor dropout_mask = context.getTensor(wt_idx[RNNParams::dropout_mask])
-                                .getBatchSlice(batch, 1);
-        Tensor dropout_mask_t =
-          dropout_mask.getSharedDataTensor({unit}, timestep * unit);
-        dropout_mask_t.dropout_mask(dropout_rate);
-        hs.multiply_i(dropout_mask_t);
+        // In-place calculation for activation
+        acti_func.run_fn(hs, hs);
+
+        if (dropout_rate > epsilon && training) {
+          Tensor dropout_mask =
+            context.getTensor(wt_idx[RNNParams::dropout_mask])
+              .getBatchSlice(batch, 1);
+          /** a single row mask is drawn once and shared by every timestep */
+          const bool shared = dropout_mask.height() == 1;
+          Tensor dropout_mask_t = dropout_mask.getSharedDataTensor(
+            {unit}, shared ? 0 : timestep * unit);
+          if (!shared || timestep == 0)
+            dropout_mask_t.dropout_mask(dropout_rate);
+          hs.multiply_i(dropout_mask_t);
+        }
       }
     }
   }
@@ -322,6 +462,39 @@ void RNNLayer::calcGradient(RunLayerContext &context) {
 
   Tensor &hidden_state = context.getTensor(wt_idx[RNNParams::hidden_state]);
 
+  if (batched_engine && acti_func.getKernel() && acti_func.getPrimeKernel()) {
+    const unsigned int rows = batch_size * max_timestep;
+
+    backwardRecurrence(batch_size, max_timestep, unit,
+                       acti_func.getPrimeKernel(), weight_hh.getData<float>(),
+                       hidden_state.getData<float>(),
+                       hidden_state_derivative.getData<float>());
+
+    /** the weight_ih gradient of every timestep is one gemm */
+    const Tensor inputs =
+      input.getSharedDataTensor(TensorDim({rows, input_dim.width()}), 0);
+    const Tensor d_states =
+      hidden_state_derivative.getSharedDataTensor(TensorDim({rows, unit}), 0);
+    inputs.dot(d_states, djdweight_ih, true, false, 1.0f);
+
+    recurrentWeightGradient(batch_size, max_timestep, unit,
+                            hidden_state.getData<float>(),
+                            hidden_state_derivative.getData<float>(),
+                            djdweight_hh.getData<float>());
+
+    if (!disable_bias) {
+      const Tensor d_state_rows = hidden_state_derivative.getSharedDataTensor(
+        TensorDim(rows, 1, 1, unit), 0);
+      if (integrate_bias) {
+        d_state_rows.sum(0, djdbias_h, 1.0f, 1.0f);
+      } else {
+        d_state_rows.sum(0, djdbias_ih, 1.0f, 1.0f);
+        d_state_rows.sum(0, djdbias_hh, 1.0f, 1.0f);
+      }
+    }
+    return;
+  }
+
   for (unsigned int batch = 0; batch < batch_size; ++batch) {
     Tensor deriv_t = hidden_state_derivative.getBatchSlice(batch, 1);
     Tensor input_t = input.getBatchSlice(batch, 1);
@@ -33,6 +33,19 @@ enum ZoneoutLSTMParams {
   lstm_cell_state,
 };
 
+/**
+ * @brief packed zoneout mask of @a timestep out of the mask of all timesteps,
+ * which has a row of words for each (timestep, batch)
+ */
+static Tensor getZoneoutBitmask(Tensor &mask, unsigned int timestep,
+                                unsigned int batch_size) {
+  const TensorDim &dim = mask.getDim();
+  const TensorDim step_dim(batch_size, 1, 1, dim.width(), dim.getFormat(),
+                           dim.getDataType());
+  return mask.getSharedDataTensor(step_dim,
+                                  timestep * batch_size * dim.width());
+}
+
 ZoneoutLSTMCellLayer::ZoneoutLSTMCellLayer() :
   zoneout_lstmcell_props(HiddenStateZoneOutRate(), CellStateZoneOutRate(),
                          Test(), props::MaxTimestep(), props::Timestep()) {
@@ -194,6 +207,11 @@ void ZoneoutLSTMCellLayer::finalize(InitLayerContext &context) {
   // * batch_size, 1, 1, unit ]
   const TensorDim hidden_state_zoneout_mask_dim(max_timestep * batch_size, 1, 1,
                                                 unit);
+  // zoneout_bitmask_dim = [ max_timestep * batch_size, 1, 1, (unit + 31) / 32 ]
+  // one bit per element, set when the new state is kept
+  const TensorDim zoneout_bitmask_dim(
+    max_timestep * batch_size, 1, 1, (unit + 31) / 32,
+    input_dim.getFormat(), TensorDim::DataType::UINT32);
   if (test) {
     wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask] =
       context.requestWeight(hidden_state_zoneout_mask_dim, Initializer::NONE,
@@ -201,8 +219,8 @@ void ZoneoutLSTMCellLayer::finalize(InitLayerContext &context) {
                             "hidden_state_zoneout_mask", false);
   } else {
     wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask] =
-      context.requestTensor(hidden_state_zoneout_mask_dim,
-                            "hidden_state_zoneout_mask", Initializer::NONE,
+      context.requestTensor(zoneout_bitmask_dim, "hidden_state_zoneout_mask",
+                            Initializer::NONE,
                             false, TensorLifespan::ITERATION_LIFESPAN, false);
   }
 
@@ -215,7 +233,7 @@ void ZoneoutLSTMCellLayer::finalize(InitLayerContext &context) {
       1.0f, 0.0f, "cell_state_zoneout_mask", false);
   } else {
     wt_idx[ZoneoutLSTMParams::cell_state_zoneout_mask] = context.requestTensor(
-      cell_state_zoneout_mask_dim, "cell_state_zoneout_mask", Initializer::NONE,
+      zoneout_bitmask_dim, "cell_state_zoneout_mask", Initializer::NONE,
       false, TensorLifespan::ITERATION_LIFESPAN, false);
   }
 
@@ -296,43 +314,42 @@ void ZoneoutLSTMCellLayer::forwarding(RunLayerContext &context, bool training) {
               hidden_state, lstm_cell_state, weight_ih, weight_hh, bias_h,
               bias_ih, bias_hh, ifgo);
 
-  if (training) {
+  if (training && !test) {
+    Tensor hidden_state_zoneout_mask = getZoneoutBitmask(
+      context.getTensor(wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask]),
+      timestep, batch_size);
+    hidden_state_zoneout_mask.setRandBitmask(1.0f - hidden_state_zoneout_rate);
+    hidden_state.select_bitmask(hidden_state_zoneout_mask, prev_hidden_state,
+                                hidden_state);
+
+    Tensor cell_state_zoneout_mask = getZoneoutBitmask(
+      context.getTensor(wt_idx[ZoneoutLSTMParams::cell_state_zoneout_mask]),
+      timestep, batch_size);
+    cell_state_zoneout_mask.setRandBitmask(1.0f - cell_state_zoneout_rate);
+    lstm_cell_state.select_bitmask(cell_state_zoneout_mask, prev_cell_state,
+                                   cell_state);
+  } else if (training) {
     Tensor &hs_zoneout_mask =
-      test ? context.getWeight(
-               wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask])
-           : context.getTensor(
-               wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask]);
+      context.getWeight(wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask]);
     hs_zoneout_mask.reshape({max_timestep, 1, batch_size, unit});
     Tensor hidden_state_zoneout_mask =
       hs_zoneout_mask.getBatchSlice(timestep, 1);
     hidden_state_zoneout_mask.reshape({batch_size, 1, 1, unit});
     Tensor prev_hidden_state_zoneout_mask;
-    if (!test) {
-      prev_hidden_state_zoneout_mask =
-        hidden_state_zoneout_mask.zoneout_mask(hidden_state_zoneout_rate);
-    } else {
-      hidden_state_zoneout_mask.multiply(-1.0f, prev_hidden_state_zoneout_mask);
-      prev_hidden_state_zoneout_mask.add_i(1.0f);
-    }
+    hidden_state_zoneout_mask.multiply(-1.0f, prev_hidden_state_zoneout_mask);
+    prev_hidden_state_zoneout_mask.add_i(1.0f);
 
     hidden_state.multiply_i(hidden_state_zoneout_mask);
     prev_hidden_state.multiply(prev_hidden_state_zoneout_mask, hidden_state,
                                1.0f);
     Tensor &cs_zoneout_mask =
-      test
-        ? context.getWeight(wt_idx[ZoneoutLSTMParams::cell_state_zoneout_mask])
-        : context.getTensor(wt_idx[ZoneoutLSTMParams::cell_state_zoneout_mask]);
+      context.getWeight(wt_idx[ZoneoutLSTMParams::cell_state_zoneout_mask]);
     cs_zoneout_mask.reshape({max_timestep, 1, batch_size, unit});
     Tensor cell_state_zoneout_mask = cs_zoneout_mask.getBatchSlice(timestep, 1);
     cell_state_zoneout_mask.reshape({batch_size, 1, 1, unit});
     Tensor prev_cell_state_zoneout_mask;
-    if (!test) {
-      prev_cell_state_zoneout_mask =
-        cell_state_zoneout_mask.zoneout_mask(cell_state_zoneout_rate);
-    } else {
-      cell_state_zoneout_mask.multiply(-1.0f, prev_cell_state_zoneout_mask);
-      prev_cell_state_zoneout_mask.add_i(1.0f);
-    }
+    cell_state_zoneout_mask.multiply(-1.0f, prev_cell_state_zoneout_mask);
+    prev_cell_state_zoneout_mask.add_i(1.0f);
 
     lstm_cell_state.multiply(cell_state_zoneout_mask, cell_state);
     prev_cell_state.multiply(prev_cell_state_zoneout_mask, cell_state, 1.0f);
@@ -431,38 +448,53 @@ void ZoneoutLSTMCellLayer::calcGradient(RunLayerContext &context) {
 
   Tensor d_prev_hidden_state_residual;
   Tensor d_hidden_state_masked;
-  Tensor &hs_zoneout_mask =
-    test
-      ? context.getWeight(wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask])
-      : context.getTensor(wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask]);
-  hs_zoneout_mask.reshape({max_timestep, 1, batch_size, unit});
-  Tensor hidden_state_zoneout_mask = hs_zoneout_mask.getBatchSlice(timestep, 1);
-  hidden_state_zoneout_mask.reshape({batch_size, 1, 1, unit});
-  Tensor prev_hidden_state_zoneout_mask = hidden_state_zoneout_mask.apply(
-    (std::function<float(float)>)[epsilon = epsilon](float x) {
-      return x < epsilon;
-    });
-
-  d_hidden_state.multiply(prev_hidden_state_zoneout_mask,
-                          d_prev_hidden_state_residual);
-  d_hidden_state.multiply(hidden_state_zoneout_mask, d_hidden_state_masked);
-
   Tensor d_prev_cell_state_residual;
-  Tensor &cs_zoneout_mask =
-    test
-      ? context.getWeight(wt_idx[ZoneoutLSTMParams::cell_state_zoneout_mask])
-      : context.getTensor(wt_idx[ZoneoutLSTMParams::cell_state_zoneout_mask]);
-  cs_zoneout_mask.reshape({max_timestep, 1, batch_size, unit});
-  Tensor cell_state_zoneout_mask = cs_zoneout_mask.getBatchSlice(timestep, 1);
-  cell_state_zoneout_mask.reshape({batch_size, 1, 1, unit});
-  Tensor prev_cell_state_zoneout_mask = cell_state_zoneout_mask.apply(
-    (std::function<float(float)>)[epsilon = epsilon](float x) {
-      return x < epsilon;
-    });
-
-  d_cell_state.multiply(prev_cell_state_zoneout_mask,
-                        d_prev_cell_state_residual);
-  d_cell_state.multiply(cell_state_zoneout_mask, d_lstm_cell_state);
+  if (!test) {
+    const Tensor hidden_state_zoneout_mask = getZoneoutBitmask(
+      context.getTensor(wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask]),
+      timestep, batch_size);
+    d_hidden_state.multiply_bitmask(hidden_state_zoneout_mask, 0.0f, 1.0f,
+                                    d_prev_hidden_state_residual);
+    d_hidden_state.multiply_bitmask(hidden_state_zoneout_mask, 1.0f, 0.0f,
+                                    d_hidden_state_masked);
+
+    const Tensor cell_state_zoneout_mask = getZoneoutBitmask(
+      context.getTensor(wt_idx[ZoneoutLSTMParams::cell_state_zoneout_mask]),
+      timestep, batch_size);
+    d_cell_state.multiply_bitmask(cell_state_zoneout_mask, 0.0f, 1.0f,
+                                  d_prev_cell_state_residual);
+    d_cell_state.multiply_bitmask(cell_state_zoneout_mask, 1.0f, 0.0f,
+                                  d_lstm_cell_state);
+  } else {
+    Tensor &hs_zoneout_mask =
+      context.getWeight(wt_idx[ZoneoutLSTMParams::hidden_state_zoneout_mask]);
+    hs_zoneout_mask.reshape({max_timestep, 1, batch_size, unit});
+    Tensor hidden_state_zoneout_mask =
+      hs_zoneout_mask.getBatchSlice(timestep, 1);
+    hidden_state_zoneout_mask.reshape({batch_size, 1, 1, unit});
+    Tensor prev_hidden_state_zoneout_mask = hidden_state_zoneout_mask.apply(
+      (std::function<float(float)>)[epsilon = epsilon](float x) {
+        return x < epsilon;
+      });
+
+    d_hidden_state.multiply(prev_hidden_state_zoneout_mask,
+                            d_prev_hidden_state_residual);
+    d_hidden_state.multiply(hidden_state_zoneout_mask, d_hidden_state_masked);
+
+    Tensor &cs_zoneout_mask =
+      context.getWeight(wt_idx[ZoneoutLSTMParams::cell_state_zoneout_mask]);
+    cs_zoneout_mask.reshape({max_timestep, 1, batch_size, unit});
+    Tensor cell_state_zoneout_mask = cs_zoneout_mask.getBatchSlice(timestep, 1);
+    cell_state_zoneout_mask.reshape({batch_size, 1, 1, unit});
+    Tensor prev_cell_state_zoneout_mask = cell_state_zoneout_mask.apply(
+      (std::function<float(float)>)[epsilon = epsilon](float x) {
+        return x < epsilon;
+      });
+
+    d_cell_state.multiply(prev_cell_state_zoneout_mask,
+                          d_prev_cell_state_residual);
+    d_cell_state.multiply(cell_state_zoneout_mask, d_lstm_cell_state);
+  }
 
   calcGradientLSTM(batch_size, unit, disable_bias, integrate_bias, acti_func,
                    recurrent_acti_func, input, prev_hidden_state,
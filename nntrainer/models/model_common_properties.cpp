@@ -30,13 +30,30 @@ ContinueTrain::ContinueTrain(bool value) { set(value); }
 
 MemoryOptimization::MemoryOptimization(bool value) { set(value); }
 
+PartialBatch::PartialBatch(bool value) { set(value); }
+
 MemorySwap::MemorySwap(bool value) { set(value); }
 
 MemorySwapPath::MemorySwapPath(const std::string &value) { set(value); }
 
+MemoryMapWeights::MemoryMapWeights(bool value) { set(value); }
+
 MemorySwapLookahead::MemorySwapLookahead(const unsigned int &value) {
   set(value);
 }
+
+MemorySwapCompressBudget::MemorySwapCompressBudget(const unsigned int &value) {
+  set(value);
+}
+
+MemorySwapLossy::MemorySwapLossy(bool value) { set(value); }
+
+MemorySwapPrefetchLimit::MemorySwapPrefetchLimit(const unsigned int &value) {
+  set(value);
+}
+
+InterOpParallel::InterOpParallel(bool value) { set(value); }
+
 ModelTensorDataType::ModelTensorDataType(ModelTensorDataTypeInfo::Enum value) {
   set(value);
 }
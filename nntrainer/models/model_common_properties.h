@@ -126,6 +126,36 @@ public:
   MemoryOptimization(bool value = true);
 };
 
+/**
+ * @brief run the last partial batch of an epoch instead of skipping it
+ *
+ */
+class PartialBatch : public Property<bool> {
+public:
+  static constexpr const char *key =
+    "partial_batch";              /**< unique key to access */
+  using prop_tag = bool_prop_tag; /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to false
+   */
+  PartialBatch(bool value = false);
+};
+
+/**
+ * @brief largest batch size expected, the tensors are planned once for it so
+ * that a batch change up to it does not plan and allocate again
+ *
+ */
+class MaxBatchSize : public PositiveIntegerProperty {
+public:
+  static constexpr const char *key =
+    "max_batch_size";             /**< unique key to access */
+  using prop_tag = uint_prop_tag; /**< property type */
+};
+
 /**
  * @brief cache size property
  *
@@ -179,6 +209,83 @@ public:
   MemorySwapLookahead(const unsigned int &value = 0);
 };
 
+/**
+ * @brief budget of the compressed in-memory swap tier in MiB, 0 to swap out to
+ * the swap file only
+ *
+ */
+class MemorySwapCompressBudget : public Property<unsigned int> {
+public:
+  static constexpr const char *key =
+    "memory_swap_compress_budget"; /**< unique key to access */
+  using prop_tag = uint_prop_tag;  /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to 0
+   */
+  MemorySwapCompressBudget(const unsigned int &value = 0);
+};
+
+/**
+ * @brief pack FP32 activations to FP16 in the compressed in-memory swap tier
+ *
+ */
+class MemorySwapLossy : public Property<bool> {
+public:
+  static constexpr const char *key =
+    "memory_swap_lossy";          /**< unique key to access */
+  using prop_tag = bool_prop_tag; /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to false
+   */
+  MemorySwapLossy(bool value = false);
+};
+
+/**
+ * @brief limit in MiB of the swapped out data loaded ahead of the running
+ * execution order. If set, the lookahead is chosen for each execution order
+ * from the measured load and compute time, 0 to use the fixed
+ * memory_swap_lookahead
+ *
+ */
+class MemorySwapPrefetchLimit : public Property<unsigned int> {
+public:
+  static constexpr const char *key =
+    "memory_swap_prefetch_limit"; /**< unique key to access */
+  using prop_tag = uint_prop_tag; /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to 0
+   */
+  MemorySwapPrefetchLimit(const unsigned int &value = 0);
+};
+
+/**
+ * @brief map the weights from the model file instead of reading them when
+ * loading for inference. Effective only if built with enable-mmap
+ *
+ */
+class MemoryMapWeights : public Property<bool> {
+public:
+  static constexpr const char *key =
+    "memory_map_weights";         /**< unique key to access */
+  using prop_tag = bool_prop_tag; /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to false
+   */
+  MemoryMapWeights(bool value = false);
+};
+
 /**
  * @brief     Enumeration of Data Type for model & layer
  */
@@ -240,6 +347,36 @@ public:
   bool isValid(const float &value) const override;
 };
 
+/**
+ * @brief number of threads of the global thread pool, including the caller.
+ * If not given, NNTR_NUM_THREADS env or the build option is used
+ *
+ */
+class NumThreads : public PositiveIntegerProperty {
+public:
+  static constexpr const char *key = "num_threads"; /**< unique key to access */
+  using prop_tag = uint_prop_tag;                    /**< property type */
+};
+
+/**
+ * @brief run the layers of the graph which do not depend on each other at the
+ * same time. Ignored if memory_swap is set
+ *
+ */
+class InterOpParallel : public Property<bool> {
+public:
+  static constexpr const char *key =
+    "inter_op_parallel";          /**< unique key to access */
+  using prop_tag = bool_prop_tag; /**< property type */
+
+  /**
+   * @brief Constructor
+   *
+   * @param value value to set, defaults to false
+   */
+  InterOpParallel(bool value = false);
+};
+
 } // namespace nntrainer::props
 
 #endif
@@ -29,8 +29,10 @@
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <utility>
 
 #include <activation_realizer.h>
+#include <bn_fold_realizer.h>
 #include <common_properties.h>
 #include <databuffer.h>
 #include <flatten_realizer.h>
@@ -40,6 +42,7 @@
 #include <model_loader.h>
 #include <multiout_realizer.h>
 #include <neuralnet.h>
+#include <nntr_thread_pool.h>
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
 #include <node_exporter.h>
@@ -70,8 +73,13 @@ NeuralNetwork::NeuralNetwork() :
   model_flex_props(
     props::Epochs(), props::TrainingBatchSize(), props::SavePath(),
     props::ContinueTrain(), props::SaveBestPath(), props::MemoryOptimization(),
-    props::MemorySwap(), props::MemorySwapPath(), props::MemorySwapLookahead(),
-    props::TensorFormat(), props::ModelTensorDataType()),
+    props::PartialBatch(), props::MaxBatchSize(), props::MemorySwap(),
+    props::MemorySwapPath(), props::MemorySwapLookahead(),
+    props::MemorySwapCompressBudget(),
+    props::MemorySwapLossy(), props::MemorySwapPrefetchLimit(),
+    props::MemoryMapWeights(), props::TensorFormat(),
+    props::ModelTensorDataType(), props::NumThreads(),
+    props::InterOpParallel()),
   load_path(std::string()),
   epoch_idx(0),
   iter(0),
@@ -90,8 +98,13 @@ NeuralNetwork::NeuralNetwork(AppContext app_context_) :
   model_flex_props(
     props::Epochs(), props::TrainingBatchSize(), props::SavePath(),
     props::ContinueTrain(), props::SaveBestPath(), props::MemoryOptimization(),
-    props::MemorySwap(), props::MemorySwapPath(), props::MemorySwapLookahead(),
-    props::TensorFormat(), props::ModelTensorDataType()),
+    props::PartialBatch(), props::MaxBatchSize(), props::MemorySwap(),
+    props::MemorySwapPath(), props::MemorySwapLookahead(),
+    props::MemorySwapCompressBudget(),
+    props::MemorySwapLossy(), props::MemorySwapPrefetchLimit(),
+    props::MemoryMapWeights(), props::TensorFormat(),
+    props::ModelTensorDataType(), props::NumThreads(),
+    props::InterOpParallel()),
   load_path(std::string()),
   epoch_idx(0),
   iter(0),
@@ -170,11 +183,23 @@ int NeuralNetwork::compile(ExecutionMode mode) {
   realizers.emplace_back(new FlattenRealizer());
   realizers.emplace_back(new ActivationRealizer());
 
+  bool memory_swap = std::get<props::MemorySwap>(model_flex_props);
+
+  /// folding rewrites the weights in place after they are read, so it is not
+  /// applied to weights swapped or mapped from the file
+  if (mode == ExecutionMode::INFERENCE && !memory_swap &&
+      !std::get<props::MemoryMapWeights>(model_flex_props) &&
+      std::get<props::TensorFormat>(model_flex_props).get() ==
+        TensorDim::Format::NCHW &&
+      std::get<props::ModelTensorDataType>(model_flex_props).get() ==
+        props::ModelTensorDataTypeInfo::Enum::W32A32) {
+    realizers.emplace_back(new BnFoldRealizer());
+  }
+
   for (auto &realizer : realizers) {
     graph_representation = realizer->realize(graph_representation);
   }
 
-  bool memory_swap = std::get<props::MemorySwap>(model_flex_props);
   const std::string memory_swap_path =
     std::get<props::MemorySwapPath>(model_flex_props);
   unsigned int lookahead =
@@ -189,8 +214,33 @@ int NeuralNetwork::compile(ExecutionMode mode) {
   model_graph = NetworkGraph(memory_swap, mode, memory_swap_path, lookahead,
                              tensor_format, tensor_type);
 
+  if (auto &num_threads = std::get<props::NumThreads>(model_flex_props);
+      !num_threads.empty()) {
+    ThreadPool::Global().setNumThreads(num_threads);
+  }
+
+  bool inter_op_parallel = std::get<props::InterOpParallel>(model_flex_props);
+  if (inter_op_parallel && memory_swap) {
+    ml_logw("inter_op_parallel is ignored as memory_swap is enabled");
+    inter_op_parallel = false;
+  }
+
   model_graph.setMemoryOptimizations(
     std::get<props::MemoryOptimization>(model_flex_props));
+  model_graph.setInterOpParallel(inter_op_parallel);
+  if (auto &max_batch_size = std::get<props::MaxBatchSize>(model_flex_props);
+      !max_batch_size.empty()) {
+    model_graph.setMaxBatchSize(max_batch_size);
+  }
+  model_graph.setCompressedSwapTier(
+    static_cast<size_t>(
+      std::get<props::MemorySwapCompressBudget>(model_flex_props))
+      << 20,
+    std::get<props::MemorySwapLossy>(model_flex_props));
+  model_graph.setPrefetchLimit(
+    static_cast<size_t>(
+      std::get<props::MemorySwapPrefetchLimit>(model_flex_props))
+    << 20);
   for (auto &node : graph_representation) {
     if (auto &prop = std::get<props::ClipGradByGlobalNorm>(model_props);
         !prop.empty()) {
@@ -651,6 +701,17 @@ void NeuralNetwork::load(const std::string &file_path,
       << "Cannot load if not initialized yet, path: " << file_path
       << " format: " << static_cast<unsigned>(format);
 
+#ifdef USE_MMAP
+    /// weights point to the pages of the file, so nothing is read here and the
+    /// pages are shared by every process serving the same model
+    if (exec_mode == ExecutionMode::INFERENCE && !swap_mode &&
+        std::get<props::MemoryMapWeights>(model_flex_props) &&
+        model_graph.mapWeights(file_path)) {
+      ml_logi("mapped modelfile: %s", file_path.c_str());
+      break;
+    }
+#endif
+
     auto model_file = checkedOpenStream<std::ifstream>(
       file_path, std::ios::in | std::ios::binary);
     for (auto iter = model_graph.cbegin(); iter != model_graph.cend(); iter++) {
@@ -813,7 +874,11 @@ sharedConstTensors NeuralNetwork::inference(sharedConstTensors X,
   if (!validateInput(X))
     throw std::invalid_argument("Input validation failed.");
 
-  allocate(ExecutionMode::INFERENCE);
+  /// tensors already planned for inference are reused, a batch change is
+  /// handled by setBatchSize()
+  if (!model_graph.isAllocated(ExecutionMode::INFERENCE) ||
+      std::get<props::MemorySwap>(model_flex_props))
+    allocate(ExecutionMode::INFERENCE);
 
   int nn_foward;
   PROFILE_TIME_REGISTER_EVENT(nn_foward, "nn_forward");
@@ -821,6 +886,14 @@ sharedConstTensors NeuralNetwork::inference(sharedConstTensors X,
   out = forwarding(X, label, false);
   PROFILE_TIME_END(nn_foward);
 
+  if (std::get<props::MemorySwap>(model_flex_props)) {
+    auto prefetch = model_graph.getPrefetchStats(true);
+    ml_logi("prefetch waits: %u, stalled: %u (%lf s), compute: %lf s, "
+            "max lookahead: %u",
+            prefetch.waits, prefetch.stalls, prefetch.stall_time,
+            prefetch.compute_time, prefetch.lookahead);
+  }
+
   if (free_mem)
     /**
      * Free the memory needed for training before exiting.
@@ -893,7 +966,8 @@ sharedConstTensors NeuralNetwork::incremental_inference(
   if (!validateInput(X))
     throw std::invalid_argument("Input validation failed.");
 
-  if (from == 0) {
+  if (from == 0 && (!model_graph.isAllocated(ExecutionMode::INFERENCE) ||
+                    std::get<props::MemorySwap>(model_flex_props))) {
     allocate(ExecutionMode::INFERENCE);
   }
 
@@ -1064,8 +1138,9 @@ int NeuralNetwork::train_run(
   }
 
   auto batch_size = std::get<props::TrainingBatchSize>(model_flex_props);
+  auto partial_batch = std::get<props::PartialBatch>(model_flex_props);
 
-  auto const &outputs = model_graph.getOutputTensors();
+  auto outputs = model_graph.getOutputTensors();
   auto in_dims = model_graph.getInputDimension();
   auto label_dims = model_graph.getOutputDimension();
 
@@ -1086,7 +1161,8 @@ int NeuralNetwork::train_run(
    * @param on_epoch_end function that will receive reference to stat,
    * buffer which will be called on the epoch end
    */
-  auto run_epoch = [this, &in_dims, &label_dims, &outputs, batch_size](
+  auto run_epoch = [this, &in_dims, &label_dims, &outputs, batch_size,
+                    partial_batch](
                      DataBuffer *buffer, bool shuffle,
                      auto &&on_iteration_fetch, auto &&on_iteration_update_stat,
                      auto &&on_epoch_end, RunStats &stat) {
@@ -1109,9 +1185,14 @@ int NeuralNetwork::train_run(
         break;
       }
       auto &iteration = iter_view.get();
-      if (iteration.batch() != static_cast<unsigned int>(batch_size)) {
-        /// @todo support partial batch
-        continue;
+      if (iteration.batch() != model_graph.getBatchSize()) {
+        if (!partial_batch) {
+          continue;
+        }
+        /// the last iteration of an epoch runs on the front of the tensors
+        /// allocated for the full batch
+        model_graph.setBatchSize(iteration.batch());
+        outputs = model_graph.getOutputTensors();
       }
 
       auto const &labels = iteration.getLabelsRef();
@@ -1122,6 +1203,11 @@ int NeuralNetwork::train_run(
       on_iteration_update_stat(stat, outputs, labels);
     }
     future_iq.get();
+
+    if (model_graph.getBatchSize() != static_cast<unsigned int>(batch_size)) {
+      model_graph.setBatchSize(batch_size);
+      outputs = model_graph.getOutputTensors();
+    }
     on_epoch_end(stat, *buffer);
 
     if (stat.num_iterations == 0) {
@@ -1140,6 +1226,14 @@ int NeuralNetwork::train_run(
       // To avoid unconsidered memory leak, we need to clear the cache
       model_graph.flushCache();
 
+      if (std::get<props::MemorySwap>(model_flex_props)) {
+        auto swap = model_graph.getSwapStats(true);
+        ml_logi("swap read: %zu bytes, written: %zu bytes, dropped clean: %zu "
+                "bytes, compressed tier stored: %zu bytes, loaded: %zu bytes",
+                swap.read_bytes, swap.write_bytes, swap.clean_bytes,
+                swap.tier_store_bytes, swap.tier_load_bytes);
+      }
+
       if (!stop_cb(stop_user_data)) {
         std::cout << "#" << epoch_idx << "/" << getEpochs();
         ml_logi("# %d / %d", epoch_idx, getEpochs());
@@ -1187,32 +1281,37 @@ int NeuralNetwork::train_run(
     forwarding(false, stop_cb, stop_user_data);
   };
 
-  auto update_eval_stat = [batch_size, &update_train_stat](
+  /// number of evaluated samples, the last batch of an epoch can be partial
+  unsigned int num_eval_samples = 0;
+
+  auto update_eval_stat = [&num_eval_samples, &update_train_stat](
                             RunStats &stat, const std::vector<Tensor> &outputs,
                             const std::vector<Tensor> &labels) {
     auto model_out = outputs[0].argmax();
     auto label_out = labels[0].argmax();
+    unsigned int batch = outputs[0].batch();
 
-    for (unsigned int b = 0; b < batch_size; b++) {
+    for (unsigned int b = 0; b < batch; b++) {
       if (model_out[b] == label_out[b])
         stat.num_correct_predictions++;
     }
+    num_eval_samples += batch;
 
     update_train_stat(stat, outputs, labels);
   };
 
-  auto eval_epoch_end = [this, batch_size, max_acc = 0.0f,
+  auto eval_epoch_end = [this, &num_eval_samples, max_acc = 0.0f,
                          min_loss = std::numeric_limits<float>::max()](
                           RunStats &stat, DataBuffer &buffer) mutable {
+    auto num_samples = std::exchange(num_eval_samples, 0u);
     if (stat.num_iterations != 0) {
       stat.loss /= static_cast<float>(stat.num_iterations);
     } else {
       std::cerr << "stat.num_iterations is 0" << std::endl;
       return;
     }
-    stat.accuracy = stat.num_correct_predictions /
-                    static_cast<float>(stat.num_iterations * batch_size) *
-                    100.0f;
+    stat.accuracy =
+      stat.num_correct_predictions / static_cast<float>(num_samples) * 100.0f;
 
     if (stat.accuracy > max_acc ||
         (stat.accuracy == max_acc && stat.loss < min_loss)) {
@@ -627,9 +627,13 @@ private:
   using FlexiblePropTypes =
     std::tuple<props::Epochs, props::TrainingBatchSize, props::SavePath,
                props::ContinueTrain, props::SaveBestPath,
-               props::MemoryOptimization, props::MemorySwap,
-               props::MemorySwapPath, props::MemorySwapLookahead,
-               props::TensorFormat, props::ModelTensorDataType>;
+               props::MemoryOptimization, props::PartialBatch,
+               props::MaxBatchSize, props::MemorySwap, props::MemorySwapPath,
+               props::MemorySwapLookahead, props::MemorySwapCompressBudget,
+               props::MemorySwapLossy, props::MemorySwapPrefetchLimit,
+               props::MemoryMapWeights, props::TensorFormat,
+               props::ModelTensorDataType, props::NumThreads,
+               props::InterOpParallel>;
   using RigidPropTypes =
     std::tuple<props::LossType, std::vector<props::InputConnection>,
                std::vector<props::LabelLayer>, props::ClipGradByGlobalNorm,
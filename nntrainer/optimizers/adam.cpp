@@ -13,8 +13,14 @@
 
 #include <cmath>
 #include <fstream>
+#include <limits>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
 
 #include <adam.h>
+#include <nntr_thread_pool.h>
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
 #include <node_exporter.h>
@@ -22,6 +28,212 @@
 
 namespace nntrainer {
 
+enum AdamParams { wm, wv };
+
+namespace {
+
+/** minimum number of elements updated by a thread */
+constexpr unsigned int ADAM_GRAIN = 1u << 14;
+
+/**
+ * @brief coefficients of a fused adam step
+ */
+struct AdamCoeff {
+  float beta1;
+  float beta2;
+  float c1; /**< 1 - beta1 */
+  float c2; /**< 1 - beta2 */
+  float epsilon;
+  float step;
+  float v_scale;
+  float g_scale;
+};
+
+/**
+ * @brief load a gradient value as float
+ */
+inline float adam_load(const float *p) { return *p; }
+
+#ifdef ENABLE_FP16
+inline float adam_load(const _FP16 *p) { return static_cast<float>(*p); }
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+/**
+ * @brief load 8 gradient values as float
+ */
+inline __m256 adam_load8(const float *p) { return _mm256_loadu_ps(p); }
+
+#ifdef ENABLE_FP16
+inline __m256 adam_load8(const _FP16 *p) {
+#ifdef __F16C__
+  return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)p));
+#else
+  return _mm256_setr_ps(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]);
+#endif
+}
+#endif
+#endif
+
+/**
+ * @brief update [start, end) of the weight and the moments
+ *
+ * @param c coefficients
+ * @param g gradient
+ * @param w fp32 weight, the master weight in mixed precision
+ * @param m first moment
+ * @param v second moment
+ * @param w16 half precision weight to refresh, nullptr if none
+ */
+template <typename T>
+void adam_update(const AdamCoeff &c, const T *g, float *w, float *m, float *v,
+#ifdef ENABLE_FP16
+                 _FP16 *w16,
+#endif
+                 size_t start, size_t end) {
+  const float c1 = c.c1;
+  const float c2 = c.c2;
+  size_t i = start;
+
+#if defined(__AVX2__) && defined(__FMA__)
+  const __m256 b1_v = _mm256_set1_ps(c.beta1);
+  const __m256 b2_v = _mm256_set1_ps(c.beta2);
+  const __m256 c1_v = _mm256_set1_ps(c1);
+  const __m256 c2_v = _mm256_set1_ps(c2);
+  const __m256 eps_v = _mm256_set1_ps(c.epsilon);
+  const __m256 step_v = _mm256_set1_ps(c.step);
+  const __m256 vs_v = _mm256_set1_ps(c.v_scale);
+  const __m256 gs_v = _mm256_set1_ps(c.g_scale);
+
+  for (; i + 8 <= end; i += 8) {
+    __m256 g_v = _mm256_mul_ps(adam_load8(g + i), gs_v);
+    __m256 m_v = _mm256_loadu_ps(m + i);
+    __m256 v_v = _mm256_loadu_ps(v + i);
+    __m256 w_v = _mm256_loadu_ps(w + i);
+
+    m_v = _mm256_fmadd_ps(c1_v, g_v, _mm256_mul_ps(b1_v, m_v));
+    v_v = _mm256_fmadd_ps(_mm256_mul_ps(c2_v, g_v), g_v,
+                          _mm256_mul_ps(b2_v, v_v));
+    __m256 denom =
+      _mm256_add_ps(_mm256_sqrt_ps(_mm256_mul_ps(v_v, vs_v)), eps_v);
+    w_v = _mm256_sub_ps(w_v, _mm256_div_ps(_mm256_mul_ps(step_v, m_v), denom));
+
+    _mm256_storeu_ps(m + i, m_v);
+    _mm256_storeu_ps(v + i, v_v);
+    _mm256_storeu_ps(w + i, w_v);
+#if defined(ENABLE_FP16) && defined(__F16C__)
+    if (w16)
+      _mm_storeu_si128((__m128i *)(w16 + i),
+                       _mm256_cvtps_ph(w_v, _MM_FROUND_TO_NEAREST_INT));
+#elif defined(ENABLE_FP16)
+    if (w16)
+      for (size_t k = i; k < i + 8; ++k)
+        w16[k] = static_cast<_FP16>(w[k]);
+#endif
+  }
+#endif
+
+  for (; i < end; ++i) {
+    float grad = adam_load(g + i) * c.g_scale;
+    m[i] = c.beta1 * m[i] + c1 * grad;
+    v[i] = c.beta2 * v[i] + c2 * grad * grad;
+    w[i] -= c.step * m[i] / (std::sqrt(v[i] * c.v_scale) + c.epsilon);
+#ifdef ENABLE_FP16
+    if (w16)
+      w16[i] = static_cast<_FP16>(w[i]);
+#endif
+  }
+}
+
+/**
+ * @brief run the fused update over the whole tensor on the thread pool
+ */
+template <typename T>
+void adam_run(const AdamCoeff &c, const T *g, float *w, float *m, float *v,
+#ifdef ENABLE_FP16
+              _FP16 *w16,
+#endif
+              size_t len) {
+  ThreadPool::Global().parallelFor(
+    0, len, ADAM_GRAIN, [&](unsigned int s, unsigned int e, unsigned int) {
+      adam_update(c, g, w, m, v,
+#ifdef ENABLE_FP16
+                  w16,
+#endif
+                  s, e);
+    });
+}
+
+} // namespace
+
+bool applyFusedAdam(RunOptimizerContext &context, double beta1, double beta2,
+                    float epsilon, float step, float v_scale) {
+  using DataType = ml::train::TensorDim::DataType;
+
+  Tensor &w = context.getWeight();
+  Tensor &grad = context.getGradient();
+  Tensor &wm = context.getOptimizerVariable(AdamParams::wm);
+  Tensor &wv = context.getOptimizerVariable(AdamParams::wv);
+
+  bool mixed = context.isMixedPrecision();
+  bool has_master = mixed && w.getDataType() != DataType::FP32;
+  Tensor &master = has_master ? context.getWeightFP32() : w;
+
+  if (master.getDataType() != DataType::FP32 ||
+      wm.getDataType() != DataType::FP32 ||
+      wv.getDataType() != DataType::FP32)
+    return false;
+
+  if (!master.getContiguous() || !wm.getContiguous() || !wv.getContiguous() ||
+      !grad.getContiguous() || !w.getContiguous())
+    return false;
+
+  size_t len = master.size();
+  if (len != wm.size() || len != wv.size() || len != grad.size() ||
+      len != w.size() || len > std::numeric_limits<unsigned int>::max())
+    return false;
+
+  AdamCoeff c = {static_cast<float>(beta1),
+                 static_cast<float>(beta2),
+                 static_cast<float>(1.0 - beta1),
+                 static_cast<float>(1.0 - beta2),
+                 epsilon,
+                 step,
+                 v_scale,
+                 mixed ? 1.0f / context.getLossScale() : 1.0f};
+
+  float *w_data = master.getData<float>();
+  float *m_data = wm.getData<float>();
+  float *v_data = wv.getData<float>();
+
+#ifdef ENABLE_FP16
+  _FP16 *w16 = nullptr;
+  if (has_master) {
+    if (w.getDataType() != DataType::FP16)
+      return false;
+    w16 = w.getData<_FP16>();
+  }
+
+  if (grad.getDataType() == DataType::FP16) {
+    adam_run(c, grad.getData<_FP16>(), w_data, m_data, v_data, w16, len);
+    return true;
+  }
+#else
+  if (has_master)
+    return false;
+#endif
+
+  if (grad.getDataType() != DataType::FP32)
+    return false;
+
+  adam_run(c, grad.getData<float>(), w_data, m_data, v_data,
+#ifdef ENABLE_FP16
+           w16,
+#endif
+           len);
+  return true;
+}
+
 Adam::Adam() : adam_props(PropsB1(), PropsB2(), PropsEpsilon(), TorchRef()) {
   /** default properties */
   auto &[b1, b2, eps, torch_ref] = adam_props;
@@ -33,8 +245,6 @@ Adam::Adam() : adam_props(PropsB1(), PropsB2(), PropsEpsilon(), TorchRef()) {
 
 Adam::~Adam() {}
 
-enum AdamParams { wm, wv };
-
 std::vector<TensorDim> Adam::getOptimizerVariableDim(const TensorDim &dim) {
   /**
    * @note We assume the optimizer parameters should be full precsion to
@@ -72,6 +282,28 @@ double Adam::getUpdatedLearningRate(unsigned int iteration, double ll) const {
 }
 
 void Adam::applyGradient(RunOptimizerContext &context) {
+  auto &beta1 = std::get<PropsB1>(adam_props).get();
+  auto &beta2 = std::get<PropsB2>(adam_props).get();
+  auto &epsilon = std::get<PropsEpsilon>(adam_props).get();
+  auto &torch_ref = std::get<TorchRef>(adam_props).get();
+
+  // This is implementation of adam from original paper.
+  // This is not deleted intentionally.
+  unsigned int iteration = context.getIteration();
+  float biasCorrection1 = 1 - pow(beta1, iteration + 1);
+  float biasCorrection2 = 1 - pow(beta2, iteration + 1);
+
+  /**
+   * torch_ref divides sqrt(v) by sqrt(biasCorrection2), otherwise it is folded
+   * into the learning rate. Both are done in a single pass if possible.
+   */
+  float step = torch_ref ? context.getLearningRate() / biasCorrection1
+                         : getUpdatedLearningRate(iteration,
+                                                  context.getLearningRate());
+  float v_scale = torch_ref ? 1.0f / biasCorrection2 : 1.0f;
+  if (applyFusedAdam(context, beta1, beta2, epsilon, step, v_scale))
+    return;
+
   Tensor empty_tensor;
 
   Tensor &x_grad =
@@ -85,16 +317,6 @@ void Adam::applyGradient(RunOptimizerContext &context) {
 
   context.applyLossScale(x_grad);
 
-  auto &beta1 = std::get<PropsB1>(adam_props).get();
-  auto &beta2 = std::get<PropsB2>(adam_props).get();
-  auto &epsilon = std::get<PropsEpsilon>(adam_props).get();
-  auto &torch_ref = std::get<TorchRef>(adam_props).get();
-
-  // This is implementation of adam from original paper.
-  // This is not deleted intentionally.
-  unsigned int iteration = context.getIteration();
-  float biasCorrection1 = 1 - pow(beta1, iteration + 1);
-  float biasCorrection2 = 1 - pow(beta2, iteration + 1);
   Tensor &wm = context.getOptimizerVariable(AdamParams::wm);
   Tensor &wv = context.getOptimizerVariable(AdamParams::wv);
 
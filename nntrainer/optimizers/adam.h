@@ -62,6 +62,28 @@ public:
   using prop_tag = bool_prop_tag;                 /**< property type */
 };
 
+/**
+ * @brief Update the weight, the first and the second moment of Adam in a
+ * single pass over the tensors. The gradient is unscaled by the loss scale in
+ * mixed precision, and the low precision weight is refreshed from the fp32
+ * master weight in the same pass.
+ *
+ * m = beta1 * m + (1 - beta1) * g
+ * v = beta2 * v + (1 - beta2) * g^2
+ * w = w - step * m / (sqrt(v * v_scale) + epsilon)
+ *
+ * @param context run optimizer context
+ * @param beta1 decay rate of the first moment
+ * @param beta2 decay rate of the second moment
+ * @param epsilon small value to avoid division by zero
+ * @param step step size, including the bias correction of the first moment
+ * @param v_scale scale of the second moment before sqrt
+ * @return true if updated, false if the tensor types are not supported
+ * @note 1 - beta is taken in double, beta2 is too close to 1 for float
+ */
+bool applyFusedAdam(RunOptimizerContext &context, double beta1, double beta2,
+                    float epsilon, float step, float v_scale);
+
 /**
  * @class   Adam optimizer class
  * @brief   Adam optimizer
@@ -37,7 +37,15 @@ AdamW::~AdamW() {}
 enum AdamParams { wm, wv };
 
 std::vector<TensorDim> AdamW::getOptimizerVariableDim(const TensorDim &dim) {
-  return {dim, dim};
+  /**
+   * @note the moments are kept in full precision as in Adam, which is also
+   * what the fused update expects.
+   */
+  TensorDim wm_dim(dim);
+  TensorDim wv_dim(dim);
+  wm_dim.setDataType(ml::train::TensorDim::DataType::FP32);
+  wv_dim.setDataType(ml::train::TensorDim::DataType::FP32);
+  return {wm_dim, wv_dim};
 }
 
 void AdamW::exportTo(Exporter &exporter,
@@ -52,6 +60,21 @@ void AdamW::setProperty(const std::vector<std::string> &values) {
 }
 
 void AdamW::applyGradient(RunOptimizerContext &context) {
+  auto &beta1 = std::get<PropsB1>(adam_props).get();
+  auto &beta2 = std::get<PropsB2>(adam_props).get();
+  auto &epsilon = std::get<PropsEpsilon>(adam_props).get();
+
+  // This is implementation of adam from original paper.
+  // This is not deleted intentionally.
+  unsigned int iteration = context.getIteration();
+  float biasCorrection1 = 1 - pow(beta1, iteration + 1);
+  float biasCorrection2 = 1 - pow(beta2, iteration + 1);
+
+  if (applyFusedAdam(context, beta1, beta2, epsilon,
+                     context.getLearningRate() / biasCorrection1,
+                     1.0f / biasCorrection2))
+    return;
+
   Tensor empty_tensor;
 
   Tensor &x_grad =
@@ -65,16 +88,6 @@ void AdamW::applyGradient(RunOptimizerContext &context) {
 
   context.applyLossScale(x_grad);
 
-  auto &beta1 = std::get<PropsB1>(adam_props).get();
-  auto &beta2 = std::get<PropsB2>(adam_props).get();
-  auto &epsilon = std::get<PropsEpsilon>(adam_props).get();
-  auto &torch_ref = std::get<TorchRef>(adam_props).get();
-
-  // This is implementation of adam from original paper.
-  // This is not deleted intentionally.
-  unsigned int iteration = context.getIteration();
-  float biasCorrection1 = 1 - pow(beta1, iteration + 1);
-  float biasCorrection2 = 1 - pow(beta2, iteration + 1);
   Tensor &wm = context.getOptimizerVariable(AdamParams::wm);
   Tensor &wv = context.getOptimizerVariable(AdamParams::wv);
 
@@ -84,16 +97,13 @@ void AdamW::applyGradient(RunOptimizerContext &context) {
   wv.multiply_i(beta2);
   wv.add_i(x_grad.multiply(x_grad), 1.0f - beta2);
 
-  wv.divide_i(sqrtFloat(biasCorrection2));
-  std::function<double(double)> sqrtEps = [epsilon](double f) {
-    return 1 / (sqrtDouble(f) + epsilon);
-  };
-  wv.apply<float>(sqrtEps);
-  x_grad = wv;
-  x_grad.divide_i(biasCorrection1);
-  x_grad.multiply_i(wm);
+  /** keep wv intact, it is the running second moment */
+  Tensor denom = wv.apply<float>(sqrtFloat<float>);
+  denom.divide_i(sqrtFloat(biasCorrection2));
+  denom.add_i(epsilon);
+  wm.divide(denom, x_grad);
 
-  context.applyGradient(context.getLearningRate(), x_grad);
+  context.applyGradient(context.getLearningRate() / biasCorrection1, x_grad);
 }
 
 } // namespace nntrainer
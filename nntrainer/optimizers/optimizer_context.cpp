@@ -62,4 +62,26 @@ void RunOptimizerContext::applyLossScale(Tensor &fp32_grad) {
   float loss_scale = weight->getLossScale();
   fp32_grad.divide_i(loss_scale);
 }
+
+/**
+ * @brief   Check if the weight is trained in mixed precision
+ */
+bool RunOptimizerContext::isMixedPrecision() const {
+  return weight->isMixedPrecision();
+}
+
+/**
+ * @brief   Get the full precision master copy of the weight
+ */
+Tensor &RunOptimizerContext::getWeightFP32() const {
+  return weight->getVariableFP32Ref();
+}
+
+/**
+ * @brief   Get the loss scale of the weight
+ */
+float RunOptimizerContext::getLossScale() const {
+  return weight->getLossScale();
+}
+
 } // namespace nntrainer
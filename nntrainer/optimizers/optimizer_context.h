@@ -102,6 +102,28 @@ public:
    */
   void applyLossScale(Tensor &fp32_grad);
 
+  /**
+   * @brief   Check if the weight is trained in mixed precision
+   *
+   * @return true if mixed precision, else false
+   */
+  bool isMixedPrecision() const;
+
+  /**
+   * @brief   Get the full precision master copy of the weight
+   *
+   * @return Tensor& Reference to the fp32 weight tensor
+   * @note only valid in mixed precision
+   */
+  Tensor &getWeightFP32() const;
+
+  /**
+   * @brief   Get the loss scale of the weight
+   *
+   * @return loss scale
+   */
+  float getLossScale() const;
+
 private:
   Weight *weight;       /**< weights for the optimizer */
   size_t iteration;     /**< iteration number */
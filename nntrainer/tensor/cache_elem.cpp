@@ -13,6 +13,7 @@
 
 #include "cache_elem.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
@@ -31,6 +32,8 @@ std::map<CachePolicy, std::string> policyToStr = {
   {TEMPORAL, "TEMPORAL"},
   {FIRST_LAST_SKIP, "FIRST_LAST_SKIP"},
   {ITERATION_CONSIST, "ITER_CONSIST"},
+  {ACTIVATION_SYNCED, "ACTIVATION_SYNCED"},
+  {ACTIVATION_CONSIST, "ACTIVATION_CONSIST"},
   {SYNC_ONCE, "SYNC_ONCE"}};
 
 inline bool checkAllocOnly(CachePolicy policy, CacheElem::Options opt) {
@@ -49,7 +52,7 @@ inline bool checkDeallocOnly(CachePolicy policy, CacheElem::Options opt) {
 
 } // namespace
 
-void CacheElem::swapIn(Options opt) {
+void CacheElem::swapIn(Options opt, unsigned int order) {
   std::lock_guard<std::mutex> lock(device_mutex);
 
   opt = static_cast<Options>(opt | initial_opt);
@@ -60,6 +63,7 @@ void CacheElem::swapIn(Options opt) {
   mem_data->setAddr((void *)buf);
   mem_data->setValid(true);
   active = true;
+  dirty = isWrittenAt(order);
 #ifdef PROFILE
   std::string msg("CacheElem(");
   msg += device->getDevicePath() + ") #" + std::to_string(id);
@@ -74,15 +78,40 @@ void CacheElem::swapOut(Options opt) {
   bool dealloc_only = checkDeallocOnly(policy, opt);
   void *buf = (void *)mem_data->getAddr();
 
+  /** the first write back is always done, it persists the initial data */
+  bool clean = !dealloc_only && !dirty && !(opt & Options::FIRST_WRITE);
+  if (clean)
+    device->addCleanBytes(length);
+
   initial_opt = static_cast<Options>(initial_opt & ~Options::FIRST_WRITE);
-  device->putBuffer(buf, dealloc_only);
+  device->putBuffer(buf, dealloc_only || clean, codec);
   mem_data->setAddr(nullptr);
   mem_data->setValid(false);
   active = false;
 
 #ifdef PROFILE
-  PROFILE_CACHE_DEALLOC(buf, policyToStr[policy], !dealloc_only);
+  PROFILE_CACHE_DEALLOC(buf, policyToStr[policy], !dealloc_only && !clean);
 #endif
 }
 
+void CacheElem::access(unsigned int order) {
+  std::lock_guard<std::mutex> lock(device_mutex);
+
+  if (active && isWrittenAt(order))
+    dirty = true;
+}
+
+void CacheElem::setWriteOrder(const std::vector<unsigned int> &order) {
+  std::lock_guard<std::mutex> lock(device_mutex);
+
+  write_order = order;
+  write_order_known = true;
+}
+
+bool CacheElem::isWrittenAt(unsigned int order) const {
+  return !write_order_known || order == UNKNOWN_ORDER ||
+         std::find(write_order.begin(), write_order.end(), order) !=
+           write_order.end();
+}
+
 } // namespace nntrainer
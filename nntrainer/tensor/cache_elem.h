@@ -14,8 +14,10 @@
 #ifndef __CACHE_ELEM_H__
 #define __CACHE_ELEM_H__
 
+#include <limits>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include <memory_data.h>
 #include <swap_device.h>
@@ -39,6 +41,14 @@ enum CachePolicy {
      ALWAYS_SYNCED */
   SYNC_ONCE = (FRIST_WRITE_CONSIST | READ_CONSIST | NO_WRITE_BACK),
   /**< Will sync at first from the device, and the value will always consist */
+  FORWARD_KEPT = 0b1000000,
+  /**< Data is produced in forwarding and kept for backwarding. It does not
+     change the synchronization, the compressed swap tier may keep such data
+     with a lossy codec */
+  ACTIVATION_SYNCED = (FORWARD_KEPT | ALWAYS_SYNCED),
+  /**< ALWAYS_SYNCED activation */
+  ACTIVATION_CONSIST = (FORWARD_KEPT | ITERATION_CONSIST),
+  /**< ITERATION_CONSIST activation */
 };
 
 /**
@@ -56,6 +66,13 @@ public:
     /**< First access & write */
   };
 
+  /**
+   * @brief execution order of an access made outside of any known order
+   *
+   */
+  static constexpr unsigned int UNKNOWN_ORDER =
+    std::numeric_limits<unsigned int>::max();
+
   /**
    * @brief CacheElem default constructor
    *
@@ -66,6 +83,9 @@ public:
     initial_opt(Options::FIRST_ACCESS_WRITE),
     device(dev),
     active(false),
+    dirty(true),
+    write_order_known(false),
+    codec(SwapCodec::NONE),
     id(mem_id),
     offset(off),
     length(len),
@@ -81,17 +101,55 @@ public:
   /**
    * @brief load data from swap device
    *
-   * @param alloc_only only allocate buffer without reading data
+   * @param opt cache options
+   * @param order execution order the data is loaded for
    */
-  void swapIn(Options opt = Options::NONE);
+  void swapIn(Options opt = Options::NONE, unsigned int order = UNKNOWN_ORDER);
 
   /**
-   * @brief unload data to swap device
+   * @brief unload data to swap device. Clean data is dropped without write
+   * back.
    *
-   * @param dealloc_only only deallocate buffer without writing data
+   * @param opt cache options
    */
   void swapOut(Options opt = Options::NONE);
 
+  /**
+   * @brief mark the loaded data is accessed at @a order. It becomes dirty if
+   * the element is written at @a order.
+   *
+   * @param order execution order
+   */
+  void access(unsigned int order);
+
+  /**
+   * @brief set execution orders in which the element is written. If not set,
+   * the element is regarded as written at every access.
+   *
+   * @param order execution orders
+   */
+  void setWriteOrder(const std::vector<unsigned int> &order);
+
+  /**
+   * @brief set codec of the compressed tier the element is swapped out to
+   *
+   * @param c codec, NONE to swap out to the swap file
+   */
+  void setCodec(SwapCodec c) {
+    std::scoped_lock lg(device_mutex);
+    codec = c;
+  }
+
+  /**
+   * @brief check if the loaded data can be modified since loaded
+   *
+   * @return true if dirty
+   */
+  bool isDirty() const {
+    std::scoped_lock lg(device_mutex);
+    return dirty;
+  }
+
   /**
    * @brief unload data to swap device
    *
@@ -123,15 +181,27 @@ public:
   void reset() { initial_opt = Options::FIRST_ACCESS_WRITE; }
 
 private:
-  Options initial_opt;                  /**< accessed */
-  mutable std::mutex device_mutex;      /**< protect device */
-  std::shared_ptr<SwapDevice> device;   /**< swap device */
-  bool active;                          /**< element is loaded */
-  unsigned int id;                      /**< memory id */
-  size_t offset;                        /**< element offset from swap device */
-  size_t length;                        /**< element size */
-  CachePolicy policy;                   /**< cache policy */
-  std::shared_ptr<MemoryData> mem_data; /**< allocated memory data */
+  /**
+   * @brief check if the element is written at @a order
+   *
+   * @param order execution order
+   * @return true if written
+   */
+  bool isWrittenAt(unsigned int order) const;
+
+  Options initial_opt;                   /**< accessed */
+  mutable std::mutex device_mutex;       /**< protect device */
+  std::shared_ptr<SwapDevice> device;    /**< swap device */
+  bool active;                           /**< element is loaded */
+  bool dirty;                            /**< data can be modified */
+  bool write_order_known;                /**< write_order is given */
+  std::vector<unsigned int> write_order; /**< orders the element is written */
+  SwapCodec codec;                       /**< codec of the compressed tier */
+  unsigned int id;                       /**< memory id */
+  size_t offset;                         /**< element offset from swap device */
+  size_t length;                         /**< element size */
+  CachePolicy policy;                    /**< cache policy */
+  std::shared_ptr<MemoryData> mem_data;  /**< allocated memory data */
 };
 
 } // namespace nntrainer
@@ -21,6 +21,7 @@
 #include <nntrainer_error.h>
 #include <nntrainer_log.h>
 #include <profiler.h>
+#include <util_func.h>
 
 namespace nntrainer {
 
@@ -87,19 +88,70 @@ convertTensorLifespanToCachePolicy(const TensorLifespan lifespan) {
     break;
   }
 
+  /** activations are written in forwarding and kept for backwarding */
+  if (lifespan != TensorLifespan::EPOCH_LIFESPAN &&
+      lifespan != TensorLifespan::MAX_LIFESPAN &&
+      enum_class_logical_and(lifespan,
+                             TensorLifespan::FORWARD_FUNC_LIFESPAN) &&
+      enum_class_logical_and(lifespan,
+                             TensorLifespan::CALC_GRAD_DERIV_LIFESPAN))
+    policy = static_cast<CachePolicy>(policy | CachePolicy::FORWARD_KEPT);
+
   return policy;
 }
 
 std::atomic_int pool_id = 0;
 
+/**
+ * @brief swap I/O issued in the scope of this object is run as one batch
+ *
+ */
+class SwapBatch {
+public:
+  /**
+   * @brief open a batch on @a dev for the calling thread
+   */
+  explicit SwapBatch(std::shared_ptr<SwapDevice> &dev) :
+    device(dev), submitted(false) {
+    device->beginBatch();
+  }
+
+  /**
+   * @brief submit the batch if it is left by an exception
+   */
+  ~SwapBatch() {
+    if (submitted)
+      return;
+    try {
+      device->submitBatch();
+    } catch (std::exception &e) {
+      ml_loge("Failed to submit swap batch: %s", e.what());
+    }
+  }
+
+  /**
+   * @brief submit the batch and wait for its completion
+   */
+  void submit() {
+    submitted = true;
+    device->submitBatch();
+  }
+
+private:
+  std::shared_ptr<SwapDevice> &device;
+  bool submitted;
+};
+
 } // namespace
 
 CachePool::CachePool(const std::string &n) :
   name(n),
   swap_device(std::make_shared<SwapDevice>(n + "_" + std::to_string(getpid()) +
-                                           "_" + std::to_string(pool_id++))) {}
+                                           "_" + std::to_string(pool_id++))),
+  current_order(CacheElem::UNKNOWN_ORDER) {}
 
-CachePool::CachePool(const std::string &path, const std::string &n) : name(n) {
+CachePool::CachePool(const std::string &path, const std::string &n) :
+  name(n), current_order(CacheElem::UNKNOWN_ORDER) {
   if (path.empty())
     swap_device = std::make_shared<SwapDevice>(
       n + "_" + std::to_string(getpid()) + "_" + std::to_string(pool_id++));
@@ -133,16 +185,19 @@ void CachePool::deallocate() {
   if (!swap_device->isOperating())
     return;
 
+  SwapBatch batch(swap_device);
   for (auto &[id, elem] : elems)
     invalidate(id);
+  batch.submit();
 
   actives.clear();
+  current_order = CacheElem::UNKNOWN_ORDER;
   swap_device->finish();
 }
 
 void CachePool::validate(unsigned int id) {
   if (!elems[id]->isActive()) {
-    elems[id]->swapIn();
+    elems[id]->swapIn(CacheElem::NONE, current_order);
     actives.push_back(elems[id]);
   }
 }
@@ -184,6 +239,10 @@ std::shared_ptr<MemoryData> CachePool::getMemory(unsigned int id) {
     std::bind(&CachePool::invalidate, this, std::placeholders::_1));
   auto elem =
     std::make_shared<CacheElem>(swap_device, id, offset, len, mem_data, policy);
+  if (auto found = write_orders.find(id); found != write_orders.end())
+    elem->setWriteOrder(found->second);
+  if (auto found = tier_codecs.find(policy); found != tier_codecs.end())
+    elem->setCodec(found->second);
   elems[id] = elem;
 
   std::string ords;
@@ -199,17 +258,22 @@ std::shared_ptr<MemoryData> CachePool::getMemory(unsigned int id) {
 }
 
 void CachePool::flush() {
+  SwapBatch batch(swap_device);
   for (auto &elem : actives)
     elem->swapOut(CacheElem::LAST_ACCESS);
+  batch.submit();
 
   for (auto &[id, elem] : elems)
     elem->reset();
 
   actives.clear();
+  current_order = CacheElem::UNKNOWN_ORDER;
 }
 
 void CachePool::flushExcept(unsigned int order) {
   auto exe_orders = getMemoryExecOrder();
+  SwapBatch batch(swap_device);
+  enterOrder(order);
 
   actives.remove_if([&, order](auto elem) -> bool {
     auto id = elem->getId();
@@ -230,10 +294,17 @@ void CachePool::flushExcept(unsigned int order) {
     }
     return false;
   });
+
+  for (auto &elem : actives)
+    elem->access(order);
+
+  batch.submit();
 }
 
 void CachePool::flushExcept(std::vector<unsigned int> order) {
   auto exe_orders = getMemoryExecOrder();
+  SwapBatch batch(swap_device);
+  enterOrder(order[0]);
 
   actives.remove_if([&, order](const auto elem) -> bool {
     auto id = elem->getId();
@@ -255,6 +326,12 @@ void CachePool::flushExcept(std::vector<unsigned int> order) {
     elem->swapOut(opt);
     return true;
   });
+
+  for (auto &elem : actives)
+    for (auto &o : order)
+      elem->access(o);
+
+  batch.submit();
 }
 
 void CachePool::clear() {
@@ -267,8 +344,12 @@ void CachePool::clear() {
 bool CachePool::isAllocated() const { return swap_device->isOperating(); }
 
 void CachePool::loadExec(unsigned int order) {
-  for (auto &id : exec_ids[order])
+  SwapBatch batch(swap_device);
+  for (auto &id : exec_ids[order]) {
     validate(id);
+    elems[id]->access(order);
+  }
+  batch.submit();
 }
 
 void CachePool::initCacheElemIter(CacheElemsIter &iter) {
@@ -299,30 +380,87 @@ bool CachePool::loadExecOnce(unsigned int order, ExecIdsIter &iter) {
 
 void CachePool::unloadExec(unsigned int order) {
   auto exe_orders = getMemoryExecOrder();
+  SwapBatch batch(swap_device);
   for (auto &[id, elem] : elems) {
     auto exe_order = exe_orders.at(id - 1);
     auto found = std::find(exe_order.begin(), exe_order.end(), order);
     if (found != exe_order.end())
       invalidate(id);
   }
+  batch.submit();
 }
 
 void CachePool::loadActives() {
   ml_logd("load active caches");
 
+  SwapBatch batch(swap_device);
   for (auto &elem : actives)
     elem->swapIn();
+  batch.submit();
 }
 
 void CachePool::unloadActives() {
   ml_logd("unload active caches");
 
+  SwapBatch batch(swap_device);
   for (auto &elem : actives)
     elem->swapOut();
+  batch.submit();
 }
 
 unsigned int CachePool::getNumLoadedTensors() {
   return swap_device->getNumLoadedTensors();
 }
 
+void CachePool::setWriteOrder(unsigned int id,
+                              const std::vector<unsigned int> &order) {
+  write_orders[id] = order;
+  if (auto found = elems.find(id); found != elems.end())
+    found->second->setWriteOrder(order);
+}
+
+void CachePool::setCompressedTier(
+  size_t budget, const std::map<CachePolicy, SwapCodec> &codecs) {
+  swap_device->setCompressedTier(budget);
+  tier_codecs = budget ? codecs : std::map<CachePolicy, SwapCodec>();
+
+  for (auto &[id, elem] : elems) {
+    auto found = tier_codecs.find(getCachePolicy().at(id - 1));
+    elem->setCodec(found != tier_codecs.end() ? found->second
+                                              : SwapCodec::NONE);
+  }
+}
+
+SwapDevice::Stats CachePool::getSwapStats(bool reset) {
+  auto stats = swap_device->getStats();
+  if (reset)
+    swap_device->resetStats();
+  return stats;
+}
+
+std::vector<size_t> CachePool::getExecOrderBytes(unsigned int max_order) {
+  auto &sizes = getMemorySize();
+  auto &exe_orders = getMemoryExecOrder();
+  std::vector<size_t> bytes(max_order + 1, 0);
+
+  for (size_t idx = 0; idx < sizes.size(); ++idx)
+    for (auto &o : exe_orders[idx])
+      if (o <= max_order)
+        bytes[o] += sizes[idx];
+
+  return bytes;
+}
+
+void CachePool::enterOrder(unsigned int order) {
+  unsigned int prev = current_order.exchange(order);
+
+  /**
+   * Orders only grow within a pass. If a new pass begins, the data loaded
+   * before could be modified out of any order, e.g. by loading weights.
+   */
+  if (order < prev)
+    for (auto &elem : actives)
+      elem->access(CacheElem::UNKNOWN_ORDER);
+}
+
 } // namespace nntrainer
@@ -14,7 +14,9 @@
 #ifndef __CACHE_POOL_H__
 #define __CACHE_POOL_H__
 
+#include <atomic>
 #include <list>
+#include <map>
 #include <mutex>
 #include <vector>
 
@@ -195,6 +197,44 @@ public:
    */
   virtual unsigned int getNumLoadedTensors();
 
+  /**
+   * @brief Set execution orders in which the memory is written. Loaded data
+   * which is not written since loaded is dropped without write back.
+   *
+   * @param id memory id
+   * @param order execution orders
+   */
+  virtual void setWriteOrder(unsigned int id,
+                             const std::vector<unsigned int> &order);
+
+  /**
+   * @brief Get bytes moved by the swap device
+   *
+   * @param reset reset the stats after read
+   * @return stats of the swap device
+   */
+  virtual SwapDevice::Stats getSwapStats(bool reset = false);
+
+  /**
+   * @brief Keep swapped out elements compressed in memory before the swap
+   * file
+   *
+   * @param budget bytes of compressed data to keep, 0 to disable
+   * @param codecs codec for elements of each cache policy, elements of other
+   * policies are swapped out to the swap file
+   */
+  virtual void
+  setCompressedTier(size_t budget,
+                    const std::map<CachePolicy, SwapCodec> &codecs);
+
+  /**
+   * @brief Get bytes of the elements used by each execution order
+   *
+   * @param max_order last execution order to count
+   * @return std::vector<size_t> bytes indexed by execution order
+   */
+  virtual std::vector<size_t> getExecOrderBytes(unsigned int max_order);
+
 protected:
   /**
    * @brief validate cache element
@@ -218,6 +258,13 @@ protected:
   std::vector<CachePolicy> &getCachePolicy() { return policies; }
 
 private:
+  /**
+   * @brief Set the execution order about to run
+   *
+   * @param order execution order
+   */
+  void enterOrder(unsigned int order);
+
   std::string name;                        /**< pool name */
   std::shared_ptr<SwapDevice> swap_device; /**< swap device */
   CacheElems elems;                        /**< cache elements */
@@ -225,6 +272,9 @@ private:
   std::list<std::shared_ptr<CacheElem>> actives;
   std::vector<CachePolicy> policies;
   std::map<unsigned int, ExecIds> exec_ids;
+  std::map<unsigned int, std::vector<unsigned int>> write_orders;
+  std::map<CachePolicy, SwapCodec> tier_codecs; /**< codec of each policy */
+  std::atomic<unsigned int> current_order; /**< order being executed */
 
   std::mutex mod_mutex;
 };
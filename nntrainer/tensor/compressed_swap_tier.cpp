@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   compressed_swap_tier.cpp
+ * @date   17 Oct 2026
+ * @brief  Compressed in-memory tier of the swap device
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <cstring>
+#include <stdexcept>
+
+#include <compressed_swap_tier.h>
+#include <fp16.h>
+#include <nntrainer_error.h>
+
+namespace nntrainer {
+
+namespace {
+
+/**
+ * @brief append a bitmask of nonzero words followed by the nonzero words
+ *
+ * @param n number of words
+ * @param load returns i-th word
+ * @param out encoded data
+ */
+template <typename T, typename Load>
+void elideZeros(size_t n, Load load, std::vector<uint8_t> &out) {
+  const size_t mask_len = (n + 7) / 8;
+  const size_t base = out.size();
+  out.resize(base + mask_len + n * sizeof(T));
+
+  uint8_t *mask = out.data() + base;
+  uint8_t *packed = mask + mask_len;
+  std::memset(mask, 0, mask_len);
+
+  size_t count = 0;
+  for (size_t i = 0; i < n; ++i) {
+    T word = load(i);
+    if (word != 0) {
+      mask[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+      std::memcpy(packed + count * sizeof(T), &word, sizeof(T));
+      ++count;
+    }
+  }
+
+  out.resize(base + mask_len + count * sizeof(T));
+}
+
+/**
+ * @brief restore words appended by elideZeros
+ *
+ * @param n number of words
+ * @param in encoded data
+ * @param store stores i-th word
+ * @return const uint8_t* end of the encoded words
+ */
+template <typename T, typename Store>
+const uint8_t *restoreZeros(size_t n, const uint8_t *in, Store store) {
+  const uint8_t *mask = in;
+  const uint8_t *packed = in + (n + 7) / 8;
+
+  for (size_t i = 0; i < n; ++i) {
+    T word = 0;
+    if ((mask[i / 8] >> (i % 8)) & 1u) {
+      std::memcpy(&word, packed, sizeof(T));
+      packed += sizeof(T);
+    }
+    store(i, word);
+  }
+
+  return packed;
+}
+
+} // namespace
+
+bool CompressedSwapTier::store(off_t offset, const void *buf, size_t len,
+                               SwapCodec codec) {
+  erase(offset, len);
+
+  if (codec == SwapCodec::NONE || len == 0)
+    return false;
+
+  /** only whole FP32 data can be packed */
+  if (codec == SwapCodec::FP16 && len % sizeof(float) != 0)
+    codec = SwapCodec::ZERO;
+
+  std::vector<uint8_t> encoded;
+  encode(codec, buf, len, encoded);
+  if (encoded.size() * 100 > len * max_ratio || encoded.size() > budget)
+    return false;
+
+  lru.push_front(offset);
+  Entry &entry = blocks[offset];
+  entry.block = {offset, len, codec, std::move(encoded)};
+  entry.lru_iter = lru.begin();
+  usage += entry.block.data.size();
+
+  return true;
+}
+
+bool CompressedSwapTier::load(off_t offset, size_t len, void *buf) {
+  auto found = blocks.find(offset);
+  if (found == blocks.end() || found->second.block.len != len)
+    return false;
+
+  decode(found->second.block, buf);
+  lru.splice(lru.begin(), lru, found->second.lru_iter);
+
+  return true;
+}
+
+std::vector<CompressedBlock> CompressedSwapTier::take(off_t offset,
+                                                      size_t len) {
+  std::vector<CompressedBlock> taken;
+
+  auto it = blocks.lower_bound(offset);
+  if (it != blocks.begin()) {
+    auto prev = std::prev(it);
+    if (prev->first + static_cast<off_t>(prev->second.block.len) > offset)
+      it = prev;
+  }
+
+  while (it != blocks.end() && it->first < offset + static_cast<off_t>(len))
+    taken.push_back(remove(it++));
+
+  return taken;
+}
+
+std::vector<CompressedBlock> CompressedSwapTier::spill() {
+  std::vector<CompressedBlock> taken;
+
+  while (usage > budget && !lru.empty())
+    taken.push_back(remove(blocks.find(lru.back())));
+
+  return taken;
+}
+
+void CompressedSwapTier::erase(off_t offset, size_t len) { take(offset, len); }
+
+std::vector<CompressedBlock> CompressedSwapTier::takeAll() {
+  std::vector<CompressedBlock> taken;
+  taken.reserve(blocks.size());
+
+  for (auto &[offset, entry] : blocks)
+    taken.push_back(std::move(entry.block));
+  blocks.clear();
+  lru.clear();
+  usage = 0;
+
+  return taken;
+}
+
+CompressedBlock
+CompressedSwapTier::remove(std::map<off_t, Entry>::iterator it) {
+  CompressedBlock block = std::move(it->second.block);
+  usage -= block.data.size();
+  lru.erase(it->second.lru_iter);
+  blocks.erase(it);
+  return block;
+}
+
+void CompressedSwapTier::encode(SwapCodec codec, const void *buf, size_t len,
+                                std::vector<uint8_t> &out) {
+  const uint8_t *data = static_cast<const uint8_t *>(buf);
+  const size_t n = len / sizeof(uint32_t);
+  out.clear();
+
+  switch (codec) {
+  case SwapCodec::ZERO:
+    elideZeros<uint32_t>(
+      n,
+      [data](size_t i) {
+        uint32_t word;
+        std::memcpy(&word, data + i * sizeof(uint32_t), sizeof(uint32_t));
+        return word;
+      },
+      out);
+    out.insert(out.end(), data + n * sizeof(uint32_t), data + len);
+    break;
+  case SwapCodec::FP16:
+    NNTR_THROW_IF(len % sizeof(float) != 0, std::invalid_argument)
+      << "CompressedSwapTier: FP16 codec needs FP32 data";
+    elideZeros<uint16_t>(
+      n,
+      [data](size_t i) {
+        float value;
+        std::memcpy(&value, data + i * sizeof(float), sizeof(float));
+        return compute_fp32_to_fp16(value);
+      },
+      out);
+    break;
+  default:
+    out.assign(data, data + len);
+    break;
+  }
+}
+
+void CompressedSwapTier::decode(const CompressedBlock &block, void *buf) {
+  uint8_t *data = static_cast<uint8_t *>(buf);
+  const size_t n = block.len / sizeof(uint32_t);
+  const uint8_t *in = block.data.data();
+
+  switch (block.codec) {
+  case SwapCodec::ZERO:
+    in = restoreZeros<uint32_t>(n, in, [data](size_t i, uint32_t word) {
+      std::memcpy(data + i * sizeof(uint32_t), &word, sizeof(uint32_t));
+    });
+    std::memcpy(data + n * sizeof(uint32_t), in, block.len % sizeof(uint32_t));
+    break;
+  case SwapCodec::FP16:
+    restoreZeros<uint16_t>(n, in, [data](size_t i, uint16_t half) {
+      float value = compute_fp16_to_fp32(half);
+      std::memcpy(data + i * sizeof(float), &value, sizeof(float));
+    });
+    break;
+  default:
+    std::memcpy(data, in, block.len);
+    break;
+  }
+}
+
+} // namespace nntrainer
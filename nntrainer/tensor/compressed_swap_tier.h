@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   compressed_swap_tier.h
+ * @date   17 Oct 2026
+ * @brief  Compressed in-memory tier of the swap device
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#ifndef __COMPRESSED_SWAP_TIER_H__
+#define __COMPRESSED_SWAP_TIER_H__
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <sys/types.h>
+#include <vector>
+
+namespace nntrainer {
+
+/**
+ * @brief codec used to keep swapped out data in the compressed tier
+ */
+enum class SwapCodec {
+  NONE = 0, /**< not kept in the tier, written to the swap file */
+  ZERO = 1, /**< lossless, zero words are dropped */
+  FP16 = 2, /**< lossy, FP32 data is packed to FP16 and zero halves dropped */
+};
+
+/**
+ * @brief swapped out range kept by the compressed tier
+ */
+struct CompressedBlock {
+  off_t offset;              /**< offset in the swap file */
+  size_t len;                /**< length of the decoded data */
+  SwapCodec codec;           /**< codec of data */
+  std::vector<uint8_t> data; /**< encoded data */
+};
+
+/**
+ * @class   CompressedSwapTier
+ * @brief   Keeps swapped out ranges compressed in memory up to a budget.
+ * Blocks never overlap, a stored range replaces what it covers. The tier
+ * is not thread safe, it is guarded by its swap device.
+ */
+class CompressedSwapTier {
+public:
+  /**
+   * @brief a block is stored only if encoded to at most this fraction of
+   * its length, in percent
+   */
+  static constexpr size_t max_ratio = 75;
+
+  /**
+   * @brief Construct a new CompressedSwapTier
+   *
+   * @param budget maximum bytes of encoded data held
+   */
+  explicit CompressedSwapTier(size_t budget_) : budget(budget_), usage(0) {}
+
+  /**
+   * @brief Store [offset, offset + len) encoded with @a codec. Blocks
+   * overlapping the range are dropped even if it is not stored.
+   *
+   * @param offset offset in the swap file
+   * @param buf data
+   * @param len length of data
+   * @param codec codec to use
+   * @return true if stored, false if it has to be written to the swap file
+   */
+  bool store(off_t offset, const void *buf, size_t len, SwapCodec codec);
+
+  /**
+   * @brief Decode the block of exactly [offset, offset + len) to @a buf.
+   * The block is kept, so that the data can be dropped again if not changed.
+   *
+   * @param offset offset in the swap file
+   * @param len length of data
+   * @param buf buffer to decode to
+   * @return true if found
+   */
+  bool load(off_t offset, size_t len, void *buf);
+
+  /**
+   * @brief Take out blocks overlapping [offset, offset + len)
+   *
+   * @param offset offset in the swap file
+   * @param len length of the range
+   * @return std::vector<CompressedBlock> blocks removed from the tier
+   */
+  std::vector<CompressedBlock> take(off_t offset, size_t len);
+
+  /**
+   * @brief Take out least recently used blocks until the tier is within the
+   * budget
+   *
+   * @return std::vector<CompressedBlock> blocks removed from the tier
+   */
+  std::vector<CompressedBlock> spill();
+
+  /**
+   * @brief Drop blocks overlapping [offset, offset + len)
+   *
+   * @param offset offset in the swap file
+   * @param len length of the range
+   */
+  void erase(off_t offset, size_t len);
+
+  /**
+   * @brief Take out every block
+   *
+   * @return std::vector<CompressedBlock> blocks removed from the tier
+   */
+  std::vector<CompressedBlock> takeAll();
+
+  /**
+   * @brief Get bytes of encoded data held
+   *
+   * @return size_t bytes held
+   */
+  size_t getUsage() const { return usage; }
+
+  /**
+   * @brief Encode @a len bytes of @a buf
+   *
+   * @param codec codec to use
+   * @param buf data
+   * @param len length of data
+   * @param out encoded data
+   */
+  static void encode(SwapCodec codec, const void *buf, size_t len,
+                     std::vector<uint8_t> &out);
+
+  /**
+   * @brief Decode @a block to @a buf of block.len bytes
+   *
+   * @param block encoded block
+   * @param buf buffer to decode to
+   */
+  static void decode(const CompressedBlock &block, void *buf);
+
+private:
+  /**
+   * @brief block with its place in the lru list
+   */
+  struct Entry {
+    CompressedBlock block;               /**< block */
+    std::list<off_t>::iterator lru_iter; /**< position in lru */
+  };
+
+  /**
+   * @brief remove @a it from the tier and return its block
+   */
+  CompressedBlock remove(std::map<off_t, Entry>::iterator it);
+
+  size_t budget;                 /**< maximum bytes held */
+  size_t usage;                  /**< bytes held */
+  std::map<off_t, Entry> blocks; /**< <offset, entry> */
+  std::list<off_t> lru;          /**< offsets, most recently used first */
+};
+
+} // namespace nntrainer
+
+#endif /** __COMPRESSED_SWAP_TIER_H__ */
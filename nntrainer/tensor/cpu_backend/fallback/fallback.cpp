@@ -13,6 +13,7 @@
 
 #include <assert.h>
 #include <fallback_internal.h>
+#include <nntr_thread_pool.h>
 #include <nntrainer_error.h>
 
 namespace nntrainer {
@@ -74,7 +75,7 @@ void sgemv(const unsigned int TStorageOrder, bool TransA, const unsigned int M,
            const unsigned int N, const float alpha, const float *A,
            const unsigned int lda, const float *X, const unsigned int incX,
            const float beta, float *Y, const unsigned int incY) {
-  __fallback_sgemv(TStorageOrder, TransA, M, N, alpha, A, lda, Y, incX, beta, Y,
+  __fallback_sgemv(TStorageOrder, TransA, M, N, alpha, A, lda, X, incX, beta, Y,
                    incY);
 }
 
@@ -116,6 +117,43 @@ void sgemm(const unsigned int TStorageOrder, bool TransA, bool TransB,
                    ldb, beta, C, ldc);
 }
 
+void sgemm_batched(const unsigned int TStorageOrder, bool TransA, bool TransB,
+                   const unsigned int M, const unsigned int N,
+                   const unsigned int K, const float alpha, const float *A,
+                   const unsigned int lda, const size_t strideA, const float *B,
+                   const unsigned int ldb, const size_t strideB,
+                   const float beta, float *C, const unsigned int ldc,
+                   const size_t strideC, const unsigned int batch) {
+  ThreadPool::Global().parallelFor(
+    0, batch, 1, [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b)
+        sgemm(TStorageOrder, TransA, TransB, M, N, K, alpha, A + b * strideA,
+              lda, B + b * strideB, ldb, beta, C + b * strideC, ldc);
+    });
+}
+
+void qgemm_int8(bool TransB, const unsigned int M, const unsigned int N,
+                const unsigned int K, const float *A,
+                const unsigned int lda, const int8_t *B,
+                const unsigned int ldb, const float *scales,
+                const unsigned int scale_inc_k,
+                const unsigned int scale_inc_n, const float beta,
+                float *C, const unsigned int ldc) {
+  __fallback_qgemm_int8(TransB, M, N, K, A, lda, B, ldb, scales,
+                         scale_inc_k, scale_inc_n, beta, C, ldc);
+}
+
+void qgemm_int4(bool TransB, const unsigned int M, const unsigned int N,
+                const unsigned int K, const float *A,
+                const unsigned int lda, const uint8_t *B,
+                const unsigned int ldb, const float *scales,
+                const unsigned int scale_inc_k,
+                const unsigned int scale_inc_n, const float beta,
+                float *C, const unsigned int ldc) {
+  __fallback_qgemm_int4(TransB, M, N, K, A, lda, B, ldb, scales,
+                         scale_inc_k, scale_inc_n, beta, C, ldc);
+}
+
 unsigned int isamax(const unsigned int N, const float *X,
                     const unsigned int incX) {
   return __fallback_isamax(N, X, incX);
@@ -167,4 +205,52 @@ float max_val(const unsigned int N, float *X) { return __fallback_max(N, X); }
 void softmax(const unsigned int N, float *X, float *Y) {
   __fallback_softmax(N, X, Y);
 }
+
+void ele_sigmoid(const unsigned int N, const float *X, float *Y) {
+  __fallback_ele_sigmoid(N, X, Y);
+}
+
+void ele_sigmoid_prime(const unsigned int N, const float *Y, const float *dY,
+                       float *dX) {
+  __fallback_ele_sigmoid_prime(N, Y, dY, dX);
+}
+
+void ele_tanh(const unsigned int N, const float *X, float *Y) {
+  __fallback_ele_tanh(N, X, Y);
+}
+
+void ele_tanh_prime(const unsigned int N, const float *Y, const float *dY,
+                    float *dX) {
+  __fallback_ele_tanh_prime(N, Y, dY, dX);
+}
+
+void ele_relu(const unsigned int N, const float *X, float *Y) {
+  __fallback_ele_relu(N, X, Y);
+}
+
+void ele_relu_prime(const unsigned int N, const float *Y, const float *dY,
+                    float *dX) {
+  __fallback_ele_relu_prime(N, Y, dY, dX);
+}
+
+void ele_leaky_relu(const unsigned int N, const float *X, float *Y,
+                    float slope) {
+  __fallback_ele_leaky_relu(N, X, Y, slope);
+}
+
+void ele_leaky_relu_prime(const unsigned int N, const float *Y, const float *dY,
+                          float *dX, float slope) {
+  __fallback_ele_leaky_relu_prime(N, Y, dY, dX, slope);
+}
+
+void philox_uniform(const unsigned int N, const uint64_t seed,
+                    const uint64_t offset, float *X, const float min,
+                    const float max) {
+  __fallback_philox_uniform(N, seed, offset, X, min, max);
+}
+
+void philox_bernoulli(const unsigned int N, const uint64_t seed,
+                      const uint64_t offset, const float p, uint32_t *X) {
+  __fallback_philox_bernoulli(N, seed, offset, p, X);
+}
 } /* namespace nntrainer */
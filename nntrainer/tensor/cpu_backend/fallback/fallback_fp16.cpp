@@ -13,6 +13,7 @@
 
 #include <assert.h>
 #include <fallback_internal.h>
+#include <nntr_thread_pool.h>
 #include <nntrainer_error.h>
 
 namespace nntrainer {
@@ -84,6 +85,43 @@ void sgemm(const unsigned int TStorageOrder, bool TransA, bool TransB,
                    ldb, beta, C, ldc);
 }
 
+void sgemm_batched(const unsigned int TStorageOrder, bool TransA, bool TransB,
+                   const unsigned int M, const unsigned int N,
+                   const unsigned int K, const float alpha, const _FP16 *A,
+                   const unsigned int lda, const size_t strideA, const _FP16 *B,
+                   const unsigned int ldb, const size_t strideB,
+                   const float beta, _FP16 *C, const unsigned int ldc,
+                   const size_t strideC, const unsigned int batch) {
+  ThreadPool::Global().parallelFor(
+    0, batch, 1, [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b)
+        sgemm(TStorageOrder, TransA, TransB, M, N, K, alpha, A + b * strideA,
+              lda, B + b * strideB, ldb, beta, C + b * strideC, ldc);
+    });
+}
+
+void qgemm_int8(bool TransB, const unsigned int M, const unsigned int N,
+                const unsigned int K, const _FP16 *A,
+                const unsigned int lda, const int8_t *B,
+                const unsigned int ldb, const float *scales,
+                const unsigned int scale_inc_k,
+                const unsigned int scale_inc_n, const float beta,
+                _FP16 *C, const unsigned int ldc) {
+  __fallback_qgemm_int8(TransB, M, N, K, A, lda, B, ldb, scales,
+                         scale_inc_k, scale_inc_n, beta, C, ldc);
+}
+
+void qgemm_int4(bool TransB, const unsigned int M, const unsigned int N,
+                const unsigned int K, const _FP16 *A,
+                const unsigned int lda, const uint8_t *B,
+                const unsigned int ldb, const float *scales,
+                const unsigned int scale_inc_k,
+                const unsigned int scale_inc_n, const float beta,
+                _FP16 *C, const unsigned int ldc) {
+  __fallback_qgemm_int4(TransB, M, N, K, A, lda, B, ldb, scales,
+                         scale_inc_k, scale_inc_n, beta, C, ldc);
+}
+
 void sgemv(const unsigned int TStorageOrder, bool TransA, const unsigned int M,
            const unsigned int N, const float alpha, const _FP16 *A,
            const unsigned int lda, const _FP16 *X, const unsigned int incX,
@@ -17,20 +17,15 @@
 #include <cmath>
 #include <cstdint>
 #include <fallback_internal.h>
+#include <nntr_thread_pool.h>
 #include <stdexcept>
 #include <tensor_dim.h>
+#include <vector>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
 
-#define sgemv_loop(ci, cj, cM, cN)                                             \
-  do {                                                                         \
-    float y0;                                                                  \
-    unsigned int i, j;                                                         \
-    for (ci = 0; ci != cM; ci++) {                                             \
-      y0 = Y[ci * incY] * beta;                                                \
-      for (cj = 0; cj != cN; cj++)                                             \
-        y0 += A[i + j * lda] * X[cj * incX];                                   \
-      Y[ci * incY] = y0;                                                       \
-    }                                                                          \
-  } while (0);
 namespace nntrainer {
 
 void __fallback_sscal(const unsigned int N, const float alpha, float *X,
@@ -147,27 +142,284 @@ void __fallback_saxpy(const unsigned int N, const float alpha, const float *X,
     Y[i * incY] = Y[i * incY] + X[i * incX] * alpha;
 }
 
+namespace {
+
+/** micro-kernel rows */
+constexpr unsigned int SGEMM_MR = 6;
+/** micro-kernel columns */
+constexpr unsigned int SGEMM_NR = 16;
+/** rows of A packed at once, multiple of SGEMM_MR */
+constexpr unsigned int SGEMM_MC = 144;
+/** depth of a packed block */
+constexpr unsigned int SGEMM_KC = 256;
+/** columns of B packed at once, multiple of SGEMM_NR */
+constexpr unsigned int SGEMM_NC = 2048;
+
+/**
+ * @brief per-thread packing buffer which only grows
+ *
+ * @param slot index of the buffer
+ * @param len number of elements required
+ * @return float* buffer of at least @a len elements
+ */
+float *get_pack_buffer(unsigned int slot, size_t len) {
+  thread_local std::vector<float> buffers[2];
+  if (buffers[slot].size() < len)
+    buffers[slot].resize(len);
+  return buffers[slot].data();
+}
+
+/**
+ * @brief pack op(B)[pc : pc + kc, jc : jc + nc] into SGEMM_NR wide panels,
+ * zero padded to SGEMM_NR columns
+ */
+void pack_b(bool TransB, unsigned int kc, unsigned int nc, const float *B,
+            unsigned int ldb, unsigned int pc, unsigned int jc, float *Bp) {
+  for (unsigned int j0 = 0; j0 < nc; j0 += SGEMM_NR) {
+    unsigned int nr = std::min(SGEMM_NR, nc - j0);
+    float *panel = Bp + (size_t)j0 * kc;
+    for (unsigned int k = 0; k < kc; ++k) {
+      float *dst = panel + (size_t)k * SGEMM_NR;
+      for (unsigned int j = 0; j < nr; ++j)
+        dst[j] = TransB ? B[(size_t)(jc + j0 + j) * ldb + pc + k]
+                        : B[(size_t)(pc + k) * ldb + jc + j0 + j];
+      for (unsigned int j = nr; j < SGEMM_NR; ++j)
+        dst[j] = 0.0f;
+    }
+  }
+}
+
+/**
+ * @brief pack op(A)[ic : ic + mc, pc : pc + kc] into SGEMM_MR high panels,
+ * zero padded to SGEMM_MR rows
+ */
+void pack_a(bool TransA, unsigned int mc, unsigned int kc, const float *A,
+            unsigned int lda, unsigned int ic, unsigned int pc, float *Ap) {
+  for (unsigned int i0 = 0; i0 < mc; i0 += SGEMM_MR) {
+    unsigned int mr = std::min(SGEMM_MR, mc - i0);
+    float *panel = Ap + (size_t)i0 * kc;
+    for (unsigned int k = 0; k < kc; ++k) {
+      float *dst = panel + (size_t)k * SGEMM_MR;
+      for (unsigned int i = 0; i < mr; ++i)
+        dst[i] = TransA ? A[(size_t)(pc + k) * lda + ic + i0 + i]
+                        : A[(size_t)(ic + i0 + i) * lda + pc + k];
+      for (unsigned int i = mr; i < SGEMM_MR; ++i)
+        dst[i] = 0.0f;
+    }
+  }
+}
+
+/**
+ * @brief write back a micro tile, C[mr][nr] = alpha * acc + beta * C. C is not
+ * read when beta is zero.
+ */
+inline void sgemm_store(const float (*acc)[SGEMM_NR], float alpha, float beta,
+                        float *C, unsigned int ldc, unsigned int mr,
+                        unsigned int nr) {
+  for (unsigned int i = 0; i < mr; ++i) {
+    float *c = C + (size_t)i * ldc;
+    if (beta == 0.0f) {
+      for (unsigned int j = 0; j < nr; ++j)
+        c[j] = alpha * acc[i][j];
+    } else {
+      for (unsigned int j = 0; j < nr; ++j)
+        c[j] = alpha * acc[i][j] + beta * c[j];
+    }
+  }
+}
+
+#if defined(__AVX2__) && defined(__FMA__)
+/**
+ * @brief register-tiled micro-kernel, C[mr][nr] = alpha * Ap * Bp + beta * C.
+ * The 6x16 tile lives in twelve ymm registers, rows are unrolled by hand as
+ * the compiler does not unroll them at -O2.
+ */
+inline void sgemm_kernel(unsigned int kc, const float *Ap, const float *Bp,
+                         float alpha, float beta, float *C, unsigned int ldc,
+                         unsigned int mr, unsigned int nr) {
+  __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+  __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+  __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+  __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+  __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+  __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+  for (unsigned int k = 0; k < kc; ++k) {
+    const __m256 b0 = _mm256_loadu_ps(Bp);
+    const __m256 b1 = _mm256_loadu_ps(Bp + 8);
+    __m256 a;
+
+    a = _mm256_broadcast_ss(Ap);
+    c00 = _mm256_fmadd_ps(a, b0, c00);
+    c01 = _mm256_fmadd_ps(a, b1, c01);
+    a = _mm256_broadcast_ss(Ap + 1);
+    c10 = _mm256_fmadd_ps(a, b0, c10);
+    c11 = _mm256_fmadd_ps(a, b1, c11);
+    a = _mm256_broadcast_ss(Ap + 2);
+    c20 = _mm256_fmadd_ps(a, b0, c20);
+    c21 = _mm256_fmadd_ps(a, b1, c21);
+    a = _mm256_broadcast_ss(Ap + 3);
+    c30 = _mm256_fmadd_ps(a, b0, c30);
+    c31 = _mm256_fmadd_ps(a, b1, c31);
+    a = _mm256_broadcast_ss(Ap + 4);
+    c40 = _mm256_fmadd_ps(a, b0, c40);
+    c41 = _mm256_fmadd_ps(a, b1, c41);
+    a = _mm256_broadcast_ss(Ap + 5);
+    c50 = _mm256_fmadd_ps(a, b0, c50);
+    c51 = _mm256_fmadd_ps(a, b1, c51);
+
+    Ap += SGEMM_MR;
+    Bp += SGEMM_NR;
+  }
+
+  float acc[SGEMM_MR][SGEMM_NR];
+  _mm256_storeu_ps(acc[0], c00);
+  _mm256_storeu_ps(acc[0] + 8, c01);
+  _mm256_storeu_ps(acc[1], c10);
+  _mm256_storeu_ps(acc[1] + 8, c11);
+  _mm256_storeu_ps(acc[2], c20);
+  _mm256_storeu_ps(acc[2] + 8, c21);
+  _mm256_storeu_ps(acc[3], c30);
+  _mm256_storeu_ps(acc[3] + 8, c31);
+  _mm256_storeu_ps(acc[4], c40);
+  _mm256_storeu_ps(acc[4] + 8, c41);
+  _mm256_storeu_ps(acc[5], c50);
+  _mm256_storeu_ps(acc[5] + 8, c51);
+  sgemm_store(acc, alpha, beta, C, ldc, mr, nr);
+}
+#else
+/**
+ * @brief register-tiled micro-kernel, C[mr][nr] = alpha * Ap * Bp + beta * C.
+ * The fixed size inner loops are left to the auto-vectorizer.
+ */
+inline void sgemm_kernel(unsigned int kc, const float *Ap, const float *Bp,
+                         float alpha, float beta, float *C, unsigned int ldc,
+                         unsigned int mr, unsigned int nr) {
+  float acc[SGEMM_MR][SGEMM_NR] = {};
+
+  for (unsigned int k = 0; k < kc; ++k) {
+    for (unsigned int i = 0; i < SGEMM_MR; ++i) {
+      const float a = Ap[i];
+      for (unsigned int j = 0; j < SGEMM_NR; ++j)
+        acc[i][j] += a * Bp[j];
+    }
+    Ap += SGEMM_MR;
+    Bp += SGEMM_NR;
+  }
+
+  sgemm_store(acc, alpha, beta, C, ldc, mr, nr);
+}
+#endif
+
+/**
+ * @brief compute C[ic : ic + mc, jc : jc + nc] with a packed B block
+ */
+void sgemm_block(bool TransA, unsigned int mc, unsigned int nc,
+                 unsigned int kc, float alpha, const float *A,
+                 unsigned int lda, unsigned int ic, unsigned int pc,
+                 const float *Bp, float beta, float *C, unsigned int ldc) {
+  float *Ap = get_pack_buffer(0, (size_t)SGEMM_MC * SGEMM_KC);
+
+  for (unsigned int i_mc = 0; i_mc < mc; i_mc += SGEMM_MC) {
+    unsigned int m_blk = std::min(SGEMM_MC, mc - i_mc);
+    pack_a(TransA, m_blk, kc, A, lda, ic + i_mc, pc, Ap);
+
+    for (unsigned int j0 = 0; j0 < nc; j0 += SGEMM_NR) {
+      for (unsigned int i0 = 0; i0 < m_blk; i0 += SGEMM_MR) {
+        sgemm_kernel(kc, Ap + (size_t)i0 * kc, Bp + (size_t)j0 * kc, alpha,
+                     beta, C + (size_t)(i_mc + i0) * ldc + j0, ldc,
+                     std::min(SGEMM_MR, m_blk - i0),
+                     std::min(SGEMM_NR, nc - j0));
+      }
+    }
+  }
+}
+
+} // namespace
+
 void __fallback_sgemm(const unsigned int TStorageOrder, bool TransA,
                       bool TransB, const unsigned int M, const unsigned int N,
                       const unsigned int K, const float alpha, const float *A,
                       const unsigned int lda, const float *B,
                       const unsigned int ldb, const float beta, float *C,
                       const unsigned int ldc) {
-  for (unsigned int m = 0; m < M; ++m) {
-    for (unsigned int n = 0; n < N; ++n) {
-      double c = 0.0;
-      float c_old = C[m * ldc + n];
-      for (unsigned int k = 0; k < K; ++k) {
-        float a, b;
-        a = ((TransA == true) ? A[k * lda + m] : A[m * lda + k]);
-        b = ((TransB == true) ? B[n * ldb + k] : B[k * ldb + n]);
-        c += a * b;
+  if (TStorageOrder != 0) {
+    /** C^T = op(B)^T * op(A)^T in row-major */
+    __fallback_sgemm(0, TransB, TransA, N, M, K, alpha, B, ldb, A, lda, beta,
+                     C, ldc);
+    return;
+  }
+
+  if (M == 0 || N == 0)
+    return;
+
+  if (K == 0 || alpha == 0.0f) {
+    for (unsigned int m = 0; m < M; ++m)
+      for (unsigned int n = 0; n < N; ++n)
+        C[m * ldc + n] = beta == 0.0f ? 0.0f : beta * C[m * ldc + n];
+    return;
+  }
+
+  /** a single row or column of C is a matrix-vector product */
+  if (M == 1) {
+    __fallback_sgemv(0, !TransB, TransB ? N : K, TransB ? K : N, alpha, B, ldb,
+                     A, TransA ? lda : 1, beta, C, 1);
+    return;
+  }
+  if (N == 1) {
+    __fallback_sgemv(0, TransA, TransA ? K : M, TransA ? M : K, alpha, A, lda,
+                     B, TransB ? 1 : ldb, beta, C, ldc);
+    return;
+  }
+
+  ThreadPool &pool = ThreadPool::Global();
+  const unsigned int num_mblocks = (M + SGEMM_MC - 1) / SGEMM_MC;
+
+  if (num_mblocks >= pool.getNumThreads()) {
+    /** tall matrix : share the packed B block, split rows over the threads */
+    for (unsigned int jc = 0; jc < N; jc += SGEMM_NC) {
+      unsigned int nc = std::min(SGEMM_NC, N - jc);
+      for (unsigned int pc = 0; pc < K; pc += SGEMM_KC) {
+        unsigned int kc = std::min(SGEMM_KC, K - pc);
+        float b = pc == 0 ? beta : 1.0f;
+
+        float *Bp = get_pack_buffer(1, (size_t)SGEMM_NC * SGEMM_KC);
+        pack_b(TransB, kc, nc, B, ldb, pc, jc, Bp);
+
+        pool.parallelFor(
+          0, num_mblocks, 1,
+          [&](unsigned int start, unsigned int end, unsigned int) {
+            unsigned int ic = start * SGEMM_MC;
+            unsigned int mc = std::min(end * SGEMM_MC, M) - ic;
+            sgemm_block(TransA, mc, nc, kc, alpha, A, lda, ic, pc, Bp, b,
+                        C + (size_t)ic * ldc + jc, ldc);
+          });
       }
-      C[m * ldc + n] = alpha * c;
-      if (beta != 0.0)
-        C[m * ldc + n] += beta * c_old;
     }
+    return;
   }
+
+  /** wide matrix : split columns over the threads, each packs its own B */
+  const unsigned int nr_blocks = (N + SGEMM_NR - 1) / SGEMM_NR;
+  const unsigned int grain = std::max(
+    std::min((nr_blocks + pool.getNumThreads() - 1) / pool.getNumThreads(),
+             SGEMM_NC / SGEMM_NR),
+    1u);
+
+  pool.parallelFor(
+    0, nr_blocks, grain,
+    [&](unsigned int start, unsigned int end, unsigned int) {
+      unsigned int jc = start * SGEMM_NR;
+      unsigned int nc = std::min(end * SGEMM_NR, N) - jc;
+      float *Bp = get_pack_buffer(1, (size_t)SGEMM_NC * SGEMM_KC);
+
+      for (unsigned int pc = 0; pc < K; pc += SGEMM_KC) {
+        unsigned int kc = std::min(SGEMM_KC, K - pc);
+        pack_b(TransB, kc, nc, B, ldb, pc, jc, Bp);
+        sgemm_block(TransA, M, nc, kc, alpha, A, lda, 0, pc, Bp,
+                    pc == 0 ? beta : 1.0f, C + jc, ldc);
+      }
+    });
 }
 
 void __fallback_sgemv(const unsigned int TStorageOrder, bool TransA,
@@ -175,12 +427,293 @@ void __fallback_sgemv(const unsigned int TStorageOrder, bool TransA,
                       const float alpha, const float *A, const unsigned int lda,
                       const float *X, const unsigned int incX, const float beta,
                       float *Y, const unsigned int incY) {
+  if (TStorageOrder != 0) {
+    /** column-major A is a row-major N x M matrix */
+    __fallback_sgemv(0, !TransA, N, M, alpha, A, lda, X, incX, beta, Y, incY);
+    return;
+  }
+
+  if (!TransA) {
+    for (unsigned int i = 0; i < M; ++i) {
+      const float *row = A + (size_t)i * lda;
+      float sum = 0.0f;
+      for (unsigned int j = 0; j < N; ++j)
+        sum += row[j] * X[j * incX];
+      Y[i * incY] =
+        beta == 0.0f ? alpha * sum : alpha * sum + beta * Y[i * incY];
+    }
+    return;
+  }
+
+  for (unsigned int j = 0; j < N; ++j)
+    Y[j * incY] = beta == 0.0f ? 0.0f : beta * Y[j * incY];
+
+  for (unsigned int i = 0; i < M; ++i) {
+    const float *row = A + (size_t)i * lda;
+    const float x = alpha * X[i * incX];
+    if (incY == 1) {
+      for (unsigned int j = 0; j < N; ++j)
+        Y[j] += x * row[j];
+    } else {
+      for (unsigned int j = 0; j < N; ++j)
+        Y[j * incY] += x * row[j];
+    }
+  }
+}
+
+namespace {
+
+/** columns of C computed by a task of the single row weight-only gemm */
+constexpr unsigned int QGEMV_NB = 512;
+/** elements of a stored row of B decoded at once */
+constexpr unsigned int QGEMM_DECODE = SGEMM_NC;
+
+static_assert(QGEMM_DECODE >= SGEMM_KC && QGEMM_DECODE >= QGEMV_NB,
+              "a decoded row must hold a packed depth and a gemv block");
+
+/**
+ * @brief decoder of the rows of a row-major int8 matrix
+ */
+struct Int8Rows {
+  const int8_t *B;  /**< data */
+  unsigned int ldb; /**< leading dimension */
+
+  /**
+   * @brief convert B[r][c0 : c0 + len] to float
+   */
+  void operator()(unsigned int r, unsigned int c0, unsigned int len,
+                  float *dst) const {
+    const int8_t *src = B + (size_t)r * ldb + c0;
+    for (unsigned int i = 0; i < len; ++i)
+      dst[i] = src[i];
+  }
+};
+
+/**
+ * @brief decoder of the rows of a row-major int4x2 matrix, an even element is
+ * in the high nibble
+ */
+struct Int4Rows {
+  const uint8_t *B; /**< data */
+  unsigned int ldb; /**< leading dimension in elements */
+
+  /**
+   * @brief convert B[r][c0 : c0 + len] to float
+   */
+  void operator()(unsigned int r, unsigned int c0, unsigned int len,
+                  float *dst) const {
+    size_t idx = (size_t)r * ldb + c0;
+    unsigned int i = 0;
+    if (len > 0 && (idx & 1)) {
+      dst[i++] = low(B[idx / 2]);
+      ++idx;
+    }
+
+    const uint8_t *src = B + idx / 2;
+    for (; i + 1 < len; i += 2, ++src) {
+      dst[i] = high(*src);
+      dst[i + 1] = low(*src);
+    }
+    if (i < len)
+      dst[i] = high(*src);
+  }
+
+  /**
+   * @brief signed value of the high nibble
+   */
+  static int high(uint8_t byte) { return static_cast<int8_t>(byte) >> 4; }
 
-  if (TransA == true) {
-    sgemv_loop(i, j, N, M);
+  /**
+   * @brief signed value of the low nibble
+   */
+  static int low(uint8_t byte) {
+    return static_cast<int8_t>(static_cast<uint8_t>(byte << 4)) >> 4;
+  }
+};
+
+/**
+ * @brief dequantize op(B)[pc : pc + kc, jc : jc + nc] into SGEMM_NR wide
+ * panels, zero padded to SGEMM_NR columns. @a rows decodes the stored rows of
+ * B, which are the columns of op(B) if TransB.
+ */
+template <typename Rows>
+void pack_b_quant(const Rows &rows, bool TransB, unsigned int kc,
+                  unsigned int nc, unsigned int pc, unsigned int jc,
+                  const float *scales, unsigned int scale_inc_k,
+                  unsigned int scale_inc_n, float *Bp) {
+  float buf[QGEMM_DECODE];
+
+  if (TransB) {
+    for (unsigned int j = 0; j < nc; ++j) {
+      float *dst = Bp + (size_t)(j / SGEMM_NR) * SGEMM_NR * kc + j % SGEMM_NR;
+      const float *scale =
+        scales + (size_t)(jc + j) * scale_inc_n + (size_t)pc * scale_inc_k;
+      rows(jc + j, pc, kc, buf);
+      for (unsigned int k = 0; k < kc; ++k)
+        dst[(size_t)k * SGEMM_NR] = buf[k] * scale[(size_t)k * scale_inc_k];
+    }
+  } else {
+    for (unsigned int k = 0; k < kc; ++k) {
+      const float *scale =
+        scales + (size_t)(pc + k) * scale_inc_k + (size_t)jc * scale_inc_n;
+      rows(pc + k, jc, nc, buf);
+      for (unsigned int j = 0; j < nc; ++j)
+        buf[j] *= scale[(size_t)j * scale_inc_n];
+      for (unsigned int j0 = 0; j0 < nc; j0 += SGEMM_NR) {
+        float *dst = Bp + (size_t)j0 * kc + (size_t)k * SGEMM_NR;
+        const unsigned int nr = std::min(SGEMM_NR, nc - j0);
+        for (unsigned int j = 0; j < nr; ++j)
+          dst[j] = buf[j0 + j];
+      }
+    }
+  }
+
+  if (const unsigned int nr = nc % SGEMM_NR; nr != 0) {
+    float *panel = Bp + (size_t)(nc - nr) * kc;
+    for (unsigned int k = 0; k < kc; ++k)
+      for (unsigned int j = nr; j < SGEMM_NR; ++j)
+        panel[(size_t)k * SGEMM_NR + j] = 0.0f;
+  }
+}
+
+/**
+ * @brief C[0, jc : jc + nc] = A * op(dequant(B)) + beta * C for a single row
+ * of A. Every weight is used once, so it is decoded a row at a time instead
+ * of being packed, and a scale shared by a column is applied to the sum.
+ */
+template <typename Rows>
+void qgemv_block(const Rows &rows, bool TransB, unsigned int jc,
+                 unsigned int nc, unsigned int K, const float *A,
+                 const float *scales, unsigned int scale_inc_k,
+                 unsigned int scale_inc_n, float beta, float *C) {
+  float acc[QGEMV_NB] = {};
+  float buf[QGEMM_DECODE];
+
+  if (TransB) {
+    /** a stored row of B is a column of op(B) */
+    for (unsigned int j = 0; j < nc; ++j) {
+      const float *scale = scales + (size_t)(jc + j) * scale_inc_n;
+      float sum = 0.0f;
+      for (unsigned int k0 = 0; k0 < K; k0 += QGEMM_DECODE) {
+        const unsigned int len = std::min(QGEMM_DECODE, K - k0);
+        rows(jc + j, k0, len, buf);
+        if (scale_inc_k == 0) {
+          for (unsigned int k = 0; k < len; ++k)
+            sum += A[k0 + k] * buf[k];
+        } else {
+          for (unsigned int k = 0; k < len; ++k)
+            sum += A[k0 + k] * buf[k] * scale[(size_t)(k0 + k) * scale_inc_k];
+        }
+      }
+      acc[j] = scale_inc_k == 0 ? sum * scale[0] : sum;
+    }
+  } else if (scale_inc_k == 0) {
+    for (unsigned int k = 0; k < K; ++k) {
+      rows(k, jc, nc, buf);
+      for (unsigned int j = 0; j < nc; ++j)
+        acc[j] += A[k] * buf[j];
+    }
+    const float *scale = scales + (size_t)jc * scale_inc_n;
+    for (unsigned int j = 0; j < nc; ++j)
+      acc[j] *= scale[(size_t)j * scale_inc_n];
   } else {
-    sgemv_loop(j, i, M, N);
+    for (unsigned int k = 0; k < K; ++k) {
+      const float *scale =
+        scales + (size_t)k * scale_inc_k + (size_t)jc * scale_inc_n;
+      rows(k, jc, nc, buf);
+      for (unsigned int j = 0; j < nc; ++j)
+        acc[j] += A[k] * buf[j] * scale[(size_t)j * scale_inc_n];
+    }
   }
+
+  for (unsigned int j = 0; j < nc; ++j)
+    C[jc + j] = beta == 0.0f ? acc[j] : acc[j] + beta * C[jc + j];
+}
+
+/**
+ * @brief weight-only quantized gemm over a row decoder of B. Columns of C are
+ * split over the threads so that each weight is dequantized once per block of
+ * SGEMM_MC rows of A.
+ */
+template <typename Rows>
+void qgemm(const Rows &rows, bool TransB, const unsigned int M,
+           const unsigned int N, const unsigned int K, const float *A,
+           const unsigned int lda, const float *scales,
+           const unsigned int scale_inc_k, const unsigned int scale_inc_n,
+           const float beta, float *C, const unsigned int ldc) {
+  if (M == 0 || N == 0)
+    return;
+
+  if (K == 0) {
+    for (unsigned int m = 0; m < M; ++m)
+      for (unsigned int n = 0; n < N; ++n)
+        C[m * ldc + n] = beta == 0.0f ? 0.0f : beta * C[m * ldc + n];
+    return;
+  }
+
+  ThreadPool &pool = ThreadPool::Global();
+
+  if (M == 1) {
+    pool.parallelFor(
+      0, (N + QGEMV_NB - 1) / QGEMV_NB, 1,
+      [&](unsigned int start, unsigned int end, unsigned int) {
+        for (unsigned int b = start; b < end; ++b) {
+          unsigned int jc = b * QGEMV_NB;
+          qgemv_block(rows, TransB, jc, std::min(QGEMV_NB, N - jc), K, A,
+                      scales, scale_inc_k, scale_inc_n, beta, C);
+        }
+      });
+    return;
+  }
+
+  const unsigned int nr_blocks = (N + SGEMM_NR - 1) / SGEMM_NR;
+  const unsigned int grain = std::max(
+    std::min((nr_blocks + pool.getNumThreads() - 1) / pool.getNumThreads(),
+             SGEMM_NC / SGEMM_NR),
+    1u);
+
+  pool.parallelFor(
+    0, nr_blocks, grain,
+    [&](unsigned int start, unsigned int end, unsigned int) {
+      const unsigned int col_end = std::min(end * SGEMM_NR, N);
+      float *Bp = get_pack_buffer(1, (size_t)SGEMM_NC * SGEMM_KC);
+
+      /** a range runs whole when the pool has no workers */
+      for (unsigned int jc = start * SGEMM_NR; jc < col_end; jc += SGEMM_NC) {
+        unsigned int nc = std::min(SGEMM_NC, col_end - jc);
+        for (unsigned int pc = 0; pc < K; pc += SGEMM_KC) {
+          unsigned int kc = std::min(SGEMM_KC, K - pc);
+          pack_b_quant(rows, TransB, kc, nc, pc, jc, scales, scale_inc_k,
+                       scale_inc_n, Bp);
+          sgemm_block(false, M, nc, kc, 1.0f, A, lda, 0, pc, Bp,
+                      pc == 0 ? beta : 1.0f, C + jc, ldc);
+        }
+      }
+    });
+}
+
+} // namespace
+
+void __fallback_qgemm_int8(bool TransB, const unsigned int M,
+                           const unsigned int N, const unsigned int K,
+                           const float *A, const unsigned int lda,
+                           const int8_t *B, const unsigned int ldb,
+                           const float *scales, const unsigned int scale_inc_k,
+                           const unsigned int scale_inc_n, const float beta,
+                           float *C, const unsigned int ldc) {
+  qgemm(Int8Rows{B, ldb}, TransB, M, N, K, A, lda, scales, scale_inc_k,
+        scale_inc_n, beta, C, ldc);
+}
+
+void __fallback_qgemm_int4(bool TransB, const unsigned int M,
+                           const unsigned int N, const unsigned int K,
+                           const float *A, const unsigned int lda,
+                           const uint8_t *B, const unsigned int ldb,
+                           const float *scales, const unsigned int scale_inc_k,
+                           const unsigned int scale_inc_n, const float beta,
+                           float *C, const unsigned int ldc) {
+  qgemm(Int4Rows{B, ldb}, TransB, M, N, K, A, lda, scales, scale_inc_k,
+        scale_inc_n, beta, C, ldc);
 }
 
 unsigned int __fallback_isamax(const unsigned int N, const float *X,
@@ -319,4 +852,125 @@ void __fallback_softmax(const unsigned int N, float *X, float *Y) {
     ++i;
   }
 }
+
+void __fallback_ele_sigmoid(const unsigned int N, const float *X, float *Y) {
+  for (unsigned int i = 0; i < N; ++i)
+    Y[i] = 1.0f / (1.0f + std::exp(-X[i]));
+}
+
+void __fallback_ele_sigmoid_prime(const unsigned int N, const float *Y,
+                                  const float *dY, float *dX) {
+  for (unsigned int i = 0; i < N; ++i)
+    dX[i] = dY[i] * Y[i] * (1.0f - Y[i]);
+}
+
+void __fallback_ele_tanh(const unsigned int N, const float *X, float *Y) {
+  for (unsigned int i = 0; i < N; ++i)
+    Y[i] = std::tanh(X[i]);
+}
+
+void __fallback_ele_tanh_prime(const unsigned int N, const float *Y,
+                               const float *dY, float *dX) {
+  for (unsigned int i = 0; i < N; ++i)
+    dX[i] = dY[i] * (1.0f - Y[i] * Y[i]);
+}
+
+void __fallback_ele_relu(const unsigned int N, const float *X, float *Y) {
+  for (unsigned int i = 0; i < N; ++i)
+    Y[i] = X[i] > 0.0f ? X[i] : 0.0f;
+}
+
+void __fallback_ele_relu_prime(const unsigned int N, const float *Y,
+                               const float *dY, float *dX) {
+  for (unsigned int i = 0; i < N; ++i)
+    dX[i] = Y[i] > 0.0f ? dY[i] : 0.0f;
+}
+
+void __fallback_ele_leaky_relu(const unsigned int N, const float *X, float *Y,
+                               float slope) {
+  for (unsigned int i = 0; i < N; ++i)
+    Y[i] = X[i] >= 0.0f ? X[i] : slope * X[i];
+}
+
+void __fallback_ele_leaky_relu_prime(const unsigned int N, const float *Y,
+                                     const float *dY, float *dX, float slope) {
+  for (unsigned int i = 0; i < N; ++i)
+    dX[i] = Y[i] >= 0.0f ? dY[i] : slope * dY[i];
+}
+
+namespace {
+
+constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+constexpr unsigned int PHILOX_ROUNDS = 10;
+
+/**
+ * @brief block @a counter of the Philox4x32-10 stream @a seed
+ */
+void philox4x32(const uint64_t seed, const uint64_t counter, uint32_t *out) {
+  uint32_t c0 = static_cast<uint32_t>(counter);
+  uint32_t c1 = static_cast<uint32_t>(counter >> 32);
+  uint32_t c2 = 0;
+  uint32_t c3 = 0;
+  uint32_t k0 = static_cast<uint32_t>(seed);
+  uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+
+  for (unsigned int r = 0; r < PHILOX_ROUNDS; ++r) {
+    const uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * c0;
+    const uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * c2;
+    c0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+    c1 = static_cast<uint32_t>(p1);
+    c2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+    c3 = static_cast<uint32_t>(p0);
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+/**
+ * @brief bernoulli threshold on the 24 bit sample: u_i < p iff (w >> 8) < t
+ */
+uint32_t philoxThreshold(const float p) {
+  return static_cast<uint32_t>(
+    std::ceil(std::min(std::max(p, 0.0f), 1.0f) * 16777216.0f));
+}
+
+} // namespace
+
+void __fallback_philox_uniform(const unsigned int N, const uint64_t seed,
+                               const uint64_t offset, float *X, const float min,
+                               const float max) {
+  const float range = max - min;
+  uint32_t words[4];
+
+  for (unsigned int i = 0; i < N; i += 4) {
+    philox4x32(seed, offset + i / 4, words);
+    for (unsigned int l = 0; l < 4 && i + l < N; ++l)
+      X[i + l] = min + range * ((words[l] >> 8) * 0x1p-24f);
+  }
+}
+
+void __fallback_philox_bernoulli(const unsigned int N, const uint64_t seed,
+                                 const uint64_t offset, const float p,
+                                 uint32_t *X) {
+  const uint32_t threshold = philoxThreshold(p);
+  uint32_t words[4];
+
+  for (unsigned int i = 0; i < N; i += 32) {
+    uint32_t bits = 0;
+    for (unsigned int j = 0; j < 32 && i + j < N; j += 4) {
+      philox4x32(seed, offset + (i + j) / 4, words);
+      for (unsigned int l = 0; l < 4 && i + j + l < N; ++l)
+        bits |= static_cast<uint32_t>((words[l] >> 8) < threshold) << (j + l);
+    }
+    X[i / 32] = bits;
+  }
+}
 } // namespace nntrainer
@@ -150,6 +150,44 @@ void __fallback_sgemv(const unsigned int TStorageOrder, bool TransA,
                       const float alpha, const _FP16 *A, const unsigned int lda,
                       const _FP16 *X, const unsigned int incX, const float beta,
                       _FP16 *Y, const unsigned int incY);
+
+/**
+ * @brief     weight-only quantized gemm : C = A * op(dequant(B)) + beta * C in
+ * row-major, where op(X) is one of X or X**T and dequant(B)(k, n) is
+ * op(B)(k, n) * scales[k * scale_inc_k + n * scale_inc_n]. B is dequantized
+ * tile by tile and never as a whole.
+ * @param[in] TransB true if B is stored N x K
+ * @param[in] M number of A's and C's row
+ * @param[in] N number of op(B)'s and C's columns
+ * @param[in] K number of A's columns and op(B)'s rows
+ * @param[in] A _FP16 * for Matrix A
+ * @param[in] B int8_t * for Matrix B
+ * @param[in] scales float * for the scale factors of B
+ * @param[in] scale_inc_k scale stride along op(B)'s rows
+ * @param[in] scale_inc_n scale stride along op(B)'s columns
+ * @param[in] beta float number
+ * @param[in] C _FP16 * for Matrix C
+ */
+void __fallback_qgemm_int8(bool TransB, const unsigned int M,
+                           const unsigned int N, const unsigned int K,
+                           const _FP16 *A, const unsigned int lda,
+                           const int8_t *B, const unsigned int ldb,
+                           const float *scales, const unsigned int scale_inc_k,
+                           const unsigned int scale_inc_n, const float beta,
+                           _FP16 *C, const unsigned int ldc);
+
+/**
+ * @brief     __fallback_qgemm_int8() with a 4-bit B
+ * @param[in] B uint8_t * for Matrix B, two values a byte with the even element
+ * in the high nibble
+ */
+void __fallback_qgemm_int4(bool TransB, const unsigned int M,
+                           const unsigned int N, const unsigned int K,
+                           const _FP16 *A, const unsigned int lda,
+                           const uint8_t *B, const unsigned int ldb,
+                           const float *scales, const unsigned int scale_inc_k,
+                           const unsigned int scale_inc_n, const float beta,
+                           _FP16 *C, const unsigned int ldc);
 /**
  * @brief     elementwise vector multiplication : Z = X ⊙ alpha * Y +
  * beta * Z
@@ -339,6 +377,120 @@ float __fallback_max(const unsigned int N, float *X);
  */
 void __fallback_softmax(const unsigned int N, float *X, float *Y);
 
+/**
+ * @brief sigmoid function : Y = 1 / (1 + exp(-X))
+ *
+ * @param N number of elements
+ * @param X float * for Vector X
+ * @param Y float * for Vector Y
+ */
+void __fallback_ele_sigmoid(const unsigned int N, const float *X, float *Y);
+
+/**
+ * @brief derivative of sigmoid from its output : dX = dY * Y * (1 - Y)
+ *
+ * @param N number of elements
+ * @param Y float * for activation output
+ * @param dY float * for incoming derivative
+ * @param dX float * for outgoing derivative
+ */
+void __fallback_ele_sigmoid_prime(const unsigned int N, const float *Y,
+                                  const float *dY, float *dX);
+
+/**
+ * @brief tanh function : Y = tanh(X)
+ *
+ * @param N number of elements
+ * @param X float * for Vector X
+ * @param Y float * for Vector Y
+ */
+void __fallback_ele_tanh(const unsigned int N, const float *X, float *Y);
+
+/**
+ * @brief derivative of tanh from its output : dX = dY * (1 - Y * Y)
+ *
+ * @param N number of elements
+ * @param Y float * for activation output
+ * @param dY float * for incoming derivative
+ * @param dX float * for outgoing derivative
+ */
+void __fallback_ele_tanh_prime(const unsigned int N, const float *Y,
+                               const float *dY, float *dX);
+
+/**
+ * @brief relu function : Y = max(X, 0)
+ *
+ * @param N number of elements
+ * @param X float * for Vector X
+ * @param Y float * for Vector Y
+ */
+void __fallback_ele_relu(const unsigned int N, const float *X, float *Y);
+
+/**
+ * @brief derivative of relu from its output : dX = Y > 0 ? dY : 0
+ *
+ * @param N number of elements
+ * @param Y float * for activation output
+ * @param dY float * for incoming derivative
+ * @param dX float * for outgoing derivative
+ */
+void __fallback_ele_relu_prime(const unsigned int N, const float *Y,
+                               const float *dY, float *dX);
+
+/**
+ * @brief leaky relu function : Y = X >= 0 ? X : slope * X
+ *
+ * @param N number of elements
+ * @param X float * for Vector X
+ * @param Y float * for Vector Y
+ * @param slope slope of the negative part
+ */
+void __fallback_ele_leaky_relu(const unsigned int N, const float *X, float *Y,
+                               float slope);
+
+/**
+ * @brief derivative of leaky relu : dX = Y >= 0 ? dY : slope * dY
+ *
+ * @param N number of elements
+ * @param Y float * for activation output
+ * @param dY float * for incoming derivative
+ * @param dX float * for outgoing derivative
+ * @param slope slope of the negative part
+ */
+void __fallback_ele_leaky_relu_prime(const unsigned int N, const float *Y,
+                                     const float *dY, float *dX, float slope);
+
+/**
+ * @brief uniform samples of the Philox4x32-10 counter based generator :
+ * X[i] = min + (max - min) * u_i, where u_i in [0, 1) is made of word i % 4
+ * of block offset + i / 4 of the stream @a seed
+ *
+ * @param N number of elements
+ * @param seed key of the stream
+ * @param offset first block of the stream
+ * @param X float * for Vector X
+ * @param min lower bound
+ * @param max upper bound
+ */
+void __fallback_philox_uniform(const unsigned int N, const uint64_t seed,
+                               const uint64_t offset, float *X, const float min,
+                               const float max);
+
+/**
+ * @brief packed bernoulli samples of the Philox4x32-10 counter based
+ * generator : bit i % 32 of X[i / 32] is set iff u_i < p, with u_i of
+ * philox_uniform. Bits past N in the last word are cleared.
+ *
+ * @param N number of elements
+ * @param seed key of the stream
+ * @param offset first block of the stream
+ * @param p probability of a set bit
+ * @param X uint32_t * for the packed mask of (N + 31) / 32 words
+ */
+void __fallback_philox_bernoulli(const unsigned int N, const uint64_t seed,
+                                 const uint64_t offset, const float p,
+                                 uint32_t *X);
+
 /**
  * @brief     check if X array has NaN or inf
  * @param[in] N  length of the vector
@@ -517,6 +669,44 @@ void __fallback_sgemv(const unsigned int TStorageOrder, bool TransA,
                       const float alpha, const float *A, const unsigned int lda,
                       const float *X, const unsigned int incX, const float beta,
                       float *Y, const unsigned int incY);
+
+/**
+ * @brief     weight-only quantized gemm : C = A * op(dequant(B)) + beta * C in
+ * row-major, where op(X) is one of X or X**T and dequant(B)(k, n) is
+ * op(B)(k, n) * scales[k * scale_inc_k + n * scale_inc_n]. B is dequantized
+ * tile by tile and never as a whole.
+ * @param[in] TransB true if B is stored N x K
+ * @param[in] M number of A's and C's row
+ * @param[in] N number of op(B)'s and C's columns
+ * @param[in] K number of A's columns and op(B)'s rows
+ * @param[in] A float * for Matrix A
+ * @param[in] B int8_t * for Matrix B
+ * @param[in] scales float * for the scale factors of B
+ * @param[in] scale_inc_k scale stride along op(B)'s rows
+ * @param[in] scale_inc_n scale stride along op(B)'s columns
+ * @param[in] beta float number
+ * @param[in] C float * for Matrix C
+ */
+void __fallback_qgemm_int8(bool TransB, const unsigned int M,
+                           const unsigned int N, const unsigned int K,
+                           const float *A, const unsigned int lda,
+                           const int8_t *B, const unsigned int ldb,
+                           const float *scales, const unsigned int scale_inc_k,
+                           const unsigned int scale_inc_n, const float beta,
+                           float *C, const unsigned int ldc);
+
+/**
+ * @brief     __fallback_qgemm_int8() with a 4-bit B
+ * @param[in] B uint8_t * for Matrix B, two values a byte with the even element
+ * in the high nibble
+ */
+void __fallback_qgemm_int4(bool TransB, const unsigned int M,
+                           const unsigned int N, const unsigned int K,
+                           const float *A, const unsigned int lda,
+                           const uint8_t *B, const unsigned int ldb,
+                           const float *scales, const unsigned int scale_inc_k,
+                           const unsigned int scale_inc_n, const float beta,
+                           float *C, const unsigned int ldc);
 /**
  * @brief     isamax function : index of first maxima
  * @param[in] N number of elements in X
@@ -20,6 +20,7 @@
 #include <fallback_internal.h>
 #include <stdexcept>
 #include <tensor_dim.h>
+#include <vector>
 
 #define hgemv_loop(ci, cj, cM, cN)                                             \
   do {                                                                         \
@@ -212,6 +213,82 @@ void __fallback_sgemv(const unsigned int TStorageOrder, bool TransA,
   }
 }
 
+namespace {
+
+/**
+ * @brief per-thread buffers for the single-precision copies of the half
+ * precision operands of the weight-only gemm, which only grow
+ *
+ * @param slot index of the buffer
+ * @param len number of elements required
+ * @return float* buffer of at least @a len elements
+ */
+float *get_qgemm_buffer(unsigned int slot, size_t len) {
+  thread_local std::vector<float> buffers[2];
+  if (buffers[slot].size() < len)
+    buffers[slot].resize(len);
+  return buffers[slot].data();
+}
+
+/**
+ * @brief run a single-precision weight-only gemm on half-precision A and C.
+ * Only the activations are widened, the weights stay quantized.
+ */
+template <typename QGemm>
+void qgemm_fp16(QGemm qgemm, const unsigned int M, const unsigned int N,
+                const unsigned int K, const _FP16 *A, const unsigned int lda,
+                const float beta, _FP16 *C, const unsigned int ldc) {
+  float *a = get_qgemm_buffer(0, (size_t)M * K);
+  float *c = get_qgemm_buffer(1, (size_t)M * N);
+
+  for (unsigned int m = 0; m < M; ++m)
+    for (unsigned int k = 0; k < K; ++k)
+      a[(size_t)m * K + k] = static_cast<float>(A[(size_t)m * lda + k]);
+
+  if (beta != 0.0f)
+    for (unsigned int m = 0; m < M; ++m)
+      for (unsigned int n = 0; n < N; ++n)
+        c[(size_t)m * N + n] = static_cast<float>(C[(size_t)m * ldc + n]);
+
+  qgemm(a, c);
+
+  for (unsigned int m = 0; m < M; ++m)
+    for (unsigned int n = 0; n < N; ++n)
+      C[(size_t)m * ldc + n] = static_cast<_FP16>(c[(size_t)m * N + n]);
+}
+
+} // namespace
+
+void __fallback_qgemm_int8(bool TransB, const unsigned int M,
+                           const unsigned int N, const unsigned int K,
+                           const _FP16 *A, const unsigned int lda,
+                           const int8_t *B, const unsigned int ldb,
+                           const float *scales, const unsigned int scale_inc_k,
+                           const unsigned int scale_inc_n, const float beta,
+                           _FP16 *C, const unsigned int ldc) {
+  qgemm_fp16(
+    [&](const float *a, float *c) {
+      __fallback_qgemm_int8(TransB, M, N, K, a, K, B, ldb, scales, scale_inc_k,
+                            scale_inc_n, beta, c, N);
+    },
+    M, N, K, A, lda, beta, C, ldc);
+}
+
+void __fallback_qgemm_int4(bool TransB, const unsigned int M,
+                           const unsigned int N, const unsigned int K,
+                           const _FP16 *A, const unsigned int lda,
+                           const uint8_t *B, const unsigned int ldb,
+                           const float *scales, const unsigned int scale_inc_k,
+                           const unsigned int scale_inc_n, const float beta,
+                           _FP16 *C, const unsigned int ldc) {
+  qgemm_fp16(
+    [&](const float *a, float *c) {
+      __fallback_qgemm_int4(TransB, M, N, K, a, K, B, ldb, scales, scale_inc_k,
+                            scale_inc_n, beta, c, N);
+    },
+    M, N, K, A, lda, beta, C, ldc);
+}
+
 void __fallback_ele_mul(const unsigned int N, const _FP16 *X, const _FP16 *Y,
                         _FP16 *Z, float alpha, float beta,
                         unsigned int i_stride, unsigned int o_stride) {
@@ -12,15 +12,165 @@
  *
  */
 
+#include <algorithm>
 #include <avx2_impl.h>
 #include <cassert>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <immintrin.h>
 #include <limits>
 
 namespace nntrainer::avx2 {
 
+namespace {
+
+/**
+ * @brief exp(x) for 8 floats, cephes polynomial (relative error ~1e-7)
+ */
+inline __m256 exp_ps(__m256 x) {
+  const __m256 one = _mm256_set1_ps(1.0f);
+
+  x = _mm256_min_ps(x, _mm256_set1_ps(88.3762626647949f));
+  x = _mm256_max_ps(x, _mm256_set1_ps(-88.3762626647949f));
+
+  /** exp(x) = 2^n * exp(g), n = round(x / log(2)) */
+  __m256 fx = _mm256_fmadd_ps(x, _mm256_set1_ps(1.44269504088896341f),
+                              _mm256_set1_ps(0.5f));
+  fx = _mm256_floor_ps(fx);
+
+  x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(0.693359375f), x);
+  x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(-2.12194440e-4f), x);
+
+  __m256 y = _mm256_set1_ps(1.9875691500E-4f);
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.3981999507E-3f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(8.3334519073E-3f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(4.1665795894E-2f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.6666665459E-1f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(5.0000001201E-1f));
+  y = _mm256_fmadd_ps(y, _mm256_mul_ps(x, x), _mm256_add_ps(x, one));
+
+  __m256i n = _mm256_cvttps_epi32(fx);
+  n = _mm256_slli_epi32(_mm256_add_epi32(n, _mm256_set1_epi32(0x7f)), 23);
+  return _mm256_mul_ps(y, _mm256_castsi256_ps(n));
+}
+
+/**
+ * @brief 1 / (1 + exp(-x)) for 8 floats
+ */
+inline __m256 sigmoid_ps(__m256 x) {
+  const __m256 one = _mm256_set1_ps(1.0f);
+  __m256 e = exp_ps(_mm256_xor_ps(x, _mm256_set1_ps(-0.0f)));
+  return _mm256_div_ps(one, _mm256_add_ps(one, e));
+}
+
+/**
+ * @brief sin(x) or cos(x) for 8 floats, cephes polynomial. The range
+ * reduction is accurate for |x| < 8192, larger lanes must be handled apart.
+ *
+ * @param x angle in radian
+ * @param is_cos true to compute cosine
+ */
+inline __m256 sincos_ps(__m256 x, bool is_cos) {
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i two = _mm256_set1_epi32(2);
+  const __m256i four = _mm256_set1_epi32(4);
+
+  __m256 sign_bit = _mm256_and_ps(x, sign_mask);
+  x = _mm256_andnot_ps(sign_mask, x);
+
+  /** j = (int)(x * 4 / pi), rounded up to an even number */
+  __m256i j =
+    _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f)));
+  j = _mm256_andnot_si256(one, _mm256_add_epi32(j, one));
+  __m256 y = _mm256_cvtepi32_ps(j);
+
+  __m256i swap_sign;
+  if (is_cos) {
+    j = _mm256_sub_epi32(j, two);
+    swap_sign = _mm256_slli_epi32(_mm256_andnot_si256(j, four), 29);
+    sign_bit = _mm256_castsi256_ps(swap_sign);
+  } else {
+    swap_sign = _mm256_slli_epi32(_mm256_and_si256(j, four), 29);
+    sign_bit = _mm256_xor_ps(sign_bit, _mm256_castsi256_ps(swap_sign));
+  }
+  __m256 poly_mask = _mm256_castsi256_ps(
+    _mm256_cmpeq_epi32(_mm256_and_si256(j, two), _mm256_setzero_si256()));
+
+  /** extended precision modular arithmetic: x = x - y * pi / 4 */
+  x = _mm256_fmadd_ps(y, _mm256_set1_ps(-0.78515625f), x);
+  x = _mm256_fmadd_ps(y, _mm256_set1_ps(-2.4187564849853515625e-4f), x);
+  x = _mm256_fmadd_ps(y, _mm256_set1_ps(-3.77489497744594108e-8f), x);
+
+  __m256 z = _mm256_mul_ps(x, x);
+
+  __m256 y_cos = _mm256_set1_ps(2.443315711809948E-005f);
+  y_cos = _mm256_fmadd_ps(y_cos, z, _mm256_set1_ps(-1.388731625493765E-003f));
+  y_cos = _mm256_fmadd_ps(y_cos, z, _mm256_set1_ps(4.166664568298827E-002f));
+  y_cos = _mm256_mul_ps(_mm256_mul_ps(y_cos, z), z);
+  y_cos = _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), y_cos);
+  y_cos = _mm256_add_ps(y_cos, _mm256_set1_ps(1.0f));
+
+  __m256 y_sin = _mm256_set1_ps(-1.9515295891E-4f);
+  y_sin = _mm256_fmadd_ps(y_sin, z, _mm256_set1_ps(8.3321608736E-3f));
+  y_sin = _mm256_fmadd_ps(y_sin, z, _mm256_set1_ps(-1.6666654611E-1f));
+  y_sin = _mm256_fmadd_ps(_mm256_mul_ps(y_sin, z), x, x);
+
+  y = _mm256_blendv_ps(y_cos, y_sin, poly_mask);
+  return _mm256_xor_ps(y, sign_bit);
+}
+
+/**
+ * @brief horizontal sum of 8 floats
+ */
+inline float hsum_ps(__m256 v) {
+  __m128 lo = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  lo = _mm_add_ps(lo, _mm_movehl_ps(lo, lo));
+  lo = _mm_add_ss(lo, _mm_movehdup_ps(lo));
+  return _mm_cvtss_f32(lo);
+}
+
+/**
+ * @brief horizontal max of 8 floats
+ */
+inline float hmax_ps(__m256 v) {
+  __m128 lo = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  lo = _mm_max_ps(lo, _mm_movehl_ps(lo, lo));
+  lo = _mm_max_ss(lo, _mm_movehdup_ps(lo));
+  return _mm_cvtss_f32(lo);
+}
+
+/**
+ * @brief shared body of sine and cosine: Y = f(alpha * X)
+ */
+void trigonometric(const unsigned int N, const float *X, float *Y, float alpha,
+                   bool is_cos) {
+  const __m256 alpha_v = _mm256_set1_ps(alpha);
+  const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const __m256 range = _mm256_set1_ps(8192.0f);
+
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 x = _mm256_mul_ps(_mm256_loadu_ps(&X[i]), alpha_v);
+    /** NaN compares as out of range as well */
+    __m256 out_of_range =
+      _mm256_cmp_ps(_mm256_and_ps(x, abs_mask), range, _CMP_NLT_UQ);
+    if (_mm256_movemask_ps(out_of_range)) {
+      for (unsigned int k = i; k < i + 8; ++k)
+        Y[k] = is_cos ? std::cos(alpha * X[k]) : std::sin(alpha * X[k]);
+      continue;
+    }
+    _mm256_storeu_ps(&Y[i], sincos_ps(x, is_cos));
+  }
+  while (i < N) {
+    Y[i] = is_cos ? std::cos(alpha * X[i]) : std::sin(alpha * X[i]);
+    ++i;
+  }
+}
+
+} // namespace
+
 bool is_valid(const unsigned int N, const float *input) {
   assert(N != 0);
   assert(input != NULL);
@@ -118,4 +268,586 @@ void custom_scopy(const unsigned int N, const float *X, const int incX,
   }
 }
 
+void copy_int4_to_fp32(const unsigned int N, const uint8_t *X, float *Y) {
+  const __m256i low_mask = _mm256_set1_epi32(0x0f);
+  unsigned int idx = 0;
+
+  /** len(X) = N, len(Y) = 2 * N. high nibble comes first */
+  for (; N - idx >= 8; idx += 8) {
+    __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)&X[idx]));
+    __m256 high = _mm256_cvtepi32_ps(_mm256_srli_epi32(v, 4));
+    __m256 low = _mm256_cvtepi32_ps(_mm256_and_si256(v, low_mask));
+
+    /** interleave (high, low) pairs back into the element order */
+    __m256 lo = _mm256_unpacklo_ps(high, low);
+    __m256 hi = _mm256_unpackhi_ps(high, low);
+    _mm256_storeu_ps(&Y[2 * idx], _mm256_permute2f128_ps(lo, hi, 0x20));
+    _mm256_storeu_ps(&Y[2 * idx + 8], _mm256_permute2f128_ps(lo, hi, 0x31));
+  }
+  for (; idx < N; ++idx) {
+    Y[2 * idx] = X[idx] >> 4;
+    Y[2 * idx + 1] = X[idx] & 0x0f;
+  }
+}
+
+void copy_int8_to_fp32(const unsigned int N, const uint8_t *X, float *Y) {
+  unsigned int idx = 0;
+  for (; N - idx >= 16; idx += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)&X[idx]);
+    _mm256_storeu_ps(&Y[idx], _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v)));
+    _mm256_storeu_ps(&Y[idx + 8], _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(
+                                    _mm_srli_si128(v, 8))));
+  }
+  for (; idx < N; ++idx)
+    Y[idx] = X[idx];
+}
+
+void copy_int8_to_fp32(const unsigned int N, const int8_t *X, float *Y) {
+  unsigned int idx = 0;
+  for (; N - idx >= 16; idx += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)&X[idx]);
+    _mm256_storeu_ps(&Y[idx], _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(v)));
+    _mm256_storeu_ps(&Y[idx + 8], _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(
+                                    _mm_srli_si128(v, 8))));
+  }
+  for (; idx < N; ++idx)
+    Y[idx] = X[idx];
+}
+
+void copy_s16_fp32(const unsigned int N, const int16_t *X, float *Y) {
+  unsigned int idx = 0;
+  for (; N - idx >= 8; idx += 8) {
+    __m128i v = _mm_loadu_si128((const __m128i *)&X[idx]);
+    _mm256_storeu_ps(&Y[idx], _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(v)));
+  }
+  for (; idx < N; ++idx)
+    Y[idx] = X[idx];
+}
+
+void copy_u16_fp32(const unsigned int N, const uint16_t *X, float *Y) {
+  unsigned int idx = 0;
+  for (; N - idx >= 8; idx += 8) {
+    __m128i v = _mm_loadu_si128((const __m128i *)&X[idx]);
+    _mm256_storeu_ps(&Y[idx], _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(v)));
+  }
+  for (; idx < N; ++idx)
+    Y[idx] = X[idx];
+}
+
+void copy_s8(const unsigned int N, const int8_t *X, int8_t *Y) {
+  std::memcpy(Y, X, N * sizeof(int8_t));
+}
+
+void copy_int8_or_int4(const unsigned int N, const uint8_t *X, uint8_t *Y) {
+  std::memcpy(Y, X, N * sizeof(uint8_t));
+}
+
+void copy_s16(const unsigned int N, const int16_t *X, int16_t *Y) {
+  std::memcpy(Y, X, N * sizeof(int16_t));
+}
+
+void copy_u16(const unsigned int N, const uint16_t *X, uint16_t *Y) {
+  std::memcpy(Y, X, N * sizeof(uint16_t));
+}
+
+void sine(const unsigned int N, float *X, float *Y, float alpha) {
+  trigonometric(N, X, Y, alpha, false);
+}
+
+void cosine(const unsigned int N, float *X, float *Y, float alpha) {
+  trigonometric(N, X, Y, alpha, true);
+}
+
+void inv_sqrt_inplace(const unsigned int N, float *X) {
+  const __m256 one = _mm256_set1_ps(1.0f);
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 x = _mm256_loadu_ps(&X[i]);
+    _mm256_storeu_ps(&X[i], _mm256_div_ps(one, _mm256_sqrt_ps(x)));
+  }
+  while (i < N) {
+    X[i] = 1 / std::sqrt(static_cast<float>(X[i]));
+    ++i;
+  }
+}
+
+void ele_mul(const unsigned int N, const float *X, const float *Y, float *Z,
+             float alpha, float beta) {
+  const __m256 alpha_v = _mm256_set1_ps(alpha);
+  const __m256 beta_v = _mm256_set1_ps(beta);
+  const bool use_beta = std::abs(beta) > __FLT_MIN__;
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 xy = _mm256_mul_ps(_mm256_loadu_ps(&X[i]), _mm256_loadu_ps(&Y[i]));
+    if (alpha != 1.f)
+      xy = _mm256_mul_ps(xy, alpha_v);
+    if (use_beta)
+      xy = _mm256_fmadd_ps(_mm256_loadu_ps(&Z[i]), beta_v, xy);
+    _mm256_storeu_ps(&Z[i], xy);
+  }
+  while (i < N) {
+    if (use_beta)
+      Z[i] = alpha * X[i] * Y[i] + beta * Z[i];
+    else
+      Z[i] = alpha * X[i] * Y[i];
+    ++i;
+  }
+}
+
+void ele_add(const unsigned int N, const float *X, const float *Y, float *Z,
+             float alpha, float beta) {
+  const __m256 alpha_v = _mm256_set1_ps(alpha);
+  const __m256 beta_v = _mm256_set1_ps(beta);
+  const bool use_beta = std::abs(beta) > __FLT_MIN__;
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 xy =
+      _mm256_fmadd_ps(_mm256_loadu_ps(&Y[i]), alpha_v, _mm256_loadu_ps(&X[i]));
+    if (use_beta)
+      xy = _mm256_fmadd_ps(_mm256_loadu_ps(&Z[i]), beta_v, xy);
+    _mm256_storeu_ps(&Z[i], xy);
+  }
+  while (i < N) {
+    if (use_beta)
+      Z[i] = X[i] + alpha * Y[i] + beta * Z[i];
+    else
+      Z[i] = X[i] + alpha * Y[i];
+    ++i;
+  }
+}
+
+void ele_sub(const unsigned N, const float *X, const float *Y, float *Z,
+             float alpha, float beta) {
+  const __m256 alpha_v = _mm256_set1_ps(alpha);
+  const __m256 beta_v = _mm256_set1_ps(beta);
+  const bool use_beta = std::abs(beta) > __FLT_MIN__;
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 xy =
+      _mm256_fnmadd_ps(_mm256_loadu_ps(&Y[i]), alpha_v, _mm256_loadu_ps(&X[i]));
+    if (use_beta)
+      xy = _mm256_fmadd_ps(_mm256_loadu_ps(&Z[i]), beta_v, xy);
+    _mm256_storeu_ps(&Z[i], xy);
+  }
+  while (i < N) {
+    if (use_beta)
+      Z[i] = X[i] - alpha * Y[i] + beta * Z[i];
+    else
+      Z[i] = X[i] - alpha * Y[i];
+    ++i;
+  }
+}
+
+void ele_div(const unsigned N, const float *X, const float *Y, float *Z,
+             float alpha, float beta) {
+  const __m256 alpha_v = _mm256_set1_ps(alpha);
+  const __m256 beta_v = _mm256_set1_ps(beta);
+  const bool use_beta = std::abs(beta) > __FLT_MIN__;
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 y = _mm256_loadu_ps(&Y[i]);
+    if (alpha != 1.f)
+      y = _mm256_mul_ps(y, alpha_v);
+    __m256 xy = _mm256_div_ps(_mm256_loadu_ps(&X[i]), y);
+    if (use_beta)
+      xy = _mm256_fmadd_ps(_mm256_loadu_ps(&Z[i]), beta_v, xy);
+    _mm256_storeu_ps(&Z[i], xy);
+  }
+  while (i < N) {
+    if (use_beta)
+      Z[i] = X[i] / (alpha * Y[i]) + beta * Z[i];
+    else
+      Z[i] = X[i] / (alpha * Y[i]);
+    ++i;
+  }
+}
+
+void transpose_matrix(const unsigned int M, const unsigned int N,
+                      const float *src, unsigned int ld_src, float *dst,
+                      unsigned int ld_dst) {
+  unsigned int M8 = M - M % 8;
+  unsigned int N8 = N - N % 8;
+
+  for (unsigned int i = 0; i < M8; i += 8) {
+    for (unsigned int j = 0; j < N8; j += 8) {
+      const float *s = src + i * ld_src + j;
+      __m256 r0 = _mm256_loadu_ps(s);
+      __m256 r1 = _mm256_loadu_ps(s + ld_src);
+      __m256 r2 = _mm256_loadu_ps(s + 2 * ld_src);
+      __m256 r3 = _mm256_loadu_ps(s + 3 * ld_src);
+      __m256 r4 = _mm256_loadu_ps(s + 4 * ld_src);
+      __m256 r5 = _mm256_loadu_ps(s + 5 * ld_src);
+      __m256 r6 = _mm256_loadu_ps(s + 6 * ld_src);
+      __m256 r7 = _mm256_loadu_ps(s + 7 * ld_src);
+
+      __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+      __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+      __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+      __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+      __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+      __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+      __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+      __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+      r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+      r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+      r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+      r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+      r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+      r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+      r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+      r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+      float *d = dst + j * ld_dst + i;
+      _mm256_storeu_ps(d, _mm256_permute2f128_ps(r0, r4, 0x20));
+      _mm256_storeu_ps(d + ld_dst, _mm256_permute2f128_ps(r1, r5, 0x20));
+      _mm256_storeu_ps(d + 2 * ld_dst, _mm256_permute2f128_ps(r2, r6, 0x20));
+      _mm256_storeu_ps(d + 3 * ld_dst, _mm256_permute2f128_ps(r3, r7, 0x20));
+      _mm256_storeu_ps(d + 4 * ld_dst, _mm256_permute2f128_ps(r0, r4, 0x31));
+      _mm256_storeu_ps(d + 5 * ld_dst, _mm256_permute2f128_ps(r1, r5, 0x31));
+      _mm256_storeu_ps(d + 6 * ld_dst, _mm256_permute2f128_ps(r2, r6, 0x31));
+      _mm256_storeu_ps(d + 7 * ld_dst, _mm256_permute2f128_ps(r3, r7, 0x31));
+    }
+  }
+
+  /** remaining columns of the blocked rows, then the remaining rows */
+  for (unsigned int i = 0; i < M8; ++i)
+    for (unsigned int j = N8; j < N; ++j)
+      dst[i + j * ld_dst] = src[i * ld_src + j];
+  for (unsigned int i = M8; i < M; ++i)
+    for (unsigned int j = 0; j < N; ++j)
+      dst[i + j * ld_dst] = src[i * ld_src + j];
+}
+
+void swiglu(const unsigned int N, float *X, float *Y, float *Z) {
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 y = _mm256_loadu_ps(&Y[i]);
+    __m256 e = exp_ps(_mm256_xor_ps(y, sign_mask));
+    __m256 silu = _mm256_div_ps(y, _mm256_add_ps(one, e));
+    _mm256_storeu_ps(&X[i], _mm256_mul_ps(silu, _mm256_loadu_ps(&Z[i])));
+  }
+  while (i < N) {
+    X[i] = (Y[i] / (1.f + std::exp(-Y[i]))) * Z[i];
+    ++i;
+  }
+}
+
+float max_val(const unsigned int N, float *X) {
+  unsigned int i = 0;
+  float ret = X[0];
+  if (N >= 8) {
+    __m256 max_v = _mm256_loadu_ps(X);
+    for (i = 8; N - i >= 8; i += 8)
+      max_v = _mm256_max_ps(max_v, _mm256_loadu_ps(&X[i]));
+    ret = hmax_ps(max_v);
+  }
+  while (i < N) {
+    ret = std::max(ret, X[i]);
+    ++i;
+  }
+  return ret;
+}
+
+void softmax(const unsigned int N, float *X, float *Y) {
+  const float max_x = max_val(N, X);
+  const __m256 max_v = _mm256_set1_ps(max_x);
+
+  /** Y = exp(X - max) and sum in a single pass */
+  unsigned int i = 0;
+  __m256 sum_v = _mm256_setzero_ps();
+  for (; N - i >= 8; i += 8) {
+    __m256 e = exp_ps(_mm256_sub_ps(_mm256_loadu_ps(&X[i]), max_v));
+    sum_v = _mm256_add_ps(sum_v, e);
+    _mm256_storeu_ps(&Y[i], e);
+  }
+  float sum = hsum_ps(sum_v);
+  while (i < N) {
+    Y[i] = std::exp(X[i] - max_x);
+    sum += Y[i];
+    ++i;
+  }
+
+  const __m256 sum_vec = _mm256_set1_ps(sum);
+  for (i = 0; N - i >= 8; i += 8)
+    _mm256_storeu_ps(&Y[i], _mm256_div_ps(_mm256_loadu_ps(&Y[i]), sum_vec));
+  while (i < N) {
+    Y[i] /= sum;
+    ++i;
+  }
+}
+
+
+void ele_sigmoid(const unsigned int N, const float *X, float *Y) {
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8)
+    _mm256_storeu_ps(&Y[i], sigmoid_ps(_mm256_loadu_ps(&X[i])));
+  while (i < N) {
+    Y[i] = 1.0f / (1.0f + std::exp(-X[i]));
+    ++i;
+  }
+}
+
+void ele_sigmoid_prime(const unsigned int N, const float *Y, const float *dY,
+                       float *dX) {
+  const __m256 one = _mm256_set1_ps(1.0f);
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 y = _mm256_loadu_ps(&Y[i]);
+    __m256 d = _mm256_mul_ps(y, _mm256_sub_ps(one, y));
+    _mm256_storeu_ps(&dX[i], _mm256_mul_ps(d, _mm256_loadu_ps(&dY[i])));
+  }
+  while (i < N) {
+    dX[i] = dY[i] * Y[i] * (1.0f - Y[i]);
+    ++i;
+  }
+}
+
+void ele_tanh(const unsigned int N, const float *X, float *Y) {
+  /**
+   * tanh(x) = 2 * sigmoid(2x) - 1 cancels near 0, so |x| < 0.625 takes the
+   * odd cephes polynomial x + x^3 * P(x^2) instead
+   */
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 two = _mm256_set1_ps(2.0f);
+  const __m256 small = _mm256_set1_ps(0.625f);
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 x = _mm256_loadu_ps(&X[i]);
+    __m256 s = sigmoid_ps(_mm256_mul_ps(two, x));
+    __m256 large = _mm256_fmsub_ps(two, s, one);
+
+    __m256 z = _mm256_mul_ps(x, x);
+    __m256 p = _mm256_set1_ps(-5.70498872745e-3f);
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(2.06390887954e-2f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-5.37397155531e-2f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(1.33314422036e-1f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-3.33332819422e-1f));
+    __m256 poly = _mm256_fmadd_ps(_mm256_mul_ps(p, z), x, x);
+
+    __m256 is_small =
+      _mm256_cmp_ps(_mm256_andnot_ps(sign_mask, x), small, _CMP_LT_OQ);
+    _mm256_storeu_ps(&Y[i], _mm256_blendv_ps(large, poly, is_small));
+  }
+  while (i < N) {
+    Y[i] = std::tanh(X[i]);
+    ++i;
+  }
+}
+
+void ele_tanh_prime(const unsigned int N, const float *Y, const float *dY,
+                    float *dX) {
+  const __m256 one = _mm256_set1_ps(1.0f);
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 y = _mm256_loadu_ps(&Y[i]);
+    __m256 d = _mm256_fnmadd_ps(y, y, one);
+    _mm256_storeu_ps(&dX[i], _mm256_mul_ps(d, _mm256_loadu_ps(&dY[i])));
+  }
+  while (i < N) {
+    dX[i] = dY[i] * (1.0f - Y[i] * Y[i]);
+    ++i;
+  }
+}
+
+void ele_relu(const unsigned int N, const float *X, float *Y) {
+  const __m256 zero = _mm256_setzero_ps();
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 x = _mm256_loadu_ps(&X[i]);
+    _mm256_storeu_ps(&Y[i],
+                     _mm256_and_ps(x, _mm256_cmp_ps(x, zero, _CMP_GT_OQ)));
+  }
+  while (i < N) {
+    Y[i] = X[i] > 0.0f ? X[i] : 0.0f;
+    ++i;
+  }
+}
+
+void ele_relu_prime(const unsigned int N, const float *Y, const float *dY,
+                    float *dX) {
+  const __m256 zero = _mm256_setzero_ps();
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 mask = _mm256_cmp_ps(_mm256_loadu_ps(&Y[i]), zero, _CMP_GT_OQ);
+    _mm256_storeu_ps(&dX[i], _mm256_and_ps(_mm256_loadu_ps(&dY[i]), mask));
+  }
+  while (i < N) {
+    dX[i] = Y[i] > 0.0f ? dY[i] : 0.0f;
+    ++i;
+  }
+}
+
+void ele_leaky_relu(const unsigned int N, const float *X, float *Y,
+                    float slope) {
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 slope_v = _mm256_set1_ps(slope);
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 x = _mm256_loadu_ps(&X[i]);
+    __m256 neg = _mm256_cmp_ps(x, zero, _CMP_LT_OQ);
+    _mm256_storeu_ps(&Y[i],
+                     _mm256_blendv_ps(x, _mm256_mul_ps(x, slope_v), neg));
+  }
+  while (i < N) {
+    Y[i] = X[i] >= 0.0f ? X[i] : slope * X[i];
+    ++i;
+  }
+}
+
+void ele_leaky_relu_prime(const unsigned int N, const float *Y, const float *dY,
+                          float *dX, float slope) {
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 slope_v = _mm256_set1_ps(slope);
+  unsigned int i = 0;
+  for (; N - i >= 8; i += 8) {
+    __m256 d = _mm256_loadu_ps(&dY[i]);
+    __m256 neg = _mm256_cmp_ps(_mm256_loadu_ps(&Y[i]), zero, _CMP_LT_OQ);
+    _mm256_storeu_ps(&dX[i],
+                     _mm256_blendv_ps(d, _mm256_mul_ps(d, slope_v), neg));
+  }
+  while (i < N) {
+    dX[i] = Y[i] >= 0.0f ? dY[i] : slope * dY[i];
+    ++i;
+  }
+}
+
+namespace {
+
+constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+constexpr unsigned int PHILOX_ROUNDS = 10;
+
+/**
+ * @brief high 32 bits of the eight 32x32 bit products
+ */
+inline __m256i mulhi_epu32(const __m256i a, const __m256i b) {
+  const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+  const __m256i odd =
+    _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+  return _mm256_blend_epi32(even, odd, 0xAA);
+}
+
+/**
+ * @brief blocks @a counter to @a counter + 7 of the Philox4x32-10 stream
+ * @a seed in element order, out[j] holds the 32 bit words of two blocks
+ */
+inline void philox4x32x8(const uint64_t seed, const uint64_t counter,
+                         __m256i *out) {
+  alignas(32) uint32_t lo[8];
+  alignas(32) uint32_t hi[8];
+  for (unsigned int j = 0; j < 8; ++j) {
+    lo[j] = static_cast<uint32_t>(counter + j);
+    hi[j] = static_cast<uint32_t>((counter + j) >> 32);
+  }
+
+  __m256i c0 = _mm256_load_si256(reinterpret_cast<const __m256i *>(lo));
+  __m256i c1 = _mm256_load_si256(reinterpret_cast<const __m256i *>(hi));
+  __m256i c2 = _mm256_setzero_si256();
+  __m256i c3 = _mm256_setzero_si256();
+  const __m256i m0 = _mm256_set1_epi32(static_cast<int>(PHILOX_M0));
+  const __m256i m1 = _mm256_set1_epi32(static_cast<int>(PHILOX_M1));
+  uint32_t k0 = static_cast<uint32_t>(seed);
+  uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+
+  for (unsigned int r = 0; r < PHILOX_ROUNDS; ++r) {
+    const __m256i hi0 = mulhi_epu32(c0, m0);
+    const __m256i lo0 = _mm256_mullo_epi32(c0, m0);
+    const __m256i hi1 = mulhi_epu32(c2, m1);
+    const __m256i lo1 = _mm256_mullo_epi32(c2, m1);
+    c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1),
+                          _mm256_set1_epi32(static_cast<int>(k0)));
+    c1 = lo1;
+    c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3),
+                          _mm256_set1_epi32(static_cast<int>(k1)));
+    c3 = lo0;
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+
+  /** lanes hold one block each, transpose them to element order */
+  const __m256i a = _mm256_unpacklo_epi32(c0, c1);
+  const __m256i b = _mm256_unpackhi_epi32(c0, c1);
+  const __m256i c = _mm256_unpacklo_epi32(c2, c3);
+  const __m256i d = _mm256_unpackhi_epi32(c2, c3);
+  const __m256i e0 = _mm256_unpacklo_epi64(a, c);
+  const __m256i e1 = _mm256_unpackhi_epi64(a, c);
+  const __m256i e2 = _mm256_unpacklo_epi64(b, d);
+  const __m256i e3 = _mm256_unpackhi_epi64(b, d);
+  out[0] = _mm256_permute2x128_si256(e0, e1, 0x20);
+  out[1] = _mm256_permute2x128_si256(e2, e3, 0x20);
+  out[2] = _mm256_permute2x128_si256(e0, e1, 0x31);
+  out[3] = _mm256_permute2x128_si256(e2, e3, 0x31);
+}
+
+/**
+ * @brief 32 uniform samples in [min, min + range) from block @a counter on
+ */
+inline void philoxUniform32(const uint64_t seed, const uint64_t counter,
+                            const __m256 min, const __m256 range, float *X) {
+  const __m256 scale = _mm256_set1_ps(0x1p-24f);
+  __m256i words[4];
+  philox4x32x8(seed, counter, words);
+  for (unsigned int j = 0; j < 4; ++j) {
+    const __m256 u = _mm256_mul_ps(
+      _mm256_cvtepi32_ps(_mm256_srli_epi32(words[j], 8)), scale);
+    /// no fma : keep the rounding of min + range * u in the fallback
+    _mm256_storeu_ps(X + j * 8, _mm256_add_ps(min, _mm256_mul_ps(range, u)));
+  }
+}
+
+/**
+ * @brief 32 packed bernoulli samples from block @a counter on
+ */
+inline uint32_t philoxBernoulli32(const uint64_t seed, const uint64_t counter,
+                                  const __m256i threshold) {
+  __m256i words[4];
+  uint32_t bits = 0;
+  philox4x32x8(seed, counter, words);
+  for (unsigned int j = 0; j < 4; ++j) {
+    const __m256i set =
+      _mm256_cmpgt_epi32(threshold, _mm256_srli_epi32(words[j], 8));
+    bits |= static_cast<uint32_t>(
+              _mm256_movemask_ps(_mm256_castsi256_ps(set)))
+            << (j * 8);
+  }
+  return bits;
+}
+
+} // namespace
+
+void philox_uniform(const unsigned int N, const uint64_t seed,
+                    const uint64_t offset, float *X, const float min,
+                    const float max) {
+  const __m256 min_v = _mm256_set1_ps(min);
+  const __m256 range = _mm256_set1_ps(max - min);
+  unsigned int i = 0;
+  for (; N - i >= 32; i += 32)
+    philoxUniform32(seed, offset + i / 4, min_v, range, X + i);
+
+  if (i < N) {
+    float tail[32];
+    philoxUniform32(seed, offset + i / 4, min_v, range, tail);
+    std::copy(tail, tail + (N - i), X + i);
+  }
+}
+
+void philox_bernoulli(const unsigned int N, const uint64_t seed,
+                      const uint64_t offset, const float p, uint32_t *X) {
+  const __m256i threshold = _mm256_set1_epi32(static_cast<int>(
+    std::ceil(std::min(std::max(p, 0.0f), 1.0f) * 16777216.0f)));
+  unsigned int i = 0;
+  for (; N - i >= 32; i += 32)
+    X[i / 32] = philoxBernoulli32(seed, offset + i / 4, threshold);
+
+  if (i < N)
+    X[i / 32] = philoxBernoulli32(seed, offset + i / 4, threshold) &
+                ((1u << (N - i)) - 1);
+}
+
 } // namespace nntrainer::avx2
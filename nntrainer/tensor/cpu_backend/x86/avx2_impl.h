@@ -15,6 +15,8 @@
 #define __AVX2_IMPL_H_
 #ifdef __cplusplus
 
+#include <cstdint>
+
 namespace nntrainer::avx2 {
 
 #ifdef ENABLE_FP16
@@ -46,6 +48,49 @@ void vcvt_f32_f16(unsigned int N, const float *input, _Float16 *output);
  * @param[out] false if it has NaN or inf
  */
 bool is_valid(const unsigned int N, const _Float16 *X);
+
+/**
+ * @brief     row-major half-precision gemm : C = alpha*op(A)*op(B) + beta*C.
+ * Operands stay in half-precision, panels are packed into a per-thread
+ * scratch arena and converted with F16C inside the micro-kernel.
+ * @param[in] TransA bool transpose info of A
+ * @param[in] TransB bool transpose info of B
+ * @param[in] M number of op(A)'s and C's row
+ * @param[in] N number of op(B)'s and C's columns
+ * @param[in] K number of op(A)'s columns and op(B)'s rows
+ * @param[in] alpha float number
+ * @param[in] A half-precision * for Matrix A
+ * @param[in] lda leading dimension of A
+ * @param[in] B half-precision * for Matrix B
+ * @param[in] ldb leading dimension of B
+ * @param[in] beta float number
+ * @param[in] C half-precision * for Matrix C
+ * @param[in] ldc leading dimension of C
+ */
+void hgemm(bool TransA, bool TransB, const unsigned int M,
+           const unsigned int N, const unsigned int K, const float alpha,
+           const _Float16 *A, const unsigned int lda, const _Float16 *B,
+           const unsigned int ldb, const float beta, _Float16 *C,
+           const unsigned int ldc);
+
+/**
+ * @brief     row-major half-precision gemv : Y = alpha*op(A)*X + beta*Y
+ * @param[in] TransA bool transpose info of A
+ * @param[in] M number of A's row
+ * @param[in] N number of A's columns
+ * @param[in] alpha float number
+ * @param[in] A half-precision * for Matrix A
+ * @param[in] lda leading dimension of A
+ * @param[in] X half-precision * for Vector X
+ * @param[in] incX increment of X
+ * @param[in] beta float number
+ * @param[in] Y half-precision * for Vector Y
+ * @param[in] incY increment of Y
+ */
+void hgemv(bool TransA, const unsigned int M, const unsigned int N,
+           const float alpha, const _Float16 *A, const unsigned int lda,
+           const _Float16 *X, const unsigned int incX, const float beta,
+           _Float16 *Y, const unsigned int incY);
 #endif
 
 /**
@@ -67,6 +112,308 @@ bool is_valid(const unsigned int N, const float *X);
 void custom_scopy(const unsigned int N, const float *X, const int incX,
                   float *Y, const int incY);
 
+/**
+ * @brief     copy function with avx2: Y = X
+ * @param[in] N number of elements in X
+ * @param[in] X uint8_t * for Vector X, each holds two int4 values
+ * @param[in] Y float * for Vector Y, length of 2 * N
+ */
+void copy_int4_to_fp32(const unsigned int N, const uint8_t *X, float *Y);
+
+/**
+ * @brief     copy function with avx2: Y = X
+ * @param[in] N number of elements in X
+ * @param[in] X uint8_t * for Vector X
+ * @param[in] Y float * for Vector Y
+ */
+void copy_int8_to_fp32(const unsigned int N, const uint8_t *X, float *Y);
+
+/**
+ * @brief     copy function with avx2: Y = X
+ * @param[in] N number of elements in X
+ * @param[in] X int8_t * for Vector X
+ * @param[in] Y float * for Vector Y
+ */
+void copy_int8_to_fp32(const unsigned int N, const int8_t *X, float *Y);
+
+/**
+ * @brief     copy function with avx2: Y = X
+ * @param[in] N number of elements in X
+ * @param[in] X int16_t * for Vector X
+ * @param[in] Y float * for Vector Y
+ */
+void copy_s16_fp32(const unsigned int N, const int16_t *X, float *Y);
+
+/**
+ * @brief     copy function with avx2: Y = X
+ * @param[in] N number of elements in X
+ * @param[in] X uint16_t * for Vector X
+ * @param[in] Y float * for Vector Y
+ */
+void copy_u16_fp32(const unsigned int N, const uint16_t *X, float *Y);
+
+/**
+ * @brief     copy function : Y = X
+ * @param[in] N number of elements in X
+ * @param[in] X int8_t * for Vector X
+ * @param[in] Y int8_t * for Vector Y
+ */
+void copy_s8(const unsigned int N, const int8_t *X, int8_t *Y);
+
+/**
+ * @brief     copy function : Y = X
+ * @param[in] N number of elements in X
+ * @param[in] X uint8_t * for Vector X
+ * @param[in] Y uint8_t * for Vector Y
+ */
+void copy_int8_or_int4(const unsigned int N, const uint8_t *X, uint8_t *Y);
+
+/**
+ * @brief     copy function : Y = X
+ * @param[in] N number of elements in X
+ * @param[in] X int16_t * for Vector X
+ * @param[in] Y int16_t * for Vector Y
+ */
+void copy_s16(const unsigned int N, const int16_t *X, int16_t *Y);
+
+/**
+ * @brief     copy function : Y = X
+ * @param[in] N number of elements in X
+ * @param[in] X uint16_t * for Vector X
+ * @param[in] Y uint16_t * for Vector Y
+ */
+void copy_u16(const unsigned int N, const uint16_t *X, uint16_t *Y);
+
+/**
+ * @brief     sine with avx2: Y = sin(alpha * X)
+ * @param[in] N number of elements in X
+ * @param[in] X float * for Vector X
+ * @param[in] Y float * for Vector Y
+ * @param[in] alpha float * for scaling angle (radian)
+ */
+void sine(const unsigned int N, float *X, float *Y, float alpha = 1.f);
+
+/**
+ * @brief     cosine with avx2: Y = cos(alpha * X)
+ * @param[in] N number of elements in X
+ * @param[in] X float * for Vector X
+ * @param[in] Y float * for Vector Y
+ * @param[in] alpha float * for scaling angle (radian)
+ */
+void cosine(const unsigned int N, float *X, float *Y, float alpha = 1.f);
+
+/**
+ * @brief inversed squared root transformation with avx2 : X = 1 / sqrt(X)
+ *
+ * @param N number of elements in X
+ * @param X float * for Vector X
+ */
+void inv_sqrt_inplace(const unsigned int N, float *X);
+
+/**
+ * @brief     elementwise vector multiplication : Z = X ⊙ alpha * Y + beta * Z
+ * @param[in] N  length of the vector
+ * @param[in] X float * for Vector X
+ * @param[in] Y float * for Vector Y
+ * @param[in] Z float * for Vector Z
+ * @param[in] alpha scalar multiplier for input
+ * @param[in] beta scalar multiplier for output
+ */
+void ele_mul(const unsigned int N, const float *X, const float *Y, float *Z,
+             float alpha = 1.f, float beta = 0.f);
+
+/**
+ * @brief     elementwise vector addition : Z = X + alpha * Y + beta * Z
+ * @param[in] N  length of the vector
+ * @param[in] X float * for Vector X
+ * @param[in] Y float * for Vector Y
+ * @param[in] Z float * for Vector Z
+ * @param[in] alpha scalar multiplier for input
+ * @param[in] beta scalar multiplier for output
+ */
+void ele_add(const unsigned int N, const float *X, const float *Y, float *Z,
+             float alpha = 1.f, float beta = 0.f);
+
+/**
+ * @brief     elementwise vector subtraction : Z = X - alpha * Y + beta * Z
+ * @param[in] N  length of the vector
+ * @param[in] X float * for Vector X
+ * @param[in] Y float * for Vector Y
+ * @param[in] Z float * for Vector Z
+ * @param[in] alpha scalar multiplier for input
+ * @param[in] beta scalar multiplier for output
+ */
+void ele_sub(const unsigned N, const float *X, const float *Y, float *Z,
+             float alpha = 1.f, float beta = 0.f);
+
+/**
+ * @brief     elementwise vector division : Z = X / (alpha * Y) + beta * Z
+ * @note ZeroDivisionError is not guaranteed in this function
+ * @param[in] N  length of the vector
+ * @param[in] X float * for Vector X
+ * @param[in] Y float * for Vector Y
+ * @param[in] Z float * for Vector Z
+ * @param[in] alpha scalar multiplier for input
+ * @param[in] beta scalar multiplier for output
+ */
+void ele_div(const unsigned N, const float *X, const float *Y, float *Z,
+             float alpha = 1.f, float beta = 0.f);
+
+/**
+ * @brief Matrix transpose / 2D Tensor transpose with 8x8 avx2 blocks
+ *
+ * @param M row length of input matrix
+ * @param N col length of input matrix
+ * @param src src data of input matrix
+ * @param ld_src data offset of input matrix
+ * @param dst destination of output matrix
+ * @param ld_dst data offset of output matrix
+ */
+void transpose_matrix(const unsigned int M, const unsigned int N,
+                      const float *src, unsigned int ld_src, float *dst,
+                      unsigned int ld_dst);
+
+/**
+ * @brief swiglu function with avx2 : X = (Y / (1 + exp( -Y ))) * Z
+ *
+ * @param N number of elements in X
+ * @param X float * for Vector X
+ * @param Y float * for Vector Y
+ * @param Z float * for Vector Z
+ */
+void swiglu(const unsigned int N, float *X, float *Y, float *Z);
+
+/**
+ * @brief returns maximum value of the vector X
+ *
+ * @param N number of elements in X
+ * @param X float * for Vector X
+ * @return float maximum value of vector X
+ */
+float max_val(const unsigned int N, float *X);
+
+/**
+ * @brief soft max function with avx2 y_i = exp(x_i) / sum( exp(x_i) )
+ *
+ * @param N number of elements in X
+ * @param X float * for Vector X
+ * @param Y  float * for Vector Y
+ */
+void softmax(const unsigned int N, float *X, float *Y);
+
+/**
+ * @brief sigmoid function with avx2 : Y = 1 / (1 + exp(-X))
+ *
+ * @param N number of elements
+ * @param X float * for Vector X
+ * @param Y float * for Vector Y
+ */
+void ele_sigmoid(const unsigned int N, const float *X, float *Y);
+
+/**
+ * @brief derivative of sigmoid with avx2 : dX = dY * Y * (1 - Y)
+ *
+ * @param N number of elements
+ * @param Y float * for activation output
+ * @param dY float * for incoming derivative
+ * @param dX float * for outgoing derivative
+ */
+void ele_sigmoid_prime(const unsigned int N, const float *Y, const float *dY,
+                       float *dX);
+
+/**
+ * @brief tanh function with avx2 : Y = tanh(X)
+ *
+ * @param N number of elements
+ * @param X float * for Vector X
+ * @param Y float * for Vector Y
+ */
+void ele_tanh(const unsigned int N, const float *X, float *Y);
+
+/**
+ * @brief derivative of tanh with avx2 : dX = dY * (1 - Y * Y)
+ *
+ * @param N number of elements
+ * @param Y float * for activation output
+ * @param dY float * for incoming derivative
+ * @param dX float * for outgoing derivative
+ */
+void ele_tanh_prime(const unsigned int N, const float *Y, const float *dY,
+                    float *dX);
+
+/**
+ * @brief relu function with avx2 : Y = max(X, 0)
+ *
+ * @param N number of elements
+ * @param X float * for Vector X
+ * @param Y float * for Vector Y
+ */
+void ele_relu(const unsigned int N, const float *X, float *Y);
+
+/**
+ * @brief derivative of relu with avx2 : dX = Y > 0 ? dY : 0
+ *
+ * @param N number of elements
+ * @param Y float * for activation output
+ * @param dY float * for incoming derivative
+ * @param dX float * for outgoing derivative
+ */
+void ele_relu_prime(const unsigned int N, const float *Y, const float *dY,
+                    float *dX);
+
+/**
+ * @brief leaky relu function with avx2 : Y = X >= 0 ? X : slope * X
+ *
+ * @param N number of elements
+ * @param X float * for Vector X
+ * @param Y float * for Vector Y
+ * @param slope slope of the negative part
+ */
+void ele_leaky_relu(const unsigned int N, const float *X, float *Y,
+                    float slope);
+
+/**
+ * @brief derivative of leaky relu with avx2 : dX = Y >= 0 ? dY : slope * dY
+ *
+ * @param N number of elements
+ * @param Y float * for activation output
+ * @param dY float * for incoming derivative
+ * @param dX float * for outgoing derivative
+ * @param slope slope of the negative part
+ */
+void ele_leaky_relu_prime(const unsigned int N, const float *Y, const float *dY,
+                          float *dX, float slope);
+
+/**
+ * @brief uniform samples of the Philox4x32-10 counter based generator with
+ * avx2 : X[i] = min + (max - min) * u_i, where u_i in [0, 1) is made of word
+ * i % 4 of block offset + i / 4 of the stream @a seed
+ *
+ * @param N number of elements
+ * @param seed key of the stream
+ * @param offset first block of the stream
+ * @param X float * for Vector X
+ * @param min lower bound
+ * @param max upper bound
+ */
+void philox_uniform(const unsigned int N, const uint64_t seed,
+                    const uint64_t offset, float *X, const float min,
+                    const float max);
+
+/**
+ * @brief packed bernoulli samples of the Philox4x32-10 counter based
+ * generator with avx2 : bit i % 32 of X[i / 32] is set iff u_i < p, with u_i of
+ * philox_uniform. Bits past N in the last word are cleared.
+ *
+ * @param N number of elements
+ * @param seed key of the stream
+ * @param offset first block of the stream
+ * @param p probability of a set bit
+ * @param X uint32_t * for the packed mask of (N + 31) / 32 words
+ */
+void philox_bernoulli(const unsigned int N, const uint64_t seed,
+                      const uint64_t offset, const float p, uint32_t *X);
+
 } // namespace nntrainer::avx2
 
 #endif /* __cplusplus */
@@ -12,11 +12,17 @@
  *
  */
 
+#include <algorithm>
 #include <avx2_impl.h>
 #include <cassert>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <immintrin.h>
+#include <limits>
+#include <vector>
+
+#include <nntr_thread_pool.h>
 
 namespace nntrainer::avx2 {
 
@@ -194,4 +200,305 @@ bool is_valid(const unsigned int N, const _Float16 *input) {
 
   return true;
 }
+namespace {
+
+/** micro-kernel rows */
+constexpr unsigned int HGEMM_MR = 6;
+/** micro-kernel columns, two ymm registers */
+constexpr unsigned int HGEMM_NR = 16;
+/** rows of A packed at once, multiple of HGEMM_MR */
+constexpr unsigned int HGEMM_MC = 72;
+/** depth of a packed block of A */
+constexpr unsigned int HGEMM_KC = 256;
+/** columns of B packed at once, multiple of HGEMM_NR */
+constexpr unsigned int HGEMM_NC = 512;
+
+/**
+ * @brief per-thread scratch arena. Buffers only grow, so repeated calls of the
+ * same shape never touch the heap.
+ *
+ * @param slot index of the buffer
+ * @param len number of elements required
+ * @return float* buffer of at least @a len elements
+ */
+float *get_scratch(unsigned int slot, size_t len) {
+  thread_local std::vector<float> arena[2];
+  if (arena[slot].size() < len)
+    arena[slot].resize(len);
+  return arena[slot].data();
+}
+
+/**
+ * @brief per-thread scratch arena for half-precision panels
+ *
+ * @param len number of elements required
+ * @return _Float16* buffer of at least @a len elements
+ */
+_Float16 *get_half_scratch(size_t len) {
+  thread_local std::vector<_Float16> arena;
+  if (arena.size() < len)
+    arena.resize(len);
+  return arena.data();
+}
+
+/**
+ * @brief pack columns [jc, jc + nc) of op(B) into HGEMM_NR wide panels. The
+ * panels stay in half-precision and are converted inside the micro-kernel.
+ * Each panel holds all K rows, zero padded to HGEMM_NR columns.
+ */
+void pack_b_fp16(bool TransB, unsigned int K, unsigned int nc,
+                 const _Float16 *B, unsigned int ldb, unsigned int jc,
+                 _Float16 *Bp) {
+  for (unsigned int j0 = 0; j0 < nc; j0 += HGEMM_NR) {
+    unsigned int nr = std::min(HGEMM_NR, nc - j0);
+    _Float16 *panel = Bp + (size_t)j0 * K;
+
+    if (!TransB) {
+      for (unsigned int k = 0; k < K; ++k) {
+        const _Float16 *src = B + (size_t)k * ldb + jc + j0;
+        _Float16 *dst = panel + (size_t)k * HGEMM_NR;
+        std::memcpy(dst, src, nr * sizeof(_Float16));
+        for (unsigned int j = nr; j < HGEMM_NR; ++j)
+          dst[j] = 0;
+      }
+    } else {
+      for (unsigned int j = 0; j < HGEMM_NR; ++j) {
+        if (j < nr) {
+          const _Float16 *src = B + (size_t)(jc + j0 + j) * ldb;
+          for (unsigned int k = 0; k < K; ++k)
+            panel[(size_t)k * HGEMM_NR + j] = src[k];
+        } else {
+          for (unsigned int k = 0; k < K; ++k)
+            panel[(size_t)k * HGEMM_NR + j] = 0;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief pack op(A)[ic : ic + mc, pc : pc + kc] into HGEMM_MR high panels of
+ * single-precision values, zero padded to HGEMM_MR rows
+ */
+void pack_a_fp16(bool TransA, unsigned int mc, unsigned int kc,
+                 const _Float16 *A, unsigned int lda, unsigned int ic,
+                 unsigned int pc, float *Ap) {
+  for (unsigned int i0 = 0; i0 < mc; i0 += HGEMM_MR) {
+    unsigned int mr = std::min(HGEMM_MR, mc - i0);
+    float *panel = Ap + (size_t)i0 * kc;
+
+    for (unsigned int i = 0; i < HGEMM_MR; ++i) {
+      if (i >= mr) {
+        for (unsigned int k = 0; k < kc; ++k)
+          panel[(size_t)k * HGEMM_MR + i] = 0.0f;
+      } else if (!TransA) {
+        const _Float16 *src = A + (size_t)(ic + i0 + i) * lda + pc;
+        for (unsigned int k = 0; k < kc; ++k)
+          panel[(size_t)k * HGEMM_MR + i] = static_cast<float>(src[k]);
+      } else {
+        const _Float16 *src = A + (size_t)pc * lda + ic + i0 + i;
+        for (unsigned int k = 0; k < kc; ++k)
+          panel[(size_t)k * HGEMM_MR + i] =
+            static_cast<float>(src[(size_t)k * lda]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief 6x16 micro-kernel, acc[6][16] += Ap * Bp. B panel is converted from
+ * half-precision with F16C while it is streamed.
+ */
+inline void hgemm_kernel_6x16(unsigned int kc, const float *Ap,
+                              const _Float16 *Bp, float *acc,
+                              unsigned int ldacc) {
+  __m256 c[HGEMM_MR][2];
+  for (unsigned int r = 0; r < HGEMM_MR; ++r) {
+    c[r][0] = _mm256_loadu_ps(acc + r * ldacc);
+    c[r][1] = _mm256_loadu_ps(acc + r * ldacc + 8);
+  }
+
+  for (unsigned int k = 0; k < kc; ++k) {
+    const __m256 b0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)Bp));
+    const __m256 b1 =
+      _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(Bp + 8)));
+    Bp += HGEMM_NR;
+
+    for (unsigned int r = 0; r < HGEMM_MR; ++r) {
+      const __m256 a = _mm256_broadcast_ss(Ap + r);
+      c[r][0] = _mm256_fmadd_ps(a, b0, c[r][0]);
+      c[r][1] = _mm256_fmadd_ps(a, b1, c[r][1]);
+    }
+    Ap += HGEMM_MR;
+  }
+
+  for (unsigned int r = 0; r < HGEMM_MR; ++r) {
+    _mm256_storeu_ps(acc + r * ldacc, c[r][0]);
+    _mm256_storeu_ps(acc + r * ldacc + 8, c[r][1]);
+  }
+}
+
+/**
+ * @brief C = alpha * acc + beta * C for a row of N values. C is not read when
+ * beta is zero.
+ */
+void store_row_fp16(unsigned int N, float alpha, const float *acc, float beta,
+                    _Float16 *C) {
+  const __m256 alpha_v = _mm256_set1_ps(alpha);
+  const __m256 beta_v = _mm256_set1_ps(beta);
+  unsigned int j = 0;
+
+  for (; j + 8 <= N; j += 8) {
+    __m256 v = _mm256_mul_ps(_mm256_loadu_ps(acc + j), alpha_v);
+    if (beta != 0.0f) {
+      __m256 c = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(C + j)));
+      v = _mm256_fmadd_ps(c, beta_v, v);
+    }
+    _mm_storeu_si128((__m128i *)(C + j),
+                     _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+  }
+
+  for (; j < N; ++j) {
+    float v = alpha * acc[j];
+    if (beta != 0.0f)
+      v += beta * static_cast<float>(C[j]);
+    C[j] = static_cast<_Float16>(v);
+  }
+}
+
+} // namespace
+
+void hgemm(bool TransA, bool TransB, const unsigned int M,
+           const unsigned int N, const unsigned int K, const float alpha,
+           const _Float16 *A, const unsigned int lda, const _Float16 *B,
+           const unsigned int ldb, const float beta, _Float16 *C,
+           const unsigned int ldc) {
+  if (M == 0 || N == 0)
+    return;
+
+  if (K == 0 || alpha == 0.0f) {
+    for (unsigned int i = 0; i < M; ++i) {
+      _Float16 *row = C + (size_t)i * ldc;
+      for (unsigned int j = 0; j < N; ++j)
+        row[j] = beta == 0.0f ? static_cast<_Float16>(0.0f)
+                              : static_cast<_Float16>(
+                                  beta * static_cast<float>(row[j]));
+    }
+    return;
+  }
+
+  const unsigned int num_mblocks = (M + HGEMM_MC - 1) / HGEMM_MC;
+
+  for (unsigned int jc = 0; jc < N; jc += HGEMM_NC) {
+    const unsigned int nc = std::min(HGEMM_NC, N - jc);
+    const unsigned int ldacc = (nc + HGEMM_NR - 1) / HGEMM_NR * HGEMM_NR;
+
+    /** B panel is shared by every block of rows */
+    _Float16 *Bp = get_half_scratch((size_t)ldacc * K);
+    pack_b_fp16(TransB, K, nc, B, ldb, jc, Bp);
+
+    auto run = [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int mb = start; mb < end; ++mb) {
+        const unsigned int ic = mb * HGEMM_MC;
+        const unsigned int mc = std::min(HGEMM_MC, M - ic);
+        const unsigned int mc_pad = (mc + HGEMM_MR - 1) / HGEMM_MR * HGEMM_MR;
+
+        float *acc = get_scratch(0, (size_t)mc_pad * ldacc);
+        float *Ap = get_scratch(1, (size_t)mc_pad * HGEMM_KC);
+        std::fill(acc, acc + (size_t)mc_pad * ldacc, 0.0f);
+
+        for (unsigned int pc = 0; pc < K; pc += HGEMM_KC) {
+          const unsigned int kc = std::min(HGEMM_KC, K - pc);
+          pack_a_fp16(TransA, mc, kc, A, lda, ic, pc, Ap);
+
+          for (unsigned int i0 = 0; i0 < mc_pad; i0 += HGEMM_MR)
+            for (unsigned int j0 = 0; j0 < ldacc; j0 += HGEMM_NR)
+              hgemm_kernel_6x16(kc, Ap + (size_t)i0 * kc,
+                                Bp + (size_t)j0 * K + (size_t)pc * HGEMM_NR,
+                                acc + (size_t)i0 * ldacc + j0, ldacc);
+        }
+
+        for (unsigned int i = 0; i < mc; ++i)
+          store_row_fp16(nc, alpha, acc + (size_t)i * ldacc, beta,
+                         C + (size_t)(ic + i) * ldc + jc);
+      }
+    };
+
+    if (num_mblocks > 1)
+      ThreadPool::Global().parallelFor(0, num_mblocks, 1, run);
+    else
+      run(0, 1, 0);
+  }
+}
+
+void hgemv(bool TransA, const unsigned int M, const unsigned int N,
+           const float alpha, const _Float16 *A, const unsigned int lda,
+           const _Float16 *X, const unsigned int incX, const float beta,
+           _Float16 *Y, const unsigned int incY) {
+  const unsigned int lenX = TransA ? M : N;
+  const unsigned int lenY = TransA ? N : M;
+  if (lenY == 0)
+    return;
+
+  float *x = get_scratch(0, lenX);
+  for (unsigned int i = 0; i < lenX; ++i)
+    x[i] = static_cast<float>(X[(size_t)i * incX]);
+
+  if (!TransA) {
+    for (unsigned int i = 0; i < M; ++i) {
+      const _Float16 *row = A + (size_t)i * lda;
+      __m256 sum0 = _mm256_setzero_ps();
+      __m256 sum1 = _mm256_setzero_ps();
+      unsigned int j = 0;
+      for (; j + 16 <= N; j += 16) {
+        __m256 a0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(row + j)));
+        __m256 a1 =
+          _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(row + j + 8)));
+        sum0 = _mm256_fmadd_ps(a0, _mm256_loadu_ps(x + j), sum0);
+        sum1 = _mm256_fmadd_ps(a1, _mm256_loadu_ps(x + j + 8), sum1);
+      }
+      for (; j + 8 <= N; j += 8) {
+        __m256 a0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(row + j)));
+        sum0 = _mm256_fmadd_ps(a0, _mm256_loadu_ps(x + j), sum0);
+      }
+      sum0 = _mm256_add_ps(sum0, sum1);
+      __m128 s = _mm_add_ps(_mm256_castps256_ps128(sum0),
+                            _mm256_extractf128_ps(sum0, 1));
+      s = _mm_hadd_ps(s, s);
+      s = _mm_hadd_ps(s, s);
+      float dot = _mm_cvtss_f32(s);
+      for (; j < N; ++j)
+        dot += static_cast<float>(row[j]) * x[j];
+
+      _Float16 &y = Y[(size_t)i * incY];
+      float v = alpha * dot;
+      if (beta != 0.0f)
+        v += beta * static_cast<float>(y);
+      y = static_cast<_Float16>(v);
+    }
+    return;
+  }
+
+  float *y = get_scratch(1, N);
+  std::fill(y, y + N, 0.0f);
+  for (unsigned int i = 0; i < M; ++i) {
+    const _Float16 *row = A + (size_t)i * lda;
+    const __m256 xi = _mm256_set1_ps(x[i]);
+    unsigned int j = 0;
+    for (; j + 8 <= N; j += 8) {
+      __m256 a = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(row + j)));
+      _mm256_storeu_ps(y + j, _mm256_fmadd_ps(a, xi, _mm256_loadu_ps(y + j)));
+    }
+    for (; j < N; ++j)
+      y[j] += static_cast<float>(row[j]) * x[i];
+  }
+
+  for (unsigned int j = 0; j < N; ++j) {
+    _Float16 &out = Y[(size_t)j * incY];
+    float v = alpha * y[j];
+    if (beta != 0.0f)
+      v += beta * static_cast<float>(out);
+    out = static_cast<_Float16>(v);
+  }
+}
 } // namespace nntrainer::avx
@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   avx512_impl.cpp
+ * @date   17 Oct 2026
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ * @brief  This is a source for AVX-512 implementation
+ *
+ */
+
+#include <algorithm>
+#include <avx512_impl.h>
+#include <cmath>
+#include <cstdint>
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AVX512_TARGET __attribute__((target("avx512f")))
+#else
+#define AVX512_TARGET
+#endif
+
+namespace nntrainer::avx512 {
+
+namespace {
+
+/**
+ * @brief mask of the first @a n lanes, n <= 16
+ */
+inline __mmask16 tail_mask(unsigned int n) {
+  return static_cast<__mmask16>((1u << n) - 1u);
+}
+
+/**
+ * @brief exp(x) for 16 floats, cephes polynomial (relative error ~1e-7)
+ */
+AVX512_TARGET inline __m512 exp_ps(__m512 x) {
+  x = _mm512_min_ps(x, _mm512_set1_ps(88.3762626647949f));
+  x = _mm512_max_ps(x, _mm512_set1_ps(-88.3762626647949f));
+
+  __m512 fx = _mm512_fmadd_ps(x, _mm512_set1_ps(1.44269504088896341f),
+                              _mm512_set1_ps(0.5f));
+  fx = _mm512_roundscale_ps(fx, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+  x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(0.693359375f), x);
+  x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(-2.12194440e-4f), x);
+
+  __m512 y = _mm512_set1_ps(1.9875691500E-4f);
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.3981999507E-3f));
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(8.3334519073E-3f));
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(4.1665795894E-2f));
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.6666665459E-1f));
+  y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(5.0000001201E-1f));
+  y = _mm512_fmadd_ps(y, _mm512_mul_ps(x, x),
+                      _mm512_add_ps(x, _mm512_set1_ps(1.0f)));
+
+  __m512i n = _mm512_cvttps_epi32(fx);
+  n = _mm512_slli_epi32(_mm512_add_epi32(n, _mm512_set1_epi32(0x7f)), 23);
+  return _mm512_mul_ps(y, _mm512_castsi512_ps(n));
+}
+
+/**
+ * @brief shared body of the elementwise binary operations
+ *
+ * @param op binary operation on (X, Y) vectors including alpha
+ */
+template <typename Op>
+AVX512_TARGET inline void ele_binary(const unsigned int N, const float *X,
+                                     const float *Y, float *Z, float beta,
+                                     Op op) {
+  const __m512 beta_v = _mm512_set1_ps(beta);
+  const bool use_beta = std::abs(beta) > __FLT_MIN__;
+  unsigned int i = 0;
+  for (; i < N; i += 16) {
+    __mmask16 m = N - i >= 16 ? 0xffff : tail_mask(N - i);
+    __m512 xy =
+      op(_mm512_maskz_loadu_ps(m, &X[i]), _mm512_maskz_loadu_ps(m, &Y[i]));
+    if (use_beta)
+      xy = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &Z[i]), beta_v, xy);
+    _mm512_mask_storeu_ps(&Z[i], m, xy);
+  }
+}
+
+} // namespace
+
+bool has_avx512() {
+#if defined(__GNUC__) || defined(__clang__)
+  static const bool supported = __builtin_cpu_supports("avx512f");
+  return supported;
+#else
+  return false;
+#endif
+}
+
+AVX512_TARGET void ele_mul(const unsigned int N, const float *X,
+                           const float *Y, float *Z, float alpha, float beta) {
+  const __m512 alpha_v = _mm512_set1_ps(alpha);
+  ele_binary(N, X, Y, Z, beta, [alpha_v](__m512 x, __m512 y) AVX512_TARGET {
+    return _mm512_mul_ps(_mm512_mul_ps(x, y), alpha_v);
+  });
+}
+
+AVX512_TARGET void ele_add(const unsigned int N, const float *X,
+                           const float *Y, float *Z, float alpha, float beta) {
+  const __m512 alpha_v = _mm512_set1_ps(alpha);
+  ele_binary(N, X, Y, Z, beta, [alpha_v](__m512 x, __m512 y) AVX512_TARGET {
+    return _mm512_fmadd_ps(y, alpha_v, x);
+  });
+}
+
+AVX512_TARGET void ele_sub(const unsigned N, const float *X, const float *Y,
+                           float *Z, float alpha, float beta) {
+  const __m512 alpha_v = _mm512_set1_ps(alpha);
+  ele_binary(N, X, Y, Z, beta, [alpha_v](__m512 x, __m512 y) AVX512_TARGET {
+    return _mm512_fnmadd_ps(y, alpha_v, x);
+  });
+}
+
+AVX512_TARGET void ele_div(const unsigned N, const float *X, const float *Y,
+                           float *Z, float alpha, float beta) {
+  const __m512 alpha_v = _mm512_set1_ps(alpha);
+  ele_binary(N, X, Y, Z, beta, [alpha_v](__m512 x, __m512 y) AVX512_TARGET {
+    return _mm512_div_ps(x, _mm512_mul_ps(y, alpha_v));
+  });
+}
+
+AVX512_TARGET void inv_sqrt_inplace(const unsigned int N, float *X) {
+  const __m512 one = _mm512_set1_ps(1.0f);
+  for (unsigned int i = 0; i < N; i += 16) {
+    __mmask16 m = N - i >= 16 ? 0xffff : tail_mask(N - i);
+    __m512 x = _mm512_mask_loadu_ps(one, m, &X[i]);
+    _mm512_mask_storeu_ps(&X[i], m, _mm512_div_ps(one, _mm512_sqrt_ps(x)));
+  }
+}
+
+AVX512_TARGET void swiglu(const unsigned int N, float *X, float *Y, float *Z) {
+  const __m512 one = _mm512_set1_ps(1.0f);
+  const __m512 zero = _mm512_setzero_ps();
+  for (unsigned int i = 0; i < N; i += 16) {
+    __mmask16 m = N - i >= 16 ? 0xffff : tail_mask(N - i);
+    __m512 y = _mm512_maskz_loadu_ps(m, &Y[i]);
+    __m512 e = exp_ps(_mm512_sub_ps(zero, y));
+    __m512 silu = _mm512_div_ps(y, _mm512_add_ps(one, e));
+    _mm512_mask_storeu_ps(
+      &X[i], m, _mm512_mul_ps(silu, _mm512_maskz_loadu_ps(m, &Z[i])));
+  }
+}
+
+AVX512_TARGET float max_val(const unsigned int N, float *X) {
+  __m512 max_v = _mm512_set1_ps(X[0]);
+  for (unsigned int i = 0; i < N; i += 16) {
+    __mmask16 m = N - i >= 16 ? 0xffff : tail_mask(N - i);
+    max_v = _mm512_max_ps(max_v, _mm512_mask_loadu_ps(max_v, m, &X[i]));
+  }
+
+  /// not _mm512_reduce_max_ps, its gcc 12 expansion fails -Wuninitialized
+  alignas(64) float lanes[16];
+  _mm512_store_ps(lanes, max_v);
+  float ret = lanes[0];
+  for (unsigned int i = 1; i < 16; ++i)
+    ret = std::max(ret, lanes[i]);
+  return ret;
+}
+
+AVX512_TARGET void softmax(const unsigned int N, float *X, float *Y) {
+  const __m512 max_v = _mm512_set1_ps(max_val(N, X));
+
+  /** Y = exp(X - max) and sum in a single pass */
+  __m512 sum_v = _mm512_setzero_ps();
+  for (unsigned int i = 0; i < N; i += 16) {
+    __mmask16 m = N - i >= 16 ? 0xffff : tail_mask(N - i);
+    __m512 x = _mm512_mask_loadu_ps(max_v, m, &X[i]);
+    __m512 e = exp_ps(_mm512_sub_ps(x, max_v));
+    sum_v = _mm512_mask_add_ps(sum_v, m, sum_v, e);
+    _mm512_mask_storeu_ps(&Y[i], m, e);
+  }
+
+  const __m512 sum_vec = _mm512_set1_ps(_mm512_reduce_add_ps(sum_v));
+  for (unsigned int i = 0; i < N; i += 16) {
+    __mmask16 m = N - i >= 16 ? 0xffff : tail_mask(N - i);
+    __m512 y = _mm512_maskz_loadu_ps(m, &Y[i]);
+    _mm512_mask_storeu_ps(&Y[i], m, _mm512_div_ps(y, sum_vec));
+  }
+}
+
+} // namespace nntrainer::avx512
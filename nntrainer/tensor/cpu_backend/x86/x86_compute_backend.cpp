@@ -14,8 +14,12 @@
 #include <assert.h>
 
 #include <avx2_impl.h>
+#include <avx512_impl.h>
+#ifdef USE_BLAS
 #include <cblas_interface.h>
+#endif
 #include <fallback_internal.h>
+#include <nntr_thread_pool.h>
 #include <nntrainer_error.h>
 #include <x86_compute_backend.h>
 
@@ -27,99 +31,164 @@ namespace nntrainer {
 void scopy_int4_to_float32(const unsigned int N, const uint8_t *X,
                            const unsigned int incX, float *Y,
                            const unsigned int incY) {
-  __fallback_scopy_int4_to_float32(N, X, incX, Y, incY);
+  if (incX == 1 && incY == 1) {
+    nntrainer::avx2::copy_int4_to_fp32(N, X, Y);
+  } else {
+    __fallback_scopy_int4_to_float32(N, X, incX, Y, incY);
+  }
 }
 
 void copy_s16(const unsigned int N, const int16_t *X, int16_t *Y) {
-  __fallback_copy_s16(N, X, Y);
+  nntrainer::avx2::copy_s16(N, X, Y);
 }
 
 void copy_u16(const unsigned int N, const uint16_t *X, uint16_t *Y) {
-  __fallback_copy_u16(N, X, Y);
+  nntrainer::avx2::copy_u16(N, X, Y);
 }
 
 void copy_s16_fp32(const unsigned int N, const int16_t *X, float *Y) {
-  __fallback_copy_s16_fp32(N, X, Y);
+  nntrainer::avx2::copy_s16_fp32(N, X, Y);
 }
 
 void copy_u16_fp32(const unsigned int N, const uint16_t *X, float *Y) {
-  __fallback_copy_u16_fp32(N, X, Y);
+  nntrainer::avx2::copy_u16_fp32(N, X, Y);
 }
 
 void scopy_int8_to_float32(const unsigned int N, const uint8_t *X,
                            const unsigned int incX, float *Y,
                            const unsigned int incY) {
-  __fallback_scopy_uint8_to_float32(N, X, incX, Y, incY);
+  if (incX == 1 && incY == 1) {
+    nntrainer::avx2::copy_int8_to_fp32(N, X, Y);
+  } else {
+    __fallback_scopy_uint8_to_float32(N, X, incX, Y, incY);
+  }
 }
 
 void scopy_int8_to_float32(const unsigned int N, const int8_t *X,
                            const unsigned int incX, float *Y,
                            const unsigned int incY) {
-  __fallback_scopy_int8_to_float32(N, X, incX, Y, incY);
+  if (incX == 1 && incY == 1) {
+    nntrainer::avx2::copy_int8_to_fp32(N, X, Y);
+  } else {
+    __fallback_scopy_int8_to_float32(N, X, incX, Y, incY);
+  }
 }
 
 void sine(const unsigned int N, float *X, float *Y, float alpha) {
-  __fallback_sine(N, X, Y, alpha);
+  nntrainer::avx2::sine(N, X, Y, alpha);
 }
 
 void cosine(const unsigned int N, float *X, float *Y, float alpha) {
-  __fallback_cosine(N, X, Y, alpha);
+  nntrainer::avx2::cosine(N, X, Y, alpha);
 }
 
 void inv_sqrt_inplace(const unsigned int N, float *X) {
-  __fallback_inv_sqrt_inplace(N, X);
+  if (nntrainer::avx512::has_avx512()) {
+    nntrainer::avx512::inv_sqrt_inplace(N, X);
+  } else {
+    nntrainer::avx2::inv_sqrt_inplace(N, X);
+  }
 }
 
 void ele_mul(const unsigned int N, const float *X, const float *Y, float *Z,
              float alpha, float beta, unsigned int i_stride,
              unsigned int o_stride) {
-  __fallback_ele_mul(N, X, Y, Z, alpha, beta, i_stride, o_stride);
+  if (i_stride == 1 && o_stride == 1) {
+    if (nntrainer::avx512::has_avx512())
+      nntrainer::avx512::ele_mul(N, X, Y, Z, alpha, beta);
+    else
+      nntrainer::avx2::ele_mul(N, X, Y, Z, alpha, beta);
+  } else {
+    __fallback_ele_mul(N, X, Y, Z, alpha, beta, i_stride, o_stride);
+  }
 }
 
 void ele_add(const unsigned int N, const float *X, const float *Y, float *Z,
              float alpha, float beta, unsigned int i_stride,
              unsigned int o_stride) {
-  __fallback_ele_add(N, X, Y, Z, alpha, beta, i_stride, o_stride);
+  if (i_stride == 1 && o_stride == 1) {
+    if (nntrainer::avx512::has_avx512())
+      nntrainer::avx512::ele_add(N, X, Y, Z, alpha, beta);
+    else
+      nntrainer::avx2::ele_add(N, X, Y, Z, alpha, beta);
+  } else {
+    __fallback_ele_add(N, X, Y, Z, alpha, beta, i_stride, o_stride);
+  }
 }
 
 void ele_sub(const unsigned N, const float *X, const float *Y, float *Z,
              float alpha, float beta, unsigned int i_stride,
              unsigned int o_stride) {
-  __fallback_ele_sub(N, X, Y, Z, alpha, beta, i_stride, o_stride);
+  if (i_stride == 1 && o_stride == 1) {
+    if (nntrainer::avx512::has_avx512())
+      nntrainer::avx512::ele_sub(N, X, Y, Z, alpha, beta);
+    else
+      nntrainer::avx2::ele_sub(N, X, Y, Z, alpha, beta);
+  } else {
+    __fallback_ele_sub(N, X, Y, Z, alpha, beta, i_stride, o_stride);
+  }
 }
 
 void ele_div(const unsigned N, const float *X, const float *Y, float *Z,
              float alpha, float beta, unsigned int i_stride,
              unsigned int o_stride) {
-  __fallback_ele_div(N, X, Y, Z, alpha, beta, i_stride, o_stride);
+  if (i_stride == 1 && o_stride == 1) {
+    if (nntrainer::avx512::has_avx512())
+      nntrainer::avx512::ele_div(N, X, Y, Z, alpha, beta);
+    else
+      nntrainer::avx2::ele_div(N, X, Y, Z, alpha, beta);
+  } else {
+    __fallback_ele_div(N, X, Y, Z, alpha, beta, i_stride, o_stride);
+  }
 }
 
 void saxpy(const unsigned int N, const float alpha, const float *X,
            const unsigned int incX, float *Y, const unsigned int incY) {
+#ifdef USE_BLAS
   __cblas_saxpy(N, alpha, X, incX, Y, incY);
+#else
+  __fallback_saxpy(N, alpha, X, incX, Y, incY);
+#endif
 }
 
 void sgemv(const unsigned int TStorageOrder, bool TransA, const unsigned int M,
            const unsigned int N, const float alpha, const float *A,
            const unsigned int lda, const float *X, const unsigned int incX,
            const float beta, float *Y, const unsigned int incY) {
+#ifdef USE_BLAS
   __cblas_sgemv(TStorageOrder, TransA, M, N, alpha, A, lda, X, incX, beta, Y,
                 incY);
+#else
+  __fallback_sgemv(TStorageOrder, TransA, M, N, alpha, A, lda, X, incX, beta,
+                   Y, incY);
+#endif
 }
 
 float sdot(const unsigned int N, const float *X, const unsigned int incX,
            const float *Y, const unsigned int incY) {
+#ifdef USE_BLAS
   return __cblas_sdot(N, X, incX, Y, incY);
+#else
+  return __fallback_sdot(N, X, incX, Y, incY);
+#endif
 }
 
 void scopy(const unsigned int N, const uint8_t *X, const unsigned int incX,
            uint8_t *Y, const unsigned int incY) {
-  __fallback_scopy(N, X, incX, Y, incY);
+  if (incX == 1 && incY == 1) {
+    nntrainer::avx2::copy_int8_or_int4(N, X, Y);
+  } else {
+    __fallback_scopy(N, X, incX, Y, incY);
+  }
 }
 
 void scopy(const unsigned int N, const int8_t *X, const unsigned int incX,
            int8_t *Y, const unsigned int incY) {
-  __fallback_scopy(N, X, incX, Y, incY);
+  if (incX == 1 && incY == 1) {
+    nntrainer::avx2::copy_s8(N, X, Y);
+  } else {
+    __fallback_scopy(N, X, incX, Y, incY);
+  }
 }
 
 void scopy(const unsigned int N, const float *X, const unsigned int incX,
@@ -132,11 +201,19 @@ void scopy(const unsigned int N, const float *X, const unsigned int incX,
 
 void sscal(const unsigned int N, const float alpha, float *X,
            const unsigned int incX) {
+#ifdef USE_BLAS
   __cblas_sscal(N, alpha, X, incX);
+#else
+  __fallback_sscal(N, alpha, X, incX);
+#endif
 }
 
 float snrm2(const unsigned int N, const float *X, const unsigned int incX) {
+#ifdef USE_BLAS
   return __cblas_snrm2(N, X, incX);
+#else
+  return __fallback_snrm2(N, X, incX);
+#endif
 }
 
 void sgemm(const unsigned int TStorageOrder, bool TransA, bool TransB,
@@ -144,19 +221,65 @@ void sgemm(const unsigned int TStorageOrder, bool TransA, bool TransB,
            const float alpha, const float *A, const unsigned int lda,
            const float *B, const unsigned int ldb, const float beta, float *C,
            const unsigned int ldc) {
+#ifdef USE_BLAS
   __cblas_sgemm(TStorageOrder, TransA, TransB, M, N, K, alpha, A, lda, B, ldb,
                 beta, C, ldc);
+#else
+  __fallback_sgemm(TStorageOrder, TransA, TransB, M, N, K, alpha, A, lda, B,
+                   ldb, beta, C, ldc);
+#endif
+}
+
+void sgemm_batched(const unsigned int TStorageOrder, bool TransA, bool TransB,
+                   const unsigned int M, const unsigned int N,
+                   const unsigned int K, const float alpha, const float *A,
+                   const unsigned int lda, const size_t strideA, const float *B,
+                   const unsigned int ldb, const size_t strideB,
+                   const float beta, float *C, const unsigned int ldc,
+                   const size_t strideC, const unsigned int batch) {
+  ThreadPool::Global().parallelFor(
+    0, batch, 1, [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b)
+        sgemm(TStorageOrder, TransA, TransB, M, N, K, alpha, A + b * strideA,
+              lda, B + b * strideB, ldb, beta, C + b * strideC, ldc);
+    });
+}
+
+void qgemm_int8(bool TransB, const unsigned int M, const unsigned int N,
+                const unsigned int K, const float *A,
+                const unsigned int lda, const int8_t *B,
+                const unsigned int ldb, const float *scales,
+                const unsigned int scale_inc_k,
+                const unsigned int scale_inc_n, const float beta,
+                float *C, const unsigned int ldc) {
+  __fallback_qgemm_int8(TransB, M, N, K, A, lda, B, ldb, scales,
+                         scale_inc_k, scale_inc_n, beta, C, ldc);
+}
+
+void qgemm_int4(bool TransB, const unsigned int M, const unsigned int N,
+                const unsigned int K, const float *A,
+                const unsigned int lda, const uint8_t *B,
+                const unsigned int ldb, const float *scales,
+                const unsigned int scale_inc_k,
+                const unsigned int scale_inc_n, const float beta,
+                float *C, const unsigned int ldc) {
+  __fallback_qgemm_int4(TransB, M, N, K, A, lda, B, ldb, scales,
+                         scale_inc_k, scale_inc_n, beta, C, ldc);
 }
 
 unsigned int isamax(const unsigned int N, const float *X,
                     const unsigned int incX) {
+#ifdef USE_BLAS
   return __cblas_isamax(N, X, incX);
+#else
+  return __fallback_isamax(N, X, incX);
+#endif
 }
 
 void transpose_matrix(const unsigned int M, const unsigned int N,
                       const float *src, unsigned int ld_src, float *dst,
                       unsigned int ld_dst) {
-  __fallback_transpose_matrix(M, N, src, ld_src, dst, ld_dst);
+  nntrainer::avx2::transpose_matrix(M, N, src, ld_src, dst, ld_dst);
 }
 
 bool is_valid(const unsigned int N, const float *input) {
@@ -169,13 +292,73 @@ void calc_trigonometric_vals_dup(unsigned int N_half, float *angle, float *cos_,
 }
 
 void swiglu(const unsigned int N, float *X, float *Y, float *Z) {
-  __fallback_swiglu(N, X, Y, Z);
+  if (nntrainer::avx512::has_avx512()) {
+    nntrainer::avx512::swiglu(N, X, Y, Z);
+  } else {
+    nntrainer::avx2::swiglu(N, X, Y, Z);
+  }
 }
 
-float max_val(const unsigned int N, float *X) { return __fallback_max(N, X); }
+float max_val(const unsigned int N, float *X) {
+  if (nntrainer::avx512::has_avx512())
+    return nntrainer::avx512::max_val(N, X);
+  return nntrainer::avx2::max_val(N, X);
+}
 
 void softmax(const unsigned int N, float *X, float *Y) {
-  __fallback_softmax(N, X, Y);
+  if (nntrainer::avx512::has_avx512()) {
+    nntrainer::avx512::softmax(N, X, Y);
+  } else {
+    nntrainer::avx2::softmax(N, X, Y);
+  }
+}
+
+void ele_sigmoid(const unsigned int N, const float *X, float *Y) {
+  nntrainer::avx2::ele_sigmoid(N, X, Y);
+}
+
+void ele_sigmoid_prime(const unsigned int N, const float *Y, const float *dY,
+                       float *dX) {
+  nntrainer::avx2::ele_sigmoid_prime(N, Y, dY, dX);
+}
+
+void ele_tanh(const unsigned int N, const float *X, float *Y) {
+  nntrainer::avx2::ele_tanh(N, X, Y);
+}
+
+void ele_tanh_prime(const unsigned int N, const float *Y, const float *dY,
+                    float *dX) {
+  nntrainer::avx2::ele_tanh_prime(N, Y, dY, dX);
+}
+
+void ele_relu(const unsigned int N, const float *X, float *Y) {
+  nntrainer::avx2::ele_relu(N, X, Y);
+}
+
+void ele_relu_prime(const unsigned int N, const float *Y, const float *dY,
+                    float *dX) {
+  nntrainer::avx2::ele_relu_prime(N, Y, dY, dX);
+}
+
+void ele_leaky_relu(const unsigned int N, const float *X, float *Y,
+                    float slope) {
+  nntrainer::avx2::ele_leaky_relu(N, X, Y, slope);
+}
+
+void ele_leaky_relu_prime(const unsigned int N, const float *Y, const float *dY,
+                          float *dX, float slope) {
+  nntrainer::avx2::ele_leaky_relu_prime(N, Y, dY, dX, slope);
+}
+
+void philox_uniform(const unsigned int N, const uint64_t seed,
+                    const uint64_t offset, float *X, const float min,
+                    const float max) {
+  nntrainer::avx2::philox_uniform(N, seed, offset, X, min, max);
+}
+
+void philox_bernoulli(const unsigned int N, const uint64_t seed,
+                      const uint64_t offset, const float p, uint32_t *X) {
+  nntrainer::avx2::philox_bernoulli(N, seed, offset, p, X);
 }
 
 } /* namespace nntrainer */
@@ -15,6 +15,7 @@
 #include <avx2_impl.h>
 #include <cblas_interface.h>
 #include <fallback_internal.h>
+#include <nntr_thread_pool.h>
 #include <nntrainer_error.h>
 #include <tensor_dim.h>
 #include <x86_compute_backend.h>
@@ -98,46 +99,65 @@ void sgemm(const unsigned int TStorageOrder, bool TransA, bool TransB,
            const float alpha, const _FP16 *A, const unsigned int lda,
            const _FP16 *B, const unsigned int ldb, const float beta, _FP16 *C,
            const unsigned int ldc) {
-  float *A_ = new float[M * K];
-  float *B_ = new float[N * K];
-  float *C_ = new float[M * N];
-
-  scopy(M * K, A, 1, A_, 1);
-  scopy(N * K, B, 1, B_, 1);
-  scopy(M * N, C, 1, C_, 1);
-
-  __cblas_sgemm(TStorageOrder, TransA, TransB, M, N, K, alpha, A_, lda, B_, ldb,
-                beta, C_, ldc);
-  scopy(M * N, C_, 1, C, 1);
+  if (TStorageOrder == COL_MAJOR) {
+    /** C^T = op(B)^T * op(A)^T in row-major */
+    nntrainer::avx2::hgemm(TransB, TransA, N, M, K, alpha, B, ldb, A, lda,
+                           beta, C, ldc);
+  } else {
+    nntrainer::avx2::hgemm(TransA, TransB, M, N, K, alpha, A, lda, B, ldb,
+                           beta, C, ldc);
+  }
+}
 
-  delete[] A_;
-  delete[] B_;
-  delete[] C_;
+void sgemm_batched(const unsigned int TStorageOrder, bool TransA, bool TransB,
+                   const unsigned int M, const unsigned int N,
+                   const unsigned int K, const float alpha, const _FP16 *A,
+                   const unsigned int lda, const size_t strideA, const _FP16 *B,
+                   const unsigned int ldb, const size_t strideB,
+                   const float beta, _FP16 *C, const unsigned int ldc,
+                   const size_t strideC, const unsigned int batch) {
+  ThreadPool::Global().parallelFor(
+    0, batch, 1, [&](unsigned int start, unsigned int end, unsigned int) {
+      for (unsigned int b = start; b < end; ++b)
+        sgemm(TStorageOrder, TransA, TransB, M, N, K, alpha, A + b * strideA,
+              lda, B + b * strideB, ldb, beta, C + b * strideC, ldc);
+    });
+}
+
+void qgemm_int8(bool TransB, const unsigned int M, const unsigned int N,
+                const unsigned int K, const _FP16 *A,
+                const unsigned int lda, const int8_t *B,
+                const unsigned int ldb, const float *scales,
+                const unsigned int scale_inc_k,
+                const unsigned int scale_inc_n, const float beta,
+                _FP16 *C, const unsigned int ldc) {
+  __fallback_qgemm_int8(TransB, M, N, K, A, lda, B, ldb, scales,
+                         scale_inc_k, scale_inc_n, beta, C, ldc);
+}
+
+void qgemm_int4(bool TransB, const unsigned int M, const unsigned int N,
+                const unsigned int K, const _FP16 *A,
+                const unsigned int lda, const uint8_t *B,
+                const unsigned int ldb, const float *scales,
+                const unsigned int scale_inc_k,
+                const unsigned int scale_inc_n, const float beta,
+                _FP16 *C, const unsigned int ldc) {
+  __fallback_qgemm_int4(TransB, M, N, K, A, lda, B, ldb, scales,
+                         scale_inc_k, scale_inc_n, beta, C, ldc);
 }
 
 void sgemv(const unsigned int TStorageOrder, bool TransA, const unsigned int M,
            const unsigned int N, const float alpha, const _FP16 *A,
            const unsigned int lda, const _FP16 *X, const unsigned int incX,
            const float beta, _FP16 *Y, const unsigned int incY) {
-  unsigned int lenX = (TransA) ? 1 + (M - 1) * (incX) : 1 + (N - 1) * (incX);
-  unsigned int lenY = (TransA) ? 1 + (N - 1) * (incY) : 1 + (M - 1) * (incY);
-
-  float *A_ = new float[M * N];
-  float *X_ = new float[lenX];
-  float *Y_ = new float[lenY];
-
-  scopy(M * N, A, 1, A_, 1);
-  scopy(lenX, X, 1, X_, 1);
-  scopy(lenY, Y, 1, Y_, 1);
-
-  __cblas_sgemv(TStorageOrder, TransA, M, N, alpha, A_, lda, X_, incX, beta, Y_,
-                incY);
-
-  scopy(lenY, Y_, 1, Y, 1);
-
-  delete[] A_;
-  delete[] X_;
-  delete[] Y_;
+  if (TStorageOrder == COL_MAJOR) {
+    /** column-major A is a row-major N x M matrix */
+    nntrainer::avx2::hgemv(!TransA, N, M, alpha, A, lda, X, incX, beta, Y,
+                           incY);
+  } else {
+    nntrainer::avx2::hgemv(TransA, M, N, alpha, A, lda, X, incX, beta, Y,
+                           incY);
+  }
 }
 
 void ele_mul(const unsigned int N, const _FP16 *X, const _FP16 *Y, _FP16 *Z,
@@ -15,6 +15,7 @@
 
 #include <cpu_backend.h>
 #include <float_tensor.h>
+#include <random_stream.h>
 #include <tensor.h>
 #include <util_func.h>
 
@@ -160,18 +161,21 @@ void FloatTensor::setZero() {
 }
 
 void FloatTensor::setRandNormal(float mean, float stddev) {
-  setDist<std::normal_distribution<float>>(
-    std::normal_distribution<float>(mean, stddev));
+  NNTR_THROW_IF(!contiguous, std::invalid_argument)
+    << getName() << " Tensor is not contiguous, cannot set distribution";
+  RandomStream::Global().normal(size(), (float *)getData(), mean, stddev);
 }
 
 void FloatTensor::setRandUniform(float min, float max) {
-  setDist<std::uniform_real_distribution<float>>(
-    std::uniform_real_distribution<float>(min, max));
+  NNTR_THROW_IF(!contiguous, std::invalid_argument)
+    << getName() << " Tensor is not contiguous, cannot set distribution";
+  RandomStream::Global().uniform(size(), (float *)getData(), min, max);
 }
 
 void FloatTensor::setRandBernoulli(float probability) {
-  setDist<std::bernoulli_distribution>(
-    std::bernoulli_distribution(probability));
+  NNTR_THROW_IF(!contiguous, std::invalid_argument)
+    << getName() << " Tensor is not contiguous, cannot set distribution";
+  RandomStream::Global().bernoulli(size(), (float *)getData(), probability);
 }
 
 void FloatTensor::initialize() {
@@ -689,8 +693,29 @@ Tensor &FloatTensor::dot(Tensor const &input, Tensor &output, bool trans,
                       K, lda, ldb, ldc);
 
   const float *data = (float *)getData();
-  const float *mdata = input.getData<float>();
   float *rdata = output.getData<float>();
+
+  /// weight-only quantized input is dequantized tile by tile in the kernel
+  if (input.getDataType() == Tdatatype::QINT8 ||
+      input.getDataType() == Tdatatype::QINT4) {
+    NNTR_THROW_IF(trans, std::invalid_argument)
+      << "Error: quantized dot product does not support trans";
+
+    unsigned int scale_inc_k, scale_inc_n;
+    calculateQuantizedDot(input, trans_in, scale_inc_k, scale_inc_n);
+
+    if (input.getDataType() == Tdatatype::QINT8)
+      qgemm_int8(trans_in, M, N, K, data, lda, input.getData<int8_t>(), ldb,
+                 input.getScale<float>(), scale_inc_k, scale_inc_n, beta,
+                 rdata, ldc);
+    else
+      qgemm_int4(trans_in, M, N, K, data, lda, input.getData<uint8_t>(), ldb,
+                 input.getScale<float>(), scale_inc_k, scale_inc_n, beta,
+                 rdata, ldc);
+    return output;
+  }
+
+  const float *mdata = input.getData<float>();
   const float alpha = 1.0f;
 
   /// shortcut handling in case of vector
@@ -725,6 +750,20 @@ Tensor &FloatTensor::dot(Tensor const &input, Tensor &output, bool trans,
   return output;
 }
 
+Tensor &FloatTensor::dotBatched(Tensor const &input, Tensor &output,
+                                bool trans, bool trans_in, float beta) const {
+  unsigned int M, N, K, lda, ldb, ldc;
+  calculateBatchedDot(input, output, trans, trans_in, M, N, K, lda, ldb, ldc);
+
+  sgemm_batched((unsigned int)dim.getStorageOrder(), trans, trans_in, M, N, K,
+                1.0f, (float *)getData(), lda, dim.getFeatureLen(),
+                input.getData<float>(), ldb, input.getDim().getFeatureLen(),
+                beta, output.getData<float>(), ldc,
+                output.getDim().getFeatureLen(), batch());
+
+  return output;
+}
+
 void FloatTensor::copy(const Tensor &from) {
   reshape(from.getDim());
   copy(from.getData<float>());
@@ -935,6 +974,46 @@ void FloatTensor::zoneout_mask(Tensor &opposite, float zoneout) {
   }
 }
 
+Tensor &FloatTensor::multiply_bitmask(const Tensor &mask, float on, float off,
+                                      Tensor &output) const {
+  const size_t feature_len = dim.getFeatureLen();
+  const size_t words = mask.getDim().getFeatureLen();
+  const float *in = (const float *)getData();
+  float *out = output.getData<float>();
+
+  for (unsigned int b = 0; b < batch(); ++b) {
+    const uint32_t *bits = mask.getData<uint32_t>() + b * words;
+    const float *x = in + b * feature_len;
+    float *y = out + b * feature_len;
+    for (size_t i = 0; i < feature_len; ++i) {
+      const bool bit = (bits[i / 32] >> (i % 32)) & 1u;
+      y[i] = x[i] * (bit ? on : off);
+    }
+  }
+
+  return output;
+}
+
+Tensor &FloatTensor::select_bitmask(const Tensor &mask, const Tensor &other,
+                                    Tensor &output) const {
+  const size_t feature_len = dim.getFeatureLen();
+  const size_t words = mask.getDim().getFeatureLen();
+  const float *in = (const float *)getData();
+  const float *in_other = other.getData<float>();
+  float *out = output.getData<float>();
+
+  for (unsigned int b = 0; b < batch(); ++b) {
+    const uint32_t *bits = mask.getData<uint32_t>() + b * words;
+    const size_t base = b * feature_len;
+    for (size_t i = 0; i < feature_len; ++i) {
+      const bool bit = (bits[i / 32] >> (i % 32)) & 1u;
+      out[base + i] = bit ? in[base + i] : in_other[base + i];
+    }
+  }
+
+  return output;
+}
+
 std::vector<Tensor> FloatTensor::split(std::vector<size_t> sizes, int axis) {
   size_t num_size = sizes.size();
 
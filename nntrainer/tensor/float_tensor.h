@@ -222,22 +222,6 @@ public:
    */
   void setZero() override;
 
-  /**
-   * @brief Set the Dist object
-   * @param dist distribution engine
-   */
-  template <typename Engine> void setDist(Engine dist) {
-    NNTR_THROW_IF(!contiguous, std::invalid_argument)
-      // << getName() << " Tensor is not contiguous, cannot set distribution";
-      << " Tensor is not contiguous, cannot set distribution";
-
-    float *data_ = (float *)getData();
-    unsigned int len = size();
-    for (unsigned int i = 0; i < len; ++i) {
-      data_[i] = (float)dist(rng);
-    }
-  };
-
   /**
    * @copydoc Tensor::setRandNormal()
    */
@@ -378,10 +362,20 @@ public:
   /**
    *  @copydoc Tensor::dot(Tensor const &input, Tensor &output, bool
    * trans, bool trans_in, float beta)
+   *
+   * @note input can be a QINT8 or QINT4 weight, which is multiplied without
+   * making a dequantized copy
    */
   Tensor &dot(Tensor const &input, Tensor &output, bool trans, bool trans_in,
               float beta) const override;
 
+  /**
+   * @copydoc Tensor::dotBatched(Tensor const &input, Tensor &output, bool
+   * trans, bool trans_in, float beta)
+   */
+  Tensor &dotBatched(Tensor const &input, Tensor &output, bool trans,
+                     bool trans_in, float beta) const override;
+
   /**
    * @copydoc Tensor::dropout_mask(float dropout)
    */
@@ -397,6 +391,20 @@ public:
    */
   void zoneout_mask(Tensor &opposite, float zoneout) override;
 
+  /**
+   * @copydoc Tensor::multiply_bitmask(const Tensor &mask, float on, float off,
+   * Tensor &output)
+   */
+  Tensor &multiply_bitmask(const Tensor &mask, float on, float off,
+                           Tensor &output) const override;
+
+  /**
+   * @copydoc Tensor::select_bitmask(const Tensor &mask, const Tensor &other,
+   * Tensor &output)
+   */
+  Tensor &select_bitmask(const Tensor &mask, const Tensor &other,
+                         Tensor &output) const override;
+
   /**
    * @copydoc Tensor::split(std::vector<size_t> sizes, int axis)
    */
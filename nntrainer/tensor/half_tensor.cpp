@@ -14,6 +14,7 @@
 
 #include <cpu_backend.h>
 #include <half_tensor.h>
+#include <random_stream.h>
 #include <tensor.h>
 #include <util_func.h>
 
@@ -158,18 +159,32 @@ void HalfTensor::setZero() {
 }
 
 void HalfTensor::setRandNormal(float mean, float stddev) {
-  setDist<std::normal_distribution<float>>(
-    std::normal_distribution<float>(mean, stddev));
+  setDist([mean, stddev](size_t len, float *X) {
+    RandomStream::Global().normal(len, X, mean, stddev);
+  });
 }
 
 void HalfTensor::setRandUniform(float min, float max) {
-  setDist<std::uniform_real_distribution<float>>(
-    std::uniform_real_distribution<float>(min, max));
+  setDist([min, max](size_t len, float *X) {
+    RandomStream::Global().uniform(len, X, min, max);
+  });
 }
 
 void HalfTensor::setRandBernoulli(float probability) {
-  setDist<std::bernoulli_distribution>(
-    std::bernoulli_distribution(probability));
+  setDist([probability](size_t len, float *X) {
+    RandomStream::Global().bernoulli(len, X, probability);
+  });
+}
+
+void HalfTensor::setDist(
+  const std::function<void(size_t, float *)> &generate) {
+  NNTR_THROW_IF(!contiguous, std::invalid_argument)
+    << getName() << " Tensor is not contiguous, cannot set distribution";
+
+  /// the stream generates single precision, convert through a buffer
+  std::vector<float> buf(size());
+  generate(buf.size(), buf.data());
+  scopy(buf.size(), buf.data(), 1, (_FP16 *)getData(), 1);
 }
 
 void HalfTensor::initialize() {
@@ -638,8 +653,29 @@ Tensor &HalfTensor::dot(Tensor const &input, Tensor &output, bool trans,
                       K, lda, ldb, ldc);
 
   const _FP16 *data = (_FP16 *)getData();
-  const _FP16 *mdata = input.getData<_FP16>();
   _FP16 *rdata = output.getData<_FP16>();
+
+  /// weight-only quantized input is dequantized tile by tile in the kernel
+  if (input.getDataType() == Tdatatype::QINT8 ||
+      input.getDataType() == Tdatatype::QINT4) {
+    NNTR_THROW_IF(trans, std::invalid_argument)
+      << "Error: quantized dot product does not support trans";
+
+    unsigned int scale_inc_k, scale_inc_n;
+    calculateQuantizedDot(input, trans_in, scale_inc_k, scale_inc_n);
+
+    if (input.getDataType() == Tdatatype::QINT8)
+      qgemm_int8(trans_in, M, N, K, data, lda, input.getData<int8_t>(), ldb,
+                 input.getScale<float>(), scale_inc_k, scale_inc_n, beta,
+                 rdata, ldc);
+    else
+      qgemm_int4(trans_in, M, N, K, data, lda, input.getData<uint8_t>(), ldb,
+                 input.getScale<float>(), scale_inc_k, scale_inc_n, beta,
+                 rdata, ldc);
+    return output;
+  }
+
+  const _FP16 *mdata = input.getData<_FP16>();
   const float alpha = 1.0f;
 
   /// shortcut handling in case of vector
@@ -674,6 +710,20 @@ Tensor &HalfTensor::dot(Tensor const &input, Tensor &output, bool trans,
   return output;
 }
 
+Tensor &HalfTensor::dotBatched(Tensor const &input, Tensor &output, bool trans,
+                               bool trans_in, float beta) const {
+  unsigned int M, N, K, lda, ldb, ldc;
+  calculateBatchedDot(input, output, trans, trans_in, M, N, K, lda, ldb, ldc);
+
+  sgemm_batched((unsigned int)dim.getStorageOrder(), trans, trans_in, M, N, K,
+                1.0f, (_FP16 *)getData(), lda, dim.getFeatureLen(),
+                input.getData<_FP16>(), ldb, input.getDim().getFeatureLen(),
+                beta, output.getData<_FP16>(), ldc,
+                output.getDim().getFeatureLen(), batch());
+
+  return output;
+}
+
 void HalfTensor::dropout_mask(float dropout) {
   _FP16 scale = static_cast<_FP16>(1.0 / (1 - dropout));
   _FP16 *data_ = (_FP16 *)getData();
@@ -723,6 +773,46 @@ void HalfTensor::zoneout_mask(Tensor &opposite, float zoneout) {
   }
 }
 
+Tensor &HalfTensor::multiply_bitmask(const Tensor &mask, float on, float off,
+                                     Tensor &output) const {
+  const size_t feature_len = dim.getFeatureLen();
+  const size_t words = mask.getDim().getFeatureLen();
+  const _FP16 *in = (const _FP16 *)getData();
+  _FP16 *out = output.getData<_FP16>();
+
+  for (unsigned int b = 0; b < batch(); ++b) {
+    const uint32_t *bits = mask.getData<uint32_t>() + b * words;
+    const _FP16 *x = in + b * feature_len;
+    _FP16 *y = out + b * feature_len;
+    for (size_t i = 0; i < feature_len; ++i) {
+      const bool bit = (bits[i / 32] >> (i % 32)) & 1u;
+      y[i] = (_FP16)((float)x[i] * (bit ? on : off));
+    }
+  }
+
+  return output;
+}
+
+Tensor &HalfTensor::select_bitmask(const Tensor &mask, const Tensor &other,
+                                   Tensor &output) const {
+  const size_t feature_len = dim.getFeatureLen();
+  const size_t words = mask.getDim().getFeatureLen();
+  const _FP16 *in = (const _FP16 *)getData();
+  const _FP16 *in_other = other.getData<_FP16>();
+  _FP16 *out = output.getData<_FP16>();
+
+  for (unsigned int b = 0; b < batch(); ++b) {
+    const uint32_t *bits = mask.getData<uint32_t>() + b * words;
+    const size_t base = b * feature_len;
+    for (size_t i = 0; i < feature_len; ++i) {
+      const bool bit = (bits[i / 32] >> (i % 32)) & 1u;
+      out[base + i] = bit ? in[base + i] : in_other[base + i];
+    }
+  }
+
+  return output;
+}
+
 std::vector<Tensor> HalfTensor::split(std::vector<size_t> sizes, int axis) {
   size_t num_size = sizes.size();
 
@@ -13,6 +13,8 @@
 #define __HALF_TENSOR_H__
 #ifdef __cplusplus
 
+#include <functional>
+
 #include <tensor_base.h>
 
 #ifdef DEBUG
@@ -224,19 +226,9 @@ public:
 
   /**
    * @brief Set the Dist object
-   * @param dist distribution engine
+   * @param generate fills a single precision buffer of the given length
    */
-  template <typename Engine> void setDist(Engine dist) {
-    NNTR_THROW_IF(!contiguous, std::invalid_argument)
-      // << getName() << " Tensor is not contiguous, cannot set distribution";
-      << " Tensor is not contiguous, cannot set distribution";
-
-    _FP16 *data_ = (_FP16 *)getData();
-    unsigned int len = size();
-    for (unsigned int i = 0; i < len; ++i) {
-      data_[i] = (_FP16)dist(rng);
-    }
-  };
+  void setDist(const std::function<void(size_t, float *)> &generate);
 
   /**
    * @copydoc Tensor::setRandNormal()
@@ -368,10 +360,20 @@ public:
   /**
    *  @copydoc Tensor::dot(Tensor const &input, Tensor &output, bool
    * trans, bool trans_in, float beta)
+   *
+   * @note input can be a QINT8 or QINT4 weight, which is multiplied without
+   * making a dequantized copy
    */
   Tensor &dot(Tensor const &input, Tensor &output, bool trans, bool trans_in,
               float beta) const override;
 
+  /**
+   * @copydoc Tensor::dotBatched(Tensor const &input, Tensor &output, bool
+   * trans, bool trans_in, float beta)
+   */
+  Tensor &dotBatched(Tensor const &input, Tensor &output, bool trans,
+                     bool trans_in, float beta) const override;
+
   /**
    * @copydoc Tensor::dropout_mask(float dropout)
    */
@@ -387,6 +389,20 @@ public:
    */
   void zoneout_mask(Tensor &opposite, float zoneout) override;
 
+  /**
+   * @copydoc Tensor::multiply_bitmask(const Tensor &mask, float on, float off,
+   * Tensor &output)
+   */
+  Tensor &multiply_bitmask(const Tensor &mask, float on, float off,
+                           Tensor &output) const override;
+
+  /**
+   * @copydoc Tensor::select_bitmask(const Tensor &mask, const Tensor &other,
+   * Tensor &output)
+   */
+  Tensor &select_bitmask(const Tensor &mask, const Tensor &other,
+                         Tensor &output) const override;
+
   /**
    * @copydoc Tensor::split(std::vector<size_t> sizes, int axis)
    */
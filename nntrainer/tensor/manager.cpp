@@ -118,6 +118,36 @@ MMapedMemory::MMapedMemory(size_t size, bool allocate_fd_) :
           buf_size, fd, buf);
 }
 
+MMapedMemory::MMapedMemory(const std::string &file_path) :
+  fd(-1), buf(nullptr), buf_size(0), allocate_fd(false) {
+  int fd_ = open(file_path.c_str(), O_RDONLY);
+  if (fd_ < 0) {
+    throw std::runtime_error("[MMapedMemory] opening file failed: " +
+                             file_path);
+  }
+
+  struct stat st;
+  if (fstat(fd_, &st) < 0 || st.st_size == 0) {
+    close(fd_);
+    throw std::runtime_error("[MMapedMemory] invalid file: " + file_path);
+  }
+
+  /// private writable mapping, so that a layer modifying its weight in place
+  /// gets its own copy of the page instead of a fault
+  void *buf_ =
+    mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd_, 0);
+  close(fd_);
+  if (buf_ == MAP_FAILED) {
+    throw std::runtime_error("[MMapedMemory] mmap failed: " + file_path);
+  }
+
+  buf = buf_;
+  buf_size = st.st_size;
+
+  ml_logd("[MMapedMemory] file mapped: %s size: %zu, addr: %p",
+          file_path.c_str(), buf_size, buf);
+}
+
 MMapedMemory::~MMapedMemory() noexcept {
 #ifdef DEBUG
   assert(buf_size > 0 && fd > 0);
@@ -160,6 +190,69 @@ void Manager::allocateWeights(unsigned int max_exec_order_, bool init) {
 
 void Manager::deallocateWeights() { weight_pool.deallocate(); }
 
+bool Manager::mapWeights(const std::vector<Tensor *> &weights,
+                         const std::string &file_path) {
+#if defined(_WIN32)
+  return false;
+#else
+  if (!weight_pool.isAllocated() || enable_swap) {
+    return false;
+  }
+
+  /// tensor offsets are in elements, so each weight has to start at a
+  /// multiple of its element size
+  std::vector<size_t> offsets;
+  offsets.reserve(weights.size());
+  size_t offset = 0;
+  for (auto &w : weights) {
+    auto dtype = w->getDataType();
+    if (!w->getContiguous() || (dtype != TensorDim::DataType::FP32 &&
+                                dtype != TensorDim::DataType::FP16)) {
+      ml_logi("[Manager] cannot map %s, reading weights instead",
+              w->getName().c_str());
+      return false;
+    }
+    size_t type_size = w->getDim().getDataTypeSize();
+    if (offset % type_size != 0) {
+      return false;
+    }
+    offsets.push_back(offset / type_size);
+    offset += w->bytes();
+  }
+
+  std::shared_ptr<MMapedMemory> file;
+  try {
+    file = std::make_shared<MMapedMemory>(file_path);
+  } catch (std::exception &e) {
+    ml_logw("%s, reading weights instead", e.what());
+    return false;
+  }
+
+  if (offset > file->size()) {
+    ml_logw("[Manager] %s is smaller than the weights, reading weights instead",
+            file_path.c_str());
+    return false;
+  }
+
+  /// the mapping lives as long as any tensor refers to it
+  auto mem = std::shared_ptr<MemoryData>(
+    new MemoryData(file->data()), [file](MemoryData *m) { delete m; });
+
+  try {
+    for (unsigned int i = 0; i < weights.size(); ++i) {
+      weight_pool.setExternalData(weights[i]->getName(), mem, offsets[i]);
+    }
+  } catch (std::invalid_argument &e) {
+    /// weights mapped so far hold the right values, reading them again only
+    /// writes to private copies of the pages
+    ml_logw("%s, reading weights instead", e.what());
+    return false;
+  }
+
+  return true;
+#endif
+}
+
 static Tensor *requestTensor_(const TensorSpecV2 &spec,
                               const GraphNode::ExecutionOrder &exec_order,
                               const std::string &scope, TensorPool &tp,
@@ -466,6 +559,20 @@ std::vector<Weight *> Manager::requestWeights(
       var =
         weight_pool.request(name, dim_v, var_exec_order, var_ls, t_initializer);
 
+      /**
+       * A weight with gradient is only written when the gradient is applied,
+       * which lets a swapped weight be dropped without write back otherwise.
+       * Weights without gradient (e.g. moving statistics) are updated in
+       * forwarding, and clipping or mixed precision applies the gradient
+       * outside of the order, so they are kept as written at every order.
+       */
+      if (need_gradient &&
+          !Weight::isGradientClipByGlobalNorm(clip_by_global_norm) &&
+          !isMixedPrecision())
+        weight_pool.setWriteOrder(
+          name, trainable ? std::vector<unsigned int>{applyGradient_order}
+                          : std::vector<unsigned int>{});
+
       if (trainable && need_gradient) {
         /** is_wgrad is the index which is true when it is the gradient tensor
          * of weight. If it is true, memory planner schedule based on it to
@@ -747,24 +854,37 @@ void Manager::flushCache() {
 bool Manager::checkLoadComplete(unsigned int order) {
   if (async_load_tensor.count(order) == 1) {
     auto &tasks = async_load_tensor[order];
+    auto wait_start = PrefetchScheduler::Clock::now();
+    bool stalled = false;
+    auto waitLoad = [&stalled](std::future<bool> &fut) {
+      if (fut.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        stalled = true;
+        fut.wait();
+      }
+    };
     std::unique_lock<std::mutex> lock(completed_load_mutex);
     if (exec_mode == ExecutionMode::TRAIN) {
       auto w_fut = completed_load_tensor[std::get<0>(tasks)].get_future();
       auto t_fut = completed_load_tensor[std::get<1>(tasks)].get_future();
       lock.unlock();
       if (std::get<0>(tasks) != 0)
-        w_fut.wait();
+        waitLoad(w_fut);
       if (std::get<1>(tasks) != 0)
-        t_fut.wait();
+        waitLoad(t_fut);
     } else {
       auto w_fut = completed_load_tensor[std::get<0>(tasks)].get_future();
       lock.unlock();
       if (std::get<0>(tasks) != 0)
-        w_fut.wait();
+        waitLoad(w_fut);
     }
     async_load_tensor.erase(order);
+    compute_start = PrefetchScheduler::Clock::now();
+    prefetch.recordWait(
+      std::chrono::duration<double>(compute_start - wait_start).count(),
+      stalled);
     ml_logd("wait and completed %d", order);
   } else {
+    compute_start = PrefetchScheduler::Clock::now();
     ml_logd("without wait completed %d", order);
   }
   return true;
@@ -795,24 +915,34 @@ bool Manager::checkUnloadComplete(unsigned int order) {
 
 void Manager::LoadTensors(unsigned int order,
                           unsigned int remainder_lookahead) {
-  auto loadTensorsAsync = [&](TensorPool &pool, unsigned int order) {
+  auto loadTensorsAsync = [&](TensorPool &pool, unsigned int o,
+                              unsigned int channel, size_t bytes) {
+    auto issued = PrefetchScheduler::Clock::now();
     return pool.loadCacheExecAsync(
-      order, [&](int id, TaskExecutor::CompleteStatus status) {
+      o, [this, channel, bytes, issued](int id,
+                                        TaskExecutor::CompleteStatus status) {
+        prefetch.recordLoad(channel, bytes, issued);
         std::scoped_lock<std::mutex> lock(completed_load_mutex);
         completed_load_tensor[id].set_value(true);
       });
   };
 
+  auto orderBytes = [](const std::vector<size_t> &bytes, unsigned int o) {
+    return o < bytes.size() ? bytes[o] : 0;
+  };
+
   auto enqueTasks = [&](unsigned int o) {
     if (async_load_tensor.count(o)) {
       ml_logd("Task loadTensors (%d) is in progress", o);
       return;
     }
-    auto load_weight = loadTensorsAsync(weight_pool, o);
+    auto load_weight =
+      loadTensorsAsync(weight_pool, o, 0, orderBytes(weight_order_bytes, o));
     ml_logd("load weigth is requested in LoadTensors with order - %d", o);
     int load_tensor = 0;
     if (exec_mode != ml::train::ExecutionMode::INFERENCE) {
-      load_tensor = loadTensorsAsync(tensor_pool, o);
+      load_tensor =
+        loadTensorsAsync(tensor_pool, o, 1, orderBytes(tensor_order_bytes, o));
       ml_logd("load tensor is requested in LoadTensors with order - %d", o);
     }
     NNTR_THROW_IF(load_weight < 0 || load_tensor < 0, std::runtime_error)
@@ -820,6 +950,11 @@ void Manager::LoadTensors(unsigned int order,
     async_load_tensor[o] = std::make_tuple(load_weight, load_tensor);
   };
 
+  if (prefetch_limit) {
+    initPrefetchOrderBytes();
+    remainder_lookahead = prefetch.getLookahead(order);
+  }
+
   for (unsigned int i = order; i < order + remainder_lookahead + 1; ++i) {
     if (i <= max_exec_order) {
       enqueTasks(i);
@@ -853,6 +988,9 @@ void Manager::UnloadTensors(unsigned int order) {
     async_unload_tensor[o] = std::make_tuple(unload_weight, unload_tensor);
   };
 
+  std::chrono::duration<double> compute =
+    PrefetchScheduler::Clock::now() - compute_start;
+  prefetch.recordCompute(order, compute.count());
   enqueTasks(order);
 }
 
@@ -912,4 +1050,62 @@ unsigned int Manager::getNumLoadedTensorPoolTensors() {
   return tensor_pool.getNumLoadedTensors();
 }
 
+SwapDevice::Stats Manager::getSwapStats(bool reset) {
+  auto weight = weight_pool.getSwapStats(reset);
+  auto tensor = tensor_pool.getSwapStats(reset);
+  return {weight.read_bytes + tensor.read_bytes,
+          weight.write_bytes + tensor.write_bytes,
+          weight.clean_bytes + tensor.clean_bytes,
+          weight.tier_store_bytes + tensor.tier_store_bytes,
+          weight.tier_load_bytes + tensor.tier_load_bytes};
+}
+
+void Manager::setCompressedSwapTier(size_t budget, bool lossy) {
+  if (!enable_swap)
+    return;
+
+  std::map<CachePolicy, SwapCodec> codecs = {
+    {CachePolicy::ALWAYS_SYNCED, SwapCodec::ZERO},
+    {CachePolicy::ITERATION_CONSIST, SwapCodec::ZERO},
+    {CachePolicy::ACTIVATION_SYNCED, SwapCodec::ZERO},
+    {CachePolicy::ACTIVATION_CONSIST, SwapCodec::ZERO},
+    {CachePolicy::SYNC_ONCE, SwapCodec::ZERO}};
+  weight_pool.setCompressedSwapTier(budget, codecs);
+
+  /**
+   * Only activations may be packed lossy, gradients and optimizer states are
+   * always kept as they are.
+   */
+  if (lossy && istrequal(tensor_dtype[1], "FP32")) {
+    codecs[CachePolicy::ACTIVATION_SYNCED] = SwapCodec::FP16;
+    codecs[CachePolicy::ACTIVATION_CONSIST] = SwapCodec::FP16;
+  }
+  tensor_pool.setCompressedSwapTier(budget, codecs);
+}
+
+void Manager::setPrefetchLimit(size_t limit) {
+  prefetch_limit = enable_swap ? limit : 0;
+  prefetch.setLimit(prefetch_limit);
+}
+
+PrefetchScheduler::Stats Manager::getPrefetchStats(bool reset) {
+  return prefetch.getStats(reset);
+}
+
+void Manager::initPrefetchOrderBytes() {
+  if (weight_order_bytes.size() == max_exec_order + 1)
+    return;
+
+  weight_order_bytes = weight_pool.getExecOrderBytes(max_exec_order);
+  weight_order_bytes.resize(max_exec_order + 1, 0);
+  if (exec_mode != ml::train::ExecutionMode::INFERENCE)
+    tensor_order_bytes = tensor_pool.getExecOrderBytes(max_exec_order);
+  tensor_order_bytes.resize(max_exec_order + 1, 0);
+
+  std::vector<size_t> bytes(max_exec_order + 1);
+  for (unsigned int o = 0; o <= max_exec_order; ++o)
+    bytes[o] = weight_order_bytes[o] + tensor_order_bytes[o];
+  prefetch.setOrderBytes(std::move(bytes));
+}
+
 } // namespace nntrainer
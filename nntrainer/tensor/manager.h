@@ -32,6 +32,7 @@
 #include <basic_planner.h>
 #include <common.h>
 #include <graph_node.h>
+#include <prefetch_scheduler.h>
 #include <tensor_pool.h>
 #include <var_grad.h>
 #include <weight.h>
@@ -54,6 +55,15 @@ public:
    */
   MMapedMemory(size_t size, bool allocate_fd_ = false);
 
+  /**
+   * @brief Construct a new MMapedMemory object mapping a whole file. The
+   * mapping is private, pages are shared with the page cache until written.
+   *
+   * @param file_path path of the file to map
+   * @throw std::runtime_error if the file cannot be mapped
+   */
+  explicit MMapedMemory(const std::string &file_path);
+
   /**
    * @brief Destroy the MMapedMemory object
    *
@@ -155,6 +165,7 @@ public:
     enable_swap(enable_swap_),
     enable_optimizations(true),
     swap_lookahead(lookahead),
+    prefetch(0, lookahead),
     tensor_format(tensor_format_),
     tensor_dtype(split(tensor_dtype_, getRegex("\\-"))),
     exec_mode(exec_mode_) {}
@@ -357,6 +368,20 @@ public:
     tensor_pool.setBatchSize(name, batch);
   }
 
+  /**
+   * @brief Detach the managed tensors from their memory to update their batch
+   * without releasing the memory
+   *
+   * @note weights are not detached as they are independent of batch size
+   */
+  void detachTensors() { tensor_pool.detach(); }
+
+  /**
+   * @brief Attach the managed tensors back to the memory kept by
+   * detachTensors()
+   */
+  void attachTensors() { tensor_pool.attach(); }
+
   /**
    * @brief Allocate memory for all the managed tensors
    *
@@ -396,6 +421,19 @@ public:
    */
   void deallocateWeights();
 
+  /**
+   * @brief Map the given weights to a file instead of reading them. Weights
+   * are laid out in the file back to back in the given order.
+   *
+   * @param weights weights in the order they are saved
+   * @param file_path path of the file to map
+   * @return true if every weight is mapped, false if the weights cannot be
+   * mapped and must be read instead
+   * @note weights must be allocated already
+   */
+  bool mapWeights(const std::vector<Tensor *> &weights,
+                  const std::string &file_path);
+
   /**
    * @brief Set optimizations for manager
    *
@@ -554,6 +592,42 @@ public:
    */
   unsigned int getNumLoadedTensorPoolTensors();
 
+  /**
+   * @brief Get bytes moved by the swap devices of the weight and tensor pools
+   *
+   * @param reset reset the stats after read
+   * @return SwapDevice::Stats summed stats
+   */
+  SwapDevice::Stats getSwapStats(bool reset = false);
+
+  /**
+   * @brief Keep swapped out weights and tensors compressed in memory before
+   * the swap file
+   *
+   * @param budget bytes of compressed data each of the weight and tensor
+   * pools keeps, 0 to disable
+   * @param lossy pack FP32 tensors kept for backwarding to FP16
+   */
+  void setCompressedSwapTier(size_t budget, bool lossy);
+
+  /**
+   * @brief Set the limit of the swapped out data loaded ahead. If set,
+   * LoadTensors chooses the lookahead of each execution order from the bytes
+   * of the orders and the measured load and compute time.
+   *
+   * @param limit bytes of the orders loaded ahead, 0 to use the lookahead
+   * given by the caller
+   */
+  void setPrefetchLimit(size_t limit);
+
+  /**
+   * @brief Get the stats of the waits for loads and the chosen lookahead
+   *
+   * @param reset reset the stats after read
+   * @return PrefetchScheduler::Stats prefetch stats
+   */
+  PrefetchScheduler::Stats getPrefetchStats(bool reset = false);
+
 private:
   /** @todo: merge this list to one */
   std::vector<std::unique_ptr<Weight>> weights_v2; /**< weights for the layers
@@ -610,6 +684,23 @@ private:
 
   unsigned int swap_lookahead; /** lookahead for memory swap */
 
+  size_t prefetch_limit = 0; /**< limit of bytes loaded ahead, 0 if fixed */
+
+  PrefetchScheduler prefetch; /**< chooses the lookahead of LoadTensors */
+
+  std::vector<size_t> weight_order_bytes; /**< weight bytes of each order */
+
+  std::vector<size_t> tensor_order_bytes; /**< tensor bytes of each order */
+
+  /** time the forwarding of the loaded execution order started */
+  PrefetchScheduler::Clock::time_point compute_start;
+
+  /**
+   * @brief Set the bytes of each execution order to the prefetch scheduler
+   * once the pools are finalized
+   */
+  void initPrefetchOrderBytes();
+
   std::string tensor_format;
 
   std::vector<std::string> tensor_dtype;
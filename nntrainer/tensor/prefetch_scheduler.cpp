@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   prefetch_scheduler.cpp
+ * @date   17 Oct 2026
+ * @brief  Decides how far ahead the swapped out tensors are loaded
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <algorithm>
+
+#include <prefetch_scheduler.h>
+
+namespace nntrainer {
+
+PrefetchScheduler::PrefetchScheduler(size_t limit_, unsigned int lookahead_) :
+  limit(limit_),
+  lookahead(lookahead_),
+  load_bytes(-1),
+  load_seconds(-1),
+  stats({0, 0, 0, 0, 0}) {}
+
+void PrefetchScheduler::setLimit(size_t limit_) {
+  std::scoped_lock<std::mutex> lock(mutex);
+  limit = limit_;
+}
+
+void PrefetchScheduler::setOrderBytes(std::vector<size_t> bytes) {
+  std::scoped_lock<std::mutex> lock(mutex);
+  order_bytes = std::move(bytes);
+}
+
+size_t PrefetchScheduler::getOrderBytes(unsigned int order) const {
+  return order < order_bytes.size() ? order_bytes[order] : 0;
+}
+
+void PrefetchScheduler::recordLoad(unsigned int channel, size_t bytes,
+                                   Clock::time_point issued) {
+  auto now = Clock::now();
+
+  std::scoped_lock<std::mutex> lock(mutex);
+  if (channel >= channel_done.size())
+    channel_done.resize(channel + 1);
+
+  /** a load queued behind others starts when the previous one is done */
+  auto start = std::max(issued, channel_done[channel]);
+  channel_done[channel] = now;
+
+  if (bytes == 0)
+    return;
+
+  update(load_bytes, static_cast<double>(bytes));
+  update(load_seconds, std::chrono::duration<double>(now - start).count());
+}
+
+void PrefetchScheduler::recordCompute(unsigned int order, double seconds) {
+  std::scoped_lock<std::mutex> lock(mutex);
+  if (order >= compute_time.size())
+    compute_time.resize(order + 1, -1);
+
+  update(compute_time[order], seconds);
+  stats.compute_time += seconds;
+}
+
+void PrefetchScheduler::recordWait(double seconds, bool stalled) {
+  std::scoped_lock<std::mutex> lock(mutex);
+  stats.waits++;
+  if (stalled) {
+    stats.stalls++;
+    stats.stall_time += seconds;
+  }
+}
+
+unsigned int PrefetchScheduler::getLookahead(unsigned int order) {
+  std::scoped_lock<std::mutex> lock(mutex);
+  if (order + 1 >= order_bytes.size())
+    return 0;
+
+  const unsigned int last = order_bytes.size() - 1;
+  size_t bytes = order_bytes[order];
+  unsigned int chosen = 0;
+
+  if (limit == 0) {
+    chosen = std::min(lookahead, last - order);
+  } else if (load_bytes <= 0 || load_seconds < 0) {
+    /** until a load is measured, the fixed lookahead is kept in the limit */
+    for (unsigned int k = 1; k <= lookahead && order + k <= last; ++k) {
+      bytes += order_bytes[order + k];
+      if (bytes > limit)
+        break;
+      chosen = k;
+    }
+  } else {
+    /**
+     * Loads are run one after another. Order k has to be requested now if the
+     * loads up to k take longer than the compute of the orders between the
+     * next request and k, otherwise it can wait until the next order.
+     * Compute not measured yet counts as 0.
+     */
+    double load = 0.0;
+    double compute = 0.0;
+    for (unsigned int k = 1; order + k <= last; ++k) {
+      bytes += order_bytes[order + k];
+      if (bytes > limit)
+        break;
+
+      load += order_bytes[order + k] * load_seconds / load_bytes;
+      if (load > compute)
+        chosen = k;
+
+      if (order + k < compute_time.size())
+        compute += std::max(compute_time[order + k], 0.0);
+    }
+  }
+
+  stats.lookahead = std::max(stats.lookahead, chosen);
+  return chosen;
+}
+
+PrefetchScheduler::Stats PrefetchScheduler::getStats(bool reset) {
+  std::scoped_lock<std::mutex> lock(mutex);
+  Stats ret = stats;
+  if (reset)
+    stats = {0, 0, 0, 0, 0};
+  return ret;
+}
+
+} // namespace nntrainer
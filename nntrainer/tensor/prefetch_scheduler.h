@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   prefetch_scheduler.h
+ * @date   17 Oct 2026
+ * @brief  Decides how far ahead the swapped out tensors are loaded
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#ifndef __PREFETCH_SCHEDULER_H__
+#define __PREFETCH_SCHEDULER_H__
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace nntrainer {
+
+/**
+ * @class   PrefetchScheduler
+ * @brief   Chooses the number of execution orders to load ahead from the
+ * bytes used by each order, the measured compute time of each order and the
+ * measured load throughput. Orders are loaded just early enough for their
+ * loading to be hidden behind the compute of the preceding orders, as long as
+ * the bytes of the loaded orders are within the memory limit.
+ */
+class PrefetchScheduler {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief weight of a new measurement in the running estimates
+   */
+  static constexpr double smoothing = 0.25;
+
+  /**
+   * @brief prefetch stats
+   */
+  struct Stats {
+    unsigned int waits;     /**< number of waits for a load */
+    unsigned int stalls;    /**< number of waits for an unfinished load */
+    double stall_time;      /**< seconds blocked by unfinished loads */
+    double compute_time;    /**< seconds spent between the loads */
+    unsigned int lookahead; /**< largest lookahead chosen */
+  };
+
+  /**
+   * @brief Construct a new PrefetchScheduler
+   *
+   * @param limit_ maximum bytes of the orders loaded ahead, 0 to always use
+   * the fixed lookahead
+   * @param lookahead_ fixed lookahead, used also until the load throughput
+   * is measured
+   */
+  PrefetchScheduler(size_t limit_ = 0, unsigned int lookahead_ = 0);
+
+  /**
+   * @brief Set the limit of bytes of the orders loaded ahead
+   *
+   * @param limit_ maximum bytes, 0 to always use the fixed lookahead
+   */
+  void setLimit(size_t limit_);
+
+  /**
+   * @brief Set bytes used by each execution order
+   *
+   * @param bytes bytes indexed by execution order
+   */
+  void setOrderBytes(std::vector<size_t> bytes);
+
+  /**
+   * @brief Get bytes used by an execution order
+   *
+   * @param order execution order
+   * @return size_t bytes
+   */
+  size_t getOrderBytes(unsigned int order) const;
+
+  /**
+   * @brief Record a finished load
+   *
+   * @param channel loader which ran the load, loads of a channel are run one
+   * after another
+   * @param bytes bytes of the loaded order
+   * @param issued time the load was requested
+   */
+  void recordLoad(unsigned int channel, size_t bytes, Clock::time_point issued);
+
+  /**
+   * @brief Record the compute time of an execution order
+   *
+   * @param order execution order
+   * @param seconds compute time
+   */
+  void recordCompute(unsigned int order, double seconds);
+
+  /**
+   * @brief Record a wait for a load
+   *
+   * @param seconds time blocked
+   * @param stalled true if the load was not finished when waited for
+   */
+  void recordWait(double seconds, bool stalled);
+
+  /**
+   * @brief Get the number of orders to load ahead of @a order
+   *
+   * @param order execution order about to run
+   * @return unsigned int lookahead
+   */
+  unsigned int getLookahead(unsigned int order);
+
+  /**
+   * @brief Get the prefetch stats
+   *
+   * @param reset reset the stats after read
+   * @return Stats stats
+   */
+  Stats getStats(bool reset = false);
+
+private:
+  /**
+   * @brief update a running estimate
+   */
+  static void update(double &estimate, double value) {
+    estimate =
+      estimate < 0 ? value : estimate + smoothing * (value - estimate);
+  }
+
+  size_t limit;                     /**< bytes loaded ahead at most */
+  unsigned int lookahead;           /**< fixed lookahead */
+  std::vector<size_t> order_bytes;  /**< bytes of each order */
+  std::vector<double> compute_time; /**< seconds of each order, < 0 unknown */
+  double load_bytes;   /**< bytes per load, < 0 unknown */
+  double load_seconds; /**< seconds per load, < 0 unknown */
+  std::vector<Clock::time_point> channel_done; /**< last load of channels */
+  Stats stats;                                 /**< stats */
+  std::mutex mutex; /**< loads are recorded from the loader threads */
+};
+
+} // namespace nntrainer
+
+#endif /** __PREFETCH_SCHEDULER_H__ */
@@ -8,25 +8,442 @@
  * @bug		No known bugs except for NYI items
  */
 
+#include <algorithm>
+#include <cstring>
 #include <math.h>
+#include <mutex>
+#include <vector>
+
+#include <cpu_backend.h>
+#include <nntr_thread_pool.h>
 #include <quantizer.h>
 #include <tensor.h>
 
 namespace nntrainer {
 
+namespace {
+
+/** elements converted at once */
+constexpr size_t QUANT_BLOCK = 256;
+/** elements of a task, even so that no byte of 4-bit codes is shared */
+constexpr size_t QUANT_GRAIN = 1 << 16;
+
+/**
+ * @brief where the quantization parameters of an element are. The parameters
+ * of a per channel quantized tensor are indexed by the axis counted by
+ * Tensor::scale_size() for its data type.
+ */
+struct QParams {
+  const float *scales;             /**< scale factors */
+  const unsigned int *zero_points; /**< zero points, nullptr if signed */
+  size_t width;                    /**< width of the tensor */
+  size_t height;                   /**< height of the tensor */
+
+  /** @brief the axis the parameters are indexed by */
+  enum class Axis { NONE, WIDTH, HEIGHT } axis;
+};
+
+/**
+ * @brief get the channel axis of a per channel quantized data type
+ */
+QParams::Axis channelAxis(Tdatatype qtype) {
+  return (qtype == Tdatatype::QINT4 || qtype == Tdatatype::QINT16)
+           ? QParams::Axis::HEIGHT
+           : QParams::Axis::WIDTH;
+}
+
+/**
+ * @brief check if the quantized data type has zero points
+ */
+bool hasZeroPoint(Tdatatype qtype) {
+  return qtype == Tdatatype::UINT8 || qtype == Tdatatype::UINT16;
+}
+
+/**
+ * @brief make the parameter locations of a quantized tensor
+ */
+QParams makeQParams(const TensorDim &dim, Tdatatype qtype, QScheme qscheme,
+                    const float *scales, const unsigned int *zero_points) {
+  QParams::Axis axis = qscheme == QScheme::PER_CHANNEL_AFFINE
+                         ? channelAxis(qtype)
+                         : QParams::Axis::NONE;
+  return {scales, hasZeroPoint(qtype) ? zero_points : nullptr, dim.width(),
+          dim.height(), axis};
+}
+
+/**
+ * @brief number of channels of a per channel quantized data type
+ */
+size_t channelSize(const TensorDim &dim, Tdatatype qtype) {
+  return channelAxis(qtype) == QParams::Axis::HEIGHT ? dim.height()
+                                                     : dim.width();
+}
+
+/**
+ * @brief call @a fn(i, len, idx, inc) for runs of [begin, end) whose element
+ * i + j has the parameters at idx + j * inc
+ */
+template <typename Fn>
+void forEachRun(const QParams &p, size_t begin, size_t end, Fn fn) {
+  for (size_t i = begin; i < end;) {
+    size_t len = std::min(QUANT_BLOCK, end - i);
+    size_t idx = 0;
+    size_t inc = 0;
+    if (p.axis != QParams::Axis::NONE) {
+      const size_t w = i % p.width;
+      len = std::min(len, p.width - w);
+      if (p.axis == QParams::Axis::WIDTH) {
+        idx = w;
+        inc = 1;
+      } else {
+        idx = (i / p.width) % p.height;
+      }
+    }
+    fn(i, len, idx, inc);
+    i += len;
+  }
+}
+
+/**
+ * @brief run @a fn(begin, end) over [0, size) on the global thread pool
+ */
+template <typename Fn> void parallelRange(size_t size, Fn fn) {
+  ThreadPool::Global().parallelFor(
+    0, (size + QUANT_GRAIN - 1) / QUANT_GRAIN, 1,
+    [&](unsigned int start, unsigned int end, unsigned int) {
+      fn(start * QUANT_GRAIN, std::min(end * QUANT_GRAIN, size));
+    });
+}
+
+/**
+ * @brief round half away from zero as std::lround does, written without
+ * branches so that the loops calling it are vectorized
+ */
+inline float roundHalfAway(float x) {
+  float r = std::nearbyint(x);
+  float away = x + std::copysign(0.5f, x);
+  return r + static_cast<float>(std::fabs(x - r) == 0.5f) * (away - r);
+}
+
+/**
+ * @brief codes of a quantized tensor stored one per element
+ */
+template <typename T> struct Codes {
+  T *data; /**< first code */
+
+  /**
+   * @brief store the integral values @a q as the elements [i, i + len)
+   */
+  void store(size_t i, size_t len, const float *q) const {
+    for (size_t j = 0; j < len; ++j)
+      data[i + j] = static_cast<T>(static_cast<int>(q[j]));
+  }
+
+  /**
+   * @brief load the elements [i, i + len) into @a q
+   */
+  void load(size_t i, size_t len, float *q) const {
+    for (size_t j = 0; j < len; ++j)
+      q[j] = data[i + j];
+  }
+};
+
+/**
+ * @brief 4-bit codes of a quantized tensor, two a byte with the even element
+ * in the high nibble
+ */
+struct Int4Codes {
+  uint8_t *data; /**< first byte */
+
+  /**
+   * @brief get the low nibble of an integral value
+   */
+  static uint8_t nibble(float q) {
+    return static_cast<unsigned int>(static_cast<int>(q)) & 0x0f;
+  }
+
+  /**
+   * @brief store the integral values @a q as the elements [i, i + len)
+   */
+  void store(size_t i, size_t len, const float *q) const {
+    size_t j = 0;
+    if (len > 0 && (i & 1)) {
+      uint8_t &byte = data[i / 2];
+      byte = (byte & 0xf0) | nibble(q[j++]);
+    }
+    for (; j + 1 < len; j += 2)
+      data[(i + j) / 2] = (nibble(q[j]) << 4) | nibble(q[j + 1]);
+    if (j < len) {
+      uint8_t &byte = data[(i + j) / 2];
+      byte = (nibble(q[j]) << 4) | (byte & 0x0f);
+    }
+  }
+
+  /**
+   * @brief load the elements [i, i + len) into @a q
+   */
+  void load(size_t i, size_t len, float *q) const {
+    size_t j = 0;
+    if (len > 0 && (i & 1))
+      q[j++] = low(data[i / 2]);
+    for (; j + 1 < len; j += 2) {
+      q[j] = high(data[(i + j) / 2]);
+      q[j + 1] = low(data[(i + j) / 2]);
+    }
+    if (j < len)
+      q[j] = high(data[(i + j) / 2]);
+  }
+
+  /**
+   * @brief signed value of the high nibble
+   */
+  static int high(uint8_t byte) { return static_cast<int8_t>(byte) >> 4; }
+
+  /**
+   * @brief signed value of the low nibble
+   */
+  static int low(uint8_t byte) {
+    return static_cast<int8_t>(static_cast<uint8_t>(byte << 4)) >> 4;
+  }
+};
+
+/**
+ * @brief get @a len elements of the input as float
+ */
+const float *widen(const float *x, size_t len, float *) { return x; }
+
+/**
+ * @brief store @a len elements computed in @a buf
+ */
+void narrow(const float *, size_t, float *) {}
+
+/**
+ * @brief get the buffer the output is computed in
+ */
+float *outputBuffer(float *y, float *) { return y; }
+
+#ifdef ENABLE_FP16
+/**
+ * @copydoc widen(const float *, size_t, float *)
+ */
+const float *widen(const _FP16 *x, size_t len, float *buf) {
+  scopy(len, x, 1, buf, 1);
+  return buf;
+}
+
 /**
- * @brief Helper function for clipping
- *
- * @tparam T data type
- * @param val value to clip
- * @param lower lower bound
- * @param upper upper bound
- * @return T cliped data
+ * @copydoc narrow(const float *, size_t, float *)
  */
-template <typename T> T clip(const T &val, const T &lower, const T &upper) {
-  return std::max(lower, std::min(val, upper));
+void narrow(const float *buf, size_t len, _FP16 *y) {
+  scopy(len, buf, 1, y, 1);
 }
 
+/**
+ * @copydoc outputBuffer(float *, float *)
+ */
+float *outputBuffer(_FP16 *, float *buf) { return buf; }
+#endif
+
+/**
+ * @brief quantize @a size elements of @a input into @a codes
+ */
+template <typename In, typename C>
+void quantizeCodes(const In *input, size_t size, const C &codes,
+                   const QParams &p, float qmin, float qmax) {
+  parallelRange(size, [&](size_t begin, size_t end) {
+    float buf[QUANT_BLOCK];
+    float q[QUANT_BLOCK];
+    forEachRun(p, begin, end, [&](size_t i, size_t len, size_t idx,
+                                  size_t inc) {
+      const float *x = widen(input + i, len, buf);
+      const float *scale = p.scales + idx;
+      if (inc == 0) {
+        const float s = scale[0];
+        const float z = p.zero_points ? p.zero_points[idx] : 0.0f;
+        for (size_t j = 0; j < len; ++j)
+          q[j] = std::min(std::max(roundHalfAway(x[j] / s) + z, qmin), qmax);
+      } else if (p.zero_points) {
+        const unsigned int *zp = p.zero_points + idx;
+        for (size_t j = 0; j < len; ++j)
+          q[j] = std::min(
+            std::max(roundHalfAway(x[j] / scale[j]) +
+                       static_cast<float>(static_cast<int>(zp[j])),
+                     qmin),
+            qmax);
+      } else {
+        for (size_t j = 0; j < len; ++j)
+          q[j] = std::min(std::max(roundHalfAway(x[j] / scale[j]), qmin), qmax);
+      }
+      codes.store(i, len, q);
+    });
+  });
+}
+
+/**
+ * @brief dequantize @a size elements of @a codes into @a output
+ */
+template <typename C, typename Out>
+void dequantizeCodes(const C &codes, size_t size, const QParams &p,
+                     Out *output) {
+  parallelRange(size, [&](size_t begin, size_t end) {
+    float buf[QUANT_BLOCK];
+    float q[QUANT_BLOCK];
+    forEachRun(p, begin, end, [&](size_t i, size_t len, size_t idx,
+                                  size_t inc) {
+      float *y = outputBuffer(output + i, buf);
+      const float *scale = p.scales + idx;
+      codes.load(i, len, q);
+      if (inc == 0) {
+        const float s = scale[0];
+        const float z = p.zero_points ? p.zero_points[idx] : 0.0f;
+        for (size_t j = 0; j < len; ++j)
+          y[j] = (q[j] - z) * s;
+      } else if (p.zero_points) {
+        const unsigned int *zp = p.zero_points + idx;
+        for (size_t j = 0; j < len; ++j)
+          y[j] =
+            (q[j] - static_cast<float>(static_cast<int>(zp[j]))) * scale[j];
+      } else {
+        for (size_t j = 0; j < len; ++j)
+          y[j] = q[j] * scale[j];
+      }
+      narrow(y, len, output + i);
+    });
+  });
+}
+
+/**
+ * @brief quantize @a input of a floating point type into @a output
+ */
+template <typename In>
+void quantizeTensor(const In *input, Tensor &output, const QParams &p,
+                    float qmin, float qmax) {
+  const size_t size = output.size();
+  switch (output.getDataType()) {
+  case Tdatatype::QINT4:
+    quantizeCodes(input, size, Int4Codes{output.getData<uint8_t>()}, p, qmin,
+                  qmax);
+    break;
+  case Tdatatype::QINT8:
+    quantizeCodes(input, size, Codes<int8_t>{output.getData<int8_t>()}, p,
+                  qmin, qmax);
+    break;
+  case Tdatatype::QINT16:
+    quantizeCodes(input, size, Codes<int16_t>{output.getData<int16_t>()}, p,
+                  qmin, qmax);
+    break;
+  case Tdatatype::UINT8:
+    quantizeCodes(input, size, Codes<uint8_t>{output.getData<uint8_t>()}, p,
+                  qmin, qmax);
+    break;
+  case Tdatatype::UINT16:
+    quantizeCodes(input, size, Codes<uint16_t>{output.getData<uint16_t>()}, p,
+                  qmin, qmax);
+    break;
+  default:
+    throw std::invalid_argument("[Quantizer] Unsupported data type error.");
+  }
+}
+
+/**
+ * @brief dequantize @a input into @a output of a floating point type
+ */
+template <typename Out>
+void dequantizeTensor(const Tensor &input, const QParams &p, Out *output) {
+  const size_t size = input.size();
+  switch (input.getDataType()) {
+  case Tdatatype::QINT4:
+    dequantizeCodes(Int4Codes{input.getData<uint8_t>()}, size, p, output);
+    break;
+  case Tdatatype::QINT8:
+    dequantizeCodes(Codes<int8_t>{input.getData<int8_t>()}, size, p, output);
+    break;
+  case Tdatatype::QINT16:
+    dequantizeCodes(Codes<int16_t>{input.getData<int16_t>()}, size, p,
+                    output);
+    break;
+  case Tdatatype::UINT8:
+    dequantizeCodes(Codes<uint8_t>{input.getData<uint8_t>()}, size, p,
+                    output);
+    break;
+  case Tdatatype::UINT16:
+    dequantizeCodes(Codes<uint16_t>{input.getData<uint16_t>()}, size, p,
+                    output);
+    break;
+  default:
+    throw std::invalid_argument("[Quantizer] Unsupported data type error.");
+  }
+}
+
+/**
+ * @brief check if the data type is a floating point type a quantizer reads
+ * and writes
+ */
+bool isFloatingPoint(Tdatatype dtype) {
+#ifdef ENABLE_FP16
+  return dtype == Tdatatype::FP32 || dtype == Tdatatype::FP16;
+#else
+  return dtype == Tdatatype::FP32;
+#endif
+}
+
+/**
+ * @brief quantize @a input with the parameters @a p into @a output
+ */
+void quantizeTensor(const Tensor &input, Tensor &output, const QParams &p,
+                    float qmin, float qmax) {
+  if (input.getDataType() == Tdatatype::FP32) {
+    quantizeTensor(input.getData<float>(), output, p, qmin, qmax);
+  } else {
+#ifdef ENABLE_FP16
+    quantizeTensor(input.getData<_FP16>(), output, p, qmin, qmax);
+#endif
+  }
+}
+
+/**
+ * @brief dequantize @a input with the parameters it holds into @a dtype
+ */
+Tensor dequantizeTensor(const Tensor &input, Tdatatype dtype) {
+  NNTR_THROW_IF(!isFloatingPoint(dtype), std::invalid_argument)
+    << "[Quantizer::dequantize] Cannot dequantize to a non floating point "
+       "type.";
+
+  NNTR_THROW_IF(input.q_scheme() == QScheme::PER_CHANNEL_AFFINE &&
+                  input.getFormat() != Tformat::NCHW,
+                std::invalid_argument)
+    << "[Quantizer::dequantize] Per channel quantization needs NCHW format.";
+
+  /// the parameters follow the data and may be unaligned
+  Tdatatype qtype = input.getDataType();
+  std::vector<float> scales(input.scale_size());
+  std::vector<unsigned int> zero_points(input.scale_size());
+  std::memcpy(scales.data(), input.getScale<float>(),
+              scales.size() * sizeof(float));
+  if (hasZeroPoint(qtype))
+    std::memcpy(zero_points.data(), input.getZeroPoint(),
+                zero_points.size() * sizeof(unsigned int));
+
+  QParams p = makeQParams(input.getDim(), qtype, input.q_scheme(),
+                          scales.data(), zero_points.data());
+
+  TensorDim dim = input.getDim();
+  dim.setDataType(dtype);
+  Tensor output(dim);
+
+  if (dtype == Tdatatype::FP32) {
+    dequantizeTensor(input, p, output.getData<float>());
+  } else {
+#ifdef ENABLE_FP16
+    dequantizeTensor(input, p, output.getData<_FP16>());
+#endif
+  }
+
+  return output;
+}
+
+} // namespace
+
 void Quantizer::calculateMinMaxValue(Tdatatype qtype) {
   unsigned int N;
 
@@ -92,15 +509,14 @@ Tensor PerTensorAffineQuantizer::quantize(const Tensor &input,
 Tensor &PerTensorAffineQuantizer::quantize(const Tensor &input, Tensor &output,
                                            float *scales,
                                            unsigned int *zero_points) {
-  // Currently only full precision floating point is supported. FP16 is NYI
-  NNTR_THROW_IF(input.getDataType() != Tdatatype::FP32, std::invalid_argument)
+  NNTR_THROW_IF(!isFloatingPoint(input.getDataType()), std::invalid_argument)
     << "[Quantizer::quantize] Tensor data type is not floating point.";
 
   // Check if output tensor is valid
   NNTR_THROW_IF(output.empty(), std::invalid_argument)
     << "[Quantizer::quantize] Cannot quantize to an empty tensor.";
 
-  NNTR_THROW_IF(output.getDataType() == Tdatatype::FP32, std::invalid_argument)
+  NNTR_THROW_IF(isFloatingPoint(output.getDataType()), std::invalid_argument)
     << "[Quantizer::quantize] Cannot quantize to full precision floating "
        "point.";
 
@@ -111,38 +527,21 @@ Tensor &PerTensorAffineQuantizer::quantize(const Tensor &input, Tensor &output,
   NNTR_THROW_IF(input.size() != output.size(), std::invalid_argument)
     << "[Quantizer::quantize] Tensor size does not match.";
 
-  if (output.getDataType() == Tdatatype::UINT8 ||
-      output.getDataType() == Tdatatype::UINT16) {
+  if (hasZeroPoint(output.getDataType())) {
     NNTR_THROW_IF(zero_points == nullptr, std::invalid_argument)
       << "[Quantizer::quantize] Output zero point is invalid.";
   }
 
   calculateMinMaxValue(output.getDataType());
 
-  long int val;
-
-  /// @todo this is a naive impl. need optimization
-  for (unsigned int b = 0; b < output.batch(); ++b) {
-    for (unsigned int c = 0; c < output.channel(); ++c) {
-      for (unsigned int h = 0; h < output.height(); ++h) {
-        for (unsigned int w = 0; w < output.width(); ++w) {
-          val = std::lround(input.getValue(b, c, h, w) / *scales);
+  QParams p = makeQParams(output.getDim(), output.getDataType(),
+                          QScheme::PER_TENSOR_AFFINE, scales, zero_points);
+  quantizeTensor(input, output, p, quant_min, quant_max);
 
-          if (output.getDataType() == Tdatatype::UINT8 ||
-              output.getDataType() == Tdatatype::UINT16) {
-            val += *zero_points;
-          }
+  std::memcpy(output.getScale<float>(), scales, sizeof(float));
 
-          output.setValue(b, c, h, w, clip(val, quant_min, quant_max));
-        }
-      }
-    }
-  }
-  *output.getScale<float>() = *scales;
-
-  if (output.getDataType() == Tdatatype::UINT8 ||
-      output.getDataType() == Tdatatype::UINT16) {
-    *output.getZeroPoint() = *zero_points;
+  if (hasZeroPoint(output.getDataType())) {
+    std::memcpy(output.getZeroPoint(), zero_points, sizeof(unsigned int));
   }
 
   return output;
@@ -150,15 +549,7 @@ Tensor &PerTensorAffineQuantizer::quantize(const Tensor &input, Tensor &output,
 
 Tensor PerTensorAffineQuantizer::dequantize(const Tensor &input,
                                             Tdatatype dtype) {
-  Tensor output = input.clone(dtype);
-  if (input.getDataType() == Tdatatype::UINT8 ||
-      input.getDataType() == Tdatatype::UINT16) {
-    output.subtract_i(*input.getZeroPoint());
-  }
-
-  output.multiply_i(*input.getScale<float>());
-
-  return output;
+  return dequantizeTensor(input, dtype);
 }
 
 QScheme PerTensorAffineQuantizer::qscheme() const {
@@ -172,23 +563,151 @@ std::unique_ptr<Quantizer> PerChannelAffineQuantizer::create() {
   return std::make_unique<PerChannelAffineQuantizer>();
 }
 
+void PerChannelAffineQuantizer::calculateQParams(const Tensor &input,
+                                                 Tdatatype qtype) {
+  const size_t channels = channelSize(input.getDim(), qtype);
+  QParams p = makeQParams(input.getDim(), qtype, QScheme::PER_CHANNEL_AFFINE,
+                          nullptr, nullptr);
+
+  std::vector<float> lo(channels, 0.0f), hi(channels, 0.0f);
+  std::mutex merge;
+  auto reduce = [&](auto *data) {
+    parallelRange(input.size(), [&](size_t begin, size_t end) {
+      std::vector<float> task_lo(channels, 0.0f), task_hi(channels, 0.0f);
+      float buf[QUANT_BLOCK];
+      forEachRun(p, begin, end,
+                 [&](size_t i, size_t len, size_t idx, size_t inc) {
+                   const float *x = widen(data + i, len, buf);
+                   if (inc == 0) {
+                     float l = task_lo[idx], h = task_hi[idx];
+                     for (size_t j = 0; j < len; ++j) {
+                       l = std::min(l, x[j]);
+                       h = std::max(h, x[j]);
+                     }
+                     task_lo[idx] = l;
+                     task_hi[idx] = h;
+                   } else {
+                     float *l = task_lo.data() + idx;
+                     float *h = task_hi.data() + idx;
+                     for (size_t j = 0; j < len; ++j) {
+                       l[j] = std::min(l[j], x[j]);
+                       h[j] = std::max(h[j], x[j]);
+                     }
+                   }
+                 });
+
+      std::lock_guard<std::mutex> lock(merge);
+      for (size_t k = 0; k < channels; ++k) {
+        lo[k] = std::min(lo[k], task_lo[k]);
+        hi[k] = std::max(hi[k], task_hi[k]);
+      }
+    });
+  };
+
+  if (input.getDataType() == Tdatatype::FP32) {
+    reduce(input.getData<float>());
+  } else {
+#ifdef ENABLE_FP16
+    reduce(input.getData<_FP16>());
+#endif
+  }
+
+  /// signed types are quantized symmetrically, unsigned types use the zero
+  /// point to cover [min(x, 0), max(x, 0)]
+  scales.resize(channels);
+  zero_points.assign(channels, 0);
+  for (size_t k = 0; k < channels; ++k) {
+    if (hasZeroPoint(qtype)) {
+      scales[k] = (hi[k] - lo[k]) / (quant_max - quant_min);
+      scales[k] = std::max(scales[k], std::numeric_limits<float>::epsilon());
+      zero_points[k] = std::clamp<long int>(
+        std::lround(quant_min - lo[k] / scales[k]), quant_min, quant_max);
+    } else {
+      scales[k] = std::max(-lo[k], hi[k]) / ((quant_max - quant_min) / 2.0f);
+      scales[k] = std::max(scales[k], std::numeric_limits<float>::epsilon());
+    }
+  }
+}
+
 Tensor PerChannelAffineQuantizer::quantize(const Tensor &input,
                                            Tdatatype qtype) {
-  /// @todo NYI
-  return input;
+  NNTR_THROW_IF(!isFloatingPoint(input.getDataType()), std::invalid_argument)
+    << "[Quantizer::quantize] Tensor data type is not floating point.";
+
+  NNTR_THROW_IF(input.getFormat() != Tformat::NCHW, std::invalid_argument)
+    << "[Quantizer::quantize] Per channel quantization needs NCHW format.";
+
+  // 1. Calculate quantization parameters
+  calculateMinMaxValue(qtype);
+  calculateQParams(input, qtype);
+
+  // 2. Create output tensor with same dimension but different data type
+  TensorDim dim = input.getDim();
+  dim.setDataType(qtype);
+  Tensor output(dim, nullptr, QScheme::PER_CHANNEL_AFFINE);
+
+  // 3. perform quantization
+  quantize(input, output, scales.data(), zero_points.data());
+
+  return output;
 }
 
 Tensor &PerChannelAffineQuantizer::quantize(const Tensor &input, Tensor &output,
                                             float *scales,
                                             unsigned int *zero_points) {
-  /// @todo NYI
+  NNTR_THROW_IF(!isFloatingPoint(input.getDataType()), std::invalid_argument)
+    << "[Quantizer::quantize] Tensor data type is not floating point.";
+
+  NNTR_THROW_IF(output.empty(), std::invalid_argument)
+    << "[Quantizer::quantize] Cannot quantize to an empty tensor.";
+
+  NNTR_THROW_IF(isFloatingPoint(output.getDataType()), std::invalid_argument)
+    << "[Quantizer::quantize] Cannot quantize to full precision floating "
+       "point.";
+
+  NNTR_THROW_IF(output.q_scheme() != QScheme::PER_CHANNEL_AFFINE,
+                std::invalid_argument)
+    << "[Quantizer::quantize] Output tensor is not per channel quantized.";
+
+  NNTR_THROW_IF(input.size() != output.size(), std::invalid_argument)
+    << "[Quantizer::quantize] Tensor size does not match.";
+
+  NNTR_THROW_IF(output.getFormat() != Tformat::NCHW, std::invalid_argument)
+    << "[Quantizer::quantize] Per channel quantization needs NCHW format.";
+
+  const size_t channels = output.scale_size();
+  NNTR_THROW_IF(scales == nullptr ||
+                  std::any_of(scales, scales + channels,
+                              [](float scale) {
+                                return std::fpclassify(scale) == FP_ZERO;
+                              }),
+                std::invalid_argument)
+    << "[Quantizer::quantize] Output scale factor is invalid.";
+
+  if (hasZeroPoint(output.getDataType())) {
+    NNTR_THROW_IF(zero_points == nullptr, std::invalid_argument)
+      << "[Quantizer::quantize] Output zero point is invalid.";
+  }
+
+  calculateMinMaxValue(output.getDataType());
+
+  QParams p = makeQParams(output.getDim(), output.getDataType(),
+                          QScheme::PER_CHANNEL_AFFINE, scales, zero_points);
+  quantizeTensor(input, output, p, quant_min, quant_max);
+
+  std::memcpy(output.getScale<float>(), scales, channels * sizeof(float));
+
+  if (hasZeroPoint(output.getDataType())) {
+    std::memcpy(output.getZeroPoint(), zero_points,
+                channels * sizeof(unsigned int));
+  }
+
   return output;
 }
 
 Tensor PerChannelAffineQuantizer::dequantize(const Tensor &input,
                                              Tdatatype dtype) {
-  /// @todo NYI
-  return input;
+  return dequantizeTensor(input, dtype);
 }
 
 QScheme PerChannelAffineQuantizer::qscheme() const {
@@ -15,6 +15,7 @@
 #include <memory>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 #include <tensor_dim.h>
 
@@ -240,6 +241,9 @@ private:
  * @note PerChannelAffineQuantizer is similar to PerTensorAffineQuantizer, but
  * it has separate scale and zero_point parameters for each channel. This allows
  * for more precise quantization of different channels within the same tensor.
+ * A channel is a column for QINT8, UINT8 and UINT16 and a row for QINT4 and
+ * QINT16, following Tensor::scale_size(). Signed types are quantized
+ * symmetrically and unsigned types get a zero point.
  *
  */
 class PerChannelAffineQuantizer : public UniformQuantizer {
@@ -247,12 +251,7 @@ public:
   /**
    * @brief Basic Constructor of a PerChannelAffineQuantizer
    */
-  PerChannelAffineQuantizer() :
-    UniformQuantizer(),
-    scales(nullptr),
-    zero_points(nullptr),
-    quant_min(0),
-    quant_max(0) {}
+  PerChannelAffineQuantizer() : UniformQuantizer() {}
 
   /**
    * @copydoc Quantizer::create()
@@ -284,17 +283,15 @@ public:
   QScheme qscheme() const override;
 
 private:
-  float *scales;
-  int *zero_points;
-  long int quant_min = 0;
-  long int quant_max = 0;
+  std::vector<float> scales;
+  std::vector<unsigned int> zero_points;
 
   /**
    * @copydoc Quantizer::calculateQParams(const Tensor &input,
    * ml::train::TensorDim::DataType qtype)
    */
   void calculateQParams(const Tensor &input,
-                        ml::train::TensorDim::DataType qtype) override {}
+                        ml::train::TensorDim::DataType qtype) override;
 };
 
 /**
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   random_stream.cpp
+ * @date   17 Oct 2026
+ * @brief  Counter based random stream for tensor initialization and masks
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+#include <algorithm>
+#include <cmath>
+
+#include <cpu_backend.h>
+#include <nntr_thread_pool.h>
+#include <random_stream.h>
+
+namespace nntrainer {
+
+namespace {
+
+/**
+ * @brief elements generated by one task. Multiple of 32 so that a chunk
+ * starts on a counter block and on a mask word.
+ */
+constexpr size_t CHUNK = 1 << 16;
+
+/**
+ * @brief run @a fn(start, n) over [0, len) in chunks of CHUNK elements
+ */
+template <typename Fn> void forEachChunk(size_t len, Fn &&fn) {
+  const size_t chunks = (len + CHUNK - 1) / CHUNK;
+  if (chunks <= 1) {
+    if (len)
+      fn(0, len);
+    return;
+  }
+
+  ThreadPool::Global().parallelFor(
+    0, chunks, 1, [&](unsigned int begin, unsigned int end, unsigned int) {
+      for (size_t c = begin; c < end; ++c) {
+        const size_t start = c * CHUNK;
+        fn(start, std::min(CHUNK, len - start));
+      }
+    });
+}
+
+/**
+ * @brief Box-Muller transform of the uniform pair (u1, u2) in [0, 1)
+ */
+inline void boxMuller(float &u1, float &u2, float mean, float stddev) {
+  constexpr float TWO_PI = 6.28318530717958647692f;
+  /// 1 - u1 is in (0, 1], so the logarithm is finite
+  const float r = stddev * std::sqrt(-2.0f * std::log(1.0f - u1));
+  const float theta = TWO_PI * u2;
+  u1 = mean + r * std::cos(theta);
+  u2 = mean + r * std::sin(theta);
+}
+
+} // namespace
+
+RandomStream &RandomStream::Global() {
+  static RandomStream stream;
+  return stream;
+}
+
+void RandomStream::setSeed(uint64_t seed_) {
+  seed = seed_;
+  counter = 0;
+}
+
+uint64_t RandomStream::reserve(size_t len) {
+  return counter.fetch_add((len + 3) / 4);
+}
+
+void RandomStream::uniform(size_t len, float *X, float min, float max) {
+  const uint64_t key = seed;
+  const uint64_t offset = reserve(len);
+
+  forEachChunk(len, [&](size_t start, size_t n) {
+    philox_uniform(n, key, offset + start / 4, X + start, min, max);
+  });
+}
+
+void RandomStream::normal(size_t len, float *X, float mean, float stddev) {
+  const uint64_t key = seed;
+  /// one more element for the pair of an odd last element
+  const uint64_t offset = reserve(len + 1);
+
+  forEachChunk(len, [&](size_t start, size_t n) {
+    float *x = X + start;
+    philox_uniform(n, key, offset + start / 4, x, 0.0f, 1.0f);
+
+    size_t i = 0;
+    for (; i + 1 < n; i += 2)
+      boxMuller(x[i], x[i + 1], mean, stddev);
+
+    if (i < n) {
+      /// only the last chunk of an odd length, the pair is in the same block
+      const size_t last = start + i;
+      float block[4];
+      philox_uniform(4, key, offset + last / 4, block, 0.0f, 1.0f);
+      boxMuller(block[last % 4], block[last % 4 + 1], mean, stddev);
+      x[i] = block[last % 4];
+    }
+  });
+}
+
+void RandomStream::bernoulli(size_t len, float *X, float p) {
+  const uint64_t key = seed;
+  const uint64_t offset = reserve(len);
+
+  forEachChunk(len, [&](size_t start, size_t n) {
+    float *x = X + start;
+    philox_uniform(n, key, offset + start / 4, x, 0.0f, 1.0f);
+    for (size_t i = 0; i < n; ++i)
+      x[i] = x[i] < p ? 1.0f : 0.0f;
+  });
+}
+
+void RandomStream::bitmask(size_t len, uint32_t *X, float p) {
+  const uint64_t key = seed;
+  const uint64_t offset = reserve(len);
+
+  forEachChunk(len, [&](size_t start, size_t n) {
+    philox_bernoulli(n, key, offset + start / 4, p, X + start / 32);
+  });
+}
+
+} // namespace nntrainer
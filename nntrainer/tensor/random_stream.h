@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   random_stream.h
+ * @date   17 Oct 2026
+ * @brief  Counter based random stream for tensor initialization and masks
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+#ifndef __RANDOM_STREAM_H__
+#define __RANDOM_STREAM_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace nntrainer {
+
+/**
+ * @class   RandomStream
+ * @brief   process-wide Philox4x32-10 stream. Every request reserves a range
+ * of counter blocks and element i of the request is a pure function of
+ * (seed, first block, i), so a request can be generated by any number of
+ * threads and with simd without changing its values.
+ */
+class RandomStream {
+public:
+  /**
+   * @brief stream shared by all tensors
+   */
+  static RandomStream &Global();
+
+  /**
+   * @brief Construct a new Random Stream object
+   *
+   * @param seed key of the stream
+   */
+  explicit RandomStream(uint64_t seed = 0) : seed(seed), counter(0) {}
+
+  /**
+   * @brief set the key of the stream and restart it
+   *
+   * @param seed key of the stream
+   */
+  void setSeed(uint64_t seed);
+
+  /**
+   * @brief fill @a X with uniform samples in [min, max)
+   *
+   * @param len number of elements
+   * @param X output
+   * @param min lower bound
+   * @param max upper bound
+   */
+  void uniform(size_t len, float *X, float min, float max);
+
+  /**
+   * @brief fill @a X with normal samples (Box-Muller)
+   *
+   * @param len number of elements
+   * @param X output
+   * @param mean mean
+   * @param stddev standard deviation
+   */
+  void normal(size_t len, float *X, float mean, float stddev);
+
+  /**
+   * @brief fill @a X with 1 with probability @a p, 0 otherwise
+   *
+   * @param len number of elements
+   * @param X output
+   * @param p probability of 1
+   */
+  void bernoulli(size_t len, float *X, float p);
+
+  /**
+   * @brief fill @a X with packed bernoulli samples, bit i % 32 of
+   * X[i / 32] is set with probability @a p
+   *
+   * @param len number of bits, X holds (len + 31) / 32 words
+   * @param X output
+   * @param p probability of a set bit
+   */
+  void bitmask(size_t len, uint32_t *X, float p);
+
+private:
+  /**
+   * @brief reserve the counter blocks of @a len elements
+   *
+   * @param len number of elements
+   * @return uint64_t first block of the reservation
+   */
+  uint64_t reserve(size_t len);
+
+  std::atomic<uint64_t> seed;    /**< key of the stream */
+  std::atomic<uint64_t> counter; /**< next free block */
+};
+
+} // namespace nntrainer
+
+#endif /* __RANDOM_STREAM_H__ */
@@ -11,7 +11,9 @@
  *
  */
 
+#include <algorithm>
 #include <cstring>
+#include <exception>
 #include <fcntl.h>
 #include <malloc.h>
 #include <profiler.h>
@@ -24,11 +26,128 @@
 
 namespace nntrainer {
 
+namespace {
+
+/**
+ * @brief get page size of the system
+ */
+size_t pageSize() {
+#if defined(_WIN32)
+  return 4096;
+#else
+  static const size_t page_size = sysconf(_SC_PAGE_SIZE);
+  return page_size;
+#endif
+}
+
+} // namespace
+
+SwapBufferArena::~SwapBufferArena() {
+  trim();
+  for (auto &[ptr, size] : in_use)
+    unmap(ptr, size);
+}
+
+void *SwapBufferArena::map(size_t size) {
+#if defined(_WIN32)
+  void *ptr = _aligned_malloc(size, pageSize());
+  NNTR_THROW_IF(ptr == nullptr, std::runtime_error)
+    << "SwapBufferArena: memory alloc failed";
+#else
+  void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  const size_t error_buflen = 100;
+  char error_buf[error_buflen];
+  NNTR_THROW_IF(ptr == MAP_FAILED, std::runtime_error)
+    << "SwapBufferArena: mmap: "
+    << SAFE_STRERROR(errno, error_buf, error_buflen);
+
+  /** pinning is best effort, it is limited by RLIMIT_MEMLOCK */
+  if (mlock(ptr, size) != 0)
+    ml_logd("SwapBufferArena: buffer is not pinned");
+#endif
+  return ptr;
+}
+
+void SwapBufferArena::unmap(void *ptr, size_t size) {
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  munmap(ptr, size);
+#endif
+}
+
+void *SwapBufferArena::alloc(size_t size) {
+  const size_t page_size = pageSize();
+  size = std::max((size + page_size - 1) / page_size * page_size, page_size);
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  /** reuse the smallest free block which does not waste more than half */
+  auto found = free_blocks.lower_bound(size);
+  if (found != free_blocks.end() && found->first <= size * 2) {
+    auto [block_size, ptr] = *found;
+    free_blocks.erase(found);
+    free_bytes -= block_size;
+    in_use_bytes += block_size;
+    peak_bytes = std::max(peak_bytes, in_use_bytes);
+    in_use[ptr] = block_size;
+    return ptr;
+  }
+
+  in_use_bytes += size;
+  peak_bytes = std::max(peak_bytes, in_use_bytes);
+
+  /** drop free blocks not to hold more than the peak in use */
+  while (!free_blocks.empty() && in_use_bytes + free_bytes > peak_bytes) {
+    auto largest = std::prev(free_blocks.end());
+    unmap(largest->second, largest->first);
+    free_bytes -= largest->first;
+    free_blocks.erase(largest);
+  }
+
+  void *ptr;
+  try {
+    ptr = map(size);
+  } catch (...) {
+    in_use_bytes -= size;
+    throw;
+  }
+  in_use[ptr] = size;
+
+  return ptr;
+}
+
+void SwapBufferArena::release(void *ptr) {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto found = in_use.find(ptr);
+  NNTR_THROW_IF(found == in_use.end(), std::invalid_argument)
+    << "SwapBufferArena: Couldn't find buffer";
+
+  size_t size = found->second;
+  in_use.erase(found);
+  in_use_bytes -= size;
+  free_blocks.emplace(size, ptr);
+  free_bytes += size;
+}
+
+void SwapBufferArena::trim() {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  for (auto &[size, ptr] : free_blocks)
+    unmap(ptr, size);
+  free_blocks.clear();
+  free_bytes = 0;
+  peak_bytes = in_use_bytes;
+}
+
 void SwapDevice::start(size_t size) {
   if (fd > 0)
     return;
 
-  fd = open(dev_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_SYNC, 0666UL);
+  /** the file is scratch space, it does not need to be synced to the disk */
+  fd = open(dev_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666UL);
   NNTR_THROW_IF(fd < 0, std::runtime_error)
     << "SwapDevice: open file: " << dev_path;
 
@@ -47,125 +166,228 @@ void SwapDevice::start(size_t size) {
   off = lseek(fd, 0, SEEK_SET);
   NNTR_THROW_IF(off < 0, std::runtime_error)
     << "SwapDevice: seek file: " << dev_path;
+
+  if (!engine)
+    engine = SwapIOEngine::create(num_io_threads);
 }
 
 void *SwapDevice::getBuffer(off_t offset, size_t size, bool alloc_only) {
   NNTR_THROW_IF(fd <= 0, std::runtime_error)
     << "SwapDevice: Device is not started";
 
-#ifdef USE_MMAP
-  // page aligned
-  size_t off = (offset / sysconf(_SC_PAGE_SIZE)) * sysconf(_SC_PAGE_SIZE);
-  size_t diff = offset - off;
-  size_t len = size + diff;
+  void *ptr = arena.alloc(size);
+  if (alloc_only)
+    std::memset(ptr, 0, size);
 
-  char *ptr = static_cast<char *>(
-    mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, off));
-  const size_t error_buflen = 100;
-  char error_buf[error_buflen];
-  NNTR_THROW_IF(ptr == (void *)-1, std::runtime_error)
-    << "SwapDevice: mmap: "
-    << std::string(strerror_r(errno, error_buf, error_buflen));
+  std::unique_lock<std::mutex> lock(mutex);
+  allocated[ptr] = std::make_pair(offset, (ssize_t)size);
+  ++num_loaded_tensors;
 
-  void *buf = static_cast<void *>(ptr + diff);
-  mapped[buf] = std::make_tuple(ptr, len, offset, (ssize_t)size);
+  if (!alloc_only) {
+    if (tier) {
+      if (tier->load(offset, size, ptr)) {
+        tier_load_bytes += size;
+        return ptr;
+      }
+      /** the range is kept with another layout, the file has to be updated */
+      spill(lock, tier->take(offset, size));
+    }
+
+    read_bytes += size;
+    settle(lock, offset, size);
+    enqueue(lock, {SwapIORequest::Op::READ, fd, ptr, size, offset});
+  }
 
-  ++num_loaded_tensors;
+  return ptr;
+}
 
-  return buf;
-#else
-  off_t off;
-  ssize_t len;
-  void *ptr;
+void SwapDevice::putBuffer(void *ptr, bool dealloc_only, SwapCodec codec) {
+  NNTR_THROW_IF(fd <= 0, std::runtime_error)
+    << "SwapDevice: Device is not started";
 
-  ptr = calloc(1, size);
-  NNTR_THROW_IF(ptr == NULL, std::runtime_error)
-    << "SwapDevice: memory alloc failed";
+  std::unique_lock<std::mutex> lock(mutex);
 
-  if (!alloc_only) {
-    off = lseek(fd, offset, SEEK_SET);
-    NNTR_THROW_IF(off < 0, std::runtime_error)
-      << "SwapDevice: seek file: " << dev_path;
+  auto found = allocated.find(ptr);
+  NNTR_THROW_IF(found == allocated.end(), std::invalid_argument)
+    << "SwapDevice: Couldn't find buffer";
 
-    len = read(fd, ptr, size);
-    NNTR_THROW_IF(len != (size_t)size, std::runtime_error)
-      << "SwapDevice: read file: " << dev_path;
-  }
+  auto [offset, size] = found->second;
 
-  allocated[ptr] = std::make_pair(offset, (ssize_t)size);
+  /** the buffer may still be read, or the range written by others */
+  settle(lock, offset, size);
 
-  ++num_loaded_tensors;
+  allocated.erase(ptr);
+  --num_loaded_tensors;
 
-  return ptr;
-#endif
+  if (dealloc_only) {
+    lock.unlock();
+    arena.release(ptr);
+    return;
+  }
+
+  if (tier) {
+    /** blocks sticking out of the range keep the rest of their data */
+    std::vector<CompressedBlock> partial;
+    for (auto &block : tier->take(offset, size))
+      if (block.offset < offset ||
+          block.offset + static_cast<off_t>(block.len) > offset + size)
+        partial.push_back(std::move(block));
+    if (!partial.empty()) {
+      spill(lock, std::move(partial));
+      settle(lock, offset, size);
+    }
+
+    if (tier->store(offset, ptr, size, codec)) {
+      tier_store_bytes += size;
+      arena.release(ptr);
+      spill(lock, tier->spill());
+      return;
+    }
+  }
+
+  write_bytes += size;
+  enqueue(lock, {SwapIORequest::Op::WRITE, fd, ptr, static_cast<size_t>(size),
+                 offset});
 }
 
-void SwapDevice::putBuffer(void *ptr, bool dealloc_only) {
-  NNTR_THROW_IF(fd <= 0, std::runtime_error)
-    << "SwapDevice: Device is not started";
-#ifdef USE_MMAP
-  int ret;
+void SwapDevice::setCompressedTier(size_t budget) {
+  std::unique_lock<std::mutex> lock(mutex);
 
-  NNTR_THROW_IF(mapped.find(ptr) == mapped.end(), std::runtime_error)
-    << "Couldn't find buffer";
+  /** data kept by the previous tier is moved to the swap file */
+  if (tier) {
+    spill(lock, tier->takeAll());
+    tier.reset();
+  }
 
-  off_t off;
-  ssize_t len;
+  if (budget > 0)
+    tier = std::make_unique<CompressedSwapTier>(budget);
+}
+
+void SwapDevice::beginBatch() {
+  std::lock_guard<std::mutex> lock(mutex);
+  batch_threads.insert(std::this_thread::get_id());
+}
 
-  auto info = mapped[ptr];
-  if (!dealloc_only) {
-    off = lseek(fd, std::get<2>(info), SEEK_SET);
-    NNTR_THROW_IF(off < 0, std::runtime_error)
-      << "SwapDevice: seek file: " << dev_path;
-
-    ssize_t size = std::get<3>(info);
-    len = write(fd, ptr, size);
-    NNTR_THROW_IF(len != size, std::runtime_error)
-      << "SwapDevice: write file: " << len << "::" << std::to_string(size)
-      << dev_path;
+void SwapDevice::submitBatch() {
+  std::unique_lock<std::mutex> lock(mutex);
+  auto id = std::this_thread::get_id();
+  batch_threads.erase(id);
+
+  std::vector<std::list<PendingIO>::iterator> batch;
+  std::vector<SwapIORequest> reqs;
+  for (auto it = pending.begin(); it != pending.end(); ++it) {
+    if (it->owner == id && !it->submitted) {
+      it->submitted = true;
+      batch.push_back(it);
+      reqs.push_back(it->req);
+    }
   }
+  lock.unlock();
 
-  ret = munmap(std::get<void *>(info), std::get<size_t>(info));
-  const size_t error_buflen = 100;
-  char error_buf[error_buflen];
-  NNTR_THROW_IF(ret == -1, std::runtime_error)
-    << "SwapDevice: munmap: "
-    << std::string(strerror_r(errno, error_buf, error_buflen));
+  if (reqs.empty())
+    return;
 
-  mapped.erase(ptr);
+  std::exception_ptr error;
+  try {
+    engine->submit(reqs);
+  } catch (...) {
+    error = std::current_exception();
+  }
 
-#ifndef __ANDROID__
-  madvise(std::get<void *>(info), std::get<size_t>(info), MADV_FREE);
-#endif
+  lock.lock();
+  for (auto &it : batch)
+    pending.erase(it);
+  lock.unlock();
+  io_done.notify_all();
 
-#else
-  off_t off;
-  ssize_t len;
+  for (auto &req : reqs)
+    if (req.op == SwapIORequest::Op::WRITE)
+      arena.release(req.buf);
 
-  NNTR_THROW_IF(allocated.find(ptr) == allocated.end(), std::invalid_argument)
-    << "SwapDevice: Couldn't find buffer";
+  if (error)
+    std::rethrow_exception(error);
+}
 
-  auto [offset, size] = allocated[ptr];
+void SwapDevice::enqueue(std::unique_lock<std::mutex> &lock,
+                         const SwapIORequest &req) {
+  auto id = std::this_thread::get_id();
+  bool batched = batch_threads.find(id) != batch_threads.end();
 
-  if (!dealloc_only) {
-    off = lseek(fd, offset, SEEK_SET);
-    NNTR_THROW_IF(off < 0, std::runtime_error)
-      << "SwapDevice: seek file: " << dev_path;
+  pending.push_back({id, !batched, req});
+  if (batched)
+    return;
+
+  auto it = std::prev(pending.end());
+  lock.unlock();
 
-    len = write(fd, ptr, size);
-    NNTR_THROW_IF(len != size, std::runtime_error)
-      << "SwapDevice: write file: " << dev_path;
+  std::exception_ptr error;
+  try {
+    engine->submit({req});
+  } catch (...) {
+    error = std::current_exception();
   }
 
-  free(ptr);
-  allocated.erase(ptr);
+  lock.lock();
+  pending.erase(it);
+  io_done.notify_all();
 
-#if !defined(__ANDROID__) && !defined(_WIN32)
-  malloc_trim(0);
-#endif
+  if (req.op == SwapIORequest::Op::WRITE)
+    arena.release(req.buf);
 
-#endif
-  --num_loaded_tensors;
+  if (error)
+    std::rethrow_exception(error);
+}
+
+void SwapDevice::settle(std::unique_lock<std::mutex> &lock, off_t offset,
+                        size_t size) {
+  auto overlaps = [offset, size](const PendingIO &io) {
+    return io.req.offset < offset + static_cast<off_t>(size) &&
+           offset < io.req.offset + static_cast<off_t>(io.req.len);
+  };
+
+  while (true) {
+    auto it = std::find_if(pending.begin(), pending.end(), overlaps);
+    if (it == pending.end())
+      return;
+
+    if (it->submitted) {
+      io_done.wait(lock);
+      continue;
+    }
+
+    /** take the request out of its batch and run it here */
+    it->submitted = true;
+    SwapIORequest req = it->req;
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+      SwapIOEngine::execute(req);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    pending.erase(it);
+    io_done.notify_all();
+
+    if (req.op == SwapIORequest::Op::WRITE)
+      arena.release(req.buf);
+
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+void SwapDevice::spill(std::unique_lock<std::mutex> &lock,
+                       std::vector<CompressedBlock> blocks) {
+  for (const auto &block : blocks) {
+    void *buf = arena.alloc(block.len);
+    CompressedSwapTier::decode(block, buf);
+
+    write_bytes += block.len;
+    enqueue(lock, {SwapIORequest::Op::WRITE, fd, buf, block.len, block.offset});
+  }
 }
 
 unsigned int SwapDevice::getNumLoadedTensors() { return num_loaded_tensors; }
@@ -178,15 +400,29 @@ void SwapDevice::finish() {
   if (fd < 0)
     return;
 
-#ifdef USE_MMAP
-  for (auto &[ptr, info] : mapped)
-    free(ptr);
-  mapped.clear();
-#else
-  for (auto &alloc : allocated)
-    free(alloc.first);
-  allocated.clear();
-#endif
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    io_done.wait(lock, [this] {
+      return std::none_of(pending.begin(), pending.end(),
+                          [](const PendingIO &io) { return io.submitted; });
+    });
+
+    /** requests of batches which are never submitted are dropped */
+    for (auto &io : pending)
+      if (io.req.op == SwapIORequest::Op::WRITE)
+        arena.release(io.req.buf);
+    pending.clear();
+    batch_threads.clear();
+
+    for (auto &alloc : allocated)
+      arena.release(alloc.first);
+    allocated.clear();
+    num_loaded_tensors = 0;
+
+    if (tier)
+      tier->takeAll();
+  }
+  arena.trim();
 
   close(fd);
   fd = -1;
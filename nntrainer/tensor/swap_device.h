@@ -14,35 +14,110 @@
 #ifndef __SWAP_DEVICE_H__
 #define __SWAP_DEVICE_H__
 
+#include <atomic>
 #include <fcntl.h>
+#include <condition_variable>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <system_error>
+#include <thread>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #if defined(_WIN32)
 #include <io.h>
-#define O_SYNC 0UL
 #else
 #include <sys/mman.h>
 #include <unistd.h>
 #endif
 
+#include <compressed_swap_tier.h>
+#include <swap_io_engine.h>
+
 #if defined(_WIN32)
 using ssize_t = std::make_signed_t<size_t>;
 #endif
 
 namespace nntrainer {
 
+/**
+ * @class   SwapBufferArena
+ * @brief   Page aligned buffers for swapped in tensors. Released buffers are
+ * kept and handed out again, and the arena never holds more than the peak
+ * of the bytes in use at the same time.
+ */
+class SwapBufferArena {
+public:
+  /**
+   * @brief SwapBufferArena destructor
+   *
+   */
+  ~SwapBufferArena();
+
+  /**
+   * @brief Get a buffer of at least @a size bytes
+   *
+   * @param size requested size
+   * @return page aligned buffer
+   */
+  void *alloc(size_t size);
+
+  /**
+   * @brief Give a buffer back to the arena
+   *
+   * @param ptr buffer obtained from alloc
+   */
+  void release(void *ptr);
+
+  /**
+   * @brief Return every released buffer to the system
+   *
+   */
+  void trim();
+
+private:
+  /**
+   * @brief map a new block, pinned if allowed
+   */
+  static void *map(size_t size);
+
+  /**
+   * @brief unmap a block
+   */
+  static void unmap(void *ptr, size_t size);
+
+  std::mutex mutex;                          /**< protect the arena */
+  std::multimap<size_t, void *> free_blocks; /**< <size, block> */
+  std::map<void *, size_t> in_use;           /**< <block, size> */
+  size_t free_bytes = 0;                     /**< bytes in free_blocks */
+  size_t in_use_bytes = 0;                   /**< bytes in in_use */
+  size_t peak_bytes = 0;                     /**< peak of in_use_bytes */
+};
+
 /**
  * @class   SwapDevice
  * @brief   A device used to storing data with long access time
  */
 class SwapDevice {
 public:
+  /**
+   * @brief bytes moved by the device
+   *
+   */
+  struct Stats {
+    size_t read_bytes;       /**< bytes read from the swap file */
+    size_t write_bytes;      /**< bytes written to the swap file */
+    size_t clean_bytes;      /**< bytes dropped without write back as clean */
+    size_t tier_store_bytes; /**< bytes kept by the compressed tier */
+    size_t tier_load_bytes;  /**< bytes loaded from the compressed tier */
+  };
+
   /**
    * @brief swap device default path
    *
@@ -85,6 +160,8 @@ public:
    * @param alloc_only only allocate buffer without reading data
    *
    * @return The pointer of the swap space
+   * @note if a batch is open on the calling thread, the data is valid only
+   * after submitBatch()
    *
    */
   void *getBuffer(off_t offset, size_t size, bool alloc_only = false);
@@ -94,8 +171,36 @@ public:
    *
    * @param ptr The pointer obtained from getBuffer
    * @param dealloc_only only deallocate buffer without writing data
+   * @param codec codec to keep the data in the compressed tier with. The data
+   * is written to the swap file if it is NONE, there is no tier, or the data
+   * does not compress well.
+   * @note if a batch is open on the calling thread, the write is deferred to
+   * submitBatch()
+   */
+  void putBuffer(void *ptr, bool dealloc_only = false,
+                 SwapCodec codec = SwapCodec::NONE);
+
+  /**
+   * @brief Keep swapped out data compressed in memory before the swap file.
+   * Least recently used data is spilled to the swap file over the budget.
+   *
+   * @param budget bytes of compressed data to keep, 0 to disable the tier
+   */
+  void setCompressedTier(size_t budget);
+
+  /**
+   * @brief Collect the I/O of following getBuffer/putBuffer calls of the
+   * calling thread instead of running them one by one
+   *
+   */
+  void beginBatch();
+
+  /**
+   * @brief Run the I/O collected since beginBatch() as a single batch and
+   * wait for its completion
+   *
    */
-  void putBuffer(void *ptr, bool dealloc_only = false);
+  void submitBatch();
 
   /**
    * @brief Close device
@@ -126,18 +231,101 @@ public:
    */
   unsigned int getNumLoadedTensors();
 
+  /**
+   * @brief Count a buffer which is dropped without write back as it is clean
+   *
+   * @param size size of the buffer
+   */
+  void addCleanBytes(size_t size) { clean_bytes += size; }
+
+  /**
+   * @brief Get bytes moved since the last resetStats()
+   *
+   * @return Stats stats of the device
+   */
+  Stats getStats() const {
+    return {read_bytes.load(), write_bytes.load(), clean_bytes.load(),
+            tier_store_bytes.load(), tier_load_bytes.load()};
+  }
+
+  /**
+   * @brief Reset stats of the device
+   *
+   */
+  void resetStats() {
+    read_bytes = 0;
+    write_bytes = 0;
+    clean_bytes = 0;
+    tier_store_bytes = 0;
+    tier_load_bytes = 0;
+  }
+
+  /**
+   * @brief number of threads of the pread/pwrite backend
+   *
+   */
+  static constexpr unsigned int num_io_threads = 4;
+
 private:
+  /**
+   * @brief request which is queued to a batch or being run
+   */
+  struct PendingIO {
+    std::thread::id owner; /**< thread which issued the request */
+    bool submitted;        /**< true if the request is being run */
+    SwapIORequest req;     /**< request */
+  };
+
+  /**
+   * @brief run @a req now, or queue it to the open batch of this thread
+   *
+   * @param lock locked device mutex
+   * @param req request to run
+   */
+  void enqueue(std::unique_lock<std::mutex> &lock, const SwapIORequest &req);
+
+  /**
+   * @brief finish every pending request overlapping [offset, offset + size)
+   * of the swap file. Queued requests are run on the calling thread, and
+   * running ones are waited for.
+   *
+   * @param lock locked device mutex
+   * @param offset offset of the range
+   * @param size size of the range
+   */
+  void settle(std::unique_lock<std::mutex> &lock, off_t offset, size_t size);
+
+  /**
+   * @brief write blocks taken out of the compressed tier to the swap file
+   *
+   * @param lock locked device mutex
+   * @param blocks blocks to write
+   */
+  void spill(std::unique_lock<std::mutex> &lock,
+             std::vector<CompressedBlock> blocks);
+
   const std::string dev_path; /**< device path */
   int fd;                     /**< device file description */
 
+  std::mutex mutex; /**< protect the members below */
   unsigned int num_loaded_tensors;
-#ifdef USE_MMAP
-  std::map<void *, std::tuple<void *, size_t, off_t, ssize_t>>
-    mapped; /**< <pointer, <orig_pointer, size, offset, origianl size>> */
-#else
   std::map<void *, std::pair<off_t, ssize_t>>
     allocated; /**< <pointer, <offset, size>> */
-#endif
+  std::condition_variable io_done; /**< notified when requests finish */
+  std::list<PendingIO> pending;    /**< queued or running requests */
+  std::unordered_set<std::thread::id>
+    batch_threads; /**< threads with an open batch */
+
+  std::atomic<size_t> read_bytes = 0;       /**< bytes read */
+  std::atomic<size_t> write_bytes = 0;      /**< bytes written */
+  std::atomic<size_t> clean_bytes = 0;      /**< bytes dropped as clean */
+  std::atomic<size_t> tier_store_bytes = 0; /**< bytes kept by tier */
+  std::atomic<size_t> tier_load_bytes = 0;  /**< bytes loaded from tier */
+
+  SwapBufferArena arena;                /**< buffers of loaded tensors */
+  std::unique_ptr<SwapIOEngine> engine; /**< I/O engine */
+  std::unique_ptr<CompressedSwapTier>
+    tier; /**< compressed tier, no blocks overlap a pending request */
 };
 
 } // namespace nntrainer
@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   swap_io_engine.cpp
+ * @date   17 Oct 2026
+ * @brief  Batched I/O engine for the swap device
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <string>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef USE_LIBURING
+#include <liburing.h>
+#endif
+
+#include <nntrainer_error.h>
+#include <nntrainer_log.h>
+#include <swap_io_engine.h>
+
+namespace nntrainer {
+
+namespace {
+
+#if defined(_WIN32)
+std::mutex seek_mutex; /**< lseek and read/write are not atomic on windows */
+
+ssize_t preadFd(int fd, void *buf, size_t len, off_t offset) {
+  std::lock_guard<std::mutex> lock(seek_mutex);
+  if (_lseeki64(fd, offset, SEEK_SET) < 0)
+    return -1;
+  return _read(fd, buf, static_cast<unsigned int>(len));
+}
+
+ssize_t pwriteFd(int fd, const void *buf, size_t len, off_t offset) {
+  std::lock_guard<std::mutex> lock(seek_mutex);
+  if (_lseeki64(fd, offset, SEEK_SET) < 0)
+    return -1;
+  return _write(fd, buf, static_cast<unsigned int>(len));
+}
+#else
+ssize_t preadFd(int fd, void *buf, size_t len, off_t offset) {
+  return pread(fd, buf, len, offset);
+}
+
+ssize_t pwriteFd(int fd, const void *buf, size_t len, off_t offset) {
+  return pwrite(fd, buf, len, offset);
+}
+#endif
+
+} // namespace
+
+void SwapIOEngine::execute(const SwapIORequest &req) {
+  char *buf = static_cast<char *>(req.buf);
+  size_t done = 0;
+
+  while (done < req.len) {
+    ssize_t ret = req.op == SwapIORequest::Op::READ
+                    ? preadFd(req.fd, buf + done, req.len - done,
+                              req.offset + static_cast<off_t>(done))
+                    : pwriteFd(req.fd, buf + done, req.len - done,
+                               req.offset + static_cast<off_t>(done));
+    if (ret < 0 && errno == EINTR)
+      continue;
+
+    const size_t error_buflen = 100;
+    char error_buf[error_buflen];
+    NNTR_THROW_IF(ret < 0, std::runtime_error)
+      << "SwapIOEngine: "
+      << (req.op == SwapIORequest::Op::READ ? "read" : "write")
+      << " failed: " << SAFE_STRERROR(errno, error_buf, error_buflen);
+    NNTR_THROW_IF(ret == 0, std::runtime_error)
+      << "SwapIOEngine: unexpected end of file at "
+      << req.offset + static_cast<off_t>(done);
+
+    done += static_cast<size_t>(ret);
+  }
+}
+
+void SwapIOEngine::submit(const std::vector<SwapIORequest> &reqs) {
+  if (reqs.empty())
+    return;
+
+  std::vector<SwapIORequest> segs;
+  segs.reserve(reqs.size());
+  for (auto &req : reqs) {
+    for (size_t off = 0; off < req.len; off += max_segment_size) {
+      size_t len = std::min(max_segment_size, req.len - off);
+      segs.push_back({req.op, req.fd, static_cast<char *>(req.buf) + off, len,
+                      req.offset + static_cast<off_t>(off)});
+    }
+  }
+
+  run(segs);
+}
+
+std::unique_ptr<SwapIOEngine> SwapIOEngine::create(unsigned int num_threads) {
+#ifdef USE_LIBURING
+  try {
+    return std::make_unique<IOUringSwapIOEngine>();
+  } catch (std::exception &e) {
+    ml_logw("SwapIOEngine: io_uring is not usable, fall back to pread/pwrite: "
+            "%s",
+            e.what());
+  }
+#endif
+  return std::make_unique<ThreadPoolSwapIOEngine>(num_threads);
+}
+
+ThreadPoolSwapIOEngine::ThreadPoolSwapIOEngine(unsigned int num_threads) :
+  pool(num_threads) {}
+
+void ThreadPoolSwapIOEngine::run(const std::vector<SwapIORequest> &segs) {
+  pool.parallelFor(0, static_cast<unsigned int>(segs.size()), 1,
+                   [&segs](unsigned int s, unsigned int e, unsigned int) {
+                     for (unsigned int i = s; i < e; ++i)
+                       execute(segs[i]);
+                   });
+}
+
+#ifdef USE_LIBURING
+IOUringSwapIOEngine::IOUringSwapIOEngine() :
+  ring(std::make_unique<struct io_uring>()) {
+  int ret = io_uring_queue_init(queue_depth, ring.get(), 0);
+  const size_t error_buflen = 100;
+  char error_buf[error_buflen];
+  NNTR_THROW_IF(ret < 0, std::runtime_error)
+    << "IOUringSwapIOEngine: queue init failed: "
+    << SAFE_STRERROR(-ret, error_buf, error_buflen);
+}
+
+IOUringSwapIOEngine::~IOUringSwapIOEngine() { io_uring_queue_exit(ring.get()); }
+
+void IOUringSwapIOEngine::run(const std::vector<SwapIORequest> &segs) {
+  /** the ring is shared by the load and unload threads of a device */
+  std::lock_guard<std::mutex> lock(ring_mutex);
+
+  size_t next = 0;
+  unsigned int inflight = 0;
+  std::exception_ptr error;
+  const size_t error_buflen = 100;
+  char error_buf[error_buflen];
+
+  while (next < segs.size() || inflight > 0) {
+    while (next < segs.size() && inflight < queue_depth) {
+      struct io_uring_sqe *sqe = io_uring_get_sqe(ring.get());
+      if (sqe == nullptr)
+        break;
+
+      auto &seg = segs[next];
+      if (seg.op == SwapIORequest::Op::READ)
+        io_uring_prep_read(sqe, seg.fd, seg.buf, seg.len, seg.offset);
+      else
+        io_uring_prep_write(sqe, seg.fd, seg.buf, seg.len, seg.offset);
+      io_uring_sqe_set_data(sqe, reinterpret_cast<void *>(next));
+      ++next;
+      ++inflight;
+    }
+
+    int ret = io_uring_submit_and_wait(ring.get(), 1);
+    if (ret < 0 && ret != -EINTR && ret != -EAGAIN && ret != -EBUSY) {
+      /** the kernel may still own the buffers, they can not be released */
+      ml_loge("IOUringSwapIOEngine: submit failed: %s",
+              SAFE_STRERROR(-ret, error_buf, error_buflen));
+      std::terminate();
+    }
+
+    struct io_uring_cqe *cqe;
+    unsigned int head;
+    unsigned int reaped = 0;
+    io_uring_for_each_cqe(ring.get(), head, cqe) {
+      auto &seg = segs[reinterpret_cast<std::uintptr_t>(
+        io_uring_cqe_get_data(cqe))];
+      int res = cqe->res;
+      ++reaped;
+
+      try {
+        NNTR_THROW_IF(res < 0, std::runtime_error)
+          << "IOUringSwapIOEngine: "
+          << (seg.op == SwapIORequest::Op::READ ? "read" : "write")
+          << " failed: " << SAFE_STRERROR(-res, error_buf, error_buflen);
+        /** finish a short transfer on this thread */
+        if (static_cast<size_t>(res) < seg.len)
+          execute({seg.op, seg.fd, static_cast<char *>(seg.buf) + res,
+                   seg.len - res, seg.offset + res});
+      } catch (...) {
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+    io_uring_cq_advance(ring.get(), reaped);
+    inflight -= reaped;
+  }
+
+  if (error)
+    std::rethrow_exception(error);
+}
+#endif
+
+} // namespace nntrainer
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   swap_io_engine.h
+ * @date   17 Oct 2026
+ * @brief  Batched I/O engine for the swap device
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#ifndef __SWAP_IO_ENGINE_H__
+#define __SWAP_IO_ENGINE_H__
+
+#include <memory>
+#include <mutex>
+#include <sys/types.h>
+#include <vector>
+
+#include <nntr_thread_pool.h>
+
+#ifdef USE_LIBURING
+struct io_uring;
+#endif
+
+namespace nntrainer {
+
+/**
+ * @brief a read or write of a contiguous range of the swap file
+ */
+struct SwapIORequest {
+  enum class Op { READ, WRITE };
+
+  Op op;        /**< operation */
+  int fd;       /**< swap file descriptor */
+  void *buf;    /**< memory buffer */
+  size_t len;   /**< length in bytes */
+  off_t offset; /**< offset in the swap file */
+};
+
+/**
+ * @class   SwapIOEngine
+ * @brief   Runs a batch of swap file requests and waits for all of them.
+ * Requests are split into segments so that a large tensor is spread over
+ * the backend as well.
+ */
+class SwapIOEngine {
+public:
+  /**
+   * @brief maximum size of a single segment given to the backend
+   */
+  static constexpr size_t max_segment_size = 8 * 1024 * 1024;
+
+  /**
+   * @brief Destroy the SwapIOEngine
+   */
+  virtual ~SwapIOEngine() = default;
+
+  /**
+   * @brief Create the engine, io_uring if it is available, otherwise a pool
+   * of pread/pwrite workers
+   *
+   * @param num_threads number of threads of the pread/pwrite backend
+   * @return std::unique_ptr<SwapIOEngine> created engine
+   */
+  static std::unique_ptr<SwapIOEngine> create(unsigned int num_threads);
+
+  /**
+   * @brief Run @a reqs and wait for all of them
+   *
+   * @param reqs requests to run
+   * @throw std::runtime_error if any of the requests fails
+   */
+  void submit(const std::vector<SwapIORequest> &reqs);
+
+  /**
+   * @brief Run a single request on the calling thread
+   *
+   * @param req request to run
+   * @throw std::runtime_error if the request fails
+   */
+  static void execute(const SwapIORequest &req);
+
+protected:
+  /**
+   * @brief Run every segment and wait for completion
+   *
+   * @param segs segments not larger than max_segment_size
+   */
+  virtual void run(const std::vector<SwapIORequest> &segs) = 0;
+};
+
+/**
+ * @class   ThreadPoolSwapIOEngine
+ * @brief   pread/pwrite backend, segments are spread over a private pool
+ */
+class ThreadPoolSwapIOEngine : public SwapIOEngine {
+public:
+  /**
+   * @brief Construct a new ThreadPoolSwapIOEngine
+   *
+   * @param num_threads number of threads including the caller
+   */
+  explicit ThreadPoolSwapIOEngine(unsigned int num_threads);
+
+protected:
+  /**
+   * @copydoc SwapIOEngine::run(const std::vector<SwapIORequest> &segs)
+   */
+  void run(const std::vector<SwapIORequest> &segs) override;
+
+private:
+  ThreadPool pool; /**< I/O workers, kept apart from the compute pool */
+};
+
+#ifdef USE_LIBURING
+/**
+ * @class   IOUringSwapIOEngine
+ * @brief   io_uring backend, a batch is submitted with a single syscall per
+ * ring full of segments
+ */
+class IOUringSwapIOEngine : public SwapIOEngine {
+public:
+  /**
+   * @brief queue depth of the ring
+   */
+  static constexpr unsigned int queue_depth = 64;
+
+  /**
+   * @brief Construct a new IOUringSwapIOEngine
+   *
+   * @throw std::runtime_error if the ring can not be created
+   */
+  IOUringSwapIOEngine();
+
+  /**
+   * @brief Destroy the IOUringSwapIOEngine
+   */
+  ~IOUringSwapIOEngine();
+
+protected:
+  /**
+   * @copydoc SwapIOEngine::run(const std::vector<SwapIORequest> &segs)
+   */
+  void run(const std::vector<SwapIORequest> &segs) override;
+
+private:
+  std::unique_ptr<struct io_uring> ring; /**< submission/completion ring */
+  std::mutex ring_mutex;                 /**< protect ring */
+};
+#endif
+
+} // namespace nntrainer
+
+#endif /** __SWAP_IO_ENGINE_H__ */
@@ -16,6 +16,7 @@
 #include <int4_tensor.h>
 #include <lazy_tensor.h>
 #include <short_tensor.h>
+#include <random_stream.h>
 #include <tensor.h>
 #include <uint_tensor.h>
 
@@ -166,17 +167,17 @@ Tensor::Tensor(const TensorDim &d, bool alloc_now, Initializer init,
     throw std::invalid_argument("Error: enable-fp16 is not enabled");
 #endif
   } else if (d.getDataType() == Tdatatype::UINT8) {
-    itensor =
-      std::shared_ptr<UInt8Tensor>(new UInt8Tensor(d, alloc_now, init, name),
-                                   std::default_delete<UInt8Tensor>());
+    itensor = std::shared_ptr<UInt8Tensor>(
+      new UInt8Tensor(d, alloc_now, init, name, qscheme),
+      std::default_delete<UInt8Tensor>());
   } else if (d.getDataType() == Tdatatype::UINT16) {
-    itensor =
-      std::shared_ptr<UInt16Tensor>(new UInt16Tensor(d, alloc_now, init, name),
-                                    std::default_delete<UInt16Tensor>());
+    itensor = std::shared_ptr<UInt16Tensor>(
+      new UInt16Tensor(d, alloc_now, init, name, qscheme),
+      std::default_delete<UInt16Tensor>());
   } else if (d.getDataType() == Tdatatype::UINT32) {
-    itensor =
-      std::shared_ptr<UInt32Tensor>(new UInt32Tensor(d, alloc_now, init, name),
-                                    std::default_delete<UInt32Tensor>());
+    itensor = std::shared_ptr<UInt32Tensor>(
+      new UInt32Tensor(d, alloc_now, init, name, qscheme),
+      std::default_delete<UInt32Tensor>());
   } else if (d.getDataType() == Tdatatype::QINT16) {
     itensor = std::shared_ptr<ShortTensor>(
       new ShortTensor(d, alloc_now, init, name, qscheme),
@@ -220,14 +221,14 @@ Tensor::Tensor(const TensorDim &d, const void *buf, QScheme qscheme) {
     throw std::invalid_argument("Error: enable-fp16 is not enabled");
 #endif
   } else if (d.getDataType() == Tdatatype::UINT8) {
-    itensor = std::shared_ptr<UInt8Tensor>(new UInt8Tensor(d, buf),
+    itensor = std::shared_ptr<UInt8Tensor>(new UInt8Tensor(d, buf, qscheme),
                                            std::default_delete<UInt8Tensor>());
   } else if (d.getDataType() == Tdatatype::UINT16) {
     itensor = std::shared_ptr<UInt16Tensor>(
-      new UInt16Tensor(d, buf), std::default_delete<UInt16Tensor>());
+      new UInt16Tensor(d, buf, qscheme), std::default_delete<UInt16Tensor>());
   } else if (d.getDataType() == Tdatatype::UINT32) {
     itensor = std::shared_ptr<UInt32Tensor>(
-      new UInt32Tensor(d, buf), std::default_delete<UInt32Tensor>());
+      new UInt32Tensor(d, buf, qscheme), std::default_delete<UInt32Tensor>());
   } else if (d.getDataType() == Tdatatype::QINT16) {
     itensor = std::shared_ptr<ShortTensor>(new ShortTensor(d, buf, qscheme),
                                            std::default_delete<ShortTensor>());
@@ -235,7 +236,7 @@ Tensor::Tensor(const TensorDim &d, const void *buf, QScheme qscheme) {
     itensor = std::shared_ptr<CharTensor>(new CharTensor(d, buf, qscheme),
                                           std::default_delete<CharTensor>());
   } else if (d.getDataType() == Tdatatype::QINT4) {
-    itensor = std::shared_ptr<Int4QTensor>(new Int4QTensor(d, buf),
+    itensor = std::shared_ptr<Int4QTensor>(new Int4QTensor(d, buf, qscheme),
                                            std::default_delete<Int4QTensor>());
   } else if (d.getDataType() == Tdatatype::BCQ) {
 #ifdef ENABLE_BIQGEMM
@@ -939,8 +940,18 @@ Tensor &Tensor::dotBatched(Tensor const &m, Tensor &result, bool trans,
   if (!result.isAllocated())
     throw std::invalid_argument(
       "Output tensor must be preallocated for dotBatched operation");
+
+  if (getDataType() == Tdatatype::FP32 || getDataType() == Tdatatype::FP16) {
+    NNTR_THROW_IF(!getContiguous() || !m.getContiguous() ||
+                    !result.getContiguous(),
+                  std::invalid_argument)
+      << getName() << " is not contiguous. Cannot dot product.";
+
+    itensor->dotBatched(m, result, trans, trans_m, beta);
+    return result;
+  }
+
   for (unsigned int b = 0; b < batch(); b++) {
-    /** @todo try using transpose to speedup the operation */
     const Tensor this_b = this->getBatchSlice(b, 1);
     Tensor m_b = m.getBatchSlice(b, 1);
     Tensor result_b = result.getBatchSlice(b, 1);
@@ -1023,6 +1034,54 @@ void Tensor::zoneout_mask(Tensor &opposite, float zoneout) {
   itensor->zoneout_mask(opposite, zoneout);
 }
 
+void Tensor::setRandBitmask(float probability) {
+  NNTR_THROW_IF(getDataType() != Tdatatype::UINT32, std::invalid_argument)
+    << "[Tensor::setRandBitmask] mask should be a UINT32 tensor";
+  NNTR_THROW_IF(!getContiguous(), std::invalid_argument)
+    << "[Tensor::setRandBitmask] mask should be contiguous";
+
+  RandomStream::Global().bitmask(size() * 32, getData<uint32_t>(),
+                                 probability);
+}
+
+/**
+ * @brief check the operands of the packed mask operations
+ */
+static void checkBitmask(const Tensor &input, const Tensor &mask,
+                         const Tensor &output, const char *op) {
+  NNTR_THROW_IF(mask.getDataType() != Tdatatype::UINT32, std::invalid_argument)
+    << "[Tensor::" << op << "] mask should be a UINT32 tensor";
+  NNTR_THROW_IF(mask.batch() != input.batch() ||
+                  mask.getDim().getFeatureLen() * 32 <
+                    input.getDim().getFeatureLen(),
+                std::invalid_argument)
+    << "[Tensor::" << op << "] mask " << mask.getDim()
+    << " is too small for " << input.getDim();
+  NNTR_THROW_IF(output.getDim() != input.getDim(), std::invalid_argument)
+    << "[Tensor::" << op << "] output dimension does not match";
+  NNTR_THROW_IF(!input.getContiguous() || !mask.getContiguous() ||
+                  !output.getContiguous(),
+                std::invalid_argument)
+    << "[Tensor::" << op << "] tensors should be contiguous";
+}
+
+Tensor &Tensor::multiply_bitmask(const Tensor &mask, float on, float off,
+                                 Tensor &output) const {
+  CREATE_IF_EMPTY_DIMS(output, getDim(), nullptr);
+  checkBitmask(*this, mask, output, "multiply_bitmask");
+  return itensor->multiply_bitmask(mask, on, off, output);
+}
+
+Tensor &Tensor::select_bitmask(const Tensor &mask, const Tensor &other,
+                               Tensor &output) const {
+  CREATE_IF_EMPTY_DIMS(output, getDim(), nullptr);
+  checkBitmask(*this, mask, output, "select_bitmask");
+  NNTR_THROW_IF(other.getDim() != getDim() || !other.getContiguous(),
+                std::invalid_argument)
+    << "[Tensor::select_bitmask] other dimension does not match";
+  return itensor->select_bitmask(mask, other, output);
+}
+
 std::vector<Tensor> Tensor::split(unsigned num_size, int axis) {
   NNTR_THROW_IF(num_size == 0, std::invalid_argument)
     << "num size cannot be zero";
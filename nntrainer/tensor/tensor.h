@@ -22,6 +22,8 @@
   } while (0);
 
 #include <cstddef>
+#include <functional>
+#include <type_traits>
 
 #include <cpu_backend.h>
 #include <nntrainer_log.h>
@@ -775,6 +777,75 @@ public:
     return output;
   }
 
+  /**
+   * @brief     Apply an element-wise callable. Unlike the std::function
+   * version, @a f is taken by its own type so that it is inlined into the loop
+   * and the loop can be vectorized for contiguous tensors.
+   * @param[in] f callable which takes and returns T
+   * @param[out] output output tensor
+   * @retval    Tensor
+   */
+  template <typename T = float, typename Func,
+            typename = std::enable_if_t<
+              std::is_invocable_r_v<T, Func, T> &&
+              !std::is_same_v<std::decay_t<Func>, std::function<T(T)>>>>
+  Tensor &apply(Func f, Tensor &output) const {
+    CREATE_IF_EMPTY_DIMS(output, {itensor->getFormat(), itensor->getDataType()},
+                         nullptr);
+
+    Tdatatype type = getDataType();
+    bool is_same_type =
+      (std::is_same_v<T, float> && type == Tdatatype::FP32)
+#ifdef ENABLE_FP16
+      || (std::is_same_v<T, _FP16> && type == Tdatatype::FP16)
+#endif
+      ;
+
+    if (!is_same_type || output.getDataType() != type ||
+        !getContiguous() || !output.getContiguous() || size() != output.size())
+      return apply<T>(std::function<T(T)>(f), output);
+
+    const T *in = getData<T>();
+    T *out = output.getData<T>();
+    size_t len = size();
+    for (size_t i = 0; i < len; ++i)
+      out[i] = f(in[i]);
+
+    return output;
+  }
+
+  /**
+   * @brief     Apply an element-wise callable
+   * @param[in] f callable which takes and returns T
+   * @retval    Tensor
+   */
+  template <typename T = float, typename Func,
+            typename = std::enable_if_t<
+              std::is_invocable_r_v<T, Func, T> &&
+              !std::is_same_v<std::decay_t<Func>, std::function<T(T)>>>>
+  Tensor apply(Func f) const {
+    Tensor result;
+    apply<T>(f, result);
+
+    return result;
+  }
+
+  /**
+   * @brief     Apply an element-wise callable instantly to the element
+   * @param[in] f callable which takes and returns T
+   * @return int ML_ERROR_NONE if successful
+   */
+  template <typename T = float, typename Func,
+            typename = std::enable_if_t<
+              std::is_invocable_r_v<T, Func, T> &&
+              !std::is_same_v<std::decay_t<Func>, std::function<T(T)>>>>
+  int apply_i(Func f) {
+    Tensor result = *this;
+    apply<T>(f, result);
+
+    return ML_ERROR_NONE;
+  }
+
   /**
    * @brief     Apply function to Tensor
    * @param[in] *function function pointer applied
@@ -1388,6 +1459,38 @@ public:
    */
   void zoneout_mask(Tensor &opposite, float zoneout);
 
+  /**
+   * @brief Draw a packed bernoulli mask inplace
+   * @details Only for UINT32 tensors. Bit i % 32 of word i / 32 is set with
+   * probability @a probability.
+   * @param probability probability of a set bit
+   */
+  void setRandBitmask(float probability);
+
+  /**
+   * @brief Multiply with a packed mask : x * (bit ? on : off)
+   * @details @a mask is a UINT32 tensor with a row of
+   * (feature_len + 31) / 32 words for each batch. Bit i % 32 of word i / 32
+   * of row b belongs to element i of batch b.
+   * @param mask packed mask
+   * @param on multiplier of the set bits
+   * @param off multiplier of the cleared bits
+   * @param[out] output output tensor
+   * @retval Tensor& reference of output
+   */
+  Tensor &multiply_bitmask(const Tensor &mask, float on, float off,
+                           Tensor &output) const;
+
+  /**
+   * @brief Select with a packed mask : bit ? x : other
+   * @param mask packed mask, see multiply_bitmask
+   * @param other tensor of the cleared bits
+   * @param[out] output output tensor
+   * @retval Tensor& reference of output
+   */
+  Tensor &select_bitmask(const Tensor &mask, const Tensor &other,
+                         Tensor &output) const;
+
   /**
    * @brief split tensor along axis.
    *
@@ -342,6 +342,76 @@ void TensorBase::calculateFlattenDot(
   ldc = (getFormat() == Tformat::NHWC) ? output.channel() : output.width();
 }
 
+void TensorBase::calculateBatchedDot(Tensor const &input, Tensor const &output,
+                                     bool trans, bool trans_in,
+                                     unsigned int &M, unsigned int &N,
+                                     unsigned int &K, unsigned int &lda,
+                                     unsigned int &ldb,
+                                     unsigned int &ldc) const {
+  unsigned int rows, cols, input_rows, input_cols;
+  if (getFormat() == Tformat::NHWC) {
+    rows = height() * width();
+    cols = channel();
+    input_rows = input.height() * input.width();
+    input_cols = input.channel();
+  } else {
+    rows = channel() * height();
+    cols = width();
+    input_rows = input.channel() * input.height();
+    input_cols = input.width();
+  }
+
+  M = trans ? cols : rows;
+  K = trans ? rows : cols;
+  N = trans_in ? input_rows : input_cols;
+
+  if ((trans_in ? input_cols : input_rows) != K)
+    throw std::runtime_error("Error: incompatible dimensions for dot product");
+
+  NNTR_THROW_IF(input.batch() != batch() || output.batch() != batch(),
+                std::invalid_argument)
+    << "Error: batch of the tensors must match for batched dot product";
+  NNTR_THROW_IF(output.getDim().getFeatureLen() != M * N,
+                std::invalid_argument)
+    << "Error: output of batched dot product has wrong dimension";
+
+  lda = cols;
+  ldb = input_cols;
+  ldc = N;
+}
+
+void TensorBase::calculateQuantizedDot(Tensor const &input, bool trans_in,
+                                       unsigned int &scale_inc_k,
+                                       unsigned int &scale_inc_n) const {
+  NNTR_THROW_IF(getFormat() != Tformat::NCHW ||
+                  input.getFormat() != Tformat::NCHW,
+                std::invalid_argument)
+    << "Error: quantized dot product supports NCHW only";
+  NNTR_THROW_IF(input.batch() != 1 || input.channel() != 1,
+                std::invalid_argument)
+    << "Error: quantized dot product needs a single matrix, "
+    << input.getName();
+
+  unsigned int inc_h = 0, inc_w = 0;
+  switch (input.q_scheme()) {
+  case QScheme::PER_TENSOR_AFFINE:
+    break;
+  case QScheme::PER_CHANNEL_AFFINE:
+    /** CharTensor has a scale per column, Int4QTensor a scale per row */
+    if (input.getDataType() == Tdatatype::QINT8)
+      inc_w = 1;
+    else
+      inc_h = 1;
+    break;
+  default:
+    throw std::invalid_argument(
+      "Error: unsupported quantization scheme for dot product");
+  }
+
+  scale_inc_k = trans_in ? inc_w : inc_h;
+  scale_inc_n = trans_in ? inc_h : inc_w;
+}
+
 /**
  * Please note that the following functions need to be implemented in a child
  * class to utilize tensor operations fully — operations such as addition,
@@ -493,6 +563,13 @@ Tensor &TensorBase::dot(Tensor const &input, Tensor &output, bool trans,
     getStringDataType());
 }
 
+Tensor &TensorBase::dotBatched(Tensor const &input, Tensor &output,
+                               bool trans, bool trans_in, float beta) const {
+  throw std::invalid_argument(
+    "Tensor::dotBatched() is currently not supported in tensor data type " +
+    getStringDataType());
+}
+
 void TensorBase::dropout_mask(float dropout) {
   throw std::invalid_argument(
     "Tensor::dropout_mask() is currently not supported in tensor data type " +
@@ -511,6 +588,20 @@ void TensorBase::zoneout_mask(Tensor &opposite, float zoneout) {
     getStringDataType());
 }
 
+Tensor &TensorBase::multiply_bitmask(const Tensor &mask, float on, float off,
+                                     Tensor &output) const {
+  throw std::invalid_argument("Tensor::multiply_bitmask() is currently not "
+                              "supported in tensor data type " +
+                              getStringDataType());
+}
+
+Tensor &TensorBase::select_bitmask(const Tensor &mask, const Tensor &other,
+                                   Tensor &output) const {
+  throw std::invalid_argument("Tensor::select_bitmask() is currently not "
+                              "supported in tensor data type " +
+                              getStringDataType());
+}
+
 std::vector<Tensor> TensorBase::split(std::vector<size_t> sizes, int axis) {
   throw std::invalid_argument(
     "Tensor::split() is currently not supported in tensor data type " +
@@ -410,6 +410,18 @@ public:
   virtual Tensor &dot(Tensor const &input, Tensor &output, bool trans,
                       bool trans_in, float beta) const;
 
+  /**
+   * @brief     Dot Product of each batch of this and the input tensor
+   * @param[in] input Tensor
+   * @param[in] output output Tensor, preallocated
+   * @param[in] trans Transpose
+   * @param[in] trans_in Transpose input
+   * @param[in] beta beta
+   * @retval    Calculated Tensor
+   */
+  virtual Tensor &dotBatched(Tensor const &input, Tensor &output, bool trans,
+                             bool trans_in, float beta) const;
+
   /**
    * @copydoc Tensor::dropout_mask(float dropout)
    */
@@ -425,6 +437,20 @@ public:
    */
   virtual void zoneout_mask(Tensor &opposite, float zoneout);
 
+  /**
+   * @copydoc Tensor::multiply_bitmask(const Tensor &mask, float on, float off,
+   * Tensor &output)
+   */
+  virtual Tensor &multiply_bitmask(const Tensor &mask, float on, float off,
+                                   Tensor &output) const;
+
+  /**
+   * @copydoc Tensor::select_bitmask(const Tensor &mask, const Tensor &other,
+   * Tensor &output)
+   */
+  virtual Tensor &select_bitmask(const Tensor &mask, const Tensor &other,
+                                 Tensor &output) const;
+
   /**
    * @copydoc Tensor::split(std::vector<size_t> sizes, int axis)
    */
@@ -800,6 +826,40 @@ protected:
                            unsigned int &N, unsigned int &K, unsigned int &lda,
                            unsigned int &ldb, unsigned int &ldc) const;
 
+  /**
+   * @brief Calcuates variables needed to perform a dot product of each batch
+   *
+   * @param[in]  input Tensor
+   * @param[in]  output output Tensor
+   * @param[in]  trans Transpose
+   * @param[in]  trans_in Transpose input
+   * @param[out] M number of op(this)'s and output's row
+   * @param[out] N number of op(inputs)'s and output's columns
+   * @param[out] K number of op(this)'s column and op(input)'s row
+   * @param[out] lda leading dimension of this
+   * @param[out] ldb leading dimension of input
+   * @param[out] ldc leading dimension of output
+   *
+   * @note op(X) is one of X or X**T
+   */
+  void calculateBatchedDot(Tensor const &input, Tensor const &output,
+                           bool trans, bool trans_in, unsigned int &M,
+                           unsigned int &N, unsigned int &K, unsigned int &lda,
+                           unsigned int &ldb, unsigned int &ldc) const;
+
+  /**
+   * @brief Calcuates the strides of the scale factors of a quantized weight
+   * along the rows and the columns of op(input) for a dot product with it
+   *
+   * @param[in]  input QINT8 or QINT4 Tensor of a single matrix
+   * @param[in]  trans_in Transpose input
+   * @param[out] scale_inc_k scale stride along op(input)'s rows
+   * @param[out] scale_inc_n scale stride along op(input)'s columns
+   */
+  void calculateQuantizedDot(Tensor const &input, bool trans_in,
+                             unsigned int &scale_inc_k,
+                             unsigned int &scale_inc_n) const;
+
   /**
    * @brief  Get the Data Type String object
    * @return std::string of tensor data type
@@ -204,6 +204,11 @@ void TensorPool::finalize(const MemoryPlanner &planner,
       throw std::runtime_error("Received invalid token from memory pool");
 #endif
 
+    /** dependents can write the memory at any of their orders */
+    if (auto pool = dynamic_cast<CachePool *>(mem_pool.get());
+        pool && details->write_order && details->dependents.empty())
+      pool->setWriteOrder(details->token, *details->write_order);
+
     bytes_requested += tensor_bytes;
   }
 
@@ -255,6 +260,7 @@ void TensorPool::deallocate() {
     cache_loader->finish();
 
   mem_pool->deallocate();
+  detached.clear();
 
   /** nullify the data pointers for the tensors */
   for (auto &spec : pool) {
@@ -262,6 +268,28 @@ void TensorPool::deallocate() {
   }
 }
 
+void TensorPool::detach() {
+  detached.clear();
+  detached.reserve(pool.size());
+
+  for (auto &spec : pool) {
+    detached.emplace_back(spec.tensor->getMemoryData(),
+                          spec.tensor->getOffset());
+    spec.tensor->setData(nullptr);
+  }
+}
+
+void TensorPool::attach() {
+  NNTR_THROW_IF(detached.size() != pool.size(), std::runtime_error)
+    << "Cannot attach tensors which are not detached";
+
+  for (unsigned int idx = 0; idx < pool.size(); ++idx) {
+    auto &[mem, offset] = detached[idx];
+    pool[idx].tensor->setData(mem, offset);
+  }
+  detached.clear();
+}
+
 const std::vector<unsigned int> &
 TensorPool::getExecutionOrder(const std::string &name) {
   return std::get<SourceDetails>(getSourceSpec(name).details).exec_order;
@@ -356,6 +384,24 @@ void TensorPool::fillPlaceholder(const std::string &name, const Tensor &t) {
   syncDependents(spec);
 }
 
+void TensorPool::setExternalData(const std::string &name,
+                                 const std::shared_ptr<MemoryData> &mem,
+                                 size_t offset) {
+  RequestSpec *rs = &pool.at(name_map.at(name));
+  size_t len = rs->tensor->size();
+  while (auto dep_details = std::get_if<DependentDetails>(&rs->details)) {
+    NNTR_THROW_IF(dep_details->offset != 0, std::invalid_argument)
+      << "Cannot set external data for a view with an offset: " << name;
+    rs = &pool.at(dep_details->parent_idx);
+  }
+
+  NNTR_THROW_IF(rs->tensor->size() != len, std::invalid_argument)
+    << "Cannot set external data for a partial view: " << name;
+
+  rs->tensor->setData(mem, offset);
+  syncDependents(*rs);
+}
+
 Tensor *TensorPool::extend(const std::string &name, const TensorDim &dim,
                            const std::vector<unsigned int> &exec_order,
                            TensorLifespan lifespan) {
@@ -462,6 +508,34 @@ bool TensorPool::isTensorLongTerm(const TensorLifespan &lifespan) {
   }
 }
 
+void TensorPool::setWriteOrder(const std::string &name,
+                               const std::vector<unsigned int> &order) {
+  auto &spec = pool.at(name_map.at(name));
+  auto details = std::get_if<SourceDetails>(&spec.details);
+  NNTR_THROW_IF(details == nullptr, std::invalid_argument)
+    << "write order can be set only to a source tensor: " << name;
+
+  details->write_order = order;
+}
+
+SwapDevice::Stats TensorPool::getSwapStats(bool reset) {
+  if (auto pool = dynamic_cast<CachePool *>(mem_pool.get()))
+    return pool->getSwapStats(reset);
+  return {0, 0, 0, 0, 0};
+}
+
+void TensorPool::setCompressedSwapTier(
+  size_t budget, const std::map<CachePolicy, SwapCodec> &codecs) {
+  if (auto pool = dynamic_cast<CachePool *>(mem_pool.get()))
+    pool->setCompressedTier(budget, codecs);
+}
+
+std::vector<size_t> TensorPool::getExecOrderBytes(unsigned int max_order) {
+  if (auto pool = dynamic_cast<CachePool *>(mem_pool.get()))
+    return pool->getExecOrderBytes(max_order);
+  return {};
+}
+
 void TensorPool::flushCache() {
   if (auto pool = dynamic_cast<CachePool *>(mem_pool.get()))
     pool->flush();
@@ -19,6 +19,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -99,6 +100,22 @@ public:
    */
   void deallocate();
 
+  /**
+   * @brief Detach the tensors from their memory to update their dimension
+   * while the memory is kept allocated
+   *
+   * @note every tensor must be attached back with attach() before use
+   */
+  void detach();
+
+  /**
+   * @brief Attach the tensors back to the memory they were detached from
+   *
+   * @note a tensor must not grow beyond the size it was allocated with, the
+   * smaller one uses the front of its memory
+   */
+  void attach();
+
   /**
    * @brief     Get execution order for the given tensor
    *
@@ -147,6 +164,18 @@ public:
    */
   void fillPlaceholder(const std::string &name, const Tensor &t);
 
+  /**
+   * @brief Point the tensor of the given name, and the views of it, to an
+   * external memory instead of the pool memory
+   *
+   * @param name Name of the tensor
+   * @param mem external memory
+   * @param offset elementwise offset in @a mem
+   * @throws std::invalid_argument if the tensor is a partial view of another
+   */
+  void setExternalData(const std::string &name,
+                       const std::shared_ptr<MemoryData> &mem, size_t offset);
+
   /**
    * @brief request placeholder which will be not managed by this tensor pool
    * but will be managed externally
@@ -258,6 +287,44 @@ public:
   void reidentifySource(const std::string &dest, const std::string &new_src,
                         unsigned int offset);
 
+  /**
+   * @brief Set execution orders in which the tensor is written. If swapped,
+   * data not written since loaded is not written back.
+   *
+   * @param name name of the source tensor
+   * @param order execution orders
+   * @note must be called before finalize
+   */
+  void setWriteOrder(const std::string &name,
+                     const std::vector<unsigned int> &order);
+
+  /**
+   * @brief Get bytes moved by the swap device
+   *
+   * @param reset reset the stats after read
+   * @return stats of the swap device, all zero if not swapped
+   */
+  SwapDevice::Stats getSwapStats(bool reset = false);
+
+  /**
+   * @brief Keep swapped out tensors compressed in memory before the swap file.
+   * No effect if not swapped.
+   *
+   * @param budget bytes of compressed data to keep, 0 to disable
+   * @param codecs codec for tensors of each cache policy
+   */
+  void setCompressedSwapTier(size_t budget,
+                             const std::map<CachePolicy, SwapCodec> &codecs);
+
+  /**
+   * @brief Get bytes of the swapped tensors used by each execution order.
+   * Empty if not swapped.
+   *
+   * @param max_order last execution order to count
+   * @return std::vector<size_t> bytes indexed by execution order
+   */
+  std::vector<size_t> getExecOrderBytes(unsigned int max_order);
+
   /**
    * @brief flush cache data
    *
@@ -322,6 +389,8 @@ private:
     std::vector<unsigned int> exec_order; /**< exec order */
     std::vector<unsigned int>
       dependents; /**< list of dependents to the source */
+    std::optional<std::vector<unsigned int>>
+      write_order; /**< orders the tensor is written, every order if not set */
   };
 
   /**
@@ -409,6 +478,8 @@ private:
     name_map;                           /**< indexing of requested tensors */
   std::shared_ptr<MemoryPool> mem_pool; /**< memory pool for the tensors */
   std::unique_ptr<CacheLoader> cache_loader; /**< memory pool for the tensors */
+  std::vector<std::pair<std::shared_ptr<MemoryData>, size_t>>
+    detached; /**< memory and offset of each tensor while detached */
 
   /**
    * @brief     Check if the lifespan leads to long term valitidy
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   tensor_view.h
+ * @date   17 Oct 2026
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ * @brief  Non-owning strided view of tensor data for inner loops
+ *
+ */
+
+#ifndef __TENSOR_VIEW_H__
+#define __TENSOR_VIEW_H__
+#ifdef __cplusplus
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include <nntrainer_error.h>
+#include <tensor.h>
+
+namespace nntrainer {
+
+/**
+ * @class TensorView
+ * @brief Non-owning, trivially copyable 4D view of tensor data with element
+ * strides. Unlike Tensor::getBatchSlice() and Tensor::getSharedDataTensor(),
+ * making a view or a sub view allocates nothing and touches no reference
+ * count, so it is meant for the slices made inside hot loops. The viewed
+ * memory must outlive the view.
+ *
+ * @tparam T element type, const qualified for a read only view
+ */
+template <typename T> class TensorView {
+public:
+  /**
+   * @brief Construct an empty view
+   */
+  TensorView() = default;
+
+  /**
+   * @brief Construct a view of contiguous memory
+   *
+   * @param data first element
+   * @param b batch
+   * @param c channel
+   * @param h height
+   * @param w width
+   */
+  TensorView(T *data, unsigned int b, unsigned int c, unsigned int h,
+             unsigned int w) :
+    data_(data),
+    dim_{b, c, h, w},
+    strides_{static_cast<size_t>(c) * h * w, static_cast<size_t>(h) * w, w,
+             1} {}
+
+  /**
+   * @brief Construct a view of a whole tensor in its memory order
+   *
+   * @param t tensor to view, must be allocated
+   * @throw std::invalid_argument if the element size does not match T or the
+   * tensor is not contiguous
+   */
+  explicit TensorView(const Tensor &t) :
+    TensorView(t.getData<T>(), t.batch(), t.channel(), t.height(), t.width()) {
+    NNTR_THROW_IF(t.getDim().getDataTypeSize() != sizeof(T) ||
+                    !t.getContiguous(),
+                  std::invalid_argument)
+      << "tensor view needs contiguous data of the viewed type, tensor: "
+      << t.getName();
+  }
+
+  /**
+   * @brief get the data of the first element
+   */
+  T *getData() const { return data_; }
+
+  /**
+   * @brief get the address of an element
+   */
+  T *getAddress(unsigned int b, unsigned int c, unsigned int h,
+                unsigned int w) const {
+    return data_ + b * strides_[0] + c * strides_[1] + h * strides_[2] +
+           w * strides_[3];
+  }
+
+  /**
+   * @brief access an element
+   */
+  T &operator()(unsigned int b, unsigned int c, unsigned int h,
+                unsigned int w) const {
+    return *getAddress(b, c, h, w);
+  }
+
+  unsigned int batch() const { return dim_[0]; }   /**< batch */
+  unsigned int channel() const { return dim_[1]; } /**< channel */
+  unsigned int height() const { return dim_[2]; }  /**< height */
+  unsigned int width() const { return dim_[3]; }   /**< width */
+
+  /**
+   * @brief get the stride of an axis in elements
+   */
+  size_t getStride(unsigned int axis) const { return strides_[axis]; }
+
+  /**
+   * @brief get the number of elements
+   */
+  size_t size() const {
+    return static_cast<size_t>(dim_[0]) * dim_[1] * dim_[2] * dim_[3];
+  }
+
+  /**
+   * @brief check if the elements are dense in memory order
+   */
+  bool isContiguous() const {
+    return strides_[3] == 1 && strides_[2] == dim_[3] &&
+           strides_[1] == static_cast<size_t>(dim_[2]) * dim_[3] &&
+           strides_[0] == static_cast<size_t>(dim_[1]) * dim_[2] * dim_[3];
+  }
+
+  /**
+   * @brief get the view of @a size batches from @a offset
+   */
+  TensorView getBatchSlice(unsigned int offset, unsigned int size) const {
+    return narrow(0, offset, size);
+  }
+
+  /**
+   * @brief get the view of [@a offset, @a offset + @a size) of an axis
+   */
+  TensorView narrow(unsigned int axis, unsigned int offset,
+                    unsigned int size) const {
+    TensorView view = *this;
+    view.data_ += offset * strides_[axis];
+    view.dim_[axis] = size;
+    return view;
+  }
+
+  /**
+   * @brief get the view of the row at (b, c, h), which is contiguous if the
+   * width is
+   */
+  TensorView getRow(unsigned int b, unsigned int c, unsigned int h) const {
+    TensorView view = *this;
+    view.data_ = getAddress(b, c, h, 0);
+    view.dim_ = {1, 1, 1, dim_[3]};
+    return view;
+  }
+
+  /**
+   * @brief get the view with two axes swapped, no data is moved
+   */
+  TensorView transpose(unsigned int axis0, unsigned int axis1) const {
+    TensorView view = *this;
+    std::swap(view.dim_[axis0], view.dim_[axis1]);
+    std::swap(view.strides_[axis0], view.strides_[axis1]);
+    return view;
+  }
+
+  /**
+   * @brief copy the elements of @a from, which must have the same dimension
+   */
+  template <typename U> void copyData(const TensorView<U> &from) const {
+    if (isContiguous() && from.isContiguous()) {
+      std::copy(from.getData(), from.getData() + size(), data_);
+      return;
+    }
+
+    for (unsigned int b = 0; b < dim_[0]; ++b)
+      for (unsigned int c = 0; c < dim_[1]; ++c)
+        for (unsigned int h = 0; h < dim_[2]; ++h)
+          for (unsigned int w = 0; w < dim_[3]; ++w)
+            (*this)(b, c, h, w) = from(b, c, h, w);
+  }
+
+private:
+  T *data_ = nullptr;                    /**< first element */
+  std::array<unsigned int, 4> dim_ = {}; /**< dimension */
+  std::array<size_t, 4> strides_ = {};   /**< strides in elements */
+};
+
+static_assert(std::is_trivially_copyable<TensorView<float>>::value,
+              "TensorView must stay trivially copyable");
+
+} // namespace nntrainer
+
+#endif /* __cplusplus */
+#endif /* __TENSOR_VIEW_H__ */
@@ -0,0 +1,255 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   nntr_thread_pool.cpp
+ * @date   17 Oct 2026
+ * @brief  Persistent work-stealing thread pool for NNTrainer
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+#include <nntr_thread_pool.h>
+#include <nntrainer_error.h>
+#include <nntrainer_log.h>
+
+#ifdef NNTR_NUM_THREADS
+static const unsigned int nntr_num_threads = NNTR_NUM_THREADS;
+#else
+static const unsigned int nntr_num_threads = 1;
+#endif
+
+namespace nntrainer {
+
+/**
+ * @brief a range submitted by parallelFor, shared by all of its chunks
+ */
+struct ThreadPool::Job {
+  const RangeFunc *fn;
+  std::atomic<unsigned int> remaining;
+  std::mutex mutex;
+  std::condition_variable done_cv;
+  std::vector<std::thread::id> slots;
+  std::exception_ptr error;
+
+  /**
+   * @brief get the slot of the calling thread, allocate one if needed
+   */
+  unsigned int acquireSlot() {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto id = std::this_thread::get_id();
+    auto it = std::find(slots.begin(), slots.end(), id);
+    if (it != slots.end())
+      return static_cast<unsigned int>(it - slots.begin());
+    slots.push_back(id);
+    return static_cast<unsigned int>(slots.size() - 1);
+  }
+};
+
+/**
+ * @brief get the default number of threads, NNTR_NUM_THREADS env overrides
+ * the build option
+ */
+static unsigned int getDefaultNumThreads() {
+  const char *env = std::getenv("NNTR_NUM_THREADS");
+  if (env != nullptr) {
+    try {
+      int n = std::stoi(env);
+      if (n > 0)
+        return static_cast<unsigned int>(n);
+    } catch (std::exception &e) {
+    }
+    ml_logw("NNTR_NUM_THREADS is given but it is not valid: %s", env);
+  }
+  return std::max(nntr_num_threads, 1u);
+}
+
+ThreadPool::ThreadPool(unsigned int num_threads_) :
+  num_threads(std::max(num_threads_, 1u)),
+  next_queue(0),
+  pending(0),
+  stop(false) {
+  startWorkers();
+}
+
+ThreadPool::~ThreadPool() { stopWorkers(); }
+
+ThreadPool &ThreadPool::Global() {
+  static ThreadPool instance(getDefaultNumThreads());
+  return instance;
+}
+
+void ThreadPool::setNumThreads(unsigned int num_threads_) {
+  num_threads_ = std::max(num_threads_, 1u);
+  if (num_threads_ == num_threads)
+    return;
+
+  stopWorkers();
+  num_threads = num_threads_;
+  startWorkers();
+}
+
+void ThreadPool::startWorkers() {
+  stop = false;
+  /** the calling thread is counted as one of the threads */
+  for (unsigned int i = 0; i + 1 < num_threads; ++i)
+    queues.emplace_back(std::make_unique<WorkQueue>());
+
+  for (unsigned int i = 0; i + 1 < num_threads; ++i)
+    workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+void ThreadPool::stopWorkers() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    stop = true;
+  }
+  sleep_cv.notify_all();
+
+  for (auto &worker : workers)
+    worker.join();
+
+  workers.clear();
+  queues.clear();
+}
+
+void ThreadPool::workerLoop(unsigned int idx) {
+  while (true) {
+    Chunk chunk;
+    if (popChunk(idx, chunk)) {
+      runChunk(chunk);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    sleep_cv.wait(lock, [this] { return stop || pending.load() > 0; });
+    if (stop)
+      return;
+  }
+}
+
+bool ThreadPool::popChunk(unsigned int idx, Chunk &chunk) {
+  unsigned int num_queues = queues.size();
+
+  if (idx < num_queues) {
+    WorkQueue &own = *queues[idx];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.chunks.empty()) {
+      chunk = std::move(own.chunks.back());
+      own.chunks.pop_back();
+      pending--;
+      return true;
+    }
+  }
+
+  for (unsigned int i = 1; i <= num_queues; ++i) {
+    WorkQueue &victim = *queues[(idx + i) % num_queues];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.chunks.empty()) {
+      chunk = std::move(victim.chunks.front());
+      victim.chunks.pop_front();
+      pending--;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ThreadPool::runChunk(Chunk &chunk) {
+  Job &job = *chunk.job;
+
+  try {
+    (*job.fn)(chunk.start, chunk.end, job.acquireSlot());
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(job.mutex);
+    if (!job.error)
+      job.error = std::current_exception();
+  }
+
+  if (job.remaining.fetch_sub(1) == 1) {
+    std::lock_guard<std::mutex> lock(job.mutex);
+    job.done_cv.notify_all();
+  }
+}
+
+void ThreadPool::parallelFor(unsigned int begin, unsigned int end,
+                             unsigned int grain, const RangeFunc &fn) {
+  if (begin >= end)
+    return;
+
+  unsigned int range = end - begin;
+  if (grain == 0)
+    grain = std::max((range + num_threads * 4 - 1) / (num_threads * 4), 1u);
+
+  unsigned int num_chunks = (range + grain - 1) / grain;
+  if (num_chunks == 1 || queues.empty()) {
+    fn(begin, end, 0);
+    return;
+  }
+
+  auto job = std::make_shared<Job>();
+  job->fn = &fn;
+  job->remaining = num_chunks;
+
+  /** spread the chunks over the worker queues in a round-robin manner */
+  unsigned int num_queues = queues.size();
+  unsigned int q = next_queue.fetch_add(1) % num_queues;
+  for (unsigned int s = begin; s < end; s += grain) {
+    unsigned int e = std::min(s + grain, end);
+    WorkQueue &queue = *queues[q];
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      pending++;
+      queue.chunks.push_back({job, s, e});
+    }
+    q = (q + 1) % num_queues;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+  }
+  sleep_cv.notify_all();
+
+  /**
+   * help with the chunks of this job only. Running an unrelated chunk here
+   * could re-enter a callback which is suspended on this thread.
+   */
+  bool found = true;
+  while (found && job->remaining.load() > 0) {
+    found = false;
+    for (unsigned int i = 0; i < num_queues && !found; ++i) {
+      Chunk chunk;
+      {
+        WorkQueue &queue = *queues[(q + i) % num_queues];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        auto it = std::find_if(queue.chunks.begin(), queue.chunks.end(),
+                               [&job](const Chunk &c) { return c.job == job; });
+        if (it != queue.chunks.end()) {
+          chunk = std::move(*it);
+          queue.chunks.erase(it);
+          pending--;
+          found = true;
+        }
+      }
+      if (found)
+        runChunk(chunk);
+    }
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->done_cv.wait(lock, [&job] { return job->remaining.load() == 0; });
+  }
+
+  if (job->error)
+    std::rethrow_exception(job->error);
+}
+
+} // namespace nntrainer
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   nntr_thread_pool.h
+ * @date   17 Oct 2026
+ * @brief  Persistent work-stealing thread pool for NNTrainer
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ *
+ */
+#ifndef __NNTR_THREAD_POOL_H__
+#define __NNTR_THREAD_POOL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nntrainer {
+
+/**
+ * @class   ThreadPool
+ * @brief   process-wide pool of persistent workers. A parallel range is split
+ * into small chunks which are spread over per-worker deques. Idle workers
+ * steal chunks from the others, and the submitting thread helps until the
+ * whole range is done, so nested submission never deadlocks.
+ */
+class ThreadPool {
+public:
+  /**
+   * @brief range callback (start, end, slot). @a slot is unique among the
+   * threads running chunks of the same range at the same time and is always
+   * smaller than the number of chunks and the pool size.
+   */
+  using RangeFunc =
+    std::function<void(unsigned int, unsigned int, unsigned int)>;
+
+  /**
+   * @brief Construct a new ThreadPool
+   *
+   * @param num_threads total number of threads including the caller
+   */
+  explicit ThreadPool(unsigned int num_threads);
+
+  /**
+   * @brief Destroy the ThreadPool, joins every worker
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /**
+   * @brief Get the process-wide thread pool. The pool is sized from the
+   * NNTR_NUM_THREADS environment variable if given, otherwise from the
+   * nntr-num-threads build option.
+   *
+   * @return ThreadPool& global thread pool
+   */
+  static ThreadPool &Global();
+
+  /**
+   * @brief Run @a fn over [begin, end) and wait for completion
+   *
+   * @param begin start of the range
+   * @param end end of the range (exclusive)
+   * @param grain chunk size, 0 lets the pool choose
+   * @param fn callback to run for each chunk
+   * @throw any exception thrown by @a fn is rethrown to the caller
+   */
+  void parallelFor(unsigned int begin, unsigned int end, unsigned int grain,
+                   const RangeFunc &fn);
+
+  /**
+   * @brief Resize the pool. Must not be called while a range is running.
+   *
+   * @param num_threads total number of threads including the caller
+   */
+  void setNumThreads(unsigned int num_threads);
+
+  /**
+   * @brief Get the number of threads including the caller
+   *
+   * @return unsigned int number of threads
+   */
+  unsigned int getNumThreads() const { return num_threads; }
+
+private:
+  struct Job;
+
+  /**
+   * @brief a chunk of a job, [start, end)
+   */
+  struct Chunk {
+    std::shared_ptr<Job> job;
+    unsigned int start;
+    unsigned int end;
+  };
+
+  /**
+   * @brief per-worker deque, owner pops from the back, thieves from the front
+   */
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Chunk> chunks;
+  };
+
+  /**
+   * @brief start background workers
+   */
+  void startWorkers();
+
+  /**
+   * @brief stop and join background workers
+   */
+  void stopWorkers();
+
+  /**
+   * @brief main loop of a background worker
+   *
+   * @param idx index of the owned queue
+   */
+  void workerLoop(unsigned int idx);
+
+  /**
+   * @brief pop a chunk, from the owned queue first then steal from others
+   *
+   * @param idx index of the owned queue, or queues.size() for none
+   * @param[out] chunk popped chunk
+   * @return true if a chunk was found
+   */
+  bool popChunk(unsigned int idx, Chunk &chunk);
+
+  /**
+   * @brief run a chunk and signal its job when finished
+   *
+   * @param chunk chunk to run
+   */
+  static void runChunk(Chunk &chunk);
+
+  unsigned int num_threads;
+  std::vector<std::unique_ptr<WorkQueue>> queues;
+  std::vector<std::thread> workers;
+  std::atomic<unsigned int> next_queue;
+  std::atomic<size_t> pending; /**< number of queued chunks */
+  bool stop;
+  std::mutex sleep_mutex;
+  std::condition_variable sleep_cv;
+};
+
+} // namespace nntrainer
+
+#endif /** __NNTR_THREAD_POOL_H__ */
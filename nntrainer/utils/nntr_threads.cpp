@@ -11,27 +11,30 @@
  */
 
 #include <algorithm>
+#include <nntr_thread_pool.h>
 #include <nntr_threads.h>
 
-#ifdef NNTR_NUM_THREADS
-static const unsigned int nntr_num_threads = NNTR_NUM_THREADS;
-#else
-static const unsigned int nntr_num_threads = 1;
-#endif
-
 namespace nntrainer {
 
+/**
+ * @brief get the number of workers for the given batch. The workers are taken
+ * from the global thread pool, so there is no point having more than batch.
+ */
+static unsigned int getNumWorkersFor(unsigned int batch) {
+  return std::max(std::min(ThreadPool::Global().getNumThreads(), batch), 1u);
+}
+
 ParallelBatch::ParallelBatch(unsigned int batch_size) :
   cb(nullptr),
   batch(batch_size),
-  num_workers(nntr_num_threads > batch ? 1 : nntr_num_threads),
+  num_workers(getNumWorkersFor(batch)),
   user_data_prop(new props::PropsUserData(nullptr)){};
 
 ParallelBatch::ParallelBatch(threaded_cb threaded_cb_, unsigned int batch_size,
                              void *user_data_) :
   cb(threaded_cb_),
   batch(batch_size),
-  num_workers(nntr_num_threads > batch ? 1 : nntr_num_threads),
+  num_workers(getNumWorkersFor(batch)),
   user_data_prop(new props::PropsUserData(user_data_)) {}
 
 ParallelBatch::~ParallelBatch() {}
@@ -42,21 +45,17 @@ void ParallelBatch::run() {
     throw std::invalid_argument("nntrainer threads: callback is not defined");
   }
 
-  unsigned int start = 0;
-  unsigned int end = batch;
-
-  unsigned int chunk = (end - start + (num_workers - 1)) / num_workers;
-
-  for (unsigned int i = 0; i < num_workers; ++i) {
-    unsigned int s = start + i * chunk;
-    unsigned int e = s + chunk;
-    if (e > end)
-      e = end;
-    workers.push_back(std::thread(cb, s, e, i, user_data_prop->get()));
-  }
-
-  std::for_each(workers.begin(), workers.end(),
-                std::mem_fn(&std::thread::join));
+  /**
+   * the batch is split into fine-grained chunks which are balanced by the
+   * work-stealing pool, pid is the slot of the running thread which is always
+   * smaller than num_workers
+   */
+  void *user_data = user_data_prop->get();
+  ThreadPool::Global().parallelFor(
+    0, batch, 0,
+    [this, user_data](unsigned int s, unsigned int e, unsigned int pid) {
+      cb(s, e, pid, user_data);
+    });
 }
 
 void ParallelBatch::setCallback(threaded_cb threaded_cb_, void *user_data_) {
@@ -57,7 +57,9 @@ public:
   ~ParallelBatch();
 
   /**
-   * @brief Run the workders
+   * @brief Run the workers on the global thread pool. The callback can be
+   * called several times with the same pid on smaller ranges, so per-worker
+   * results must be accumulated rather than overwritten.
    *
    */
   void run();
@@ -80,7 +82,6 @@ private:
   threaded_cb cb;
   unsigned int batch;
   unsigned int num_workers;
-  std::vector<std::thread> workers;
   std::unique_ptr<props::PropsUserData> user_data_prop;
 };
 
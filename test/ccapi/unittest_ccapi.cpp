@@ -413,6 +413,97 @@ TEST(nntrainer_ccapi, train_batch_size_update_after) {
   EXPECT_NEAR(model->getValidationLoss(), 2.179843, tolerance);
 }
 
+/**
+ * @brief Create a model with 50 training and validation samples
+ */
+static std::unique_ptr<ml::train::Model> createPartialBatchModel() {
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+
+  model->addLayer(ml::train::layer::Input(
+    {"input_shape=1:1:62720", "normalization=true"}));
+  model->addLayer(ml::train::layer::FullyConnected(
+    {"unit= 10", "activation=softmax", "bias_initializer=zeros",
+     "weight_initializer=xavier_uniform", "input_layers=input0"}));
+  model->setOptimizer(ml::train::optimizer::SGD({"learning_rate=0.0001"}));
+
+  std::shared_ptr<ml::train::Dataset> dataset = ml::train::createDataset(
+    ml::train::DatasetType::FILE, getTestResPath("trainingSet.dat").c_str());
+  model->setDataset(ml::train::DatasetModeType::MODE_TRAIN, dataset);
+  dataset = ml::train::createDataset(ml::train::DatasetType::FILE,
+                                     getTestResPath("valSet.dat").c_str());
+  model->setDataset(ml::train::DatasetModeType::MODE_VALID, dataset);
+
+  return model;
+}
+
+/**
+ * @brief Neural Network Model Training with the last partial batch
+ */
+TEST(nntrainer_ccapi, train_partial_batch_p) {
+  auto model = createPartialBatchModel();
+
+  /** 50 samples are run as 16 + 16 + 16 + 2 */
+  EXPECT_NO_THROW(model->setProperty(
+    {"loss=cross", "batch_size=16", "epochs=2", "partial_batch=true"}));
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_EQ(model->train(), ML_ERROR_NONE);
+
+  /** every sample is in a single partial batch */
+  EXPECT_NO_THROW(model->setProperty({"batch_size=64"}));
+  EXPECT_EQ(model->train(), ML_ERROR_NONE);
+  EXPECT_GT(model->getTrainingLoss(), 0.0f);
+  EXPECT_GT(model->getValidationLoss(), 0.0f);
+}
+
+/**
+ * @brief Neural Network Model Training skips the last partial batch
+ */
+TEST(nntrainer_ccapi, train_partial_batch_n) {
+  auto model = createPartialBatchModel();
+
+  /** every sample is in the partial batch, so nothing is run */
+  EXPECT_NO_THROW(
+    model->setProperty({"loss=cross", "batch_size=64", "epochs=1"}));
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_THROW(model->train(), std::runtime_error);
+}
+
+/**
+ * @brief Neural Network Model Inference with batch sizes up to max_batch_size
+ */
+TEST(nntrainer_ccapi, inference_max_batch_size_p) {
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET);
+
+  model->addLayer(ml::train::layer::Input({"input_shape=1:1:8"}));
+  model->addLayer(ml::train::layer::FullyConnected(
+    {"unit=4", "weight_initializer=ones", "bias_initializer=zeros"}));
+
+  EXPECT_NO_THROW(model->setProperty({"batch_size=1", "max_batch_size=8"}));
+  EXPECT_EQ(model->compile(ml::train::ExecutionMode::INFERENCE),
+            ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(ml::train::ExecutionMode::INFERENCE),
+            ML_ERROR_NONE);
+
+  std::vector<float> input(8 * 8);
+  for (unsigned int i = 0; i < input.size(); ++i)
+    input[i] = i / 8.0f;
+  std::vector<float *> in = {input.data()};
+
+  /** every batch runs on the tensors planned for 8 */
+  for (unsigned int batch : {4u, 1u, 8u, 2u}) {
+    std::vector<float *> out = model->inference(batch, in);
+    for (unsigned int b = 0; b < batch; ++b) {
+      float expected = 0.0f;
+      for (unsigned int i = 0; i < 8; ++i)
+        expected += input[b * 8 + i];
+      for (unsigned int u = 0; u < 4; ++u)
+        EXPECT_FLOAT_EQ(out[0][b * 4 + u], expected);
+    }
+  }
+}
+
 /**
  * @brief Neural Network Model Training
  * @note Compilation without any argument sets default execution mode as train.
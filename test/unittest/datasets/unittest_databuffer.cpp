@@ -14,7 +14,9 @@
 #include <databuffer.h>
 #include <random_data_producers.h>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 TEST(DataBuffer, getGenerator_p) {
   std::unique_ptr<nntrainer::DataProducer> prod =
@@ -89,3 +91,72 @@ TEST(DataBuffer, fetchAfterBqIsDeleted_n) {
   future_bq.get();
   EXPECT_THROW(db.fetch(), std::runtime_error);
 }
+
+/**
+ * @brief fetch every iteration of an epoch and flatten the inputs
+ */
+static std::vector<float> fetchEpoch(nntrainer::DataBuffer &db,
+                                     unsigned int *num_iterations = nullptr) {
+  std::vector<float> values;
+  auto future_iq = db.startFetchWorker({{4, 1, 1, 3}}, {{4, 1, 1, 5}});
+  unsigned int count = 0;
+  while (true) {
+    auto iteration_view = db.fetch();
+    if (iteration_view.isEmpty()) {
+      break;
+    }
+    auto &input = iteration_view.get().getInputsRef()[0];
+    auto batch = iteration_view.get().batch();
+    values.insert(values.end(), input.getData(),
+                  input.getData() + batch * input.getDim().getFeatureLen());
+    count++;
+  }
+  future_iq.get();
+  if (num_iterations) {
+    *num_iterations = count;
+  }
+  return values;
+}
+
+TEST(DataBuffer, fetchMultiWorkerSameAsSingleWorker_p) {
+  nntrainer::DataBuffer single(
+    std::make_unique<nntrainer::RandomDataOneHotProducer>());
+  single.setProperty({"buffer_size=3", "num_samples=103"});
+
+  nntrainer::DataBuffer multi(
+    std::make_unique<nntrainer::RandomDataOneHotProducer>());
+  multi.setProperty({"buffer_size=3", "num_samples=103", "num_workers=4"});
+
+  unsigned int num_iterations = 0;
+  auto expected = fetchEpoch(single);
+  auto actual = fetchEpoch(multi, &num_iterations);
+
+  EXPECT_EQ(num_iterations, 26u); // last one is a partial batch
+  EXPECT_EQ(expected.size(), 103u * 3);
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(DataBuffer, fetchMultiWorkerOutOfOrder_p) {
+  nntrainer::DataBuffer ordered(
+    std::make_unique<nntrainer::RandomDataOneHotProducer>());
+  ordered.setProperty({"buffer_size=2", "num_samples=64"});
+
+  nntrainer::DataBuffer unordered(
+    std::make_unique<nntrainer::RandomDataOneHotProducer>());
+  unordered.setProperty(
+    {"buffer_size=2", "num_samples=64", "num_workers=3", "in_order=false"});
+
+  auto expected = fetchEpoch(ordered);
+  auto actual = fetchEpoch(unordered);
+
+  /// every sample is delivered once but iterations can come in any order
+  std::sort(expected.begin(), expected.end());
+  std::sort(actual.begin(), actual.end());
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(DataBuffer, numWorkersZero_n) {
+  nntrainer::DataBuffer db(
+    std::make_unique<nntrainer::RandomDataOneHotProducer>());
+  EXPECT_THROW(db.setProperty({"num_workers=0"}), std::invalid_argument);
+}
@@ -310,6 +310,31 @@ TEST_P(IterQueueScenarios,
   EXPECT_FLOAT_EQ(sum_from_producer, sum_from_consumer);
 }
 
+TEST_P(IterQueueScenarios, produceAndConsumAsyncMultipleProducers_p) {
+  constexpr unsigned int num_producers = 4;
+  std::vector<std::future<void>> producers;
+  for (unsigned int p = 0; p < num_producers; ++p) {
+    producers.push_back(std::async(std::launch::async, [this, p]() {
+      for (unsigned int i = p; i < DATA_SIZE; i += num_producers) {
+        produceSample(i);
+      }
+    }));
+  }
+
+  auto consumer = std::async(std::launch::async, [this]() {
+    for (unsigned int i = 0u; i < DATA_SIZE / iq->batch(); ++i) {
+      consumeIteration();
+    }
+  });
+
+  for (auto &producer : producers) {
+    producer.get();
+  }
+  consumer.get();
+
+  EXPECT_FLOAT_EQ(sum_from_producer, sum_from_consumer);
+}
+
 TEST_P(IterQueueScenarios, produceAndConsumPartiallyFilledBatch_p) {
   auto b = iq->batch();
   if (b == 1) {
@@ -576,6 +601,43 @@ GTEST_PARAMETER_TEST(IterQueue, IterQueueScenarios,
                                        multi_slot_single_batch,
                                        single_slot_single_batch));
 
+/**
+ * @brief fill two iterations in reverse order and return the first value of
+ * the iterations in the order they are served
+ */
+static std::vector<float> serveReverselyFilled(bool in_order) {
+  nntrainer::IterationQueue iq(2, {{1, 1, 1, 2}}, {{1, 1, 1, 1}}, in_order);
+  auto first = std::make_unique<nntrainer::ScopedView<nntrainer::Sample>>(
+    iq.requestEmptySlot());
+  auto second = std::make_unique<nntrainer::ScopedView<nntrainer::Sample>>(
+    iq.requestEmptySlot());
+  first->get().getInputsRef()[0].setValue(1.0f);
+  second->get().getInputsRef()[0].setValue(2.0f);
+
+  /// finish the second iteration ahead of the first one
+  second.reset();
+  first.reset();
+  iq.notifyEndOfRequestEmpty();
+
+  std::vector<float> served;
+  while (true) {
+    auto iter_view = iq.requestFilledSlot();
+    if (iter_view.isEmpty()) {
+      break;
+    }
+    served.push_back(iter_view.get().getInputsRef()[0].getValue(0, 0, 0, 0));
+  }
+  return served;
+}
+
+TEST(IterQueue, serveInFillingOrder_p) {
+  EXPECT_EQ(serveReverselyFilled(true), std::vector<float>({1.0f, 2.0f}));
+}
+
+TEST(IterQueue, serveAsSoonAsFilled_p) {
+  EXPECT_EQ(serveReverselyFilled(false), std::vector<float>({2.0f, 1.0f}));
+}
+
 TEST(IterQueue, constructEmptySlots_01_n) {
   EXPECT_ANY_THROW(nntrainer::IterationQueue(0, {}, {}));
 }
@@ -18,6 +18,10 @@
 
 #include <nntrainer_test_util.h>
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+
 static const std::string getTestResPath(const std::string &file) {
   return getResPath(file, {"test"});
 }
@@ -53,5 +57,60 @@ auto batch_too_big = DataProducerSemanticsParamType(
   {{50000, 1, 1, 10}}, nullptr,
   DataProducerSemanticsExpectedResult::FAIL_AT_FINALIZE);
 
+auto training_set_stream = DataProducerSemanticsParamType(
+  createDataProducer<nntrainer::RawFileDataProducer>,
+  {"path=" + getTestResPath("trainingSet.dat"), "mmap=false"},
+  {{20, 3, 32, 32}}, {{20, 1, 1, 10}}, validate,
+  DataProducerSemanticsExpectedResult::SUCCESS);
+
 GTEST_PARAMETER_TEST(RawFile, DataProducerSemantics,
-                     ::testing::Values(training_set, valSet, testSet));
+                     ::testing::Values(training_set, valSet, testSet,
+                                       training_set_stream));
+
+/**
+ * @brief read the samples of the given indices into one tensor each
+ */
+static std::vector<nntrainer::Tensor>
+readSamples(nntrainer::DataProducer &producer,
+            const std::vector<unsigned int> &order) {
+  auto gen = producer.finalize({{1, 3, 32, 32}}, {{1, 1, 1, 10}});
+  producer.setAccessOrder(order);
+
+  std::vector<nntrainer::Tensor> samples;
+  for (auto idx : order) {
+    std::vector<nntrainer::Tensor> inputs = {nntrainer::Tensor(1, 3, 32, 32)};
+    std::vector<nntrainer::Tensor> labels = {nntrainer::Tensor(1, 1, 1, 10)};
+    gen(idx, inputs, labels);
+    samples.push_back(inputs[0]);
+    samples.push_back(labels[0]);
+  }
+  return samples;
+}
+
+TEST(RawFile, mmapSameAsStream_p) {
+  std::string path = "path=" + getTestResPath("trainingSet.dat");
+  nntrainer::RawFileDataProducer mapped, streamed;
+  mapped.setProperty({path});
+  streamed.setProperty({path, "mmap=false"});
+
+  auto size = mapped.size({{1, 3, 32, 32}}, {{1, 1, 1, 10}});
+  std::vector<unsigned int> order(size);
+  std::iota(order.begin(), order.end(), 0);
+  std::mt19937 rng(0);
+  std::shuffle(order.begin(), order.end(), rng);
+  order.resize(64);
+
+  auto expected = readSamples(streamed, order);
+  auto actual = readSamples(mapped, order);
+  EXPECT_TRUE(mapped.isMultiThreadSafe());
+  EXPECT_FALSE(streamed.isMultiThreadSafe());
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(RawFile, mmapAccessOrderOutOfBound_n) {
+  nntrainer::RawFileDataProducer producer;
+  producer.setProperty({"path=" + getTestResPath("trainingSet.dat")});
+  auto gen = producer.finalize({{1, 3, 32, 32}}, {{1, 1, 1, 10}});
+  auto size = producer.size({{1, 3, 32, 32}}, {{1, 1, 1, 10}});
+  EXPECT_THROW(producer.setAccessOrder({0, size}), std::invalid_argument);
+}
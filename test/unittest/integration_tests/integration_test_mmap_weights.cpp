@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   integration_test_mmap_weights.cpp
+ * @date   17 Oct 2026
+ * @brief  Integration test for loading inference weights by memory mapping
+ * @see    https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug    No known bugs except for NYI items
+ */
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <layer.h>
+#include <model.h>
+#include <optimizer.h>
+#include <util_func.h>
+
+/**
+ * @brief create a small fc model
+ */
+static std::unique_ptr<ml::train::Model>
+createFcModel(const std::vector<std::string> &props) {
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET,
+                                      {nntrainer::withKey("loss", "mse")});
+  model->addLayer(ml::train::createLayer(
+    "input", {nntrainer::withKey("name", "input0"),
+              nntrainer::withKey("input_shape", "1:1:32")}));
+  for (int i = 0; i < 3; i++) {
+    model->addLayer(ml::train::createLayer(
+      "fully_connected",
+      {nntrainer::withKey("name", "fc" + std::to_string(i)),
+       nntrainer::withKey("unit", 64),
+       nntrainer::withKey("weight_initializer", "xavier_uniform"),
+       nntrainer::withKey("bias_initializer", "ones")}));
+  }
+  model->setProperty(props);
+  return model;
+}
+
+/**
+ * @brief create a model for inference and load the given file
+ */
+static std::unique_ptr<ml::train::Model>
+loadModel(const std::string &path, const std::string &map_weights) {
+  auto model = createFcModel({nntrainer::withKey("batch_size", 1),
+                              nntrainer::withKey("memory_map_weights",
+                                                 map_weights)});
+  EXPECT_EQ(model->compile(ml::train::ExecutionMode::INFERENCE),
+            ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(ml::train::ExecutionMode::INFERENCE),
+            ML_ERROR_NONE);
+  model->load(path);
+  return model;
+}
+
+/**
+ * @brief run inference on a fixed input
+ */
+static std::vector<float> infer(ml::train::Model &model) {
+  std::vector<float> input(32);
+  for (unsigned int i = 0; i < input.size(); ++i)
+    input[i] = i * 0.1f;
+
+  std::vector<float *> in = {input.data()};
+  auto out = model.inference(1, in);
+  return std::vector<float>(out[0], out[0] + 64);
+}
+
+/**
+ * @brief address range of the mapping of @a path in this process, [0, 0) if
+ * the file is not mapped
+ */
+static std::pair<uintptr_t, uintptr_t> mappedRange(const std::string &path) {
+  char resolved[PATH_MAX];
+  if (!realpath(path.c_str(), resolved))
+    return {0, 0};
+
+  std::ifstream maps("/proc/self/maps");
+  std::string line;
+  while (std::getline(maps, line)) {
+    /// start-end perms offset dev inode path
+    std::istringstream fields(line);
+    std::string range, perms, offset, dev, inode, file;
+    fields >> range >> perms >> offset >> dev >> inode >> file;
+    if (file != resolved)
+      continue;
+
+    auto dash = range.find('-');
+    return {std::stoull(range.substr(0, dash), nullptr, 16),
+            std::stoull(range.substr(dash + 1), nullptr, 16)};
+  }
+  return {0, 0};
+}
+
+TEST(mmap_weights, same_as_read_p) {
+  const std::string path = "mmap_weights_fc.bin";
+  {
+    auto model = createFcModel({nntrainer::withKey("batch_size", 1)});
+    model->setOptimizer(ml::train::createOptimizer("sgd"));
+    ASSERT_EQ(model->compile(), ML_ERROR_NONE);
+    ASSERT_EQ(model->initialize(), ML_ERROR_NONE);
+    model->save(path, ml::train::ModelFormat::MODEL_FORMAT_BIN);
+  }
+
+  auto read_model = loadModel(path, "false");
+  auto mapped_model = loadModel(path, "true");
+  auto expected = infer(*read_model);
+  auto actual = infer(*mapped_model);
+
+  EXPECT_EQ(actual, expected);
+  EXPECT_NE(expected, std::vector<float>(64, 0.0f));
+
+#ifdef USE_MMAP
+  /// the weights point into the file, they were not read into the pool
+  auto [begin, end] = mappedRange(path);
+  ASSERT_LT(begin, end) << path << " is not mapped";
+  for (int i = 0; i < 3; ++i) {
+    const std::string name = "fc" + std::to_string(i);
+    std::shared_ptr<ml::train::Layer> layer;
+    ASSERT_EQ(mapped_model->getLayer(name.c_str(), &layer), ML_ERROR_NONE);
+    for (float *w : layer->getWeights()) {
+      auto addr = reinterpret_cast<uintptr_t>(w);
+      EXPECT_TRUE(begin <= addr && addr < end) << name << " is not mapped";
+    }
+
+    ASSERT_EQ(read_model->getLayer(name.c_str(), &layer), ML_ERROR_NONE);
+    for (float *w : layer->getWeights()) {
+      auto addr = reinterpret_cast<uintptr_t>(w);
+      EXPECT_FALSE(begin <= addr && addr < end) << name << " is mapped";
+    }
+  }
+#endif
+
+  read_model.reset();
+  mapped_model.reset();
+  std::remove(path.c_str());
+}
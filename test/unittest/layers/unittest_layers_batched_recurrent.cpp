@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file unittest_layers_batched_recurrent.cpp
+ * @date 17 Oct 2026
+ * @brief Compare the batched GRU / LSTM / RNN engines with the per-sequence
+ * path
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug No known bugs except for NYI items
+ */
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <gru.h>
+#include <layer_context.h>
+#include <lstm.h>
+#include <random_stream.h>
+#include <rnn.h>
+#include <var_grad.h>
+#include <weight.h>
+
+namespace {
+
+using nntrainer::Tensor;
+using nntrainer::TensorDim;
+
+/** seed of the dropout masks, drawn again for every forwarding */
+constexpr uint64_t MASK_SEED = 17;
+
+/**
+ * @brief a finalized recurrent layer with its tensors allocated, on the
+ * batched engine or on the per-sequence path
+ */
+template <typename LayerType> struct RecurrentRunner {
+  LayerType layer;
+  std::vector<nntrainer::Weight> weights;
+  std::vector<nntrainer::Var_Grad> ins;
+  std::vector<nntrainer::Var_Grad> outs;
+  std::vector<nntrainer::Var_Grad> tensors;
+  nntrainer::RunLayerContext rc;
+
+  RecurrentRunner(const std::vector<std::string> &props,
+                  const TensorDim &in_dim, bool batched) {
+    layer.setProperty(props);
+    if (!batched)
+      layer.disableBatchedEngine();
+
+    nntrainer::InitLayerContext context({in_dim}, {true}, false, "test");
+    layer.finalize(context);
+
+    weights.reserve(context.getWeightsSpec().size());
+    for (auto &spec : context.getWeightsSpec()) {
+      weights.emplace_back(spec, true);
+      weights.back().getGradientRef().setZero();
+    }
+
+    ins.emplace_back(in_dim, nntrainer::Initializer::NONE, true, true, "in");
+
+    outs.reserve(context.getOutSpecs().size());
+    for (auto &spec : context.getOutSpecs())
+      outs.emplace_back(spec.variable_spec.dim, nntrainer::Initializer::NONE,
+                        true, true, "out");
+
+    tensors.reserve(context.getTensorsSpec().size());
+    for (auto &spec : context.getTensorsSpec())
+      tensors.emplace_back(spec, true);
+
+    rc = nntrainer::RunLayerContext("test", true, 0.0f, false, 1.0f, false,
+                                    view(weights), view(ins), view(outs),
+                                    view(tensors));
+  }
+
+  /**
+   * @brief pointers to @a vgs
+   */
+  template <typename T> static std::vector<T *> view(std::vector<T> &vgs) {
+    std::vector<T *> v;
+    for (auto &vg : vgs)
+      v.push_back(&vg);
+    return v;
+  }
+};
+
+/**
+ * @brief expect @a a and @a b to be close elementwise
+ */
+void expectClose(const Tensor &a, const Tensor &b, float tol,
+                 const std::string &what) {
+  ASSERT_EQ(a.size(), b.size()) << what;
+  for (unsigned int i = 0; i < a.size(); ++i)
+    ASSERT_NEAR(a.getValue(i), b.getValue(i), tol) << what << " at " << i;
+}
+
+/**
+ * @brief run the batched engine and the per-sequence path on the same inputs
+ * and compare output, input derivative and weight gradients. The masks of
+ * both are drawn from the same seed; a unit that is a multiple of 4 makes the
+ * per-timestep draws of the per-sequence path line up with the single draw of
+ * the batched engine.
+ */
+template <typename LayerType>
+void compareBatchedWithPerSequence(const std::vector<std::string> &props,
+                                   const TensorDim &in_dim) {
+  RecurrentRunner<LayerType> batched(props, in_dim, true);
+  RecurrentRunner<LayerType> per_seq(props, in_dim, false);
+  ASSERT_EQ(batched.weights.size(), per_seq.weights.size());
+
+  for (unsigned int i = 0; i < batched.weights.size(); ++i) {
+    batched.weights[i].getVariableRef().setRandUniform(-0.5f, 0.5f);
+    per_seq.weights[i].getVariableRef().copyData(
+      batched.weights[i].getVariableRef());
+  }
+  batched.rc.getInput(0).setRandUniform(-1.0f, 1.0f);
+  per_seq.rc.getInput(0).copyData(batched.rc.getInput(0));
+
+  nntrainer::RandomStream::Global().setSeed(MASK_SEED);
+  batched.layer.forwarding(batched.rc, true);
+  nntrainer::RandomStream::Global().setSeed(MASK_SEED);
+  per_seq.layer.forwarding(per_seq.rc, true);
+  expectClose(batched.rc.getOutput(0), per_seq.rc.getOutput(0), 1e-5f,
+              "output");
+
+  batched.rc.getOutputGradUnsafe(0).setRandUniform(-1.0f, 1.0f);
+  per_seq.rc.getOutputGradUnsafe(0).copyData(
+    batched.rc.getOutputGradUnsafe(0));
+
+  batched.layer.calcGradient(batched.rc);
+  per_seq.layer.calcGradient(per_seq.rc);
+  batched.layer.calcDerivative(batched.rc);
+  per_seq.layer.calcDerivative(per_seq.rc);
+
+  expectClose(batched.rc.getOutgoingDerivative(0),
+              per_seq.rc.getOutgoingDerivative(0), 1e-4f, "derivative");
+  for (unsigned int i = 0; i < batched.weights.size(); ++i)
+    expectClose(batched.rc.getWeightGrad(i), per_seq.rc.getWeightGrad(i),
+                1e-4f, "gradient " + std::to_string(i));
+}
+
+/** batch of 3 sequences of 5 steps with 7 features */
+const TensorDim in_dim(3, 1, 5, 7);
+
+} // namespace
+
+TEST(BatchedRecurrent, gru_p) {
+  for (const char *seq : {"return_sequences=false", "return_sequences=true"}) {
+    for (const char *bias : {"integrate_bias=true", "integrate_bias=false"}) {
+      for (const char *reset : {"reset_after=false", "reset_after=true"}) {
+        SCOPED_TRACE(std::string(seq) + " " + bias + " " + reset);
+        compareBatchedWithPerSequence<nntrainer::GRULayer>(
+          {"unit=8", seq, bias, reset}, in_dim);
+      }
+    }
+  }
+}
+
+TEST(BatchedRecurrent, gru_dropout_p) {
+  /// without return_sequences one mask row is shared by every timestep
+  for (const char *seq : {"return_sequences=false", "return_sequences=true"}) {
+    for (const char *reset : {"reset_after=false", "reset_after=true"}) {
+      SCOPED_TRACE(std::string(seq) + " " + reset);
+      compareBatchedWithPerSequence<nntrainer::GRULayer>(
+        {"unit=8", seq, "integrate_bias=false", reset, "dropout_rate=0.3"},
+        in_dim);
+    }
+  }
+}
+
+TEST(BatchedRecurrent, lstm_p) {
+  for (const char *seq : {"return_sequences=false", "return_sequences=true"}) {
+    for (const char *bias : {"integrate_bias=true", "integrate_bias=false"}) {
+      for (const char *bidir : {"bidirectional=false", "bidirectional=true"}) {
+        SCOPED_TRACE(std::string(seq) + " " + bias + " " + bidir);
+        compareBatchedWithPerSequence<nntrainer::LSTMLayer>(
+          {"unit=8", seq, bias, bidir}, in_dim);
+      }
+    }
+  }
+}
+
+TEST(BatchedRecurrent, lstm_dropout_p) {
+  for (const char *seq : {"return_sequences=false", "return_sequences=true"}) {
+    SCOPED_TRACE(seq);
+    compareBatchedWithPerSequence<nntrainer::LSTMLayer>(
+      {"unit=8", seq, "integrate_bias=false", "dropout_rate=0.3"}, in_dim);
+  }
+}
+
+TEST(BatchedRecurrent, rnn_p) {
+  for (const char *seq : {"return_sequences=false", "return_sequences=true"}) {
+    for (const char *bias : {"integrate_bias=true", "integrate_bias=false"}) {
+      SCOPED_TRACE(std::string(seq) + " " + bias);
+      compareBatchedWithPerSequence<nntrainer::RNNLayer>({"unit=8", seq, bias},
+                                                         in_dim);
+    }
+  }
+}
+
+TEST(BatchedRecurrent, rnn_dropout_p) {
+  /// without return_sequences one mask row is shared by every timestep
+  for (const char *seq : {"return_sequences=false", "return_sequences=true"}) {
+    SCOPED_TRACE(seq);
+    compareBatchedWithPerSequence<nntrainer::RNNLayer>(
+      {"unit=8", seq, "integrate_bias=false", "dropout_rate=0.3"}, in_dim);
+  }
+}
@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file unittest_layers_depthwise_convolution2d.cpp
+ * @date 17 Oct 2026
+ * @brief Depthwise Conv2d Layer Test
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug No known bugs except for NYI items
+ */
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <conv2d_layer.h>
+#include <depthwise_conv2d_layer.h>
+#include <layer_context.h>
+#include <layers_common_tests.h>
+#include <var_grad.h>
+#include <weight.h>
+
+auto semantic_depthwise_conv2d = LayerSemanticsParamType(
+  nntrainer::createLayer<nntrainer::DepthwiseConv2DLayer>,
+  nntrainer::DepthwiseConv2DLayer::type,
+  {"filters=1", "kernel_size=1,1", "padding=1,1"},
+  LayerCreateSetPropertyOptions::AVAILABLE_FROM_APP_CONTEXT, false, 1);
+
+GTEST_PARAMETER_TEST(DepthwiseConvolution2D, LayerSemantics,
+                     ::testing::Values(semantic_depthwise_conv2d));
+
+namespace {
+
+using nntrainer::Tensor;
+using nntrainer::TensorDim;
+
+/**
+ * @brief a finalized layer with its tensors allocated
+ */
+struct LayerRunner {
+  std::unique_ptr<nntrainer::Layer> layer;
+  std::vector<nntrainer::Weight> weights;
+  std::vector<nntrainer::Var_Grad> ins;
+  std::vector<nntrainer::Var_Grad> outs;
+  nntrainer::RunLayerContext rc;
+
+  LayerRunner(std::unique_ptr<nntrainer::Layer> &&l,
+              const std::vector<std::string> &props, const TensorDim &in_dim) :
+    layer(std::move(l)) {
+    layer->setProperty(props);
+    nntrainer::InitLayerContext context({in_dim}, {true}, false, "test");
+    layer->finalize(context);
+
+    weights.reserve(context.getWeightsSpec().size());
+    for (auto &spec : context.getWeightsSpec()) {
+      weights.emplace_back(spec, true);
+      weights.back().getVariableRef().setRandUniform(-1.0f, 1.0f);
+    }
+    ins.emplace_back(in_dim, nntrainer::Initializer::NONE, true, true, "in");
+    for (auto &spec : context.getOutSpecs())
+      outs.emplace_back(spec.variable_spec.dim, nntrainer::Initializer::NONE,
+                        true, true, "out");
+
+    std::vector<nntrainer::Weight *> w;
+    for (auto &weight : weights)
+      w.push_back(&weight);
+    rc = nntrainer::RunLayerContext("test", true, 0.0f, false, 1.0f, false, w,
+                                    {&ins[0]}, {&outs[0]}, {});
+  }
+};
+
+/**
+ * @brief run a depthwise convolution and the conv2d with the equivalent block
+ * diagonal kernel, and compare output, derivative and gradients
+ */
+void compareWithConv2D(const std::vector<std::string> &props,
+                       unsigned int filters, const TensorDim &in_dim) {
+  std::vector<std::string> dw_props = props;
+  std::vector<std::string> conv_props = props;
+  dw_props.push_back("filters=" + std::to_string(filters));
+  conv_props.push_back("filters=" + std::to_string(filters));
+
+  LayerRunner dw(
+    nntrainer::createLayer<nntrainer::DepthwiseConv2DLayer>(), dw_props,
+    in_dim);
+  LayerRunner conv(nntrainer::createLayer<nntrainer::Conv2DLayer>(),
+                   conv_props, in_dim);
+
+  const unsigned int multiplier = filters / in_dim.channel();
+  Tensor &dw_kernel = dw.rc.getWeight(0);
+  Tensor &conv_kernel = conv.rc.getWeight(0);
+  conv_kernel.setZero();
+  for (unsigned int f = 0; f < filters; ++f)
+    for (unsigned int h = 0; h < dw_kernel.height(); ++h)
+      for (unsigned int w = 0; w < dw_kernel.width(); ++w)
+        conv_kernel.setValue(f, f / multiplier, h, w,
+                             dw_kernel.getValue<float>(f, 0, h, w));
+  conv.rc.getWeight(1).copyData(dw.rc.getWeight(1));
+
+  dw.rc.getInput(0).setRandUniform(-1.0f, 1.0f);
+  conv.rc.getInput(0).copyData(dw.rc.getInput(0));
+
+  dw.layer->forwarding(dw.rc, true);
+  conv.layer->forwarding(conv.rc, true);
+  EXPECT_EQ(dw.rc.getOutput(0).getDim(), conv.rc.getOutput(0).getDim());
+
+  const Tensor &dw_out = dw.rc.getOutput(0);
+  const Tensor &conv_out = conv.rc.getOutput(0);
+  for (unsigned int i = 0; i < dw_out.size(); ++i)
+    EXPECT_NEAR(dw_out.getValue(i), conv_out.getValue(i), 1e-4f);
+
+  dw.rc.getOutputGradUnsafe(0).setRandUniform(-1.0f, 1.0f);
+  conv.rc.getOutputGradUnsafe(0).copyData(dw.rc.getOutputGradUnsafe(0));
+
+  dw.layer->calcGradient(dw.rc);
+  conv.layer->calcGradient(conv.rc);
+  dw.layer->calcDerivative(dw.rc);
+  conv.layer->calcDerivative(conv.rc);
+
+  const Tensor &dw_deriv = dw.rc.getOutgoingDerivative(0);
+  const Tensor &conv_deriv = conv.rc.getOutgoingDerivative(0);
+  for (unsigned int i = 0; i < dw_deriv.size(); ++i)
+    EXPECT_NEAR(dw_deriv.getValue(i), conv_deriv.getValue(i), 1e-4f);
+
+  const Tensor &dw_grad = dw.rc.getWeightGrad(0);
+  const Tensor &conv_grad = conv.rc.getWeightGrad(0);
+  for (unsigned int f = 0; f < filters; ++f)
+    for (unsigned int h = 0; h < dw_grad.height(); ++h)
+      for (unsigned int w = 0; w < dw_grad.width(); ++w)
+        EXPECT_NEAR(dw_grad.getValue<float>(f, 0, h, w),
+                    conv_grad.getValue<float>(f, f / multiplier, h, w), 1e-3f);
+
+  const Tensor &dw_bias = dw.rc.getWeightGrad(1);
+  const Tensor &conv_bias = conv.rc.getWeightGrad(1);
+  for (unsigned int i = 0; i < dw_bias.size(); ++i)
+    EXPECT_NEAR(dw_bias.getValue(i), conv_bias.getValue(i), 1e-3f);
+}
+
+} // namespace
+
+TEST(DepthwiseConvolution2D, k3_stride1_same_p) {
+  compareWithConv2D({"kernel_size=3,3", "padding=same"}, 4,
+                    TensorDim(2, 4, 9, 11));
+}
+
+TEST(DepthwiseConvolution2D, k3_stride2_same_p) {
+  compareWithConv2D({"kernel_size=3,3", "stride=2,2", "padding=same"}, 3,
+                    TensorDim(3, 3, 10, 7));
+}
+
+TEST(DepthwiseConvolution2D, k5_stride1_valid_multiplier_p) {
+  compareWithConv2D({"kernel_size=5,5"}, 6, TensorDim(2, 3, 8, 8));
+}
+
+TEST(DepthwiseConvolution2D, k5_stride2_dilation_p) {
+  compareWithConv2D(
+    {"kernel_size=5,5", "stride=2,2", "dilation=2,2", "padding=2,3"}, 2,
+    TensorDim(1, 2, 13, 12));
+}
+
+TEST(DepthwiseConvolution2D, k3_stride3_asymmetric_p) {
+  compareWithConv2D({"kernel_size=3,2", "stride=3,1", "padding=1,0,2,1"}, 4,
+                    TensorDim(2, 2, 7, 9));
+}
+
+TEST(DepthwiseConvolution2D, default_filters_p) {
+  auto layer = nntrainer::createLayer<nntrainer::DepthwiseConv2DLayer>();
+  layer->setProperty({"kernel_size=3,3", "padding=same"});
+  nntrainer::InitLayerContext context({TensorDim(1, 5, 4, 4)}, {true}, false,
+                                      "test");
+  layer->finalize(context);
+  EXPECT_EQ(context.getOutSpecs()[0].variable_spec.dim, TensorDim(1, 5, 4, 4));
+}
+
+TEST(DepthwiseConvolution2D, filters_not_multiple_of_channels_n) {
+  auto layer = nntrainer::createLayer<nntrainer::DepthwiseConv2DLayer>();
+  layer->setProperty({"filters=5", "kernel_size=3,3"});
+  nntrainer::InitLayerContext context({TensorDim(1, 2, 4, 4)}, {true}, false,
+                                      "test");
+  EXPECT_THROW(layer->finalize(context), std::invalid_argument);
+}
@@ -9,12 +9,18 @@
  * @author hyeonseok Lee <hs89.lee@samsung.com>
  * @bug No known bugs except for NYI items
  */
+#include <memory>
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include <layer_context.h>
 #include <layers_common_tests.h>
 #include <multi_head_attention_layer.h>
+#include <var_grad.h>
+#include <weight.h>
 
 auto semantic_multi_head_attention = LayerSemanticsParamType(
   nntrainer::createLayer<nntrainer::MultiHeadAttentionLayer>,
@@ -121,3 +127,243 @@ GTEST_PARAMETER_TEST(
                     multi_head_attention_value_dim_w16a16,
                     multi_head_attention_output_shape_w16a16));
 #endif
+
+namespace {
+
+using nntrainer::Tensor;
+using nntrainer::TensorDim;
+
+/** large negative value of a masked score */
+constexpr float MASKED = -1e10f;
+
+/**
+ * @brief a finalized multi head attention layer with its tensors allocated.
+ * The unfused layer returns the attention weight, which keeps it off the
+ * fused path.
+ */
+struct MhaRunner {
+  std::unique_ptr<nntrainer::Layer> layer;
+  std::vector<nntrainer::Weight> weights;
+  std::vector<nntrainer::Var_Grad> ins;
+  std::vector<nntrainer::Var_Grad> outs;
+  std::vector<nntrainer::Var_Grad> tensors;
+  nntrainer::RunLayerContext rc;
+
+  MhaRunner(const std::vector<std::string> &props,
+            const std::vector<TensorDim> &in_dims, bool fused) :
+    layer(nntrainer::createLayer<nntrainer::MultiHeadAttentionLayer>()) {
+    layer->setProperty(props);
+    if (!fused)
+      layer->setProperty({"return_attention_weight=after"});
+
+    /// the attention weight is the second output of the unfused layer
+    nntrainer::InitLayerContext context(
+      in_dims, std::vector<bool>(fused ? 1 : 2, true), false, "test");
+    layer->finalize(context);
+
+    weights.reserve(context.getWeightsSpec().size());
+    for (auto &spec : context.getWeightsSpec()) {
+      weights.emplace_back(spec, true);
+      weights.back().getGradientRef().setZero();
+    }
+
+    ins.reserve(in_dims.size());
+    for (auto &dim : in_dims)
+      ins.emplace_back(dim, nntrainer::Initializer::NONE, true, true, "in");
+
+    outs.reserve(context.getOutSpecs().size());
+    for (auto &spec : context.getOutSpecs())
+      outs.emplace_back(spec.variable_spec.dim, nntrainer::Initializer::NONE,
+                        true, true, "out");
+
+    tensors.reserve(context.getTensorsSpec().size());
+    for (auto &spec : context.getTensorsSpec())
+      tensors.emplace_back(spec, true);
+
+    rc = runContext(view(ins), view(outs));
+  }
+
+  /**
+   * @brief context on the layer weights and tensors with other in/outputs
+   */
+  nntrainer::RunLayerContext
+  runContext(const std::vector<nntrainer::Var_Grad *> &in,
+             const std::vector<nntrainer::Var_Grad *> &out) {
+    std::vector<nntrainer::Weight *> w;
+    for (auto &weight : weights)
+      w.push_back(&weight);
+    return nntrainer::RunLayerContext("test", true, 0.0f, false, 1.0f, false,
+                                      w, in, out, view(tensors));
+  }
+
+  /**
+   * @brief pointers to @a vgs
+   */
+  static std::vector<nntrainer::Var_Grad *>
+  view(std::vector<nntrainer::Var_Grad> &vgs) {
+    std::vector<nntrainer::Var_Grad *> v;
+    for (auto &vg : vgs)
+      v.push_back(&vg);
+    return v;
+  }
+};
+
+/**
+ * @brief expect @a a and @a b to be close elementwise
+ */
+void expectClose(const Tensor &a, const Tensor &b, float tol,
+                 const std::string &what) {
+  ASSERT_EQ(a.size(), b.size()) << what;
+  for (unsigned int i = 0; i < a.size(); ++i)
+    ASSERT_NEAR(a.getValue(i), b.getValue(i), tol) << what << " at " << i;
+}
+
+/**
+ * @brief run the fused and the unfused layer on the same inputs and compare
+ * output, input derivatives and weight gradients
+ */
+void compareFusedWithUnfused(const std::vector<std::string> &props,
+                             const std::vector<TensorDim> &in_dims,
+                             const Tensor &mask = Tensor()) {
+  MhaRunner fused(props, in_dims, true);
+  MhaRunner unfused(props, in_dims, false);
+  ASSERT_EQ(fused.rc.getNumOutputs(), 1u);
+  ASSERT_EQ(unfused.rc.getNumOutputs(), 2u);
+  ASSERT_EQ(fused.weights.size(), unfused.weights.size());
+
+  for (unsigned int i = 0; i < fused.weights.size(); ++i) {
+    fused.weights[i].getVariableRef().setRandUniform(-0.5f, 0.5f);
+    unfused.weights[i].getVariableRef().copyData(
+      fused.weights[i].getVariableRef());
+  }
+  for (unsigned int i = 0; i < 3; ++i) {
+    fused.rc.getInput(i).setRandUniform(-1.0f, 1.0f);
+    unfused.rc.getInput(i).copyData(fused.rc.getInput(i));
+  }
+  if (in_dims.size() == 4) {
+    fused.rc.getInput(3).copyData(mask);
+    unfused.rc.getInput(3).copyData(mask);
+  }
+
+  fused.layer->forwarding(fused.rc, true);
+  unfused.layer->forwarding(unfused.rc, true);
+  expectClose(fused.rc.getOutput(0), unfused.rc.getOutput(0), 1e-4f,
+              "output");
+
+  fused.rc.getOutputGradUnsafe(0).setRandUniform(-1.0f, 1.0f);
+  unfused.rc.getOutputGradUnsafe(0).copyData(fused.rc.getOutputGradUnsafe(0));
+  unfused.rc.getOutputGradUnsafe(1).setZero();
+
+  fused.layer->calcGradient(fused.rc);
+  unfused.layer->calcGradient(unfused.rc);
+  fused.layer->calcDerivative(fused.rc);
+  unfused.layer->calcDerivative(unfused.rc);
+
+  for (unsigned int i = 0; i < in_dims.size(); ++i)
+    expectClose(fused.rc.getOutgoingDerivative(i),
+                unfused.rc.getOutgoingDerivative(i), 1e-4f,
+                "derivative " + std::to_string(i));
+
+  for (unsigned int i = 0; i < fused.weights.size(); ++i)
+    expectClose(fused.rc.getWeightGrad(i), unfused.rc.getWeightGrad(i), 1e-3f,
+                "gradient " + std::to_string(i));
+}
+
+} // namespace
+
+/**
+ * @brief more query rows than a query tile and more keys than a key tile,
+ * neither a multiple of the tile
+ */
+TEST(MultiHeadAttention, fused_long_sequences_p) {
+  compareFusedWithUnfused(
+    {"num_heads=2", "projected_key_dim=4", "projected_value_dim=3"},
+    {TensorDim(2, 1, 45, 6), TensorDim(2, 1, 83, 7), TensorDim(2, 1, 83, 7)});
+}
+
+/**
+ * @brief explicit mask with partly and fully masked rows
+ */
+TEST(MultiHeadAttention, fused_mask_p) {
+  const unsigned int batch = 2, heads = 2, q_len = 45, k_len = 83;
+  Tensor mask(TensorDim(batch, heads, q_len, k_len));
+  mask.setRandUniform(-2.0f, 0.0f);
+  for (unsigned int b = 0; b < batch; ++b)
+    for (unsigned int h = 0; h < heads; ++h)
+      for (unsigned int i = 0; i < q_len; ++i)
+        for (unsigned int j = 0; j < k_len; ++j)
+          if ((i * 7 + j * 3 + b + h) % 5 == 0)
+            mask.setValue(b, h, i, j, MASKED);
+
+  for (unsigned int j = 0; j < k_len; ++j) {
+    /// fully masked rows in the first and in the second query tile
+    mask.setValue(0, 1, 3, j, MASKED);
+    mask.setValue(1, 0, 40, j, MASKED);
+    /// a row whose first key tile is fully masked
+    if (j < 64)
+      mask.setValue(1, 1, 10, j, MASKED);
+  }
+
+  compareFusedWithUnfused(
+    {"num_heads=2", "projected_key_dim=4", "projected_value_dim=3"},
+    {TensorDim(batch, 1, q_len, 6), TensorDim(batch, 1, k_len, 7),
+     TensorDim(batch, 1, k_len, 7), TensorDim(batch, heads, q_len, k_len)},
+    mask);
+}
+
+/**
+ * @brief incremental forwarding over the key/value cache, first rows [0, from)
+ * then rows [from, to), against the unfused layer with a causal mask
+ */
+TEST(MultiHeadAttention, fused_incremental_forwarding_p) {
+  const unsigned int heads = 2, len = 77, from = 40, width = 6;
+  const std::vector<std::string> props = {
+    "num_heads=2", "projected_key_dim=4", "projected_value_dim=3"};
+  const TensorDim seq_dim(1, 1, len, width);
+
+  MhaRunner unfused(
+    props, {seq_dim, seq_dim, seq_dim, TensorDim(1, heads, len, len)}, false);
+  MhaRunner fused(props, {seq_dim, seq_dim, seq_dim}, true);
+  for (unsigned int i = 0; i < fused.weights.size(); ++i) {
+    fused.weights[i].getVariableRef().setRandUniform(-0.5f, 0.5f);
+    unfused.weights[i].getVariableRef().copyData(
+      fused.weights[i].getVariableRef());
+  }
+
+  Tensor &causal = unfused.rc.getInput(3);
+  causal.setZero();
+  for (unsigned int h = 0; h < heads; ++h)
+    for (unsigned int i = 0; i < len; ++i)
+      for (unsigned int j = i + 1; j < len; ++j)
+        causal.setValue(0, h, i, j, MASKED);
+  for (unsigned int i = 0; i < 3; ++i)
+    unfused.rc.getInput(i).setRandUniform(-1.0f, 1.0f);
+  unfused.layer->forwarding(unfused.rc, false);
+  const Tensor &expected = unfused.rc.getOutput(0);
+  const unsigned int out_width = expected.width();
+
+  const unsigned int steps[][2] = {{0, from}, {from, len}};
+  for (auto &step : steps) {
+    const unsigned int begin = step[0], end = step[1], rows = end - begin;
+
+    std::vector<nntrainer::Var_Grad> ins, outs;
+    ins.reserve(3);
+    for (unsigned int i = 0; i < 3; ++i) {
+      ins.emplace_back(TensorDim(1, 1, rows, width),
+                       nntrainer::Initializer::NONE, false, true, "in");
+      ins.back().getVariableRef().copyData(
+        unfused.rc.getInput(i).getSharedDataTensor(
+          TensorDim(1, 1, rows, width), begin * width));
+    }
+    outs.emplace_back(TensorDim(1, 1, rows, out_width),
+                      nntrainer::Initializer::NONE, false, true, "out");
+
+    auto rc = fused.runContext(MhaRunner::view(ins), MhaRunner::view(outs));
+    fused.layer->incremental_forwarding(rc, begin, end, false);
+
+    expectClose(rc.getOutput(0),
+                expected.getSharedDataTensor(
+                  TensorDim(1, 1, rows, out_width), begin * out_width),
+                1e-4f, "rows from " + std::to_string(begin));
+  }
+}
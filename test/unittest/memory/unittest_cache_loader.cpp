@@ -20,6 +20,7 @@
 
 #include <cache_loader.h>
 #include <cache_pool.h>
+#include <prefetch_scheduler.h>
 #include <nntrainer_test_util.h>
 
 /**
@@ -646,6 +647,84 @@ TEST_F(CacheLoaderTest, load_async_03_p) {
   delete p;
 }
 
+/**
+ * @brief fixed lookahead is used without the limit
+ */
+TEST(PrefetchScheduler, fixed_lookahead_p) {
+  nntrainer::PrefetchScheduler scheduler(0, 2);
+  scheduler.setOrderBytes({100, 100, 100, 100});
+
+  EXPECT_EQ(scheduler.getLookahead(0), 2u);
+  EXPECT_EQ(scheduler.getLookahead(2), 1u);
+  EXPECT_EQ(scheduler.getLookahead(3), 0u);
+}
+
+/**
+ * @brief fixed lookahead is kept in the limit until a load is measured
+ */
+TEST(PrefetchScheduler, unmeasured_in_limit_p) {
+  nntrainer::PrefetchScheduler scheduler(250, 3);
+  scheduler.setOrderBytes({100, 100, 100, 100, 100});
+
+  EXPECT_EQ(scheduler.getLookahead(0), 1u);
+}
+
+/**
+ * @brief slow loads are requested further ahead, up to the limit
+ */
+TEST(PrefetchScheduler, slow_load_p) {
+  using Clock = nntrainer::PrefetchScheduler::Clock;
+  nntrainer::PrefetchScheduler scheduler(400, 1);
+  scheduler.setOrderBytes({100, 100, 100, 100, 100, 100});
+
+  /** a load of 100 bytes takes about 1 second, compute 0.1 second */
+  scheduler.recordLoad(0, 100, Clock::now() - std::chrono::seconds(1));
+  for (unsigned int o = 0; o < 6; ++o)
+    scheduler.recordCompute(o, 0.1);
+
+  EXPECT_EQ(scheduler.getLookahead(0), 3u);
+  EXPECT_EQ(scheduler.getLookahead(4), 1u);
+}
+
+/**
+ * @brief loads hidden by the compute are not requested early
+ */
+TEST(PrefetchScheduler, fast_load_p) {
+  using Clock = nntrainer::PrefetchScheduler::Clock;
+  nntrainer::PrefetchScheduler scheduler(1000, 1);
+  scheduler.setOrderBytes({100, 100, 100, 100, 100, 100});
+
+  scheduler.recordLoad(0, 100, Clock::now() - std::chrono::milliseconds(100));
+  for (unsigned int o = 0; o < 6; ++o)
+    scheduler.recordCompute(o, 10.0);
+
+  EXPECT_EQ(scheduler.getLookahead(0), 1u);
+}
+
+/**
+ * @brief stalls are counted in the stats
+ */
+TEST(PrefetchScheduler, stats_p) {
+  nntrainer::PrefetchScheduler scheduler(0, 1);
+  scheduler.setOrderBytes({100, 100, 100});
+
+  scheduler.recordWait(0.0, false);
+  scheduler.recordWait(0.5, true);
+  scheduler.recordCompute(0, 0.25);
+  scheduler.getLookahead(0);
+
+  auto stats = scheduler.getStats(true);
+  EXPECT_EQ(stats.waits, 2u);
+  EXPECT_EQ(stats.stalls, 1u);
+  EXPECT_DOUBLE_EQ(stats.stall_time, 0.5);
+  EXPECT_DOUBLE_EQ(stats.compute_time, 0.25);
+  EXPECT_EQ(stats.lookahead, 1u);
+
+  stats = scheduler.getStats();
+  EXPECT_EQ(stats.waits, 0u);
+  EXPECT_EQ(stats.lookahead, 0u);
+}
+
 /**
  * TODO: cancel and timeout logic test
  */
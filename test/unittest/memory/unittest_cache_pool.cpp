@@ -398,6 +398,88 @@ TEST_F(CachePoolTest, flush_01_p) {
   EXPECT_NO_THROW(pool->deallocate());
 }
 
+/**
+ * @brief clean data is dropped without write back
+ */
+TEST_F(CachePoolTest, write_order_01_p) {
+  EXPECT_CALL(*pool, validate).Times(4);
+  EXPECT_CALL(*pool, invalidate).Times(testing::AnyNumber());
+
+  std::shared_ptr<nntrainer::MemoryData> mem;
+  auto idx = pool->requestMemory(4, 1, 3, {1, 2, 3});
+  EXPECT_NO_THROW(pool->setWriteOrder(idx, {2}));
+  EXPECT_NO_THROW(pool->planLayout(nntrainer::BasicPlanner()));
+  EXPECT_NO_THROW(pool->allocate());
+  EXPECT_NO_THROW(mem = pool->getMemory(idx));
+  pool->getSwapStats(true);
+
+  /** first write back is always done */
+  pool->flushExcept(std::vector<unsigned int>{1});
+  pool->loadExec(1);
+  *(mem->getAddr<float>()) = TEMP_DATA1;
+  pool->flushExcept(std::vector<unsigned int>{4});
+  auto stats = pool->getSwapStats(true);
+  EXPECT_EQ(stats.write_bytes, 4u);
+  EXPECT_EQ(stats.clean_bytes, 0u);
+
+  /** read only order */
+  pool->flushExcept(std::vector<unsigned int>{1});
+  pool->loadExec(1);
+  EXPECT_EQ(*(mem->getAddr<float>()), TEMP_DATA1);
+  pool->flushExcept(std::vector<unsigned int>{4});
+  stats = pool->getSwapStats(true);
+  EXPECT_EQ(stats.read_bytes, 4u);
+  EXPECT_EQ(stats.write_bytes, 0u);
+  EXPECT_EQ(stats.clean_bytes, 4u);
+
+  /** written order */
+  pool->flushExcept(std::vector<unsigned int>{2});
+  pool->loadExec(2);
+  *(mem->getAddr<float>()) = TEMP_DATA2;
+  pool->flushExcept(std::vector<unsigned int>{4});
+  stats = pool->getSwapStats(true);
+  EXPECT_EQ(stats.write_bytes, 4u);
+  EXPECT_EQ(stats.clean_bytes, 0u);
+
+  mem->validate();
+  EXPECT_EQ(*(mem->getAddr<float>()), TEMP_DATA2);
+
+  EXPECT_NO_THROW(pool->deallocate());
+}
+
+/**
+ * @brief data is dirty if accessed at an unknown order
+ */
+TEST_F(CachePoolTest, write_order_02_p) {
+  EXPECT_CALL(*pool, validate).Times(3);
+  EXPECT_CALL(*pool, invalidate).Times(testing::AnyNumber());
+
+  std::shared_ptr<nntrainer::MemoryData> mem;
+  auto idx = pool->requestMemory(4, 1, 3, {1, 2, 3});
+  EXPECT_NO_THROW(pool->setWriteOrder(idx, {}));
+  EXPECT_NO_THROW(pool->planLayout(nntrainer::BasicPlanner()));
+  EXPECT_NO_THROW(pool->allocate());
+  EXPECT_NO_THROW(mem = pool->getMemory(idx));
+
+  mem->validate();
+  mem->invalidate();
+  pool->getSwapStats(true);
+
+  /** validated out of any order */
+  mem->validate();
+  mem->invalidate();
+  EXPECT_EQ(pool->getSwapStats(true).write_bytes, 4u);
+
+  /** a new pass is started while the data is loaded */
+  pool->flushExcept(std::vector<unsigned int>{3});
+  pool->loadExec(3);
+  pool->flushExcept(std::vector<unsigned int>{1});
+  pool->flush();
+  EXPECT_EQ(pool->getSwapStats(true).write_bytes, 4u);
+
+  EXPECT_NO_THROW(pool->deallocate());
+}
+
 /**
  * @brief load cache data by execution order
  */
@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file unittest_swap_device.cpp
+ * @date 17 Oct 2026
+ * @brief Swap Device Test
+ * @see	https://github.com/nnstreamer/nntrainer
+ * @author Samsung Electronics Co., Ltd.
+ * @bug No known bugs except for NYI items
+ */
+
+#include <cstring>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <swap_device.h>
+
+/**
+ * @brief Swap device test class
+ */
+class SwapDeviceTest : public ::testing::Test {
+public:
+  void SetUp(void) {
+    device = std::make_shared<nntrainer::SwapDevice>("tmp_swap_device");
+    device->start(len * sizeof(float) * 4);
+  }
+
+  void TearDown(void) { EXPECT_NO_THROW(device->finish()); }
+
+  /**
+   * @brief fill @a ptr with values starting from @a base
+   */
+  static void fill(void *ptr, float base) {
+    float *data = static_cast<float *>(ptr);
+    std::iota(data, data + len, base);
+  }
+
+  /**
+   * @brief check @a ptr has values starting from @a base
+   */
+  static void check(void *ptr, float base) {
+    std::vector<float> expected(len);
+    std::iota(expected.begin(), expected.end(), base);
+    EXPECT_EQ(std::memcmp(ptr, expected.data(), len * sizeof(float)), 0);
+  }
+
+  static constexpr size_t len = 300000; /**< larger than a segment */
+  std::shared_ptr<nntrainer::SwapDevice> device;
+};
+
+/**
+ * @brief write and read back without batch
+ */
+TEST_F(SwapDeviceTest, put_get_01_p) {
+  void *ptr = device->getBuffer(0, len * sizeof(float), true);
+  fill(ptr, 1.0f);
+  device->putBuffer(ptr);
+  EXPECT_EQ(device->getNumLoadedTensors(), 0u);
+
+  ptr = device->getBuffer(0, len * sizeof(float));
+  check(ptr, 1.0f);
+  device->putBuffer(ptr, true);
+}
+
+/**
+ * @brief write and read back several buffers in batches
+ */
+TEST_F(SwapDeviceTest, batch_put_get_01_p) {
+  const size_t size = len * sizeof(float);
+  std::vector<void *> ptrs;
+
+  device->beginBatch();
+  for (unsigned int i = 0; i < 4; ++i) {
+    ptrs.push_back(device->getBuffer(i * size, size, true));
+    fill(ptrs.back(), i * 10.0f);
+  }
+  for (auto &ptr : ptrs)
+    device->putBuffer(ptr);
+  device->submitBatch();
+
+  ptrs.clear();
+  device->beginBatch();
+  for (unsigned int i = 0; i < 4; ++i)
+    ptrs.push_back(device->getBuffer(i * size, size));
+  EXPECT_EQ(device->getNumLoadedTensors(), 4u);
+  device->submitBatch();
+
+  for (unsigned int i = 0; i < 4; ++i) {
+    check(ptrs[i], i * 10.0f);
+    device->putBuffer(ptrs[i], true);
+  }
+}
+
+/**
+ * @brief read of a range with a queued write of another thread sees the data
+ */
+TEST_F(SwapDeviceTest, batch_read_after_write_01_p) {
+  const size_t size = len * sizeof(float);
+
+  void *ptr = device->getBuffer(size, size, true);
+  fill(ptr, 7.0f);
+
+  device->beginBatch();
+  device->putBuffer(ptr);
+
+  std::thread reader([&]() {
+    void *read = device->getBuffer(size, size);
+    check(read, 7.0f);
+    device->putBuffer(read, true);
+  });
+  reader.join();
+
+  EXPECT_NO_THROW(device->submitBatch());
+}
+
+/**
+ * @brief sparse data is kept by the compressed tier instead of the file
+ */
+TEST_F(SwapDeviceTest, compressed_tier_01_p) {
+  const size_t size = len * sizeof(float);
+  device->setCompressedTier(size);
+  device->resetStats();
+
+  float *ptr = static_cast<float *>(device->getBuffer(0, size, true));
+  for (size_t i = 0; i < len; i += 16)
+    ptr[i] = i * 0.5f;
+  device->putBuffer(ptr, false, nntrainer::SwapCodec::ZERO);
+
+  auto stats = device->getStats();
+  EXPECT_EQ(stats.write_bytes, 0u);
+  EXPECT_EQ(stats.tier_store_bytes, size);
+
+  ptr = static_cast<float *>(device->getBuffer(0, size));
+  for (size_t i = 0; i < len; ++i)
+    EXPECT_FLOAT_EQ(ptr[i], i % 16 ? 0.0f : i * 0.5f);
+  device->putBuffer(ptr, true);
+
+  stats = device->getStats();
+  EXPECT_EQ(stats.read_bytes, 0u);
+  EXPECT_EQ(stats.tier_load_bytes, size);
+}
+
+/**
+ * @brief least recently used data is spilled to the file over the budget
+ */
+TEST_F(SwapDeviceTest, compressed_tier_02_p) {
+  const size_t size = len * sizeof(float);
+  device->setCompressedTier(size / 8);
+
+  for (unsigned int i = 0; i < 3; ++i) {
+    float *ptr = static_cast<float *>(device->getBuffer(i * size, size, true));
+    for (size_t j = 0; j < len; j += 64)
+      ptr[j] = i + 1.0f;
+    device->putBuffer(ptr, false, nntrainer::SwapCodec::ZERO);
+  }
+  device->resetStats();
+
+  for (unsigned int i = 0; i < 3; ++i) {
+    float *ptr = static_cast<float *>(device->getBuffer(i * size, size));
+    EXPECT_FLOAT_EQ(ptr[0], i + 1.0f);
+    EXPECT_FLOAT_EQ(ptr[len - 1], 0.0f);
+    device->putBuffer(ptr, true);
+  }
+  EXPECT_GT(device->getStats().read_bytes, 0u);
+  EXPECT_GT(device->getStats().tier_load_bytes, 0u);
+}
+
+/**
+ * @brief a range written to the file replaces data kept by the tier
+ */
+TEST_F(SwapDeviceTest, compressed_tier_03_p) {
+  const size_t size = len * sizeof(float);
+  device->setCompressedTier(size);
+
+  float *ptr = static_cast<float *>(device->getBuffer(0, size, true));
+  for (size_t i = 0; i < len; i += 16)
+    ptr[i] = 1.0f;
+  device->putBuffer(ptr, false, nntrainer::SwapCodec::ZERO);
+
+  ptr = static_cast<float *>(device->getBuffer(size / 2, size, true));
+  fill(ptr, 3.0f);
+  device->putBuffer(ptr);
+
+  ptr = static_cast<float *>(device->getBuffer(size / 2, size));
+  check(ptr, 3.0f);
+  device->putBuffer(ptr, true);
+
+  /** the part not written keeps the data of the tier */
+  ptr = static_cast<float *>(device->getBuffer(0, size));
+  for (size_t i = 0; i < len / 2; ++i)
+    EXPECT_FLOAT_EQ(ptr[i], i % 16 ? 0.0f : 1.0f);
+  EXPECT_FLOAT_EQ(ptr[len / 2], 3.0f);
+  device->putBuffer(ptr, true);
+}
+
+/**
+ * @brief FP32 data is packed to FP16 with the lossy codec
+ */
+TEST_F(SwapDeviceTest, compressed_tier_04_p) {
+  const size_t size = len * sizeof(float);
+  device->setCompressedTier(size);
+
+  float *ptr = static_cast<float *>(device->getBuffer(0, size, true));
+  for (size_t i = 0; i < len; ++i)
+    ptr[i] = 1.0f + (i % 1000) * 1e-3f;
+  device->putBuffer(ptr, false, nntrainer::SwapCodec::FP16);
+  EXPECT_EQ(device->getStats().write_bytes, 0u);
+
+  ptr = static_cast<float *>(device->getBuffer(0, size));
+  for (size_t i = 0; i < len; ++i)
+    EXPECT_NEAR(ptr[i], 1.0f + (i % 1000) * 1e-3f, 1e-3f);
+  device->putBuffer(ptr, true);
+}
+
+/**
+ * @brief dense data does not compress and is written to the file
+ */
+TEST_F(SwapDeviceTest, compressed_tier_05_n) {
+  const size_t size = len * sizeof(float);
+  device->setCompressedTier(size);
+  device->resetStats();
+
+  void *ptr = device->getBuffer(0, size, true);
+  fill(ptr, 1.0f);
+  device->putBuffer(ptr, false, nntrainer::SwapCodec::ZERO);
+  EXPECT_EQ(device->getStats().tier_store_bytes, 0u);
+  EXPECT_EQ(device->getStats().write_bytes, size);
+
+  ptr = device->getBuffer(0, size);
+  check(ptr, 1.0f);
+  device->putBuffer(ptr, true);
+}
+
+/**
+ * @brief put unknown buffer
+ */
+TEST_F(SwapDeviceTest, put_01_n) {
+  float data;
+  EXPECT_THROW(device->putBuffer(&data), std::invalid_argument);
+}
@@ -622,6 +622,79 @@ TEST(nntrainer_activation, mishPrime_01_p) {
   }
 }
 
+/**
+ * @brief simd activation kernels match the element-wise functions
+ */
+TEST(nntrainer_activation, acti_func_kernel_p) {
+  using nntrainer::ActiFunc;
+  using nntrainer::ActivationType;
+
+  struct {
+    ActivationType type;
+    float (*fn)(float);
+    float (*prime)(float);
+  } cases[] = {
+    {ActivationType::ACT_SIGMOID, ActiFunc::sigmoid<float>,
+     ActiFunc::sigmoidPrime<float>},
+    {ActivationType::ACT_TANH, ActiFunc::tanhFloat<float>,
+     ActiFunc::tanhPrime<float>},
+    {ActivationType::ACT_RELU, ActiFunc::relu<float>,
+     ActiFunc::reluPrime<float>},
+    {ActivationType::ACT_LEAKY_RELU, ActiFunc::leakyRelu<float>,
+     ActiFunc::leakyReluPrime<float>},
+  };
+
+  /** 37 elements to cover both the vector body and the remainder */
+  int batch = 1;
+  int channel = 1;
+  int height = 1;
+  int width = 37;
+
+  nntrainer::Tensor input(batch, channel, height, width);
+  nntrainer::Tensor incoming(batch, channel, height, width);
+  GEN_TEST_INPUT(input, (l - 18) * 0.35f);
+  GEN_TEST_INPUT(incoming, (l % 5) * 0.5f - 1.0f);
+
+  for (auto &c : cases) {
+    ActiFunc act(c.type, false);
+    nntrainer::Tensor output(1, 1, 1, 37);
+    nntrainer::Tensor outgoing(1, 1, 1, 37);
+
+    act.run_fn(input, output);
+    act.run_prime_fn(input, output, outgoing, incoming);
+
+    for (unsigned int i = 0; i < 37; ++i) {
+      float x = input.getValue(i);
+      float y = c.fn(x);
+      EXPECT_NEAR(output.getValue(i), y, tolerance);
+      EXPECT_NEAR(outgoing.getValue(i), incoming.getValue(i) * c.prime(y),
+                  tolerance);
+    }
+  }
+}
+
+/**
+ * @brief templated apply falls back for non-contiguous tensors
+ */
+TEST(nntrainer_activation, apply_inline_non_contiguous_p) {
+  int batch = 1;
+  int channel = 1;
+  int height = 4;
+  int width = 6;
+
+  nntrainer::Tensor input(batch, channel, height, width);
+  GEN_TEST_INPUT(input, (l - 12) * 0.25f);
+
+  nntrainer::Tensor sliced = input.getSharedDataTensor({1, 1, 4, 3}, 0, false);
+  nntrainer::Tensor result(1, 1, 4, 3);
+  sliced.apply<float>([](float x) { return x * 2.0f + 1.0f; }, result);
+
+  for (unsigned int h = 0; h < 4; ++h)
+    for (unsigned int w = 0; w < 3; ++w)
+      EXPECT_FLOAT_EQ(result.getValue(0, 0, h, w),
+                      input.getValue(0, 0, h, w) * 2.0f + 1.0f);
+}
+
 /**
  * @brief Main gtest
  */
@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file        unittest_nntrainer_cpu_backend_fallback.cpp
+ * @date        17 Oct 2026
+ * @brief       Unit test for the fallback sgemm and sgemv against a naive gemm
+ * @see         https://github.com/nnstreamer/nntrainer
+ * @author      Samsung Electronics Co., Ltd.
+ * @bug         No known bugs
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cpu_backend.h>
+#include <fallback_internal.h>
+#include <nntr_thread_pool.h>
+
+namespace {
+
+/**
+ * @brief random vector in [-1, 1)
+ */
+std::vector<float> ranged(size_t len, unsigned int seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> v(len);
+  for (auto &x : v)
+    x = dist(gen);
+  return v;
+}
+
+/**
+ * @brief element (r, c) of a matrix stored in @a order (0 : row major)
+ */
+inline size_t at(unsigned int order, unsigned int r, unsigned int c,
+                 unsigned int ld) {
+  return order == 0 ? (size_t)r * ld + c : (size_t)c * ld + r;
+}
+
+/**
+ * @brief C = alpha * op(A) * op(B) + beta * C, accumulated in double
+ */
+void naive_sgemm(unsigned int order, bool TransA, bool TransB, unsigned int M,
+                 unsigned int N, unsigned int K, float alpha, const float *A,
+                 unsigned int lda, const float *B, unsigned int ldb,
+                 float beta, float *C, unsigned int ldc) {
+  for (unsigned int m = 0; m < M; ++m) {
+    for (unsigned int n = 0; n < N; ++n) {
+      double sum = 0.0;
+      for (unsigned int k = 0; k < K; ++k) {
+        float a = TransA ? A[at(order, k, m, lda)] : A[at(order, m, k, lda)];
+        float b = TransB ? B[at(order, n, k, ldb)] : B[at(order, k, n, ldb)];
+        sum += (double)a * b;
+      }
+      float &c = C[at(order, m, n, ldc)];
+      c = beta == 0.0f ? alpha * sum : alpha * sum + (double)beta * c;
+    }
+  }
+}
+
+/**
+ * @brief order, TransA, TransB, M, N, K, padding of the leading dimensions
+ */
+using SgemmParam =
+  std::tuple<unsigned int, bool, bool, unsigned int, unsigned int,
+             unsigned int, unsigned int>;
+
+} // namespace
+
+/**
+ * @brief sgemm cases, each run with alpha != 1 and beta in {0, 1, other}
+ */
+class nntrainer_fallback_sgemm : public ::testing::TestWithParam<SgemmParam> {
+};
+
+TEST_P(nntrainer_fallback_sgemm, compare_with_naive_p) {
+  unsigned int order, M, N, K, pad;
+  bool TransA, TransB;
+  std::tie(order, TransA, TransB, M, N, K, pad) = GetParam();
+
+  /// rows and columns of the stored (not transposed) A, B and C
+  const unsigned int a_r = TransA ? K : M, a_c = TransA ? M : K;
+  const unsigned int b_r = TransB ? N : K, b_c = TransB ? K : N;
+  const unsigned int lda = (order == 0 ? a_c : a_r) + pad;
+  const unsigned int ldb = (order == 0 ? b_c : b_r) + pad;
+  const unsigned int ldc = (order == 0 ? N : M) + pad;
+
+  auto A = ranged((size_t)(order == 0 ? a_r : a_c) * lda, M * 7 + K);
+  auto B = ranged((size_t)(order == 0 ? b_r : b_c) * ldb, N * 5 + K);
+  auto C0 = ranged((size_t)(order == 0 ? M : N) * ldc, M + N);
+
+  /// the single threaded run takes the row split, the other the column split
+  const unsigned int threads[] = {1, 4};
+  const float betas[] = {0.0f, 1.0f, -0.75f};
+  const unsigned int saved = nntrainer::ThreadPool::Global().getNumThreads();
+
+  for (unsigned int t : threads) {
+    nntrainer::ThreadPool::Global().setNumThreads(t);
+    for (float beta : betas) {
+      auto ref = C0;
+      auto out = C0;
+      if (beta == 0.0f) {
+        /// C is not read when beta is zero
+        for (unsigned int m = 0; m < M; ++m)
+          for (unsigned int n = 0; n < N; ++n)
+            out[at(order, m, n, ldc)] = NAN;
+      }
+
+      naive_sgemm(order, TransA, TransB, M, N, K, 1.5f, A.data(), lda,
+                  B.data(), ldb, beta, ref.data(), ldc);
+      nntrainer::__fallback_sgemm(order, TransA, TransB, M, N, K, 1.5f,
+                                  A.data(), lda, B.data(), ldb, beta,
+                                  out.data(), ldc);
+
+      for (unsigned int m = 0; m < M; ++m) {
+        for (unsigned int n = 0; n < N; ++n) {
+          const size_t i = at(order, m, n, ldc);
+          ASSERT_NEAR(out[i], ref[i], 1e-5f * (K + 1))
+            << "threads " << t << " beta " << beta << " m " << m << " n "
+            << n;
+        }
+      }
+
+      /// the padding of C is left untouched
+      for (size_t i = 0; i < out.size(); ++i) {
+        const size_t major = i / ldc, minor = i % ldc;
+        if (minor >= (order == 0 ? N : M) && major < (order == 0 ? M : N)) {
+          ASSERT_EQ(out[i], C0[i]) << "padding at " << i;
+        }
+      }
+    }
+  }
+
+  nntrainer::ThreadPool::Global().setNumThreads(saved);
+}
+
+/**
+ * @brief sizes around the 6 x 16 micro-kernel and the 144 x 256 blocks
+ */
+INSTANTIATE_TEST_CASE_P(
+  nntrainer_fallback_sgemm, nntrainer_fallback_sgemm,
+  ::testing::Combine(::testing::Values(0u, 1u), ::testing::Bool(),
+                     ::testing::Bool(), ::testing::Values(1u, 7u, 150u),
+                     ::testing::Values(1u, 17u, 35u),
+                     ::testing::Values(1u, 13u, 270u),
+                     ::testing::Values(0u, 3u)));
+
+/**
+ * @brief a row wider than one packed block of B
+ */
+TEST(nntrainer_fallback_sgemm, wide_n_p) {
+  const unsigned int M = 8, N = 2100, K = 9;
+  auto A = ranged(M * K, 1);
+  auto B = ranged(K * N, 2);
+  std::vector<float> ref(M * N, 0.0f), out(M * N, NAN);
+
+  naive_sgemm(0, false, false, M, N, K, 0.5f, A.data(), K, B.data(), N, 0.0f,
+              ref.data(), N);
+  nntrainer::__fallback_sgemm(0, false, false, M, N, K, 0.5f, A.data(), K,
+                              B.data(), N, 0.0f, out.data(), N);
+
+  for (size_t i = 0; i < ref.size(); ++i)
+    ASSERT_NEAR(out[i], ref[i], 1e-5f) << "at " << i;
+}
+
+/**
+ * @brief sgemv through the backend entry point, which is the fallback wrapper
+ * on builds without an x86 or arm backend
+ */
+TEST(nntrainer_fallback_sgemv, compare_with_naive_p) {
+  const unsigned int M = 37, N = 19;
+  auto A = ranged(M * N, 3);
+  auto X = ranged(std::max(M, N), 4);
+  auto Y0 = ranged(std::max(M, N), 5);
+
+  for (bool TransA : {false, true}) {
+    const unsigned int len = TransA ? N : M, inner = TransA ? M : N;
+    for (float beta : {0.0f, -0.75f}) {
+      auto ref = Y0, out = Y0;
+      naive_sgemm(0, TransA, false, len, 1, inner, 1.5f, A.data(), N,
+                  X.data(), 1, beta, ref.data(), 1);
+      nntrainer::sgemv(0, TransA, M, N, 1.5f, A.data(), N, X.data(), 1, beta,
+                       out.data(), 1);
+
+      for (unsigned int i = 0; i < len; ++i)
+        ASSERT_NEAR(out[i], ref[i], 1e-5f * (inner + 1))
+          << "TransA " << TransA << " beta " << beta << " at " << i;
+    }
+  }
+}
+
+/**
+ * @brief Main gtest
+ */
+int main(int argc, char **argv) {
+  int result = -1;
+
+  try {
+    testing::InitGoogleTest(&argc, argv);
+  } catch (...) {
+    std::cerr << "Failed to init gtest\n";
+  }
+
+  try {
+    result = RUN_ALL_TESTS();
+  } catch (...) {
+    std::cerr << "Failed to run test.\n";
+  }
+
+  return result;
+}
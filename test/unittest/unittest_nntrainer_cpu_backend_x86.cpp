@@ -0,0 +1,325 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file        unittest_nntrainer_cpu_backend_x86.cpp
+ * @date        17 Oct 2026
+ * @brief       Unit test comparing avx2 / avx-512 kernels with the fallback
+ * @see         https://github.com/nnstreamer/nntrainer
+ * @author      Samsung Electronics Co., Ltd.
+ * @bug         No known bugs
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <avx2_impl.h>
+#include <avx512_impl.h>
+#include <fallback_internal.h>
+
+namespace {
+
+/**
+ * @brief random vector in [lo, hi)
+ */
+std::vector<float> ranged(unsigned int N, float lo, float hi,
+                          unsigned int seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(lo, hi);
+  std::vector<float> v(N);
+  for (auto &x : v)
+    x = dist(gen);
+  return v;
+}
+
+/**
+ * @brief expect |a - b| <= atol + rtol * |b| elementwise
+ */
+void expectNear(const std::vector<float> &a, const std::vector<float> &b,
+                float atol, float rtol) {
+  ASSERT_EQ(a.size(), b.size());
+  for (size_t i = 0; i < a.size(); ++i)
+    ASSERT_NEAR(a[i], b[i], atol + rtol * std::abs(b[i])) << "at " << i;
+}
+
+} // namespace
+
+/**
+ * @brief vector lengths around the 8 (avx2) and 16 (avx-512) lane widths
+ */
+class nntrainer_cpu_backend_x86 : public ::testing::TestWithParam<unsigned> {};
+
+TEST_P(nntrainer_cpu_backend_x86, swiglu_p) {
+  const unsigned int N = GetParam();
+  auto Y = ranged(N, -20.0f, 20.0f, N);
+  auto Z = ranged(N, -2.0f, 2.0f, N + 1);
+
+  std::vector<float> ref(N), out(N, NAN);
+  nntrainer::__fallback_swiglu(N, ref.data(), Y.data(), Z.data());
+
+  nntrainer::avx2::swiglu(N, out.data(), Y.data(), Z.data());
+  expectNear(out, ref, 1e-6f, 1e-5f);
+
+  if (nntrainer::avx512::has_avx512()) {
+    std::fill(out.begin(), out.end(), NAN);
+    nntrainer::avx512::swiglu(N, out.data(), Y.data(), Z.data());
+    expectNear(out, ref, 1e-6f, 1e-5f);
+  }
+}
+
+TEST_P(nntrainer_cpu_backend_x86, max_val_p) {
+  const unsigned int N = GetParam();
+  auto X = ranged(N, -100.0f, -1.0f, N);
+  /// the maximum sits in the tail, after the last full vector
+  X[N - 1] = 0.5f;
+
+  const float ref = nntrainer::__fallback_max(N, X.data());
+  EXPECT_EQ(nntrainer::avx2::max_val(N, X.data()), ref);
+  if (nntrainer::avx512::has_avx512()) {
+    EXPECT_EQ(nntrainer::avx512::max_val(N, X.data()), ref);
+  }
+
+  /// and at the front, with a negative tail
+  X[N - 1] = -50.0f;
+  X[0] = -0.5f;
+  const float ref_front = nntrainer::__fallback_max(N, X.data());
+  EXPECT_EQ(nntrainer::avx2::max_val(N, X.data()), ref_front);
+  if (nntrainer::avx512::has_avx512()) {
+    EXPECT_EQ(nntrainer::avx512::max_val(N, X.data()), ref_front);
+  }
+}
+
+TEST_P(nntrainer_cpu_backend_x86, softmax_p) {
+  const unsigned int N = GetParam();
+  auto X = ranged(N, -30.0f, 30.0f, N);
+
+  std::vector<float> ref(N), out(N, NAN);
+  nntrainer::__fallback_softmax(N, X.data(), ref.data());
+
+  nntrainer::avx2::softmax(N, X.data(), out.data());
+  expectNear(out, ref, 1e-7f, 1e-5f);
+
+  if (nntrainer::avx512::has_avx512()) {
+    std::fill(out.begin(), out.end(), NAN);
+    nntrainer::avx512::softmax(N, X.data(), out.data());
+    expectNear(out, ref, 1e-7f, 1e-5f);
+  }
+}
+
+TEST_P(nntrainer_cpu_backend_x86, sigmoid_tanh_p) {
+  const unsigned int N = GetParam();
+  auto X = ranged(N, -20.0f, 20.0f, N);
+  auto dY = ranged(N, -1.0f, 1.0f, N + 1);
+
+  std::vector<float> ref(N), out(N, NAN);
+  nntrainer::__fallback_ele_sigmoid(N, X.data(), ref.data());
+  nntrainer::avx2::ele_sigmoid(N, X.data(), out.data());
+  expectNear(out, ref, 1e-6f, 1e-5f);
+
+  std::vector<float> ref_d(N), out_d(N, NAN);
+  nntrainer::__fallback_ele_sigmoid_prime(N, ref.data(), dY.data(),
+                                          ref_d.data());
+  nntrainer::avx2::ele_sigmoid_prime(N, ref.data(), dY.data(), out_d.data());
+  expectNear(out_d, ref_d, 1e-6f, 1e-5f);
+
+  nntrainer::__fallback_ele_tanh(N, X.data(), ref.data());
+  nntrainer::avx2::ele_tanh(N, X.data(), out.data());
+  expectNear(out, ref, 1e-6f, 1e-5f);
+
+  nntrainer::__fallback_ele_tanh_prime(N, ref.data(), dY.data(), ref_d.data());
+  nntrainer::avx2::ele_tanh_prime(N, ref.data(), dY.data(), out_d.data());
+  expectNear(out_d, ref_d, 1e-6f, 1e-5f);
+}
+
+TEST_P(nntrainer_cpu_backend_x86, tanh_small_p) {
+  const unsigned int N = GetParam();
+  /// |x| from 1e-8 to 1 on a log scale, with alternating signs
+  std::vector<float> X(N);
+  for (unsigned int i = 0; i < N; ++i) {
+    const float x = std::pow(10.0f, -8.0f + 8.0f * i / N);
+    X[i] = i % 2 ? -x : x;
+  }
+
+  std::vector<float> ref(N), out(N, NAN);
+  nntrainer::__fallback_ele_tanh(N, X.data(), ref.data());
+  nntrainer::avx2::ele_tanh(N, X.data(), out.data());
+  /// relative only, an absolute tolerance hides cancellation near 0
+  expectNear(out, ref, 0.0f, 1e-6f);
+
+  std::fill(out.begin(), out.end(), NAN);
+  X.assign(N, 0.0f);
+  nntrainer::avx2::ele_tanh(N, X.data(), out.data());
+  EXPECT_EQ(out, X);
+}
+
+TEST_P(nntrainer_cpu_backend_x86, sine_cosine_p) {
+  const unsigned int N = GetParam();
+  auto X = ranged(N, -10.0f, 10.0f, N);
+
+  std::vector<float> ref(N), out(N, NAN);
+  nntrainer::__fallback_sine(N, X.data(), ref.data(), 0.5f);
+  nntrainer::avx2::sine(N, X.data(), out.data(), 0.5f);
+  expectNear(out, ref, 1e-5f, 0.0f);
+
+  nntrainer::__fallback_cosine(N, X.data(), ref.data(), 0.5f);
+  nntrainer::avx2::cosine(N, X.data(), out.data(), 0.5f);
+  expectNear(out, ref, 1e-5f, 0.0f);
+}
+
+TEST_P(nntrainer_cpu_backend_x86, inv_sqrt_inplace_p) {
+  const unsigned int N = GetParam();
+  auto ref = ranged(N, 1e-3f, 1e3f, N);
+  auto out = ref;
+  auto out512 = ref;
+
+  nntrainer::__fallback_inv_sqrt_inplace(N, ref.data());
+  nntrainer::avx2::inv_sqrt_inplace(N, out.data());
+  expectNear(out, ref, 0.0f, 1e-6f);
+
+  if (nntrainer::avx512::has_avx512()) {
+    nntrainer::avx512::inv_sqrt_inplace(N, out512.data());
+    expectNear(out512, ref, 0.0f, 1e-6f);
+  }
+}
+
+TEST_P(nntrainer_cpu_backend_x86, ele_ops_p) {
+  const unsigned int N = GetParam();
+  auto X = ranged(N, -4.0f, 4.0f, N);
+  auto Y = ranged(N, 0.5f, 4.0f, N + 1);
+  auto Z0 = ranged(N, -1.0f, 1.0f, N + 2);
+  const float alpha = 0.75f, beta = 0.5f;
+
+  auto ref = Z0;
+  auto out = Z0;
+  nntrainer::__fallback_ele_mul(N, X.data(), Y.data(), ref.data(), alpha, beta,
+                                1, 1);
+  nntrainer::avx2::ele_mul(N, X.data(), Y.data(), out.data(), alpha, beta);
+  expectNear(out, ref, 1e-6f, 1e-6f);
+  if (nntrainer::avx512::has_avx512()) {
+    out = Z0;
+    nntrainer::avx512::ele_mul(N, X.data(), Y.data(), out.data(), alpha, beta);
+    expectNear(out, ref, 1e-6f, 1e-6f);
+  }
+
+  ref = Z0;
+  out = Z0;
+  nntrainer::__fallback_ele_add(N, X.data(), Y.data(), ref.data(), alpha, beta,
+                                1, 1);
+  nntrainer::avx2::ele_add(N, X.data(), Y.data(), out.data(), alpha, beta);
+  expectNear(out, ref, 1e-6f, 1e-6f);
+  if (nntrainer::avx512::has_avx512()) {
+    out = Z0;
+    nntrainer::avx512::ele_add(N, X.data(), Y.data(), out.data(), alpha, beta);
+    expectNear(out, ref, 1e-6f, 1e-6f);
+  }
+}
+
+TEST_P(nntrainer_cpu_backend_x86, copy_int4_to_fp32_p) {
+  const unsigned int N = GetParam();
+  std::vector<uint8_t> X(N);
+  for (unsigned int i = 0; i < N; ++i)
+    X[i] = static_cast<uint8_t>(i * 37 + 11);
+
+  std::vector<float> ref(2 * N), out(2 * N, NAN);
+  nntrainer::__fallback_scopy_int4_to_float32(N, X.data(), 1, ref.data(), 1);
+  nntrainer::avx2::copy_int4_to_fp32(N, X.data(), out.data());
+  EXPECT_EQ(out, ref);
+}
+
+TEST_P(nntrainer_cpu_backend_x86, copy_int8_to_fp32_p) {
+  const unsigned int N = GetParam();
+  std::vector<uint8_t> U(N);
+  std::vector<int8_t> S(N);
+  for (unsigned int i = 0; i < N; ++i) {
+    U[i] = static_cast<uint8_t>(i * 37 + 200);
+    S[i] = static_cast<int8_t>(U[i]);
+  }
+
+  std::vector<float> ref(N), out(N, NAN);
+  nntrainer::__fallback_scopy_uint8_to_float32(N, U.data(), 1, ref.data(), 1);
+  nntrainer::avx2::copy_int8_to_fp32(N, U.data(), out.data());
+  EXPECT_EQ(out, ref);
+
+  std::fill(out.begin(), out.end(), NAN);
+  nntrainer::__fallback_scopy_int8_to_float32(N, S.data(), 1, ref.data(), 1);
+  nntrainer::avx2::copy_int8_to_fp32(N, S.data(), out.data());
+  EXPECT_EQ(out, ref);
+}
+
+TEST_P(nntrainer_cpu_backend_x86, philox_uniform_p) {
+  const unsigned int N = GetParam();
+  /// an odd offset so that the blocks do not start at a multiple of 8
+  for (const uint64_t offset : {0ull, 5ull}) {
+    std::vector<float> ref(N), out(N, NAN);
+    nntrainer::__fallback_philox_uniform(N, 1234, offset, ref.data(), -0.37f,
+                                         0.91f);
+    nntrainer::avx2::philox_uniform(N, 1234, offset, out.data(), -0.37f,
+                                    0.91f);
+    EXPECT_EQ(out, ref);
+  }
+}
+
+TEST_P(nntrainer_cpu_backend_x86, philox_bernoulli_p) {
+  const unsigned int N = GetParam();
+  const unsigned int words = (N + 31) / 32;
+  for (const float p : {0.0f, 0.3f, 0.5f, 1.0f}) {
+    std::vector<uint32_t> ref(words), out(words, 0xdeadbeef);
+    nntrainer::__fallback_philox_bernoulli(N, 1234, 5, p, ref.data());
+    nntrainer::avx2::philox_bernoulli(N, 1234, 5, p, out.data());
+    EXPECT_EQ(out, ref) << "p = " << p;
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(nntrainer_cpu_backend_x86, nntrainer_cpu_backend_x86,
+                        ::testing::Values(1u, 3u, 7u, 9u, 15u, 17u, 23u, 31u,
+                                          33u, 100u, 1023u));
+
+/**
+ * @brief transpose of M x N sub-matrices that are not multiples of the 8x8
+ * block, read from and written to padded rows
+ */
+TEST(nntrainer_cpu_backend_x86, transpose_matrix_p) {
+  const unsigned int sizes[] = {1, 3, 8, 9, 17, 31};
+
+  for (unsigned int M : sizes) {
+    for (unsigned int N : sizes) {
+      const unsigned int ld_src = N + 3, ld_dst = M + 5;
+      auto src = ranged(M * ld_src, -1.0f, 1.0f, M * 100 + N);
+
+      std::vector<float> ref(N * ld_dst, -7.0f), out(N * ld_dst, -7.0f);
+      nntrainer::__fallback_transpose_matrix(M, N, src.data(), ld_src,
+                                             ref.data(), ld_dst);
+      nntrainer::avx2::transpose_matrix(M, N, src.data(), ld_src, out.data(),
+                                        ld_dst);
+      /// the padding of dst is left untouched as well
+      EXPECT_EQ(out, ref) << "M " << M << " N " << N;
+    }
+  }
+}
+
+/**
+ * @brief Main gtest
+ */
+int main(int argc, char **argv) {
+  int result = -1;
+
+  try {
+    testing::InitGoogleTest(&argc, argv);
+  } catch (...) {
+    std::cerr << "Failed to init gtest\n";
+  }
+
+  try {
+    result = RUN_ALL_TESTS();
+  } catch (...) {
+    std::cerr << "Failed to run test.\n";
+  }
+
+  return result;
+}
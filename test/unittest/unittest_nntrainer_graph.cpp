@@ -10,9 +10,13 @@
  * @bug No known bugs except for NYI items
  */
 
+#include <algorithm>
+#include <cstdio>
+
 #include <gtest/gtest.h>
 #include <ini_wrapper.h>
 #include <neuralnet.h>
+#include <random_stream.h>
 #include <util_func.h>
 
 #include "nntrainer_test_util.h"
@@ -384,6 +388,294 @@ TEST(nntrainerGraphUnitTest, NoLossLayerWhenInferenceMode) {
   ans.clear();
 }
 
+/**
+ * @brief a model with two branches joined by an addition
+ */
+static std::unique_ptr<nntrainer::NeuralNetwork>
+createBranchedModel(bool inter_op_parallel) {
+  auto model = std::make_unique<nntrainer::NeuralNetwork>();
+
+  model->addLayer(ml::train::createLayer(
+    "input", {nntrainer::withKey("name", "input0"),
+              nntrainer::withKey("input_shape", "1:1:64")}));
+  for (auto name : {"fc_a", "fc_b"}) {
+    model->addLayer(ml::train::createLayer(
+      "fully_connected",
+      {nntrainer::withKey("name", name), nntrainer::withKey("unit", 32),
+       nntrainer::withKey("input_layers", "input0"),
+       nntrainer::withKey("weight_initializer", "xavier_uniform"),
+       nntrainer::withKey("bias_initializer", "lecun_uniform")}));
+  }
+  model->addLayer(ml::train::createLayer(
+    "addition", {nntrainer::withKey("name", "add0"),
+                 nntrainer::withKey("input_layers", "fc_a,fc_b")}));
+  model->addLayer(ml::train::createLayer(
+    "fully_connected",
+    {nntrainer::withKey("name", "fc_out"), nntrainer::withKey("unit", 8),
+     nntrainer::withKey("weight_initializer", "xavier_uniform"),
+     nntrainer::withKey("bias_initializer", "lecun_uniform")}));
+
+  model->setProperty(
+    {nntrainer::withKey("batch_size", 1), nntrainer::withKey("loss", "mse"),
+     nntrainer::withKey("inter_op_parallel",
+                        inter_op_parallel ? "true" : "false")});
+  model->setOptimizer(ml::train::createOptimizer(
+    "sgd", {nntrainer::withKey("learning_rate", 0.1)}));
+  return model;
+}
+
+/**
+ * @brief save the branched model with seeded random weights to @a path
+ */
+static void saveBranchedModel(const std::string &path) {
+  auto model = createBranchedModel(false);
+  nntrainer::RandomStream::Global().setSeed(1234);
+  ASSERT_EQ(model->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(model->initialize(), ML_ERROR_NONE);
+  model->save(path, ml::train::ModelFormat::MODEL_FORMAT_BIN);
+}
+
+/**
+ * @brief copy of the weights of the layer @a name, one after another
+ */
+static std::vector<float> copyWeights(ml::train::Model &model,
+                                      const std::string &name) {
+  std::shared_ptr<ml::train::Layer> layer;
+  EXPECT_EQ(model.getLayer(name.c_str(), &layer), ML_ERROR_NONE);
+
+  std::vector<float *> weights;
+  std::vector<ml::train::TensorDim> dims;
+  layer->getWeights(weights, dims);
+
+  std::vector<float> flat;
+  for (unsigned int i = 0; i < weights.size(); ++i)
+    flat.insert(flat.end(), weights[i], weights[i] + dims[i].getDataLen());
+  return flat;
+}
+
+/**
+ * @brief run the saved branched model for inference and return the output
+ */
+static std::vector<float> inferBranchedModel(const std::string &path,
+                                             bool inter_op_parallel) {
+  auto model = createBranchedModel(inter_op_parallel);
+  EXPECT_EQ(model->compile(ml::train::ExecutionMode::INFERENCE),
+            ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(ml::train::ExecutionMode::INFERENCE),
+            ML_ERROR_NONE);
+  model->load(path);
+
+  /// the branches are not the same, so swapping them changes the output
+  EXPECT_NE(copyWeights(*model, "fc_a"), copyWeights(*model, "fc_b"));
+
+  float input[64];
+  for (unsigned int i = 0; i < 64; ++i) {
+    input[i] = i / 64.0f - 0.5f;
+  }
+
+  std::vector<float *> in = {input};
+  std::vector<float *> ans = model->inference(1, in);
+
+  return std::vector<float>(ans[0], ans[0] + 8);
+}
+
+/**
+ * @brief train the saved branched model for one step and return the output
+ * followed by the updated weights
+ */
+static std::vector<float> trainBranchedModel(const std::string &path,
+                                             bool inter_op_parallel) {
+  auto model = createBranchedModel(inter_op_parallel);
+  EXPECT_EQ(model->compile(), ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(), ML_ERROR_NONE);
+  EXPECT_EQ(model->allocate(), ML_ERROR_NONE);
+  model->load(path);
+  auto loaded = copyWeights(*model, "fc_a");
+
+  nntrainer::Tensor input(1, 1, 1, 64);
+  nntrainer::Tensor label(1, 1, 1, 8);
+  for (unsigned int i = 0; i < 64; ++i)
+    input.setValue(0, 0, 0, i, i / 64.0f - 0.5f);
+  for (unsigned int i = 0; i < 8; ++i)
+    label.setValue(0, 0, 0, i, i * 0.1f);
+
+  auto out = model->forwarding({MAKE_SHARED_TENSOR(input)},
+                               {MAKE_SHARED_TENSOR(label)});
+  const float *prediction = out[0]->getData();
+  std::vector<float> result(prediction, prediction + 8);
+  result.push_back(model->getLoss());
+  model->backwarding(0);
+
+  /// the gradient reached the first branch
+  auto updated = copyWeights(*model, "fc_a");
+  EXPECT_NE(updated, loaded);
+
+  for (auto name : {"fc_a", "fc_b", "fc_out"}) {
+    auto weights = copyWeights(*model, name);
+    result.insert(result.end(), weights.begin(), weights.end());
+  }
+  return result;
+}
+
+TEST(nntrainerGraphUnitTest, inter_op_parallel_p) {
+  const std::string path = "inter_op_parallel.bin";
+  saveBranchedModel(path);
+
+  std::vector<float> sequential = inferBranchedModel(path, false);
+  std::vector<float> parallel = inferBranchedModel(path, true);
+
+  EXPECT_EQ(sequential, parallel);
+  EXPECT_NE(sequential, std::vector<float>(8, 0.0f));
+  std::remove(path.c_str());
+}
+
+TEST(nntrainerGraphUnitTest, inter_op_parallel_train_p) {
+  const std::string path = "inter_op_parallel_train.bin";
+  saveBranchedModel(path);
+
+  /// a wave shares a forward order, which changes the tensor lifetimes
+  std::vector<float> sequential = trainBranchedModel(path, false);
+  std::vector<float> parallel = trainBranchedModel(path, true);
+
+  EXPECT_EQ(sequential, parallel);
+  EXPECT_NE(std::vector<float>(sequential.begin(), sequential.begin() + 8),
+            std::vector<float>(8, 0.0f));
+  std::remove(path.c_str());
+}
+
+/**
+ * @brief a conv2d or fc layer followed by batch normalization and relu
+ */
+static std::unique_ptr<ml::train::Model>
+createBnModel(bool conv, const std::vector<std::string> &props) {
+  auto model = ml::train::createModel(ml::train::ModelType::NEURAL_NET,
+                                      {nntrainer::withKey("loss", "mse")});
+
+  if (conv) {
+    model->addLayer(ml::train::createLayer(
+      "input", {nntrainer::withKey("name", "input0"),
+                nntrainer::withKey("input_shape", "1:4:4")}));
+    model->addLayer(ml::train::createLayer(
+      "conv2d", {nntrainer::withKey("name", "layer0"),
+                 nntrainer::withKey("filters", 2),
+                 nntrainer::withKey("kernel_size", "3,3"),
+                 nntrainer::withKey("padding", "same"),
+                 nntrainer::withKey("weight_initializer", "xavier_uniform"),
+                 nntrainer::withKey("bias_initializer", "lecun_uniform")}));
+    model->addLayer(ml::train::createLayer(
+      "batch_normalization", {nntrainer::withKey("name", "bn0")}));
+  } else {
+    model->addLayer(ml::train::createLayer(
+      "input", {nntrainer::withKey("name", "input0"),
+                nntrainer::withKey("input_shape", "1:1:16")}));
+    model->addLayer(ml::train::createLayer(
+      "fully_connected",
+      {nntrainer::withKey("name", "layer0"), nntrainer::withKey("unit", 8),
+       nntrainer::withKey("weight_initializer", "xavier_uniform"),
+       nntrainer::withKey("bias_initializer", "lecun_uniform")}));
+    model->addLayer(ml::train::createLayer(
+      "batch_normalization",
+      {nntrainer::withKey("name", "bn0"), nntrainer::withKey("axis", 3)}));
+  }
+  model->addLayer(ml::train::createLayer(
+    "activation", {nntrainer::withKey("name", "act0"),
+                   nntrainer::withKey("activation", "relu")}));
+  model->addLayer(ml::train::createLayer("flatten"));
+
+  model->setProperty(props);
+  return model;
+}
+
+/**
+ * @brief save the batch normalization model with random weights and set
+ * statistics to @a path
+ */
+static void saveBnModel(bool conv, const std::string &path) {
+  auto model = createBnModel(conv, {nntrainer::withKey("batch_size", 1)});
+  model->setOptimizer(ml::train::createOptimizer("sgd"));
+  nntrainer::RandomStream::Global().setSeed(1234);
+  ASSERT_EQ(model->compile(), ML_ERROR_NONE);
+  ASSERT_EQ(model->initialize(), ML_ERROR_NONE);
+
+  /// moving mean, moving variance, gamma and beta per channel
+  std::shared_ptr<ml::train::Layer> bn;
+  ASSERT_EQ(model->getLayer("bn0", &bn), ML_ERROR_NONE);
+  std::vector<float *> weights;
+  std::vector<ml::train::TensorDim> dims;
+  bn->getWeights(weights, dims);
+  ASSERT_EQ(weights.size(), 4u);
+  for (unsigned int c = 0; c < dims[0].getDataLen(); ++c) {
+    weights[0][c] = 0.3f - 0.2f * c;
+    weights[1][c] = 0.5f + 0.25f * c;
+    weights[2][c] = 1.5f - 0.3f * c;
+    weights[3][c] = -0.1f + 0.15f * c;
+  }
+
+  model->save(path, ml::train::ModelFormat::MODEL_FORMAT_BIN);
+}
+
+/**
+ * @brief run the saved batch normalization model twice for inference, with or
+ * without folding, and return the outputs
+ */
+static std::vector<float> inferBnModel(bool conv, const std::string &path,
+                                       bool fold) {
+  /// mapping the weights from the file keeps them from being folded
+  auto model = createBnModel(
+    conv, {nntrainer::withKey("batch_size", 1),
+           nntrainer::withKey("memory_map_weights", fold ? "false" : "true")});
+  EXPECT_EQ(model->compile(ml::train::ExecutionMode::INFERENCE),
+            ML_ERROR_NONE);
+  EXPECT_EQ(model->initialize(ml::train::ExecutionMode::INFERENCE),
+            ML_ERROR_NONE);
+  model->load(path);
+
+  std::shared_ptr<ml::train::Layer> layer;
+  if (fold) {
+    EXPECT_THROW(model->getLayer("bn0", &layer), std::out_of_range);
+    EXPECT_THROW(model->getLayer("act0", &layer), std::out_of_range);
+  } else {
+    EXPECT_EQ(model->getLayer("bn0", &layer), ML_ERROR_NONE);
+    EXPECT_EQ(model->getLayer("act0", &layer), ML_ERROR_NONE);
+  }
+
+  float input[16];
+  for (unsigned int i = 0; i < 16; ++i) {
+    input[i] = (i - 8.0f) / 8.0f;
+  }
+
+  std::vector<float *> in = {input};
+  const unsigned int len = conv ? 32 : 8;
+  std::vector<float> outputs;
+  /// the weights are folded once, the second run must not fold them again
+  for (int run = 0; run < 2; ++run) {
+    std::vector<float *> ans = model->inference(1, in);
+    outputs.insert(outputs.end(), ans[0], ans[0] + len);
+  }
+  return outputs;
+}
+
+TEST(nntrainerGraphUnitTest, bn_fold_inference_p) {
+  for (bool conv : {true, false}) {
+    SCOPED_TRACE(conv ? "conv2d" : "fully_connected");
+    const std::string path = "bn_fold_inference.bin";
+    saveBnModel(conv, path);
+
+    std::vector<float> folded = inferBnModel(conv, path, true);
+    std::vector<float> unfolded = inferBnModel(conv, path, false);
+    std::remove(path.c_str());
+
+    ASSERT_EQ(folded.size(), unfolded.size());
+    for (unsigned int i = 0; i < folded.size(); ++i) {
+      EXPECT_NEAR(folded[i], unfolded[i], 1e-5) << "at " << i;
+    }
+    /// relu cuts some of the outputs but not all of them
+    EXPECT_NE(std::count(unfolded.begin(), unfolded.end(), 0.0f), 0);
+    EXPECT_NE(std::count(unfolded.begin(), unfolded.end(), 0.0f),
+              (long)unfolded.size());
+  }
+}
+
 int main(int argc, char **argv) {
   int result = -1;
 
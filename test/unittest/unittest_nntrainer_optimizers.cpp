@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file        unittest_nntrainer_optimizers.cpp
+ * @date        17 Oct 2026
+ * @brief       Unit test comparing the fused Adam / AdamW step with a
+ * reference implementation
+ * @see         https://github.com/nnstreamer/nntrainer
+ * @author      Samsung Electronics Co., Ltd.
+ * @bug         No known bugs
+ */
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <adam.h>
+#include <adamw.h>
+#include <optimizer_context.h>
+#include <tensor.h>
+#include <weight.h>
+
+namespace {
+
+using TensorDim = ml::train::TensorDim;
+
+/** not a multiple of the 8 wide simd loop */
+constexpr unsigned int LEN = 37;
+constexpr unsigned int STEPS = 5;
+constexpr double LR = 1e-2;
+constexpr double BETA1 = 0.9;
+constexpr double BETA2 = 0.999;
+constexpr double EPSILON = 1e-7;
+
+/**
+ * @brief which update the reference follows
+ */
+enum class Rule { ADAM, ADAM_TORCH_REF, ADAMW };
+
+/**
+ * @brief scalar adam / adamw step in double
+ *
+ * @param rule update rule
+ * @param iteration zero based iteration
+ * @param g unscaled gradient
+ * @param w weight
+ * @param m first moment
+ * @param v second moment
+ */
+void reference_step(Rule rule, unsigned int iteration,
+                    const std::vector<double> &g, std::vector<double> &w,
+                    std::vector<double> &m, std::vector<double> &v) {
+  const double bc1 = 1.0 - std::pow(BETA1, iteration + 1);
+  const double bc2 = 1.0 - std::pow(BETA2, iteration + 1);
+
+  for (size_t i = 0; i < w.size(); ++i) {
+    m[i] = BETA1 * m[i] + (1.0 - BETA1) * g[i];
+    v[i] = BETA2 * v[i] + (1.0 - BETA2) * g[i] * g[i];
+
+    if (rule == Rule::ADAM) {
+      /** bias correction folded into the learning rate */
+      const double lr = LR * std::sqrt(bc2) / bc1;
+      w[i] -= lr * m[i] / (std::sqrt(v[i]) + EPSILON);
+    } else {
+      /** torch reference and AdamW : sqrt(v / bc2) in the denominator */
+      w[i] -= LR / bc1 * m[i] / (std::sqrt(v[i] / bc2) + EPSILON);
+    }
+  }
+}
+
+/**
+ * @brief create the optimizer of @a rule
+ */
+std::unique_ptr<nntrainer::Optimizer> createOptimizer(Rule rule) {
+  std::vector<std::string> props = {"beta1=0.9", "beta2=0.999",
+                                    "epsilon=1e-7"};
+  std::unique_ptr<nntrainer::Optimizer> opt;
+  if (rule == Rule::ADAMW) {
+    opt = std::make_unique<nntrainer::AdamW>();
+  } else {
+    opt = std::make_unique<nntrainer::Adam>();
+    if (rule == Rule::ADAM_TORCH_REF)
+      props.push_back("torch_ref=true");
+  }
+  opt->setProperty(props);
+  return opt;
+}
+
+/**
+ * @brief gradient of step @a iteration in [-1, 1)
+ */
+std::vector<double> gradient(unsigned int iteration) {
+  std::mt19937 gen(iteration + 1);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> g(LEN);
+  for (auto &x : g)
+    x = dist(gen);
+  return g;
+}
+
+/**
+ * @brief initial weight, exactly representable in half precision
+ */
+std::vector<double> initialWeight() {
+  std::vector<double> w(LEN);
+  for (unsigned int i = 0; i < LEN; ++i)
+    w[i] = (static_cast<int>(i % 17) - 8) / 16.0;
+  return w;
+}
+
+} // namespace
+
+/**
+ * @brief fp32 weight, fp32 gradient
+ */
+class nntrainer_FusedAdam : public ::testing::TestWithParam<Rule> {};
+
+TEST_P(nntrainer_FusedAdam, fp32_several_steps_p) {
+  const Rule rule = GetParam();
+  auto opt = createOptimizer(rule);
+
+  TensorDim dim(1, 1, 1, LEN);
+  auto opt_dims = opt->getOptimizerVariableDim(dim);
+  ASSERT_EQ(opt_dims.size(), 2u);
+
+  nntrainer::Tensor var(dim), grad(dim), m(opt_dims[0]), v(opt_dims[1]);
+  m.setZero();
+  v.setZero();
+
+  std::vector<double> w_ref = initialWeight();
+  std::vector<double> m_ref(LEN, 0.0), v_ref(LEN, 0.0);
+  for (unsigned int i = 0; i < LEN; ++i)
+    var.getData<float>()[i] = static_cast<float>(w_ref[i]);
+
+  nntrainer::Weight weight(&var, &grad, nullptr,
+                           nntrainer::WeightRegularizer::NONE, 1.0f, 0.0f);
+  weight.setOptimizerVariables({&m, &v});
+
+  for (unsigned int iter = 0; iter < STEPS; ++iter) {
+    auto g = gradient(iter);
+    for (unsigned int i = 0; i < LEN; ++i)
+      grad.getData<float>()[i] = static_cast<float>(g[i]);
+    for (auto &x : g)
+      x = static_cast<float>(x);
+
+    nntrainer::RunOptimizerContext context(&weight, iter, LR);
+    opt->applyGradient(context);
+    reference_step(rule, iter, g, w_ref, m_ref, v_ref);
+
+    for (unsigned int i = 0; i < LEN; ++i) {
+      EXPECT_NEAR(m.getData<float>()[i], m_ref[i], 1e-6) << "m at " << i;
+      EXPECT_NEAR(v.getData<float>()[i], v_ref[i], 1e-6) << "v at " << i;
+      EXPECT_NEAR(var.getData<float>()[i], w_ref[i], 1e-5)
+        << "step " << iter << " w at " << i;
+    }
+  }
+}
+
+#ifdef ENABLE_FP16
+/**
+ * @brief fp16 weight with an fp32 master copy, fp16 gradient scaled by the
+ * loss scale
+ */
+TEST_P(nntrainer_FusedAdam, mixed_precision_several_steps_p) {
+  const Rule rule = GetParam();
+  const float loss_scale = 1024.0f;
+  auto opt = createOptimizer(rule);
+
+  TensorDim dim16(1, 1, 1, LEN,
+                  {ml::train::TensorDim::Format::NCHW,
+                   ml::train::TensorDim::DataType::FP16});
+  TensorDim dim32(1, 1, 1, LEN);
+
+  /// the moments of a half precision weight are kept in fp32
+  auto opt_dims = opt->getOptimizerVariableDim(dim16);
+  ASSERT_EQ(opt_dims.size(), 2u);
+  EXPECT_EQ(opt_dims[0].getDataType(), TensorDim::DataType::FP32);
+  EXPECT_EQ(opt_dims[1].getDataType(), TensorDim::DataType::FP32);
+
+  nntrainer::Tensor var(dim16), grad(dim16), var32(dim32), m(opt_dims[0]),
+    v(opt_dims[1]);
+  m.setZero();
+  v.setZero();
+
+  std::vector<double> w_ref = initialWeight();
+  std::vector<double> m_ref(LEN, 0.0), v_ref(LEN, 0.0);
+  for (unsigned int i = 0; i < LEN; ++i) {
+    var.getData<_FP16>()[i] = static_cast<_FP16>(w_ref[i]);
+    var32.getData<float>()[i] = static_cast<float>(w_ref[i]);
+  }
+
+  nntrainer::Weight weight(&var, &grad, &var32,
+                           nntrainer::WeightRegularizer::NONE, 1.0f, 0.0f,
+                           false, 0.0f, 3, loss_scale, true);
+  weight.setOptimizerVariables({&m, &v});
+
+  for (unsigned int iter = 0; iter < STEPS; ++iter) {
+    auto g = gradient(iter);
+    std::vector<_FP16> scaled(LEN);
+    for (unsigned int i = 0; i < LEN; ++i) {
+      scaled[i] = static_cast<_FP16>(g[i] * loss_scale);
+      grad.getData<_FP16>()[i] = scaled[i];
+      /// what the optimizer sees once the loss scale is removed
+      g[i] = static_cast<float>(scaled[i]) / loss_scale;
+    }
+
+    nntrainer::RunOptimizerContext context(&weight, iter, LR);
+    opt->applyGradient(context);
+    reference_step(rule, iter, g, w_ref, m_ref, v_ref);
+
+    for (unsigned int i = 0; i < LEN; ++i) {
+      /// the gradient is unscaled on the fly, not divided in place
+      EXPECT_EQ(static_cast<float>(grad.getData<_FP16>()[i]),
+                static_cast<float>(scaled[i]))
+        << "grad at " << i;
+      EXPECT_NEAR(m.getData<float>()[i], m_ref[i], 1e-6) << "m at " << i;
+      EXPECT_NEAR(v.getData<float>()[i], v_ref[i], 1e-6) << "v at " << i;
+      EXPECT_NEAR(var32.getData<float>()[i], w_ref[i], 1e-5)
+        << "step " << iter << " w at " << i;
+      /// the half precision weight is refreshed from the master weight
+      EXPECT_EQ(static_cast<float>(var.getData<_FP16>()[i]),
+                static_cast<float>(
+                  static_cast<_FP16>(var32.getData<float>()[i])))
+        << "w16 at " << i;
+    }
+  }
+}
+#endif
+
+INSTANTIATE_TEST_CASE_P(nntrainer_FusedAdam, nntrainer_FusedAdam,
+                        ::testing::Values(Rule::ADAM, Rule::ADAM_TORCH_REF,
+                                          Rule::ADAMW));
+
+/**
+ * @brief Main gtest
+ */
+int main(int argc, char **argv) {
+  int result = -1;
+
+  try {
+    testing::InitGoogleTest(&argc, argv);
+  } catch (...) {
+    std::cerr << "Failed to init gtest\n";
+  }
+
+  try {
+    result = RUN_ALL_TESTS();
+  } catch (...) {
+    std::cerr << "Failed to run test.\n";
+  }
+
+  return result;
+}
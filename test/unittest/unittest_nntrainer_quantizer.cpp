@@ -402,6 +402,171 @@ TEST(nntrainer_Quantizer, per_tensor_affine_05_p) {
   ASSERT_EQ(output_u8, float_answer);
 }
 
+/**
+ * @brief Quantize to a per tensor quantized tensor with a per channel quantizer
+ * (negative test)
+ */
+TEST(nntrainer_Quantizer, per_channel_affine_01_n) {
+  nntrainer::Tensor input(1, 1, 4, 5);
+  input.setRandNormal(1.235f, 0.04f);
+
+  nntrainer::Tensor output(1, 1, 4, 5, nntrainer::Tformat::NCHW,
+                           nntrainer::Tdatatype::QINT8);
+
+  std::vector<float> scales(5, 0.00235f);
+
+  std::unique_ptr<nntrainer::Quantizer> quantizer =
+    nntrainer::Quantization::createQuantizer(
+      nntrainer::QScheme::PER_CHANNEL_AFFINE);
+
+  EXPECT_THROW(quantizer->quantize(input, output, scales.data()),
+               std::invalid_argument);
+}
+
+/**
+ * @brief Zero scale factor of a channel (negative test)
+ */
+TEST(nntrainer_Quantizer, per_channel_affine_02_n) {
+  nntrainer::Tensor input(1, 1, 4, 5);
+  input.setRandNormal(1.235f, 0.04f);
+
+  nntrainer::Tensor output(1, 1, 4, 5, nntrainer::Tformat::NCHW,
+                           nntrainer::Tdatatype::QINT8,
+                           nntrainer::QScheme::PER_CHANNEL_AFFINE);
+
+  std::vector<float> scales = {0.1f, 0.1f, 0.0f, 0.1f, 0.1f};
+
+  std::unique_ptr<nntrainer::Quantizer> quantizer =
+    nntrainer::Quantization::createQuantizer(
+      nntrainer::QScheme::PER_CHANNEL_AFFINE);
+
+  EXPECT_THROW(quantizer->quantize(input, output, scales.data()),
+               std::invalid_argument);
+}
+
+/**
+ * @brief Quantize / Dequantize CharTensor with a scale per column
+ */
+TEST(nntrainer_Quantizer, per_channel_affine_01_p) {
+  float input_data[] = {3.0f, 0.75f, -3.0f, -1.5f, 40.0f, 5.0f};
+  nntrainer::Tensor input({1, 1, 2, 3}, input_data);
+
+  std::vector<float> scales = {0.5f, 0.25f, 2.0f};
+  nntrainer::Tensor output(1, 1, 2, 3, nntrainer::Tformat::NCHW,
+                           nntrainer::Tdatatype::QINT8,
+                           nntrainer::QScheme::PER_CHANNEL_AFFINE);
+
+  std::unique_ptr<nntrainer::Quantizer> quantizer =
+    nntrainer::Quantization::createQuantizer(
+      nntrainer::QScheme::PER_CHANNEL_AFFINE);
+
+  quantizer->quantize(input, output, scales.data());
+
+  // halves are rounded away from zero and 160 is clipped
+  std::vector<int8_t> qdata = {6, 3, -2, -3, 127, 3};
+  for (unsigned int i = 0; i < qdata.size(); ++i)
+    EXPECT_EQ(output.getData<int8_t>()[i], qdata[i]);
+  for (unsigned int i = 0; i < scales.size(); ++i)
+    EXPECT_FLOAT_EQ(output.getScale<float>()[i], scales[i]);
+
+  float output_data[] = {3.0f, 0.75f, -4.0f, -1.5f, 31.75f, 6.0f};
+  nntrainer::Tensor float_answer({1, 1, 2, 3}, output_data);
+
+  nntrainer::Tensor dequantized =
+    quantizer->dequantize(output, nntrainer::Tdatatype::FP32);
+  ASSERT_EQ(dequantized, float_answer);
+}
+
+/**
+ * @brief Quantize / Dequantize Int4QTensor with a scale per row, where a byte
+ * holds elements of two rows
+ */
+TEST(nntrainer_Quantizer, per_channel_affine_02_p) {
+  float input_data[] = {1.0f, -4.5f, 10.0f, 0.25f, -0.125f, 1.5f};
+  nntrainer::Tensor input({1, 1, 2, 3}, input_data);
+
+  std::vector<float> scales = {0.5f, 0.25f};
+  nntrainer::Tensor output(1, 1, 2, 3, nntrainer::Tformat::NCHW,
+                           nntrainer::Tdatatype::QINT4,
+                           nntrainer::QScheme::PER_CHANNEL_AFFINE);
+
+  std::unique_ptr<nntrainer::Quantizer> quantizer =
+    nntrainer::Quantization::createQuantizer(
+      nntrainer::QScheme::PER_CHANNEL_AFFINE);
+
+  quantizer->quantize(input, output, scales.data());
+
+  float output_data[] = {1.0f, -4.0f, 3.5f, 0.25f, -0.25f, 1.5f};
+  nntrainer::Tensor float_answer({1, 1, 2, 3}, output_data);
+
+  nntrainer::Tensor dequantized =
+    quantizer->dequantize(output, nntrainer::Tdatatype::FP32);
+  ASSERT_EQ(dequantized, float_answer);
+}
+
+/**
+ * @brief Per channel quantization parameters of UInt8Tensor and QINT8 keep
+ * the error of every element within half of the scale of its channel
+ */
+TEST(nntrainer_Quantizer, per_channel_affine_03_p) {
+  const unsigned int height = 70, width = 33;
+  nntrainer::Tensor input(2, 1, height, width);
+  input.setRandUniform(-1.0f, 3.0f);
+  for (unsigned int h = 0; h < height; ++h)
+    input.setValue(0, 0, h, 3, 0.001f * h);
+
+  std::unique_ptr<nntrainer::Quantizer> quantizer =
+    nntrainer::Quantization::createQuantizer(
+      nntrainer::QScheme::PER_CHANNEL_AFFINE);
+
+  for (auto qtype :
+       {nntrainer::Tdatatype::UINT8, nntrainer::Tdatatype::QINT8}) {
+    nntrainer::Tensor quantized = quantizer->quantize(input, qtype);
+    ASSERT_EQ(quantized.q_scheme(), nntrainer::QScheme::PER_CHANNEL_AFFINE);
+    ASSERT_EQ(quantized.scale_size(), width);
+
+    nntrainer::Tensor output =
+      quantizer->dequantize(quantized, nntrainer::Tdatatype::FP32);
+
+    for (unsigned int b = 0; b < 2; ++b)
+      for (unsigned int h = 0; h < height; ++h)
+        for (unsigned int w = 0; w < width; ++w)
+          EXPECT_LE(std::abs(output.getValue(b, 0, h, w) -
+                             input.getValue(b, 0, h, w)),
+                    quantized.getScale<float>()[w] * 0.5001f);
+  }
+}
+
+#ifdef ENABLE_FP16
+/**
+ * @brief Quantizing a half precision tensor gives the codes of its single
+ * precision copy
+ */
+TEST(nntrainer_Quantizer, per_tensor_affine_fp16_p) {
+  nntrainer::Tensor input(1, 3, 17, 19, nntrainer::Tformat::NCHW,
+                          nntrainer::Tdatatype::FP16);
+  input.setRandUniform(-2.0f, 2.0f);
+  nntrainer::Tensor input_fp32 = input.clone(nntrainer::Tdatatype::FP32);
+
+  std::unique_ptr<nntrainer::Quantizer> quantizer =
+    nntrainer::Quantization::createQuantizer(
+      nntrainer::QScheme::PER_TENSOR_AFFINE);
+
+  float scale = 0.0173f;
+  nntrainer::Tensor q_half(1, 3, 17, 19, nntrainer::Tformat::NCHW,
+                           nntrainer::Tdatatype::QINT8);
+  nntrainer::Tensor q_float(1, 3, 17, 19, nntrainer::Tformat::NCHW,
+                            nntrainer::Tdatatype::QINT8);
+  quantizer->quantize(input, q_half, &scale);
+  quantizer->quantize(input_fp32, q_float, &scale);
+  ASSERT_EQ(q_half, q_float);
+
+  nntrainer::Tensor output =
+    quantizer->dequantize(q_half, nntrainer::Tdatatype::FP16);
+  ASSERT_EQ(output.getDataType(), nntrainer::Tdatatype::FP16);
+}
+#endif
+
 int main(int argc, char **argv) {
   int result = -1;
 
@@ -18,6 +18,7 @@
 #include <nntrainer_error.h>
 #include <tensor.h>
 #include <tensor_dim.h>
+#include <tensor_view.h>
 
 TEST(nntrainer_TensorDim, ctor_initializer_p) {
   unsigned int b = 3;
@@ -3710,6 +3711,113 @@ TEST(nntrainer_Tensor, dot_shortcuts_p) {
   }
 }
 
+TEST(nntrainer_Tensor, dot_batched_p) {
+  for (bool trans : {false, true}) {
+    for (bool trans_m : {false, true}) {
+      nntrainer::Tensor a = trans ? ranged(5, 1, 4, 3) : ranged(5, 1, 3, 4);
+      nntrainer::Tensor b = trans_m ? ranged(5, 1, 2, 4) : ranged(5, 1, 4, 2);
+      nntrainer::Tensor ret(5, 1, 3, 2);
+      ret.setValue(1.0f);
+      a.dotBatched(b, ret, trans, trans_m, 1.0f);
+
+      for (unsigned int i = 0; i < 5; ++i) {
+        nntrainer::Tensor answer(1, 1, 3, 2);
+        answer.setValue(1.0f);
+        a.getBatchSlice(i, 1).dot(b.getBatchSlice(i, 1), answer, trans,
+                                  trans_m, 1.0f);
+        EXPECT_EQ(ret.getBatchSlice(i, 1), answer);
+      }
+    }
+  }
+}
+
+TEST(nntrainer_Tensor, dot_batched_n) {
+  nntrainer::Tensor a = ranged(2, 1, 3, 4);
+  nntrainer::Tensor b = ranged(2, 1, 3, 2);
+  nntrainer::Tensor ret(2, 1, 3, 2);
+  EXPECT_THROW(a.dotBatched(b, ret), std::runtime_error);
+}
+
+/**
+ * @brief dot product with quantized weights against their dequantized copy.
+ * Inputs and scales are dyadic, so the results are exact in any order.
+ */
+TEST(nntrainer_Tensor, dot_quantized_weight_p) {
+  const unsigned int K = 20, N = 18;
+  std::vector<std::vector<std::vector<int8_t>>> q8(
+    1, std::vector<std::vector<int8_t>>(K, std::vector<int8_t>(N)));
+  std::vector<std::vector<std::vector<int8_t>>> q4 = q8;
+  std::vector<float> scales8(N), scales4(K);
+  nntrainer::Tensor ref8(1, 1, K, N), ref4(1, 1, K, N);
+
+  for (unsigned int k = 0; k < K; ++k) {
+    scales4[k] = std::ldexp(1.0f, -static_cast<int>(k % 3) - 2);
+    for (unsigned int n = 0; n < N; ++n) {
+      scales8[n] = std::ldexp(1.0f, -static_cast<int>(n % 4) - 4);
+      q8[0][k][n] = static_cast<int>((k * 7 + n * 3) % 255) - 127;
+      q4[0][k][n] = static_cast<int>((k * 5 + n) % 16) - 8;
+    }
+  }
+  for (unsigned int k = 0; k < K; ++k) {
+    for (unsigned int n = 0; n < N; ++n) {
+      ref8.setValue(0, 0, k, n, q8[0][k][n] * scales8[n]);
+      ref4.setValue(0, 0, k, n, q4[0][k][n] * scales4[k]);
+    }
+  }
+
+  nntrainer::Tensor w8(q8, scales8,
+                       {nntrainer::Tformat::NCHW, nntrainer::Tdatatype::QINT8},
+                       nntrainer::QScheme::PER_CHANNEL_AFFINE);
+  nntrainer::Tensor w4(q4, scales4,
+                       {nntrainer::Tformat::NCHW, nntrainer::Tdatatype::QINT4},
+                       nntrainer::QScheme::PER_CHANNEL_AFFINE);
+
+  /** a single row takes the matrix-vector path */
+  for (unsigned int M : {1u, 7u}) {
+    nntrainer::Tensor a(1, 1, M, K);
+    for (unsigned int m = 0; m < M; ++m)
+      for (unsigned int k = 0; k < K; ++k)
+        a.setValue(0, 0, m, k, (static_cast<int>((m * K + k) % 11) - 5) / 4.0f);
+
+    EXPECT_EQ(a.dot(w8), a.dot(ref8));
+    EXPECT_EQ(a.dot(w4), a.dot(ref4));
+
+    nntrainer::Tensor ret(1, 1, M, N), answer(1, 1, M, N);
+    ret.setValue(1.0f);
+    answer.setValue(1.0f);
+    a.dot(w8, ret, false, false, 1.0f);
+    a.dot(ref8, answer, false, false, 1.0f);
+    EXPECT_EQ(ret, answer);
+  }
+}
+
+/**
+ * @brief dot product with a transposed int8 weight, whose scale per column is
+ * then a scale per row of op(weight)
+ */
+TEST(nntrainer_Tensor, dot_quantized_weight_transpose_p) {
+  const unsigned int K = 9, N = 5, M = 3;
+  std::vector<std::vector<std::vector<int8_t>>> q(
+    1, std::vector<std::vector<int8_t>>(N, std::vector<int8_t>(K)));
+  std::vector<float> scales(K);
+  nntrainer::Tensor ref(1, 1, N, K);
+
+  for (unsigned int k = 0; k < K; ++k) {
+    scales[k] = std::ldexp(1.0f, -static_cast<int>(k % 2) - 3);
+    for (unsigned int n = 0; n < N; ++n) {
+      q[0][n][k] = static_cast<int>(k * 11 + n * 13) % 64 - 32;
+      ref.setValue(0, 0, n, k, q[0][n][k] * scales[k]);
+    }
+  }
+
+  nntrainer::Tensor w(q, scales,
+                      {nntrainer::Tformat::NCHW, nntrainer::Tdatatype::QINT8},
+                      nntrainer::QScheme::PER_CHANNEL_AFFINE);
+  nntrainer::Tensor a = ranged(1, 1, M, K);
+
+  EXPECT_EQ(a.dot(w, false, true), a.dot(ref, false, true));
+}
+
 TEST(nntrainer_Tensor, transpose_p) {
   nntrainer::TensorDim ref_dim(3, 2, 4, 5);
 
@@ -5470,6 +5578,59 @@ TEST(nntrainer_Tensor, zoneout_mask_04_n) {
   }
 }
 
+TEST(nntrainer_Tensor, bitmask_01_p) {
+  const float probability = 0.7f;
+  nntrainer::Tensor mask(10, 1, 1, 1000, nntrainer::Tformat::NCHW,
+                         nntrainer::Tdatatype::UINT32);
+  mask.setRandBitmask(probability);
+
+  unsigned int ones = 0;
+  for (unsigned int i = 0; i < mask.size(); ++i)
+    ones += __builtin_popcount(mask.getData<uint32_t>()[i]);
+
+  EXPECT_NEAR((float)ones / (mask.size() * 32), probability, 1e-2);
+}
+
+TEST(nntrainer_Tensor, bitmask_02_p) {
+  nntrainer::Tensor input = ranged(3, 2, 5, 7);
+  nntrainer::Tensor other = input.multiply(-1.0f);
+  nntrainer::Tensor mask(3, 1, 1, 3, nntrainer::Tformat::NCHW,
+                         nntrainer::Tdatatype::UINT32);
+  mask.setRandBitmask(0.5f);
+
+  nntrainer::Tensor scaled;
+  nntrainer::Tensor selected;
+  input.multiply_bitmask(mask, 2.0f, 0.5f, scaled);
+  input.select_bitmask(mask, other, selected);
+
+  const unsigned int feature_len = input.getDim().getFeatureLen();
+  for (unsigned int b = 0; b < input.batch(); ++b) {
+    for (unsigned int i = 0; i < feature_len; ++i) {
+      const unsigned int idx = b * feature_len + i;
+      const bool bit =
+        (mask.getData<uint32_t>()[b * 3 + i / 32] >> (i % 32)) & 1u;
+      EXPECT_FLOAT_EQ(scaled.getValue(idx),
+                      input.getValue(idx) * (bit ? 2.0f : 0.5f));
+      EXPECT_FLOAT_EQ(selected.getValue(idx),
+                      bit ? input.getValue(idx) : other.getValue(idx));
+    }
+  }
+}
+
+TEST(nntrainer_Tensor, bitmask_03_n) {
+  nntrainer::Tensor input(3, 2, 5, 7);
+  nntrainer::Tensor output(3, 2, 5, 7);
+  nntrainer::Tensor float_mask(3, 1, 1, 3);
+  nntrainer::Tensor short_mask(3, 1, 1, 2, nntrainer::Tformat::NCHW,
+                               nntrainer::Tdatatype::UINT32);
+
+  EXPECT_THROW(float_mask.setRandBitmask(0.5f), std::invalid_argument);
+  EXPECT_THROW(input.multiply_bitmask(float_mask, 1.0f, 0.0f, output),
+               std::invalid_argument);
+  EXPECT_THROW(input.multiply_bitmask(short_mask, 1.0f, 0.0f, output),
+               std::invalid_argument);
+}
+
 TEST(nntrainer_Tensor, TensorMap_p) {
   float dat[] = {1, 2, 3};
 
@@ -6034,6 +6195,60 @@ TEST(nntrainer_Tensor, transpose_5122048) {
   EXPECT_EQ(A_fp32, A_T_T);
 }
 
+TEST(nntrainer_TensorView, slice_p) {
+  int batch = 3;
+  int channel = 2;
+  int height = 4;
+  int width = 5;
+
+  nntrainer::Tensor t(batch, channel, height, width);
+  GEN_TEST_INPUT(t, i * (channel * height * width) + j * (height * width) +
+                      k * width + l);
+
+  nntrainer::TensorView<const float> view(t);
+  nntrainer::TensorView<const float> slice = view.getBatchSlice(1, 2);
+  nntrainer::Tensor answer = t.getBatchSlice(1, 2);
+
+  EXPECT_EQ(slice.batch(), 2u);
+  EXPECT_TRUE(slice.isContiguous());
+  for (unsigned int b = 0; b < 2; ++b)
+    for (unsigned int c = 0; c < 2; ++c)
+      for (unsigned int h = 0; h < 4; ++h)
+        for (unsigned int w = 0; w < 5; ++w)
+          EXPECT_EQ(slice(b, c, h, w), answer.getValue(b, c, h, w));
+
+  nntrainer::TensorView<const float> row = view.getRow(2, 1, 3);
+  EXPECT_EQ(row.getData(), t.getAddress<float>(2, 1, 3, 0));
+  EXPECT_EQ(row.width(), 5u);
+}
+
+TEST(nntrainer_TensorView, strided_copy_p) {
+  int batch = 1;
+  int channel = 1;
+  int height = 4;
+  int width = 6;
+
+  nntrainer::Tensor t(batch, channel, height, width);
+  GEN_TEST_INPUT(t, k * width + l);
+  nntrainer::Tensor out(1, 1, 3, 4);
+
+  /** columns 1 and 2 of t, transposed */
+  nntrainer::TensorView<const float> cols =
+    nntrainer::TensorView<const float>(t).narrow(3, 1, 2).transpose(2, 3);
+  EXPECT_FALSE(cols.isContiguous());
+
+  nntrainer::TensorView<float>(out).narrow(2, 0, 2).copyData(cols);
+  for (unsigned int h = 0; h < 2; ++h)
+    for (unsigned int w = 0; w < 4; ++w)
+      EXPECT_EQ(out.getValue(0, 0, h, w), t.getValue(0, 0, w, h + 1));
+}
+
+TEST(nntrainer_TensorView, type_mismatch_n) {
+  nntrainer::Tensor t(1, 1, 1, 4,
+                      {nntrainer::Tformat::NCHW, nntrainer::Tdatatype::UINT8});
+  EXPECT_THROW(nntrainer::TensorView<float>{t}, std::invalid_argument);
+}
+
 int main(int argc, char **argv) {
   int result = -1;
 
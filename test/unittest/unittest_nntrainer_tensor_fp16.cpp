@@ -4365,6 +4365,42 @@ TEST(nntrainer_Tensor, dot_shortcuts_p) {
   }
 }
 
+/**
+ * @brief dot over shapes which cross the packing block boundaries of the half
+ * precision gemm, compared with the single precision result
+ */
+TEST(nntrainer_Tensor, dot_blocked_p) {
+  nntrainer::TensorDim::TensorType t_type;
+  t_type.format = nntrainer::Tformat::NCHW;
+  t_type.data_type = nntrainer::Tdatatype::FP16;
+
+  const unsigned int M = 100, K = 300, N = 530;
+
+  for (bool trans : {false, true}) {
+    for (bool trans_in : {false, true}) {
+      nntrainer::Tensor a(1, 1, trans ? K : M, trans ? M : K, t_type);
+      nntrainer::Tensor b(1, 1, trans_in ? N : K, trans_in ? K : N, t_type);
+      a.setRandUniform(-1.0f, 1.0f);
+      b.setRandUniform(-1.0f, 1.0f);
+
+      nntrainer::Tensor ret = a.dot(b, trans, trans_in);
+      nntrainer::Tensor answer =
+        a.clone(nntrainer::Tdatatype::FP32)
+          .dot(b.clone(nntrainer::Tdatatype::FP32), trans, trans_in);
+
+      ASSERT_EQ(ret.height(), M);
+      ASSERT_EQ(ret.width(), N);
+      for (unsigned int i = 0; i < M; ++i) {
+        for (unsigned int j = 0; j < N; ++j) {
+          float expected = answer.getValue<float>(0, 0, i, j);
+          EXPECT_NEAR(static_cast<float>(ret.getValue<_FP16>(0, 0, i, j)),
+                      expected, 1e-2 * (1.0f + std::fabs(expected)));
+        }
+      }
+    }
+  }
+}
+
 TEST(nntrainer_Tensor, transpose_p) {
   nntrainer::TensorDim::TensorType t_type;
   t_type.format = nntrainer::Tformat::NCHW;
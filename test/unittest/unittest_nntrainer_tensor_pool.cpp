@@ -876,6 +876,82 @@ TEST(TensorPool, createOrExtend_unmanaged_n) {
     pool.requestOrExtend("t", {10}, {0}, nntrainer::TensorLifespan::UNMANAGED));
 }
 
+TEST(TensorPool, setExternalData_p) {
+  nntrainer::TensorPool pool;
+  // |-------- t1 -------|
+  // |-------- t2 -------|
+  auto t1 = pool.request("t1", {10}, {0}, max_ls);
+  auto t2 = pool.view("t2", "t1", {10}, {1}, max_ls);
+  pool.finalize(nntrainer::BasicPlanner(), 0, 2);
+  pool.allocate();
+
+  std::vector<float> external(14, 1.0f);
+  auto mem = std::make_shared<nntrainer::MemoryData>((void *)external.data());
+  pool.setExternalData("t2", mem, 4);
+
+  EXPECT_EQ(t1->getData<float>(), external.data() + 4);
+  EXPECT_EQ(t2->getData<float>(), external.data() + 4);
+  pool.deallocate();
+}
+
+TEST(TensorPool, setExternalData_partial_view_n) {
+  nntrainer::TensorPool pool;
+  // |-------- t1 -------|
+  //       |-t2-|
+  auto t1 = pool.request("t1", {10}, {0}, max_ls);
+  auto t2 = pool.view("t2", "t1", {3}, {1}, max_ls, 3);
+  pool.finalize(nntrainer::BasicPlanner(), 0, 2);
+  pool.allocate();
+
+  std::vector<float> external(10, 1.0f);
+  auto mem = std::make_shared<nntrainer::MemoryData>((void *)external.data());
+  EXPECT_THROW(pool.setExternalData("t2", mem, 0), std::invalid_argument);
+  EXPECT_NE(t1->getData<float>(), external.data());
+  pool.deallocate();
+}
+
+TEST(TensorPool, detach_update_batch_attach_p) {
+  nntrainer::TensorPool pool;
+  // |-------- t1 -------|
+  // |-------- t2 -------|
+  auto t1 = pool.request("t1", {4, 1, 1, 3}, {0}, max_ls);
+  auto t2 = pool.view("t2", "t1", {4, 1, 1, 3}, {1}, max_ls);
+  pool.finalize(nntrainer::BasicPlanner(), 0, 2);
+  pool.allocate();
+
+  float *data = t1->getData<float>();
+  EXPECT_THROW(t1->updateBatch(2), std::invalid_argument);
+
+  pool.detach();
+  EXPECT_FALSE(t1->isAllocated());
+  pool.setBatchSize("t1", 2);
+  pool.setBatchSize("t2", 2);
+  pool.attach();
+
+  EXPECT_EQ(t1->batch(), 2u);
+  EXPECT_EQ(t1->getData<float>(), data);
+  EXPECT_EQ(t2->getData<float>(), data);
+
+  pool.detach();
+  pool.setBatchSize("t1", 4);
+  pool.setBatchSize("t2", 4);
+  pool.attach();
+
+  EXPECT_EQ(t1->batch(), 4u);
+  EXPECT_EQ(t1->getData<float>(), data);
+  pool.deallocate();
+}
+
+TEST(TensorPool, attach_without_detach_n) {
+  nntrainer::TensorPool pool;
+  pool.request("t1", {10}, {0}, max_ls);
+  pool.finalize(nntrainer::BasicPlanner(), 0, 2);
+  pool.allocate();
+
+  EXPECT_THROW(pool.attach(), std::runtime_error);
+  pool.deallocate();
+}
+
 /**
  * @brief Main gtest
  */
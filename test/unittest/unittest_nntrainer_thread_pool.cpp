@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: Apache-2.0
+/**
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file        unittest_nntrainer_thread_pool.cpp
+ * @date        17 Oct 2026
+ * @brief       Unit test for the work-stealing thread pool
+ * @see         https://github.com/nnstreamer/nntrainer
+ * @author      Samsung Electronics Co., Ltd.
+ * @bug         No known bugs
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nntr_thread_pool.h>
+#include <nntr_threads.h>
+
+/**
+ * @brief every index is visited exactly once
+ */
+TEST(nntrainer_ThreadPool, parallel_for_p) {
+  nntrainer::ThreadPool pool(4);
+  std::vector<std::atomic<int>> visited(1000);
+
+  pool.parallelFor(0, 1000, 0,
+                   [&](unsigned int s, unsigned int e, unsigned int slot) {
+                     EXPECT_LT(slot, 4u);
+                     for (unsigned int i = s; i < e; ++i)
+                       visited[i]++;
+                   });
+
+  for (auto &v : visited)
+    EXPECT_EQ(v.load(), 1);
+}
+
+/**
+ * @brief slots are bounded by the number of chunks
+ */
+TEST(nntrainer_ThreadPool, parallel_for_slot_bound_p) {
+  nntrainer::ThreadPool pool(8);
+  std::vector<std::atomic<int>> slots(8);
+
+  for (int repeat = 0; repeat < 100; ++repeat) {
+    pool.parallelFor(0, 3, 1,
+                     [&](unsigned int s, unsigned int e, unsigned int slot) {
+                       ASSERT_LT(slot, 3u);
+                       slots[slot]++;
+                     });
+  }
+}
+
+/**
+ * @brief nested submission from a worker does not deadlock
+ */
+TEST(nntrainer_ThreadPool, nested_parallel_for_p) {
+  nntrainer::ThreadPool pool(3);
+  std::atomic<unsigned int> sum(0);
+
+  pool.parallelFor(0, 16, 1, [&](unsigned int s, unsigned int e, unsigned int) {
+    pool.parallelFor(0, 16, 1,
+                     [&](unsigned int is, unsigned int ie, unsigned int) {
+                       sum += ie - is;
+                     });
+  });
+
+  EXPECT_EQ(sum.load(), 256u);
+}
+
+/**
+ * @brief exception in a chunk is rethrown to the caller
+ */
+TEST(nntrainer_ThreadPool, parallel_for_throw_n) {
+  nntrainer::ThreadPool pool(4);
+
+  EXPECT_THROW(
+    pool.parallelFor(0, 64, 1,
+                     [](unsigned int s, unsigned int, unsigned int) {
+                       if (s == 17)
+                         throw std::runtime_error("chunk failed");
+                     }),
+    std::runtime_error);
+
+  /** the pool is still usable */
+  std::atomic<unsigned int> count(0);
+  pool.parallelFor(0, 64, 1, [&](unsigned int s, unsigned int e,
+                                 unsigned int) { count += e - s; });
+  EXPECT_EQ(count.load(), 64u);
+}
+
+/**
+ * @brief resize the pool
+ */
+TEST(nntrainer_ThreadPool, set_num_threads_p) {
+  nntrainer::ThreadPool pool(2);
+  pool.setNumThreads(5);
+  EXPECT_EQ(pool.getNumThreads(), 5u);
+
+  std::atomic<unsigned int> count(0);
+  pool.parallelFor(0, 100, 0, [&](unsigned int s, unsigned int e,
+                                  unsigned int) { count += e - s; });
+  EXPECT_EQ(count.load(), 100u);
+
+  pool.setNumThreads(0);
+  EXPECT_EQ(pool.getNumThreads(), 1u);
+}
+
+/**
+ * @brief ParallelBatch runs on the global pool and keeps pid in range
+ */
+TEST(nntrainer_ThreadPool, parallel_batch_p) {
+  nntrainer::ThreadPool::Global().setNumThreads(4);
+
+  std::vector<std::atomic<int>> visited(37);
+  unsigned int num_workers = 0;
+  auto job = [&](unsigned int s, unsigned int e, unsigned int pid, void *) {
+    EXPECT_LT(pid, num_workers);
+    for (unsigned int b = s; b < e; ++b)
+      visited[b]++;
+  };
+
+  auto workers = nntrainer::ParallelBatch(job, 37, nullptr);
+  num_workers = workers.getNumWorkers();
+  EXPECT_EQ(num_workers, 4u);
+  workers.run();
+
+  for (auto &v : visited)
+    EXPECT_EQ(v.load(), 1);
+}
+
+/**
+ * @brief Main gtest
+ */
+int main(int argc, char **argv) {
+  int result = -1;
+
+  try {
+    testing::InitGoogleTest(&argc, argv);
+  } catch (...) {
+    std::cerr << "Failed to init gtest\n";
+  }
+
+  try {
+    result = RUN_ALL_TESTS();
+  } catch (...) {
+    std::cerr << "Failed to run test.\n";
+  }
+
+  return result;
+}